@@ -105,6 +105,7 @@ module fstarpu_mod
         type(c_ptr), bind(C) :: FSTARPU_REGRESSION_BASED
         type(c_ptr), bind(C) :: FSTARPU_NL_REGRESSION_BASED
         type(c_ptr), bind(C) :: FSTARPU_MULTIPLE_REGRESSION_BASED
+        type(c_ptr), bind(C) :: FSTARPU_INTERPOLATION_BASED
 
         type(c_ptr), bind(C) :: FSTARPU_SEQ
         type(c_ptr), bind(C) :: FSTARPU_SPMD
@@ -2612,6 +2613,8 @@ module fstarpu_mod
                                 fstarpu_get_constant(C_CHAR_"FSTARPU_NL_REGRESSION_BASED"//C_NULL_CHAR)
                         FSTARPU_MULTIPLE_REGRESSION_BASED = &
                                 fstarpu_get_constant(C_CHAR_"FSTARPU_MULTIPLE_REGRESSION_BASED"//C_NULL_CHAR)
+                        FSTARPU_INTERPOLATION_BASED = &
+                                fstarpu_get_constant(C_CHAR_"FSTARPU_INTERPOLATION_BASED"//C_NULL_CHAR)
 
                         FSTARPU_SEQ = &
                                 fstarpu_get_constant(C_CHAR_"FSTARPU_SEQ"//C_NULL_CHAR)
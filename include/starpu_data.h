@@ -215,6 +215,22 @@ void starpu_data_unregister_no_coherency(starpu_data_handle_t handle);
 */
 void starpu_data_unregister_submit(starpu_data_handle_t handle);
 
+/**
+   Unregister the \p n data handles of the \p handles array, like
+   starpu_data_unregister(). The copies of all the data back to their home
+   node are issued at once, and waited for together, so that they overlap.
+   See \ref TaskSubmission for more details.
+*/
+void starpu_data_unregister_array(unsigned n, starpu_data_handle_t *handles);
+
+/**
+   Unregister the \p n data handles of the \p handles array, like
+   starpu_data_unregister_submit(). A single task waits for the tasks
+   accessing any of them, after which they are all destroyed.
+   See \ref TemporaryData for more details.
+*/
+void starpu_data_unregister_array_submit(unsigned n, starpu_data_handle_t *handles);
+
 /**
    Destroy all replicates of the data \p handle immediately. After
    data invalidation, the first access to \p handle must be performed
@@ -367,6 +383,27 @@ int starpu_data_acquire_try(starpu_data_handle_t handle, enum starpu_data_access
 */
 int starpu_data_acquire_on_node_try(starpu_data_handle_t handle, int node, enum starpu_data_access_mode mode);
 
+/**
+   Acquire the \p n data \p handles in the access mode \p mode, like
+   calling starpu_data_acquire() on each of them, but the implicit
+   dependencies of all the data are registered at once, the data are
+   locked in a deadlock-free order, their fetches into main memory are
+   overlapped, and the function waits only once for the whole set. A given
+   data can not appear twice in \p handles. starpu_data_release_array()
+   or starpu_data_release() on each data must be called once the
+   application no longer needs to access them. See \ref DataAccess for
+   more details.
+*/
+int starpu_data_acquire_array(unsigned n, starpu_data_handle_t *handles, enum starpu_data_access_mode mode);
+
+/**
+   Asynchronous equivalent of starpu_data_acquire_array(): \p callback
+   is called with \p arg once all the data are available in main memory.
+   This is non-blocking and may be called from task callbacks. See \ref
+   DataAccess for more details.
+*/
+int starpu_data_acquire_array_cb(unsigned n, starpu_data_handle_t *handles, enum starpu_data_access_mode mode, void (*callback)(void *), void *arg);
+
 #ifdef __GCC__
 
 /**
@@ -397,6 +434,13 @@ int starpu_data_acquire_on_node_try(starpu_data_handle_t handle, int node, enum
 */
 void starpu_data_release(starpu_data_handle_t handle);
 
+/**
+   Release the \p n data \p handles acquired by the application
+   either by starpu_data_acquire_array() or by
+   starpu_data_acquire_array_cb(). See \ref DataAccess for more details.
+*/
+void starpu_data_release_array(unsigned n, starpu_data_handle_t *handles);
+
 /**
    Similar to starpu_data_release(), except that the data
    was made available on the given memory \p node instead of main memory.
@@ -619,6 +663,27 @@ void starpu_data_set_ooc_flag(starpu_data_handle_t handle, unsigned flag);
 */
 unsigned starpu_data_get_ooc_flag(starpu_data_handle_t handle);
 
+/**
+   Set whether StarPU should avoid allocating \p handle in main memory (1)
+   or not (0) when it has no value yet and gets partitioned with
+   starpu_data_partition(). The default is 0. This is mostly useful for
+   data registered with the home node <c>-1</c> whose pieces are only written
+   by tasks running on accelerators: instead of allocating the whole data in
+   main memory when partitioning, starpu_data_unpartition() allocates it on
+   the gathering node, and copies the pieces there. The filter given to
+   starpu_data_partition(), including the data pointed by
+   starpu_data_filter::filter_arg_ptr, then has to remain valid until
+   starpu_data_unpartition() is called. The flag is inherited by the
+   children. See \ref DataManagementAllocation for more details.
+*/
+void starpu_data_set_lazy_allocation_flag(starpu_data_handle_t handle, unsigned flag);
+
+/**
+   Get whether StarPU should avoid allocating \p handle in main memory when
+   it gets partitioned before having a value.
+*/
+unsigned starpu_data_get_lazy_allocation_flag(starpu_data_handle_t handle);
+
 /**
    Query the status of \p handle on the specified \p memory_node.
 
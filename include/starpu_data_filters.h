@@ -338,6 +338,42 @@ void starpu_data_partition_clean(starpu_data_handle_t root_data, unsigned nparts
 */
 void starpu_data_partition_clean_node(starpu_data_handle_t root_data, unsigned nparts, starpu_data_handle_t *children, int gather_node);
 
+/**
+   Similar to starpu_data_partition_clean(), but instead of unregistering
+   the \p children, keep them in a cache attached to \p root_data, so that
+   a later call to starpu_data_partition_plan() on \p root_data with the
+   same filter \p f (same filter_func, nchildren, get_nchildren,
+   get_child_ops and filter_arg) returns the same child handles without
+   allocating or computing anything. This makes repartitioning the same
+   data in the same way very cheap, e.g. when switching between several
+   partitionings at each iteration. Since the content pointed to by
+   starpu_data_filter::filter_arg_ptr may have changed meanwhile, plans
+   whose filter has a filter_arg_ptr are not cached, and are just cleaned
+   as with starpu_data_partition_clean_node().
+
+   A few plans are kept for each data, the oldest ones get cleaned when
+   more plans are released. The cached plans are cleaned when \p root_data
+   is unregistered, or by calling starpu_data_partition_plan_cache_flush().
+   The \p children handles must not be used by the application after this
+   call, until they are returned again by starpu_data_partition_plan().
+   See \ref AsynchronousPartitioning for more details.
+*/
+void starpu_data_partition_plan_release(starpu_data_handle_t root_data, struct starpu_data_filter *f, unsigned nparts, starpu_data_handle_t *children);
+
+/**
+   Similar to starpu_data_partition_plan_release() but the root data will
+   be gathered on the given node.
+   See \ref AsynchronousPartitioning for more details.
+*/
+void starpu_data_partition_plan_release_node(starpu_data_handle_t root_data, struct starpu_data_filter *f, unsigned nparts, starpu_data_handle_t *children, int gather_node);
+
+/**
+   Clean the partition plans of \p root_data which were released with
+   starpu_data_partition_plan_release() and not reused yet.
+   See \ref AsynchronousPartitioning for more details.
+*/
+void starpu_data_partition_plan_cache_flush(starpu_data_handle_t root_data);
+
 /**
    Similar to starpu_data_unpartition_submit_sequential_consistency()
    but allow to specify a callback function for the unpartitiong task.
@@ -738,6 +738,18 @@ struct starpu_data_interface_ops
 */
 void starpu_data_register(starpu_data_handle_t *handleptr, int home_node, void *data_interface, struct starpu_data_interface_ops *ops);
 
+/**
+   Register \p n pieces of data at once into the \p handles array. \p
+   data_interfaces is an array of \p n interface structures of \p ops, laid
+   out contiguously. This is equivalent to calling starpu_data_register() on
+   each of them, but the handles and their per-node interfaces are allocated
+   together, which makes registering and unregistering many handles much
+   cheaper. The handles can be unregistered individually, or with
+   starpu_data_unregister_array().
+   See \ref DataHandlesHelpers for more details.
+*/
+void starpu_data_register_array(starpu_data_handle_t *handles, unsigned n, int home_node, void *data_interfaces, struct starpu_data_interface_ops *ops);
+
 /**
    Register the given data interface operations. If the field
    starpu_data_interface_ops::field is set to
@@ -1166,6 +1178,15 @@ void starpu_matrix_data_register(starpu_data_handle_t *handle, int home_node, ui
 */
 void starpu_matrix_data_register_allocsize(starpu_data_handle_t *handle, int home_node, uintptr_t ptr, uint32_t ld, uint32_t nx, uint32_t ny, size_t elemsize, size_t allocsize);
 
+/**
+   Register \p n matrices of the same shape, pointed to by the \p ptrs
+   array, into the \p handles array, see starpu_data_register_array().
+   This is typically used to register all the tiles of a tiled matrix at once.
+
+   See \ref MatrixDataInterface for more details.
+*/
+void starpu_matrix_data_register_array(starpu_data_handle_t *handles, unsigned n, int home_node, uintptr_t *ptrs, uint32_t ld, uint32_t nx, uint32_t ny, size_t elemsize);
+
 /**
    Register into the \p handle that to store data on node \p node it should use the
    buffer located at \p ptr, or device handle \p dev_handle and offset \p offset
@@ -2054,6 +2075,13 @@ void starpu_vector_data_register(starpu_data_handle_t *handle, int home_node, ui
 */
 void starpu_vector_data_register_allocsize(starpu_data_handle_t *handle, int home_node, uintptr_t ptr, uint32_t nx, size_t elemsize, size_t allocsize);
 
+/**
+   Register \p n vectors of the same size, pointed to by the \p ptrs array,
+   into the \p handles array, see starpu_data_register_array().
+   See \ref VectorDataInterface for more details.
+*/
+void starpu_vector_data_register_array(starpu_data_handle_t *handles, unsigned n, int home_node, uintptr_t *ptrs, uint32_t nx, size_t elemsize);
+
 /**
    Register into the \p handle that to store data on node \p node it should use the
    buffer located at \p ptr, or device handle \p dev_handle and offset \p offset
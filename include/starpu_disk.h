@@ -133,6 +133,23 @@ struct starpu_disk_ops
 	*/
 	void (*free_request)(void *async_channel);
 
+	/**
+	   Map \p size bytes of data from \p obj in \p base, at offset \p offset,
+	   in the main memory, and return the resulting pointer, or \c NULL if that
+	   is not possible. Writes to the mapping must be visible to subsequent
+	   starpu_disk_ops::read calls. When this method is provided, StarPU
+	   uses the mapping as replicate in the main memory instead of
+	   allocating memory and reading the data, for data interfaces whose
+	   disk layout is their contiguous memory layout (variables, vectors
+	   and contiguous matrices). This method is optional.
+	*/
+	void *(*map)(void *base, void *obj, off_t offset, size_t size);
+	/**
+	   Unmap \p ptr, previously returned by starpu_disk_ops::map for \p size
+	   bytes of \p obj at offset \p offset. Return 0 on success.
+	*/
+	int (*unmap)(void *base, void *obj, void *ptr, off_t offset, size_t size);
+
 	/* TODO: readv, writev, read2d, write2d, etc. */
 };
 
@@ -172,12 +189,87 @@ extern struct starpu_disk_ops starpu_disk_unistd_ops;
 */
 extern struct starpu_disk_ops starpu_disk_unistd_o_direct_ops;
 
+/**
+   Use the unistd library (write, read...) to read/write on disk, and
+   the Linux io_uring interface for asynchronous transfers. Requests
+   are submitted to the kernel in batches, and their completion is
+   polled from the completion ring without system calls.
+
+   <strong>Warning: It creates one file per allocation !</strong>
+
+   Only available on Linux systems providing io_uring (Linux >= 5.6),
+   i.e. when \c STARPU_HAVE_IO_URING is defined. If the ring can not be set up at
+   runtime, transfers are performed synchronously.
+*/
+extern struct starpu_disk_ops starpu_disk_unistd_uring_ops;
+
+/**
+   Use the unistd library (write, read...) to read/write on disk, and
+   let CPU workers access data stored on the disk directly through a
+   memory mapping of the file, instead of reading it into a buffer
+   allocated in the main memory. This is only done for variables,
+   vectors and contiguous matrices, other data are copied as with
+   starpu_disk_unistd_ops. The kernel page cache then holds the
+   data, and is asked to start reading it as soon as the data is
+   prefetched. Modifications made by CPU workers are written back to
+   the file by the kernel.
+
+   This is mostly useful for large read-mostly data registered on the disk.
+
+   <strong>Warning: It creates one file per allocation !</strong>
+*/
+extern struct starpu_disk_ops starpu_disk_unistd_mmap_ops;
+
 /**
    Use the leveldb created by Google. More information at https://code.google.com/p/leveldb/
    Do not support asynchronous transfers.
 */
 extern struct starpu_disk_ops starpu_disk_leveldb_ops;
 
+/**
+   Parameter to be given to starpu_disk_register() along with
+   ::starpu_disk_compress_ops. The structure itself is only read during
+   starpu_disk_register(), so it can e.g. be allocated on the stack of the
+   caller. starpu_disk_compress_param::parameter is however given as such to
+   the starpu_disk_ops::plug method of starpu_disk_compress_param::ops, and
+   thus has to live as long as that backend requires.
+*/
+struct starpu_disk_compress_param
+{
+	/**
+	   Disk backend which actually stores the data.
+	*/
+	struct starpu_disk_ops *ops;
+	/**
+	   Parameter to be given to the starpu_disk_ops::plug method of \c ops.
+	*/
+	void *parameter;
+	/**
+	   Data smaller than this size, in bytes, are stored uncompressed.
+	   0 means the default, 64KiB.
+	*/
+	size_t threshold;
+};
+
+/**
+   Compress data before storing it with another disk backend, and
+   decompress it after reading it back, which saves disk bandwidth for
+   compressible data. The parameter given to starpu_disk_register() has to
+   be a struct starpu_disk_compress_param pointer.
+
+   Only data written as a whole is compressed, and only when that saves at
+   least 1/8th of its size. The bandwidth measured for the disk is scaled by
+   the achieved compression ratio, so that the scheduler gets effective
+   transfer estimations. Data opened with starpu_disk_open() is stored back
+   uncompressed on starpu_disk_close(). Asynchronous transfers are compressed
+   and decompressed by a thread of the wrapper, so that the drivers do not
+   spend time on it.
+
+   The lz4 library is used if available, otherwise zlib. If none of them is
+   available, data is stored uncompressed.
+*/
+extern struct starpu_disk_ops starpu_disk_compress_ops;
+
 /**
    Close an existing data opened with starpu_disk_open(). See \ref OutOfCore_Introduction for more details.
 */
@@ -53,6 +53,8 @@ struct starpu_perfmodel_arch
 	struct starpu_perfmodel_device *devices; /**< list of the devices for the given arch */
 };
 
+struct starpu_perfmodel_history_window;
+
 /**
    todo
 */
@@ -71,6 +73,14 @@ struct starpu_perfmodel_history_entry
 	double duration;
 	starpu_tag_t tag;
 	double *parameters;
+
+	/**
+	   \private
+	   Last measurements and drift detection state, when robust
+	   estimation or change detection is enabled, see \ref
+	   STARPU_HISTORY_ESTIMATOR and \ref STARPU_HISTORY_CHANGE_THRESHOLD
+	*/
+	struct starpu_perfmodel_history_window *window;
 };
 
 /**
@@ -106,11 +116,31 @@ struct starpu_perfmodel_regression_model
 	double c;	   /**< estimated = a size ^b + c */
 	unsigned nl_valid; /**< whether the non-linear regression model is valid (i.e. enough measures) */
 
-	unsigned nsample; /**< number of sample values for non-linear regression */
+	unsigned nsample; /**< number of sample values for non-linear regression, and for multiple linear regression */
 
 	double *coeff;	      /**< list of computed coefficients for multiple linear regression model */
 	unsigned ncoeff;      /**< number of coefficients for multiple linear regression model */
 	unsigned multi_valid; /**< whether the multiple linear regression model is valid */
+
+	/**
+	   \private
+	   Weighted number of measurements accumulated in \ref rls_r and
+	   \ref rls_z for the multiple linear regression model
+	*/
+	double rls_weight;
+	/**
+	   \private
+	   Upper triangular factor R of the QR factorization of the
+	   weighted measured terms of the multiple linear regression model,
+	   packed by rows
+	*/
+	double *rls_r;
+	/**
+	   \private
+	   Q^T times the weighted measured durations, \ref coeff is the
+	   solution of R coeff = rls_z
+	*/
+	double *rls_z;
 };
 
 struct starpu_perfmodel_history_table;
@@ -159,6 +189,58 @@ struct starpu_perfmodel_per_arch
 	struct starpu_perfmodel_regression_model regression;
 
 	char debug_path[256];
+
+	/**
+	   \private
+	   When the model was loaded from a binary model file, the
+	   history entries, sorted by footprint, in the mapped file. They
+	   are copied into \ref history and \ref list when a measurement
+	   is recorded.
+	*/
+	const struct starpu_perfmodel_history_entry *mapped_history;
+	/**
+	   \private
+	   Number of entries in \ref mapped_history
+	*/
+	unsigned long mapped_nentries;
+	/**
+	   \private
+	   Read-only copy of the entries of \ref history, sorted by
+	   footprint, which predictions look up without taking the model
+	   lock. It is replaced as a whole when new entries are published.
+	*/
+	void *history_snapshot;
+	/**
+	   \private
+	   Number of entries of \ref history which are not in \ref
+	   history_snapshot yet
+	*/
+	unsigned long history_unpublished;
+	/**
+	   \private
+	   Date of the last publication of \ref history_snapshot
+	*/
+	double history_published;
+	/**
+	   \private
+	   Architecture combination from which the predictions of the
+	   footprints not calibrated on this one are transferred, see
+	   \ref STARPU_PERF_MODEL_TRANSFER. Only meaningful when \ref
+	   transfer_nsample is not 0.
+	*/
+	int transfer_comb;
+	/**
+	   \private
+	   Sum of the logarithms of the ratios between the measurements
+	   on this combination and the calibrated means on \ref
+	   transfer_comb
+	*/
+	double transfer_log_ratio;
+	/**
+	   \private
+	   Number of measurements in \ref transfer_log_ratio
+	*/
+	unsigned transfer_nsample;
 };
 
 /**
@@ -173,8 +255,10 @@ enum starpu_perfmodel_type
 	STARPU_HISTORY_BASED,		 /**< Automatic history-based cost model */
 	STARPU_REGRESSION_BASED,	 /**< Automatic linear regression-based cost model  (alpha * size ^ beta) */
 	STARPU_NL_REGRESSION_BASED,	 /**< Automatic non-linear regression-based cost model (a * size ^ b + c) */
-	STARPU_MULTIPLE_REGRESSION_BASED /**< Automatic multiple linear regression-based cost model. Application
+	STARPU_MULTIPLE_REGRESSION_BASED, /**< Automatic multiple linear regression-based cost model. Application
 					     provides parameters, their combinations and exponents. */
+	STARPU_INTERPOLATION_BASED	 /**< Automatic history-based cost model, which interpolates between the
+					     measured sizes, or uses a regression, for sizes which were not measured */
 };
 
 struct _starpu_perfmodel_state;
@@ -199,6 +283,16 @@ struct starpu_perfmodel
 	   provided, this is purely history-based.
 	   </li>
 	   <li>
+	   ::STARPU_INTERPOLATION_BASED: No other fields needs to be
+	   provided either. Footprints which were measured are predicted
+	   like ::STARPU_HISTORY_BASED. Other footprints are predicted by
+	   interpolating in log-log space between the closest measured
+	   sizes, or else from the regression of the measurements, as long
+	   as the confidence of the prediction is at least
+	   \ref STARPU_INTERPOLATION_MIN_CONFIDENCE. See
+	   starpu_task_expected_length_confidence().
+	   </li>
+	   <li>
 	   ::STARPU_MULTIPLE_REGRESSION_BASED: Need to provide fields
 	   starpu_perfmodel::nparameters (number of different parameters),
 	   starpu_perfmodel::ncombinations (number of parameters
@@ -376,6 +470,15 @@ int starpu_perfmodel_unload_model(struct starpu_perfmodel *model);
 */
 void starpu_save_history_based_model(struct starpu_perfmodel *model);
 
+/**
+   Save the performance model \p model in the file named \p filename,
+   in the text format, or in the binary format if \p binary is not 0.
+   Both formats can be loaded with starpu_perfmodel_load_file(). See
+   \ref STARPU_PERF_MODEL_BINARY.
+   Return 0 on success, or -errno if the file could not be written.
+*/
+int starpu_perfmodel_save_file(const char *filename, struct starpu_perfmodel *model, int binary);
+
 /**
   Fills \p path (supposed to be \p maxlen long) with the full path to the
   performance model file for symbol \p symbol.  This path can later on be used
@@ -508,10 +611,22 @@ double starpu_transfer_latency(unsigned src_node, unsigned dst_node);
 
 /**
    Return the estimated time to transfer a given size between two memory nodes.
+   Unless \ref STARPU_TRANSFER_CONTENTION is set to 0, this includes the
+   delay caused by sharing the link with the transfers already queued on it,
+   see starpu_transfer_queued().
    See \ref SchedulingHelpers for more details.
 */
 double starpu_transfer_predict(unsigned src_node, unsigned dst_node, size_t size);
 
+/**
+   Return the amount of data, in bytes, which was requested to be transferred
+   from \p src_node to \p dst_node and is not transferred yet. If \p nrequests
+   is not <c>NULL</c>, set it to the number of such transfers. Idle prefetches
+   are not accounted.
+   See \ref SchedulingHelpers for more details.
+*/
+size_t starpu_transfer_queued(unsigned src_node, unsigned dst_node, unsigned *nrequests);
+
 /**
    Performance model which just always return 1µs.
 */
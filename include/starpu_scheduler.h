@@ -422,6 +422,16 @@ uint32_t starpu_task_data_footprint(struct starpu_task *task);
 */
 double starpu_task_expected_length(struct starpu_task *task, struct starpu_perfmodel_arch *arch, unsigned nimpl);
 
+/**
+   Same as starpu_task_expected_length(), and set \p confidence to a value
+   between 0 and 1 which tells how reliable the prediction is: 1 when the
+   footprint of the task was measured, less when the duration was
+   interpolated between measured sizes or given by a regression, and 0 when
+   it is unknown. \p confidence can be <c>NULL</c>.
+   See \ref PerformanceModelCalibration for more details.
+*/
+double starpu_task_expected_length_confidence(struct starpu_task *task, struct starpu_perfmodel_arch *arch, unsigned nimpl, double *confidence);
+
 /**
    Same as starpu_task_expected_length() but for a precise worker.
    See \ref SchedulingHelpers for more details.
@@ -268,3 +268,24 @@ AC_DEFUN([STARPU_CHECK_SYNC_SYNCHRONIZE], [
     AC_DEFINE(STARPU_HAVE_SYNC_SYNCHRONIZE, 1,
 	      [Define to 1 if the target supports __sync_synchronize])
   fi])
+
+# Check whether the compiler can build functions for a given x86 instruction
+# set with the target attribute, and check the CPU support at runtime.
+AC_DEFUN([STARPU_CHECK_X86_TARGET_ATTRIBUTE], [
+  AC_CACHE_CHECK([whether the compiler supports x86 function target attributes],
+		 ac_cv_have_x86_target_attribute, [
+  AC_LINK_IFELSE([AC_LANG_PROGRAM([#include <immintrin.h>
+				   __attribute__((target("avx2"))) static void copy2(char *d, const char *s)
+				   { _mm256_storeu_si256((__m256i *) d, _mm256_loadu_si256((const __m256i *) s)); }
+				   __attribute__((target("avx512f"))) static void copy5(char *d, const char *s)
+				   { _mm512_stream_si512((__m512i *) d, _mm512_loadu_si512((const void *) s)); }],
+			[char s@<:@64@:>@, d@<:@64@:>@;
+			 __builtin_cpu_init();
+			 if (__builtin_cpu_supports("avx512f")) copy5(d, s);
+			 else if (__builtin_cpu_supports("avx2")) copy2(d, s);])],
+			[ac_cv_have_x86_target_attribute=yes],
+			[ac_cv_have_x86_target_attribute=no])])
+  if test $ac_cv_have_x86_target_attribute = yes; then
+    AC_DEFINE(STARPU_HAVE_X86_TARGET_ATTRIBUTE, 1,
+	      [Define to 1 if the compiler supports x86 function target attributes])
+  fi])
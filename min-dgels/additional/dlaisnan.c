@@ -1,58 +0,0 @@
-/* dlaisnan.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-logical _starpu_dlaisnan_(doublereal *din1, doublereal *din2)
-{
-    /* System generated locals */
-    logical ret_val;
-
-
-/*  -- LAPACK auxiliary routine (version 3.2) -- */
-/*     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd.. */
-/*     November 2006 */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  This routine is not for general use.  It exists solely to avoid */
-/*  over-optimization in DISNAN. */
-
-/*  DLAISNAN checks for NaNs by comparing its two arguments for */
-/*  inequality.  NaN is the only floating-point value where NaN != NaN */
-/*  returns .TRUE.  To check for NaNs, pass the same variable as both */
-/*  arguments. */
-
-/*  A compiler must assume that the two arguments are */
-/*  not the same variable, and the test will not be optimized away. */
-/*  Interprocedural or whole-program optimization may delete this */
-/*  test.  The ISNAN functions will be replaced by the correct */
-/*  Fortran 03 intrinsic once the intrinsic is widely available. */
-
-/*  Arguments */
-/*  ========= */
-
-/*  DIN1     (input) DOUBLE PRECISION */
-/*  DIN2     (input) DOUBLE PRECISION */
-/*          Two numbers to compare for inequality. */
-
-/*  ===================================================================== */
-
-/*  .. Executable Statements .. */
-    ret_val = *din1 != *din2;
-    return ret_val;
-} /* _starpu_dlaisnan_ */
@@ -1,36 +0,0 @@
-/* dcabs1.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-doublereal _starpu_dcabs1_(doublecomplex *z__)
-{
-    /* System generated locals */
-    doublereal ret_val, d__1, d__2;
-
-    /* Builtin functions */
-    double d_imag(doublecomplex *);
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. */
-/*  Purpose */
-/*  ======= */
-
-/*  DCABS1 computes absolute value of a double complex number */
-
-/*     .. Intrinsic Functions .. */
-
-    ret_val = (d__1 = z__->r, abs(d__1)) + (d__2 = d_imag(z__), abs(d__2));
-    return ret_val;
-} /* _starpu_dcabs1_ */
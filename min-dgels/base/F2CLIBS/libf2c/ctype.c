@@ -1,2 +0,0 @@
-#define My_ctype_DEF
-#include "ctype.h"
@@ -1,23 +0,0 @@
-#include "f2c.h"
-
-#ifdef KR_headers
-double exp(), cos(), sin();
-VOID z_exp(r, z) doublecomplex *r, *z;
-#else
-#undef abs
-#include "math.h"
-#ifdef __cplusplus
-extern "C" {
-#endif
-void z_exp(doublecomplex *r, doublecomplex *z)
-#endif
-{
-	double expx, zi = z->i;
-
-	expx = exp(z->r);
-	r->r = expx * cos(zi);
-	r->i = expx * sin(zi);
-	}
-#ifdef __cplusplus
-}
-#endif
@@ -1,233 +0,0 @@
-/* dpotrf.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-/* Table of constant values */
-
-static integer c__1 = 1;
-static integer c_n1 = -1;
-static doublereal c_b17 = 1.;
-static doublereal c_b20 = -1.;
-
-/* Subroutine */ int _starpu_dpotrf_(char *uplo, integer *n, doublereal *a, integer *
-	lda, integer *info)
-{
-    /* System generated locals */
-    integer a_dim1, a_offset, i__1, i__2, i__3, i__4;
-
-    /* Local variables */
-    integer j, jb, nb;
-    extern logical _starpu_lsame_(char *, char *);
-    extern /* Subroutine */ int _starpu_dtrsm_(char *, char *, char *, char *, 
-	    integer *, integer *, doublereal *, doublereal *, integer *, 
-	    doublereal *, integer *);
-    logical upper;
-    extern /* Subroutine */ int _starpu_dsyrk_(char *, char *, integer *, integer *, 
-	    doublereal *, doublereal *, integer *, doublereal *, doublereal *, 
-	     integer *), _starpu_dpotf2_(char *, integer *, 
-	    doublereal *, integer *, integer *), _starpu_xerbla_(char *, 
-	    integer *);
-    extern integer _starpu_ilaenv_(integer *, char *, char *, integer *, integer *, 
-	    integer *, integer *);
-
-
-/*  -- LAPACK routine (version 3.1) -- */
-/*     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd.. */
-/*     March 2008 */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  DPOTRF computes the Cholesky factorization of a real symmetric */
-/*  positive definite matrix A. */
-
-/*  The factorization has the form */
-/*     A = U**T * U,  if UPLO = 'U', or */
-/*     A = L  * L**T,  if UPLO = 'L', */
-/*  where U is an upper triangular matrix and L is lower triangular. */
-
-/*  This is the right looking block version of the algorithm, calling Level 3 BLAS. */
-
-/*  Arguments */
-/*  ========= */
-
-/*  UPLO    (input) CHARACTER*1 */
-/*          = 'U':  Upper triangle of A is stored; */
-/*          = 'L':  Lower triangle of A is stored. */
-
-/*  N       (input) INTEGER */
-/*          The order of the matrix A.  N >= 0. */
-
-/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA,N) */
-/*          On entry, the symmetric matrix A.  If UPLO = 'U', the leading */
-/*          N-by-N upper triangular part of A contains the upper */
-/*          triangular part of the matrix A, and the strictly lower */
-/*          triangular part of A is not referenced.  If UPLO = 'L', the */
-/*          leading N-by-N lower triangular part of A contains the lower */
-/*          triangular part of the matrix A, and the strictly upper */
-/*          triangular part of A is not referenced. */
-
-/*          On exit, if INFO = 0, the factor U or L from the Cholesky */
-/*          factorization A = U**T*U or A = L*L**T. */
-
-/*  LDA     (input) INTEGER */
-/*          The leading dimension of the array A.  LDA >= max(1,N). */
-
-/*  INFO    (output) INTEGER */
-/*          = 0:  successful exit */
-/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
-/*          > 0:  if INFO = i, the leading minor of order i is not */
-/*                positive definite, and the factorization could not be */
-/*                completed. */
-
-/*  ===================================================================== */
-
-/*     .. Parameters .. */
-/*     .. */
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. External Functions .. */
-/*     .. */
-/*     .. External Subroutines .. */
-/*     .. */
-/*     .. Intrinsic Functions .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-/*     Test the input parameters. */
-
-    /* Parameter adjustments */
-    a_dim1 = *lda;
-    a_offset = 1 + a_dim1;
-    a -= a_offset;
-
-    /* Function Body */
-    *info = 0;
-    upper = _starpu_lsame_(uplo, "U");
-    if (! upper && ! _starpu_lsame_(uplo, "L")) {
-	*info = -1;
-    } else if (*n < 0) {
-	*info = -2;
-    } else if (*lda < max(1,*n)) {
-	*info = -4;
-    }
-    if (*info != 0) {
-	i__1 = -(*info);
-	_starpu_xerbla_("DPOTRF", &i__1);
-	return 0;
-    }
-
-/*     Quick return if possible */
-
-    if (*n == 0) {
-	return 0;
-    }
-
-/*     Determine the block size for this environment. */
-
-    nb = _starpu_ilaenv_(&c__1, "DPOTRF", uplo, n, &c_n1, &c_n1, &c_n1);
-    if (nb <= 1 || nb >= *n) {
-
-/*        Use unblocked code. */
-
-	_starpu_dpotf2_(uplo, n, &a[a_offset], lda, info);
-    } else {
-
-/*        Use blocked code. */
-
-	if (upper) {
-
-/*           Compute the Cholesky factorization A = U'*U. */
-
-	    i__1 = *n;
-	    i__2 = nb;
-	    for (j = 1; i__2 < 0 ? j >= i__1 : j <= i__1; j += i__2) {
-
-/*              Update and factorize the current diagonal block and test */
-/*              for non-positive-definiteness. */
-
-/* Computing MIN */
-		i__3 = nb, i__4 = *n - j + 1;
-		jb = min(i__3,i__4);
-		_starpu_dpotf2_("Upper", &jb, &a[j + j * a_dim1], lda, info);
-		if (*info != 0) {
-		    goto L30;
-		}
-		if (j + jb <= *n) {
-
-/*                 Updating the trailing submatrix. */
-
-		    i__3 = *n - j - jb + 1;
-		    _starpu_dtrsm_("Left", "Upper", "Transpose", "Non-unit", &jb, &
-			    i__3, &c_b17, &a[j + j * a_dim1], lda, &a[j + (j 
-			    + jb) * a_dim1], lda);
-		    i__3 = *n - j - jb + 1;
-		    _starpu_dsyrk_("Upper", "Transpose", &i__3, &jb, &c_b20, &a[j + (
-			    j + jb) * a_dim1], lda, &c_b17, &a[j + jb + (j + 
-			    jb) * a_dim1], lda);
-		}
-/* L10: */
-	    }
-
-	} else {
-
-/*           Compute the Cholesky factorization A = L*L'. */
-
-	    i__2 = *n;
-	    i__1 = nb;
-	    for (j = 1; i__1 < 0 ? j >= i__2 : j <= i__2; j += i__1) {
-
-/*              Update and factorize the current diagonal block and test */
-/*              for non-positive-definiteness. */
-
-/* Computing MIN */
-		i__3 = nb, i__4 = *n - j + 1;
-		jb = min(i__3,i__4);
-		_starpu_dpotf2_("Lower", &jb, &a[j + j * a_dim1], lda, info);
-		if (*info != 0) {
-		    goto L30;
-		}
-		if (j + jb <= *n) {
-
-/*                Updating the trailing submatrix. */
-
-		    i__3 = *n - j - jb + 1;
-		    _starpu_dtrsm_("Right", "Lower", "Transpose", "Non-unit", &i__3, &
-			    jb, &c_b17, &a[j + j * a_dim1], lda, &a[j + jb + 
-			    j * a_dim1], lda);
-		    i__3 = *n - j - jb + 1;
-		    _starpu_dsyrk_("Lower", "No Transpose", &i__3, &jb, &c_b20, &a[j 
-			    + jb + j * a_dim1], lda, &c_b17, &a[j + jb + (j + 
-			    jb) * a_dim1], lda);
-		}
-/* L20: */
-	    }
-	}
-    }
-    goto L40;
-
-L30:
-    *info = *info + j - 1;
-
-L40:
-    return 0;
-
-/*     End of DPOTRF */
-
-} /* _starpu_dpotrf_ */
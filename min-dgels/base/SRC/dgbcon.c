@@ -1,284 +0,0 @@
-/* dgbcon.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-/* Table of constant values */
-
-static integer c__1 = 1;
-
-/* Subroutine */ int _starpu_dgbcon_(char *norm, integer *n, integer *kl, integer *ku, 
-	 doublereal *ab, integer *ldab, integer *ipiv, doublereal *anorm, 
-	doublereal *rcond, doublereal *work, integer *iwork, integer *info)
-{
-    /* System generated locals */
-    integer ab_dim1, ab_offset, i__1, i__2, i__3;
-    doublereal d__1;
-
-    /* Local variables */
-    integer j;
-    doublereal t;
-    integer kd, lm, jp, ix, kase;
-    extern doublereal _starpu_ddot_(integer *, doublereal *, integer *, doublereal *, 
-	    integer *);
-    integer kase1;
-    doublereal scale;
-    extern logical _starpu_lsame_(char *, char *);
-    integer isave[3];
-    extern /* Subroutine */ int _starpu_drscl_(integer *, doublereal *, doublereal *, 
-	    integer *);
-    logical lnoti;
-    extern /* Subroutine */ int _starpu_daxpy_(integer *, doublereal *, doublereal *, 
-	    integer *, doublereal *, integer *), _starpu_dlacn2_(integer *, 
-	    doublereal *, doublereal *, integer *, doublereal *, integer *, 
-	    integer *);
-    extern doublereal _starpu_dlamch_(char *);
-    extern integer _starpu_idamax_(integer *, doublereal *, integer *);
-    extern /* Subroutine */ int _starpu_dlatbs_(char *, char *, char *, char *, 
-	    integer *, integer *, doublereal *, integer *, doublereal *, 
-	    doublereal *, doublereal *, integer *), _starpu_xerbla_(char *, integer *);
-    doublereal ainvnm;
-    logical onenrm;
-    char normin[1];
-    doublereal smlnum;
-
-
-/*  -- LAPACK routine (version 3.2) -- */
-/*     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd.. */
-/*     November 2006 */
-
-/*     Modified to call DLACN2 in place of DLACON, 5 Feb 03, SJH. */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  DGBCON estimates the reciprocal of the condition number of a real */
-/*  general band matrix A, in either the 1-norm or the infinity-norm, */
-/*  using the LU factorization computed by DGBTRF. */
-
-/*  An estimate is obtained for norm(inv(A)), and the reciprocal of the */
-/*  condition number is computed as */
-/*     RCOND = 1 / ( norm(A) * norm(inv(A)) ). */
-
-/*  Arguments */
-/*  ========= */
-
-/*  NORM    (input) CHARACTER*1 */
-/*          Specifies whether the 1-norm condition number or the */
-/*          infinity-norm condition number is required: */
-/*          = '1' or 'O':  1-norm; */
-/*          = 'I':         Infinity-norm. */
-
-/*  N       (input) INTEGER */
-/*          The order of the matrix A.  N >= 0. */
-
-/*  KL      (input) INTEGER */
-/*          The number of subdiagonals within the band of A.  KL >= 0. */
-
-/*  KU      (input) INTEGER */
-/*          The number of superdiagonals within the band of A.  KU >= 0. */
-
-/*  AB      (input) DOUBLE PRECISION array, dimension (LDAB,N) */
-/*          Details of the LU factorization of the band matrix A, as */
-/*          computed by DGBTRF.  U is stored as an upper triangular band */
-/*          matrix with KL+KU superdiagonals in rows 1 to KL+KU+1, and */
-/*          the multipliers used during the factorization are stored in */
-/*          rows KL+KU+2 to 2*KL+KU+1. */
-
-/*  LDAB    (input) INTEGER */
-/*          The leading dimension of the array AB.  LDAB >= 2*KL+KU+1. */
-
-/*  IPIV    (input) INTEGER array, dimension (N) */
-/*          The pivot indices; for 1 <= i <= N, row i of the matrix was */
-/*          interchanged with row IPIV(i). */
-
-/*  ANORM   (input) DOUBLE PRECISION */
-/*          If NORM = '1' or 'O', the 1-norm of the original matrix A. */
-/*          If NORM = 'I', the infinity-norm of the original matrix A. */
-
-/*  RCOND   (output) DOUBLE PRECISION */
-/*          The reciprocal of the condition number of the matrix A, */
-/*          computed as RCOND = 1/(norm(A) * norm(inv(A))). */
-
-/*  WORK    (workspace) DOUBLE PRECISION array, dimension (3*N) */
-
-/*  IWORK   (workspace) INTEGER array, dimension (N) */
-
-/*  INFO    (output) INTEGER */
-/*          = 0:  successful exit */
-/*          < 0: if INFO = -i, the i-th argument had an illegal value */
-
-/*  ===================================================================== */
-
-/*     .. Parameters .. */
-/*     .. */
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. Local Arrays .. */
-/*     .. */
-/*     .. External Functions .. */
-/*     .. */
-/*     .. External Subroutines .. */
-/*     .. */
-/*     .. Intrinsic Functions .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-/*     Test the input parameters. */
-
-    /* Parameter adjustments */
-    ab_dim1 = *ldab;
-    ab_offset = 1 + ab_dim1;
-    ab -= ab_offset;
-    --ipiv;
-    --work;
-    --iwork;
-
-    /* Function Body */
-    *info = 0;
-    onenrm = *(unsigned char *)norm == '1' || _starpu_lsame_(norm, "O");
-    if (! onenrm && ! _starpu_lsame_(norm, "I")) {
-	*info = -1;
-    } else if (*n < 0) {
-	*info = -2;
-    } else if (*kl < 0) {
-	*info = -3;
-    } else if (*ku < 0) {
-	*info = -4;
-    } else if (*ldab < (*kl << 1) + *ku + 1) {
-	*info = -6;
-    } else if (*anorm < 0.) {
-	*info = -8;
-    }
-    if (*info != 0) {
-	i__1 = -(*info);
-	_starpu_xerbla_("DGBCON", &i__1);
-	return 0;
-    }
-
-/*     Quick return if possible */
-
-    *rcond = 0.;
-    if (*n == 0) {
-	*rcond = 1.;
-	return 0;
-    } else if (*anorm == 0.) {
-	return 0;
-    }
-
-    smlnum = _starpu_dlamch_("Safe minimum");
-
-/*     Estimate the norm of inv(A). */
-
-    ainvnm = 0.;
-    *(unsigned char *)normin = 'N';
-    if (onenrm) {
-	kase1 = 1;
-    } else {
-	kase1 = 2;
-    }
-    kd = *kl + *ku + 1;
-    lnoti = *kl > 0;
-    kase = 0;
-L10:
-    _starpu_dlacn2_(n, &work[*n + 1], &work[1], &iwork[1], &ainvnm, &kase, isave);
-    if (kase != 0) {
-	if (kase == kase1) {
-
-/*           Multiply by inv(L). */
-
-	    if (lnoti) {
-		i__1 = *n - 1;
-		for (j = 1; j <= i__1; ++j) {
-/* Computing MIN */
-		    i__2 = *kl, i__3 = *n - j;
-		    lm = min(i__2,i__3);
-		    jp = ipiv[j];
-		    t = work[jp];
-		    if (jp != j) {
-			work[jp] = work[j];
-			work[j] = t;
-		    }
-		    d__1 = -t;
-		    _starpu_daxpy_(&lm, &d__1, &ab[kd + 1 + j * ab_dim1], &c__1, &
-			    work[j + 1], &c__1);
-/* L20: */
-		}
-	    }
-
-/*           Multiply by inv(U). */
-
-	    i__1 = *kl + *ku;
-	    _starpu_dlatbs_("Upper", "No transpose", "Non-unit", normin, n, &i__1, &
-		    ab[ab_offset], ldab, &work[1], &scale, &work[(*n << 1) + 
-		    1], info);
-	} else {
-
-/*           Multiply by inv(U'). */
-
-	    i__1 = *kl + *ku;
-	    _starpu_dlatbs_("Upper", "Transpose", "Non-unit", normin, n, &i__1, &ab[
-		    ab_offset], ldab, &work[1], &scale, &work[(*n << 1) + 1], 
-		    info);
-
-/*           Multiply by inv(L'). */
-
-	    if (lnoti) {
-		for (j = *n - 1; j >= 1; --j) {
-/* Computing MIN */
-		    i__1 = *kl, i__2 = *n - j;
-		    lm = min(i__1,i__2);
-		    work[j] -= _starpu_ddot_(&lm, &ab[kd + 1 + j * ab_dim1], &c__1, &
-			    work[j + 1], &c__1);
-		    jp = ipiv[j];
-		    if (jp != j) {
-			t = work[jp];
-			work[jp] = work[j];
-			work[j] = t;
-		    }
-/* L30: */
-		}
-	    }
-	}
-
-/*        Divide X by 1/SCALE if doing so will not cause overflow. */
-
-	*(unsigned char *)normin = 'Y';
-	if (scale != 1.) {
-	    ix = _starpu_idamax_(n, &work[1], &c__1);
-	    if (scale < (d__1 = work[ix], abs(d__1)) * smlnum || scale == 0.) 
-		    {
-		goto L40;
-	    }
-	    _starpu_drscl_(n, &scale, &work[1], &c__1);
-	}
-	goto L10;
-    }
-
-/*     Compute the estimate of the reciprocal condition number. */
-
-    if (ainvnm != 0.) {
-	*rcond = 1. / ainvnm / *anorm;
-    }
-
-L40:
-    return 0;
-
-/*     End of DGBCON */
-
-} /* _starpu_dgbcon_ */
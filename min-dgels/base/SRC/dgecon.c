@@ -1,226 +0,0 @@
-/* dgecon.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-/* Table of constant values */
-
-static integer c__1 = 1;
-
-/* Subroutine */ int _starpu_dgecon_(char *norm, integer *n, doublereal *a, integer *
-	lda, doublereal *anorm, doublereal *rcond, doublereal *work, integer *
-	iwork, integer *info)
-{
-    /* System generated locals */
-    integer a_dim1, a_offset, i__1;
-    doublereal d__1;
-
-    /* Local variables */
-    doublereal sl;
-    integer ix;
-    doublereal su;
-    integer kase, kase1;
-    doublereal scale;
-    extern logical _starpu_lsame_(char *, char *);
-    integer isave[3];
-    extern /* Subroutine */ int _starpu_drscl_(integer *, doublereal *, doublereal *, 
-	    integer *), _starpu_dlacn2_(integer *, doublereal *, doublereal *, 
-	    integer *, doublereal *, integer *, integer *);
-    extern doublereal _starpu_dlamch_(char *);
-    extern integer _starpu_idamax_(integer *, doublereal *, integer *);
-    extern /* Subroutine */ int _starpu_xerbla_(char *, integer *);
-    doublereal ainvnm;
-    extern /* Subroutine */ int _starpu_dlatrs_(char *, char *, char *, char *, 
-	    integer *, doublereal *, integer *, doublereal *, doublereal *, 
-	    doublereal *, integer *);
-    logical onenrm;
-    char normin[1];
-    doublereal smlnum;
-
-
-/*  -- LAPACK routine (version 3.2) -- */
-/*     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd.. */
-/*     November 2006 */
-
-/*     Modified to call DLACN2 in place of DLACON, 5 Feb 03, SJH. */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  DGECON estimates the reciprocal of the condition number of a general */
-/*  real matrix A, in either the 1-norm or the infinity-norm, using */
-/*  the LU factorization computed by DGETRF. */
-
-/*  An estimate is obtained for norm(inv(A)), and the reciprocal of the */
-/*  condition number is computed as */
-/*     RCOND = 1 / ( norm(A) * norm(inv(A)) ). */
-
-/*  Arguments */
-/*  ========= */
-
-/*  NORM    (input) CHARACTER*1 */
-/*          Specifies whether the 1-norm condition number or the */
-/*          infinity-norm condition number is required: */
-/*          = '1' or 'O':  1-norm; */
-/*          = 'I':         Infinity-norm. */
-
-/*  N       (input) INTEGER */
-/*          The order of the matrix A.  N >= 0. */
-
-/*  A       (input) DOUBLE PRECISION array, dimension (LDA,N) */
-/*          The factors L and U from the factorization A = P*L*U */
-/*          as computed by DGETRF. */
-
-/*  LDA     (input) INTEGER */
-/*          The leading dimension of the array A.  LDA >= max(1,N). */
-
-/*  ANORM   (input) DOUBLE PRECISION */
-/*          If NORM = '1' or 'O', the 1-norm of the original matrix A. */
-/*          If NORM = 'I', the infinity-norm of the original matrix A. */
-
-/*  RCOND   (output) DOUBLE PRECISION */
-/*          The reciprocal of the condition number of the matrix A, */
-/*          computed as RCOND = 1/(norm(A) * norm(inv(A))). */
-
-/*  WORK    (workspace) DOUBLE PRECISION array, dimension (4*N) */
-
-/*  IWORK   (workspace) INTEGER array, dimension (N) */
-
-/*  INFO    (output) INTEGER */
-/*          = 0:  successful exit */
-/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
-
-/*  ===================================================================== */
-
-/*     .. Parameters .. */
-/*     .. */
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. Local Arrays .. */
-/*     .. */
-/*     .. External Functions .. */
-/*     .. */
-/*     .. External Subroutines .. */
-/*     .. */
-/*     .. Intrinsic Functions .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-/*     Test the input parameters. */
-
-    /* Parameter adjustments */
-    a_dim1 = *lda;
-    a_offset = 1 + a_dim1;
-    a -= a_offset;
-    --work;
-    --iwork;
-
-    /* Function Body */
-    *info = 0;
-    onenrm = *(unsigned char *)norm == '1' || _starpu_lsame_(norm, "O");
-    if (! onenrm && ! _starpu_lsame_(norm, "I")) {
-	*info = -1;
-    } else if (*n < 0) {
-	*info = -2;
-    } else if (*lda < max(1,*n)) {
-	*info = -4;
-    } else if (*anorm < 0.) {
-	*info = -5;
-    }
-    if (*info != 0) {
-	i__1 = -(*info);
-	_starpu_xerbla_("DGECON", &i__1);
-	return 0;
-    }
-
-/*     Quick return if possible */
-
-    *rcond = 0.;
-    if (*n == 0) {
-	*rcond = 1.;
-	return 0;
-    } else if (*anorm == 0.) {
-	return 0;
-    }
-
-    smlnum = _starpu_dlamch_("Safe minimum");
-
-/*     Estimate the norm of inv(A). */
-
-    ainvnm = 0.;
-    *(unsigned char *)normin = 'N';
-    if (onenrm) {
-	kase1 = 1;
-    } else {
-	kase1 = 2;
-    }
-    kase = 0;
-L10:
-    _starpu_dlacn2_(n, &work[*n + 1], &work[1], &iwork[1], &ainvnm, &kase, isave);
-    if (kase != 0) {
-	if (kase == kase1) {
-
-/*           Multiply by inv(L). */
-
-	    _starpu_dlatrs_("Lower", "No transpose", "Unit", normin, n, &a[a_offset], 
-		    lda, &work[1], &sl, &work[(*n << 1) + 1], info);
-
-/*           Multiply by inv(U). */
-
-	    _starpu_dlatrs_("Upper", "No transpose", "Non-unit", normin, n, &a[
-		    a_offset], lda, &work[1], &su, &work[*n * 3 + 1], info);
-	} else {
-
-/*           Multiply by inv(U'). */
-
-	    _starpu_dlatrs_("Upper", "Transpose", "Non-unit", normin, n, &a[a_offset], 
-		     lda, &work[1], &su, &work[*n * 3 + 1], info);
-
-/*           Multiply by inv(L'). */
-
-	    _starpu_dlatrs_("Lower", "Transpose", "Unit", normin, n, &a[a_offset], 
-		    lda, &work[1], &sl, &work[(*n << 1) + 1], info);
-	}
-
-/*        Divide X by 1/(SL*SU) if doing so will not cause overflow. */
-
-	scale = sl * su;
-	*(unsigned char *)normin = 'Y';
-	if (scale != 1.) {
-	    ix = _starpu_idamax_(n, &work[1], &c__1);
-	    if (scale < (d__1 = work[ix], abs(d__1)) * smlnum || scale == 0.) 
-		    {
-		goto L20;
-	    }
-	    _starpu_drscl_(n, &scale, &work[1], &c__1);
-	}
-	goto L10;
-    }
-
-/*     Compute the estimate of the reciprocal condition number. */
-
-    if (ainvnm != 0.) {
-	*rcond = 1. / ainvnm / *anorm;
-    }
-
-L20:
-    return 0;
-
-/*     End of DGECON */
-
-} /* _starpu_dgecon_ */
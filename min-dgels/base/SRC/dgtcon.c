@@ -1,209 +0,0 @@
-/* dgtcon.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-/* Table of constant values */
-
-static integer c__1 = 1;
-
-/* Subroutine */ int _starpu_dgtcon_(char *norm, integer *n, doublereal *dl, 
-	doublereal *d__, doublereal *du, doublereal *du2, integer *ipiv, 
-	doublereal *anorm, doublereal *rcond, doublereal *work, integer *
-	iwork, integer *info)
-{
-    /* System generated locals */
-    integer i__1;
-
-    /* Local variables */
-    integer i__, kase, kase1;
-    extern logical _starpu_lsame_(char *, char *);
-    integer isave[3];
-    extern /* Subroutine */ int _starpu_dlacn2_(integer *, doublereal *, doublereal *, 
-	     integer *, doublereal *, integer *, integer *), _starpu_xerbla_(char *, 
-	    integer *);
-    doublereal ainvnm;
-    logical onenrm;
-    extern /* Subroutine */ int _starpu_dgttrs_(char *, integer *, integer *, 
-	    doublereal *, doublereal *, doublereal *, doublereal *, integer *, 
-	     doublereal *, integer *, integer *);
-
-
-/*  -- LAPACK routine (version 3.2) -- */
-/*     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd.. */
-/*     November 2006 */
-
-/*     Modified to call DLACN2 in place of DLACON, 5 Feb 03, SJH. */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  DGTCON estimates the reciprocal of the condition number of a real */
-/*  tridiagonal matrix A using the LU factorization as computed by */
-/*  DGTTRF. */
-
-/*  An estimate is obtained for norm(inv(A)), and the reciprocal of the */
-/*  condition number is computed as RCOND = 1 / (ANORM * norm(inv(A))). */
-
-/*  Arguments */
-/*  ========= */
-
-/*  NORM    (input) CHARACTER*1 */
-/*          Specifies whether the 1-norm condition number or the */
-/*          infinity-norm condition number is required: */
-/*          = '1' or 'O':  1-norm; */
-/*          = 'I':         Infinity-norm. */
-
-/*  N       (input) INTEGER */
-/*          The order of the matrix A.  N >= 0. */
-
-/*  DL      (input) DOUBLE PRECISION array, dimension (N-1) */
-/*          The (n-1) multipliers that define the matrix L from the */
-/*          LU factorization of A as computed by DGTTRF. */
-
-/*  D       (input) DOUBLE PRECISION array, dimension (N) */
-/*          The n diagonal elements of the upper triangular matrix U from */
-/*          the LU factorization of A. */
-
-/*  DU      (input) DOUBLE PRECISION array, dimension (N-1) */
-/*          The (n-1) elements of the first superdiagonal of U. */
-
-/*  DU2     (input) DOUBLE PRECISION array, dimension (N-2) */
-/*          The (n-2) elements of the second superdiagonal of U. */
-
-/*  IPIV    (input) INTEGER array, dimension (N) */
-/*          The pivot indices; for 1 <= i <= n, row i of the matrix was */
-/*          interchanged with row IPIV(i).  IPIV(i) will always be either */
-/*          i or i+1; IPIV(i) = i indicates a row interchange was not */
-/*          required. */
-
-/*  ANORM   (input) DOUBLE PRECISION */
-/*          If NORM = '1' or 'O', the 1-norm of the original matrix A. */
-/*          If NORM = 'I', the infinity-norm of the original matrix A. */
-
-/*  RCOND   (output) DOUBLE PRECISION */
-/*          The reciprocal of the condition number of the matrix A, */
-/*          computed as RCOND = 1/(ANORM * AINVNM), where AINVNM is an */
-/*          estimate of the 1-norm of inv(A) computed in this routine. */
-
-/*  WORK    (workspace) DOUBLE PRECISION array, dimension (2*N) */
-
-/*  IWORK   (workspace) INTEGER array, dimension (N) */
-
-/*  INFO    (output) INTEGER */
-/*          = 0:  successful exit */
-/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
-
-/*  ===================================================================== */
-
-/*     .. Parameters .. */
-/*     .. */
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. Local Arrays .. */
-/*     .. */
-/*     .. External Functions .. */
-/*     .. */
-/*     .. External Subroutines .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-/*     Test the input arguments. */
-
-    /* Parameter adjustments */
-    --iwork;
-    --work;
-    --ipiv;
-    --du2;
-    --du;
-    --d__;
-    --dl;
-
-    /* Function Body */
-    *info = 0;
-    onenrm = *(unsigned char *)norm == '1' || _starpu_lsame_(norm, "O");
-    if (! onenrm && ! _starpu_lsame_(norm, "I")) {
-	*info = -1;
-    } else if (*n < 0) {
-	*info = -2;
-    } else if (*anorm < 0.) {
-	*info = -8;
-    }
-    if (*info != 0) {
-	i__1 = -(*info);
-	_starpu_xerbla_("DGTCON", &i__1);
-	return 0;
-    }
-
-/*     Quick return if possible */
-
-    *rcond = 0.;
-    if (*n == 0) {
-	*rcond = 1.;
-	return 0;
-    } else if (*anorm == 0.) {
-	return 0;
-    }
-
-/*     Check that D(1:N) is non-zero. */
-
-    i__1 = *n;
-    for (i__ = 1; i__ <= i__1; ++i__) {
-	if (d__[i__] == 0.) {
-	    return 0;
-	}
-/* L10: */
-    }
-
-    ainvnm = 0.;
-    if (onenrm) {
-	kase1 = 1;
-    } else {
-	kase1 = 2;
-    }
-    kase = 0;
-L20:
-    _starpu_dlacn2_(n, &work[*n + 1], &work[1], &iwork[1], &ainvnm, &kase, isave);
-    if (kase != 0) {
-	if (kase == kase1) {
-
-/*           Multiply by inv(U)*inv(L). */
-
-	    _starpu_dgttrs_("No transpose", n, &c__1, &dl[1], &d__[1], &du[1], &du2[1]
-, &ipiv[1], &work[1], n, info);
-	} else {
-
-/*           Multiply by inv(L')*inv(U'). */
-
-	    _starpu_dgttrs_("Transpose", n, &c__1, &dl[1], &d__[1], &du[1], &du2[1], &
-		    ipiv[1], &work[1], n, info);
-	}
-	goto L20;
-    }
-
-/*     Compute the estimate of the reciprocal condition number. */
-
-    if (ainvnm != 0.) {
-	*rcond = 1. / ainvnm / *anorm;
-    }
-
-    return 0;
-
-/*     End of DGTCON */
-
-} /* _starpu_dgtcon_ */
@@ -1,345 +0,0 @@
-/* _starpu_dla_gbrcond.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-/* Table of constant values */
-
-static integer c__1 = 1;
-
-doublereal _starpu_dla_gbrcond__(char *trans, integer *n, integer *kl, integer *ku, 
-	doublereal *ab, integer *ldab, doublereal *afb, integer *ldafb, 
-	integer *ipiv, integer *cmode, doublereal *c__, integer *info, 
-	doublereal *work, integer *iwork, ftnlen trans_len)
-{
-    /* System generated locals */
-    integer ab_dim1, ab_offset, afb_dim1, afb_offset, i__1, i__2, i__3, i__4;
-    doublereal ret_val, d__1;
-
-    /* Local variables */
-    integer i__, j, kd, ke;
-    doublereal tmp;
-    integer kase;
-    extern logical _starpu_lsame_(char *, char *);
-    integer isave[3];
-    extern /* Subroutine */ int _starpu_dlacn2_(integer *, doublereal *, doublereal *, 
-	     integer *, doublereal *, integer *, integer *), _starpu_xerbla_(char *, 
-	    integer *), _starpu_dgbtrs_(char *, integer *, integer *, integer 
-	    *, integer *, doublereal *, integer *, integer *, doublereal *, 
-	    integer *, integer *);
-    doublereal ainvnm;
-    logical notrans;
-
-
-/*     -- LAPACK routine (version 3.2.1)                               -- */
-/*     -- Contributed by James Demmel, Deaglan Halligan, Yozo Hida and -- */
-/*     -- Jason Riedy of Univ. of California Berkeley.                 -- */
-/*     -- April 2009                                                   -- */
-
-/*     -- LAPACK is a software package provided by Univ. of Tennessee, -- */
-/*     -- Univ. of California Berkeley and NAG Ltd.                    -- */
-
-/*     .. */
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*     DLA_GERCOND Estimates the Skeel condition number of  op(A) * op2(C) */
-/*     where op2 is determined by CMODE as follows */
-/*     CMODE =  1    op2(C) = C */
-/*     CMODE =  0    op2(C) = I */
-/*     CMODE = -1    op2(C) = inv(C) */
-/*     The Skeel condition number  cond(A) = norminf( |inv(A)||A| ) */
-/*     is computed by computing scaling factors R such that */
-/*     diag(R)*A*op2(C) is row equilibrated and computing the standard */
-/*     infinity-norm condition number. */
-
-/*  Arguments */
-/*  ========= */
-
-/*     TRANS   (input) CHARACTER*1 */
-/*     Specifies the form of the system of equations: */
-/*       = 'N':  A * X = B     (No transpose) */
-/*       = 'T':  A**T * X = B  (Transpose) */
-/*       = 'C':  A**H * X = B  (Conjugate Transpose = Transpose) */
-
-/*     N       (input) INTEGER */
-/*     The number of linear equations, i.e., the order of the */
-/*     matrix A.  N >= 0. */
-
-/*     KL      (input) INTEGER */
-/*     The number of subdiagonals within the band of A.  KL >= 0. */
-
-/*     KU      (input) INTEGER */
-/*     The number of superdiagonals within the band of A.  KU >= 0. */
-
-/*     AB      (input) DOUBLE PRECISION array, dimension (LDAB,N) */
-/*     On entry, the matrix A in band storage, in rows 1 to KL+KU+1. */
-/*     The j-th column of A is stored in the j-th column of the */
-/*     array AB as follows: */
-/*     AB(KU+1+i-j,j) = A(i,j) for max(1,j-KU)<=i<=min(N,j+kl) */
-
-/*     LDAB    (input) INTEGER */
-/*     The leading dimension of the array AB.  LDAB >= KL+KU+1. */
-
-/*     AFB     (input) DOUBLE PRECISION array, dimension (LDAFB,N) */
-/*     Details of the LU factorization of the band matrix A, as */
-/*     computed by DGBTRF.  U is stored as an upper triangular */
-/*     band matrix with KL+KU superdiagonals in rows 1 to KL+KU+1, */
-/*     and the multipliers used during the factorization are stored */
-/*     in rows KL+KU+2 to 2*KL+KU+1. */
-
-/*     LDAFB   (input) INTEGER */
-/*     The leading dimension of the array AFB.  LDAFB >= 2*KL+KU+1. */
-
-/*     IPIV    (input) INTEGER array, dimension (N) */
-/*     The pivot indices from the factorization A = P*L*U */
-/*     as computed by DGBTRF; row i of the matrix was interchanged */
-/*     with row IPIV(i). */
-
-/*     CMODE   (input) INTEGER */
-/*     Determines op2(C) in the formula op(A) * op2(C) as follows: */
-/*     CMODE =  1    op2(C) = C */
-/*     CMODE =  0    op2(C) = I */
-/*     CMODE = -1    op2(C) = inv(C) */
-
-/*     C       (input) DOUBLE PRECISION array, dimension (N) */
-/*     The vector C in the formula op(A) * op2(C). */
-
-/*     INFO    (output) INTEGER */
-/*       = 0:  Successful exit. */
-/*     i > 0:  The ith argument is invalid. */
-
-/*     WORK    (input) DOUBLE PRECISION array, dimension (5*N). */
-/*     Workspace. */
-
-/*     IWORK   (input) INTEGER array, dimension (N). */
-/*     Workspace. */
-
-/*  ===================================================================== */
-
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. Local Arrays .. */
-/*     .. */
-/*     .. External Functions .. */
-/*     .. */
-/*     .. External Subroutines .. */
-/*     .. */
-/*     .. Intrinsic Functions .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-    /* Parameter adjustments */
-    ab_dim1 = *ldab;
-    ab_offset = 1 + ab_dim1;
-    ab -= ab_offset;
-    afb_dim1 = *ldafb;
-    afb_offset = 1 + afb_dim1;
-    afb -= afb_offset;
-    --ipiv;
-    --c__;
-    --work;
-    --iwork;
-
-    /* Function Body */
-    ret_val = 0.;
-
-    *info = 0;
-    notrans = _starpu_lsame_(trans, "N");
-    if (! notrans && ! _starpu_lsame_(trans, "T") && ! _starpu_lsame_(
-	    trans, "C")) {
-	*info = -1;
-    } else if (*n < 0) {
-	*info = -2;
-    } else if (*kl < 0 || *kl > *n - 1) {
-	*info = -3;
-    } else if (*ku < 0 || *ku > *n - 1) {
-	*info = -4;
-    } else if (*ldab < *kl + *ku + 1) {
-	*info = -6;
-    } else if (*ldafb < (*kl << 1) + *ku + 1) {
-	*info = -8;
-    }
-    if (*info != 0) {
-	i__1 = -(*info);
-	_starpu_xerbla_("DLA_GBRCOND", &i__1);
-	return ret_val;
-    }
-    if (*n == 0) {
-	ret_val = 1.;
-	return ret_val;
-    }
-
-/*     Compute the equilibration matrix R such that */
-/*     inv(R)*A*C has unit 1-norm. */
-
-    kd = *ku + 1;
-    ke = *kl + 1;
-    if (notrans) {
-	i__1 = *n;
-	for (i__ = 1; i__ <= i__1; ++i__) {
-	    tmp = 0.;
-	    if (*cmode == 1) {
-/* Computing MAX */
-		i__2 = i__ - *kl;
-/* Computing MIN */
-		i__4 = i__ + *ku;
-		i__3 = min(i__4,*n);
-		for (j = max(i__2,1); j <= i__3; ++j) {
-		    tmp += (d__1 = ab[kd + i__ - j + j * ab_dim1] * c__[j], 
-			    abs(d__1));
-		}
-	    } else if (*cmode == 0) {
-/* Computing MAX */
-		i__3 = i__ - *kl;
-/* Computing MIN */
-		i__4 = i__ + *ku;
-		i__2 = min(i__4,*n);
-		for (j = max(i__3,1); j <= i__2; ++j) {
-		    tmp += (d__1 = ab[kd + i__ - j + j * ab_dim1], abs(d__1));
-		}
-	    } else {
-/* Computing MAX */
-		i__2 = i__ - *kl;
-/* Computing MIN */
-		i__4 = i__ + *ku;
-		i__3 = min(i__4,*n);
-		for (j = max(i__2,1); j <= i__3; ++j) {
-		    tmp += (d__1 = ab[kd + i__ - j + j * ab_dim1] / c__[j], 
-			    abs(d__1));
-		}
-	    }
-	    work[(*n << 1) + i__] = tmp;
-	}
-    } else {
-	i__1 = *n;
-	for (i__ = 1; i__ <= i__1; ++i__) {
-	    tmp = 0.;
-	    if (*cmode == 1) {
-/* Computing MAX */
-		i__3 = i__ - *kl;
-/* Computing MIN */
-		i__4 = i__ + *ku;
-		i__2 = min(i__4,*n);
-		for (j = max(i__3,1); j <= i__2; ++j) {
-		    tmp += (d__1 = ab[ke - i__ + j + i__ * ab_dim1] * c__[j], 
-			    abs(d__1));
-		}
-	    } else if (*cmode == 0) {
-/* Computing MAX */
-		i__2 = i__ - *kl;
-/* Computing MIN */
-		i__4 = i__ + *ku;
-		i__3 = min(i__4,*n);
-		for (j = max(i__2,1); j <= i__3; ++j) {
-		    tmp += (d__1 = ab[ke - i__ + j + i__ * ab_dim1], abs(d__1)
-			    );
-		}
-	    } else {
-/* Computing MAX */
-		i__3 = i__ - *kl;
-/* Computing MIN */
-		i__4 = i__ + *ku;
-		i__2 = min(i__4,*n);
-		for (j = max(i__3,1); j <= i__2; ++j) {
-		    tmp += (d__1 = ab[ke - i__ + j + i__ * ab_dim1] / c__[j], 
-			    abs(d__1));
-		}
-	    }
-	    work[(*n << 1) + i__] = tmp;
-	}
-    }
-
-/*     Estimate the norm of inv(op(A)). */
-
-    ainvnm = 0.;
-    kase = 0;
-L10:
-    _starpu_dlacn2_(n, &work[*n + 1], &work[1], &iwork[1], &ainvnm, &kase, isave);
-    if (kase != 0) {
-	if (kase == 2) {
-
-/*           Multiply by R. */
-
-	    i__1 = *n;
-	    for (i__ = 1; i__ <= i__1; ++i__) {
-		work[i__] *= work[(*n << 1) + i__];
-	    }
-	    if (notrans) {
-		_starpu_dgbtrs_("No transpose", n, kl, ku, &c__1, &afb[afb_offset], 
-			ldafb, &ipiv[1], &work[1], n, info);
-	    } else {
-		_starpu_dgbtrs_("Transpose", n, kl, ku, &c__1, &afb[afb_offset], 
-			ldafb, &ipiv[1], &work[1], n, info);
-	    }
-
-/*           Multiply by inv(C). */
-
-	    if (*cmode == 1) {
-		i__1 = *n;
-		for (i__ = 1; i__ <= i__1; ++i__) {
-		    work[i__] /= c__[i__];
-		}
-	    } else if (*cmode == -1) {
-		i__1 = *n;
-		for (i__ = 1; i__ <= i__1; ++i__) {
-		    work[i__] *= c__[i__];
-		}
-	    }
-	} else {
-
-/*           Multiply by inv(C'). */
-
-	    if (*cmode == 1) {
-		i__1 = *n;
-		for (i__ = 1; i__ <= i__1; ++i__) {
-		    work[i__] /= c__[i__];
-		}
-	    } else if (*cmode == -1) {
-		i__1 = *n;
-		for (i__ = 1; i__ <= i__1; ++i__) {
-		    work[i__] *= c__[i__];
-		}
-	    }
-	    if (notrans) {
-		_starpu_dgbtrs_("Transpose", n, kl, ku, &c__1, &afb[afb_offset], 
-			ldafb, &ipiv[1], &work[1], n, info);
-	    } else {
-		_starpu_dgbtrs_("No transpose", n, kl, ku, &c__1, &afb[afb_offset], 
-			ldafb, &ipiv[1], &work[1], n, info);
-	    }
-
-/*           Multiply by R. */
-
-	    i__1 = *n;
-	    for (i__ = 1; i__ <= i__1; ++i__) {
-		work[i__] *= work[(*n << 1) + i__];
-	    }
-	}
-	goto L10;
-    }
-
-/*     Compute the estimate of the reciprocal condition number. */
-
-    if (ainvnm != 0.) {
-	ret_val = 1. / ainvnm;
-    }
-
-    return ret_val;
-
-} /* _starpu_dla_gbrcond__ */
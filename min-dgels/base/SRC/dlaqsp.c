@@ -1,169 +0,0 @@
-/* dlaqsp.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-/* Subroutine */ int _starpu_dlaqsp_(char *uplo, integer *n, doublereal *ap, 
-	doublereal *s, doublereal *scond, doublereal *amax, char *equed)
-{
-    /* System generated locals */
-    integer i__1, i__2;
-
-    /* Local variables */
-    integer i__, j, jc;
-    doublereal cj, large;
-    extern logical _starpu_lsame_(char *, char *);
-    doublereal small;
-    extern doublereal _starpu_dlamch_(char *);
-
-
-/*  -- LAPACK auxiliary routine (version 3.2) -- */
-/*     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd.. */
-/*     November 2006 */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  DLAQSP equilibrates a symmetric matrix A using the scaling factors */
-/*  in the vector S. */
-
-/*  Arguments */
-/*  ========= */
-
-/*  UPLO    (input) CHARACTER*1 */
-/*          Specifies whether the upper or lower triangular part of the */
-/*          symmetric matrix A is stored. */
-/*          = 'U':  Upper triangular */
-/*          = 'L':  Lower triangular */
-
-/*  N       (input) INTEGER */
-/*          The order of the matrix A.  N >= 0. */
-
-/*  AP      (input/output) DOUBLE PRECISION array, dimension (N*(N+1)/2) */
-/*          On entry, the upper or lower triangle of the symmetric matrix */
-/*          A, packed columnwise in a linear array.  The j-th column of A */
-/*          is stored in the array AP as follows: */
-/*          if UPLO = 'U', AP(i + (j-1)*j/2) = A(i,j) for 1<=i<=j; */
-/*          if UPLO = 'L', AP(i + (j-1)*(2n-j)/2) = A(i,j) for j<=i<=n. */
-
-/*          On exit, the equilibrated matrix:  diag(S) * A * diag(S), in */
-/*          the same storage format as A. */
-
-/*  S       (input) DOUBLE PRECISION array, dimension (N) */
-/*          The scale factors for A. */
-
-/*  SCOND   (input) DOUBLE PRECISION */
-/*          Ratio of the smallest S(i) to the largest S(i). */
-
-/*  AMAX    (input) DOUBLE PRECISION */
-/*          Absolute value of largest matrix entry. */
-
-/*  EQUED   (output) CHARACTER*1 */
-/*          Specifies whether or not equilibration was done. */
-/*          = 'N':  No equilibration. */
-/*          = 'Y':  Equilibration was done, i.e., A has been replaced by */
-/*                  diag(S) * A * diag(S). */
-
-/*  Internal Parameters */
-/*  =================== */
-
-/*  THRESH is a threshold value used to decide if scaling should be done */
-/*  based on the ratio of the scaling factors.  If SCOND < THRESH, */
-/*  scaling is done. */
-
-/*  LARGE and SMALL are threshold values used to decide if scaling should */
-/*  be done based on the absolute size of the largest matrix element. */
-/*  If AMAX > LARGE or AMAX < SMALL, scaling is done. */
-
-/*  ===================================================================== */
-
-/*     .. Parameters .. */
-/*     .. */
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. External Functions .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-/*     Quick return if possible */
-
-    /* Parameter adjustments */
-    --s;
-    --ap;
-
-    /* Function Body */
-    if (*n <= 0) {
-	*(unsigned char *)equed = 'N';
-	return 0;
-    }
-
-/*     Initialize LARGE and SMALL. */
-
-    small = _starpu_dlamch_("Safe minimum") / _starpu_dlamch_("Precision");
-    large = 1. / small;
-
-    if (*scond >= .1 && *amax >= small && *amax <= large) {
-
-/*        No equilibration */
-
-	*(unsigned char *)equed = 'N';
-    } else {
-
-/*        Replace A by diag(S) * A * diag(S). */
-
-	if (_starpu_lsame_(uplo, "U")) {
-
-/*           Upper triangle of A is stored. */
-
-	    jc = 1;
-	    i__1 = *n;
-	    for (j = 1; j <= i__1; ++j) {
-		cj = s[j];
-		i__2 = j;
-		for (i__ = 1; i__ <= i__2; ++i__) {
-		    ap[jc + i__ - 1] = cj * s[i__] * ap[jc + i__ - 1];
-/* L10: */
-		}
-		jc += j;
-/* L20: */
-	    }
-	} else {
-
-/*           Lower triangle of A is stored. */
-
-	    jc = 1;
-	    i__1 = *n;
-	    for (j = 1; j <= i__1; ++j) {
-		cj = s[j];
-		i__2 = *n;
-		for (i__ = j; i__ <= i__2; ++i__) {
-		    ap[jc + i__ - j] = cj * s[i__] * ap[jc + i__ - j];
-/* L30: */
-		}
-		jc = jc + *n - j + 1;
-/* L40: */
-	    }
-	}
-	*(unsigned char *)equed = 'Y';
-    }
-
-    return 0;
-
-/*     End of DLAQSP */
-
-} /* _starpu_dlaqsp_ */
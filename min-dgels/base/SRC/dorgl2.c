@@ -1,175 +0,0 @@
-/* dorgl2.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-/* Subroutine */ int _starpu_dorgl2_(integer *m, integer *n, integer *k, doublereal *
-	a, integer *lda, doublereal *tau, doublereal *work, integer *info)
-{
-    /* System generated locals */
-    integer a_dim1, a_offset, i__1, i__2;
-    doublereal d__1;
-
-    /* Local variables */
-    integer i__, j, l;
-    extern /* Subroutine */ int _starpu_dscal_(integer *, doublereal *, doublereal *, 
-	    integer *), _starpu_dlarf_(char *, integer *, integer *, doublereal *, 
-	    integer *, doublereal *, doublereal *, integer *, doublereal *), _starpu_xerbla_(char *, integer *);
-
-
-/*  -- LAPACK routine (version 3.2) -- */
-/*     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd.. */
-/*     November 2006 */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  DORGL2 generates an m by n real matrix Q with orthonormal rows, */
-/*  which is defined as the first m rows of a product of k elementary */
-/*  reflectors of order n */
-
-/*        Q  =  H(k) . . . H(2) H(1) */
-
-/*  as returned by DGELQF. */
-
-/*  Arguments */
-/*  ========= */
-
-/*  M       (input) INTEGER */
-/*          The number of rows of the matrix Q. M >= 0. */
-
-/*  N       (input) INTEGER */
-/*          The number of columns of the matrix Q. N >= M. */
-
-/*  K       (input) INTEGER */
-/*          The number of elementary reflectors whose product defines the */
-/*          matrix Q. M >= K >= 0. */
-
-/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA,N) */
-/*          On entry, the i-th row must contain the vector which defines */
-/*          the elementary reflector H(i), for i = 1,2,...,k, as returned */
-/*          by DGELQF in the first k rows of its array argument A. */
-/*          On exit, the m-by-n matrix Q. */
-
-/*  LDA     (input) INTEGER */
-/*          The first dimension of the array A. LDA >= max(1,M). */
-
-/*  TAU     (input) DOUBLE PRECISION array, dimension (K) */
-/*          TAU(i) must contain the scalar factor of the elementary */
-/*          reflector H(i), as returned by DGELQF. */
-
-/*  WORK    (workspace) DOUBLE PRECISION array, dimension (M) */
-
-/*  INFO    (output) INTEGER */
-/*          = 0: successful exit */
-/*          < 0: if INFO = -i, the i-th argument has an illegal value */
-
-/*  ===================================================================== */
-
-/*     .. Parameters .. */
-/*     .. */
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. External Subroutines .. */
-/*     .. */
-/*     .. Intrinsic Functions .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-/*     Test the input arguments */
-
-    /* Parameter adjustments */
-    a_dim1 = *lda;
-    a_offset = 1 + a_dim1;
-    a -= a_offset;
-    --tau;
-    --work;
-
-    /* Function Body */
-    *info = 0;
-    if (*m < 0) {
-	*info = -1;
-    } else if (*n < *m) {
-	*info = -2;
-    } else if (*k < 0 || *k > *m) {
-	*info = -3;
-    } else if (*lda < max(1,*m)) {
-	*info = -5;
-    }
-    if (*info != 0) {
-	i__1 = -(*info);
-	_starpu_xerbla_("DORGL2", &i__1);
-	return 0;
-    }
-
-/*     Quick return if possible */
-
-    if (*m <= 0) {
-	return 0;
-    }
-
-    if (*k < *m) {
-
-/*        Initialise rows k+1:m to rows of the unit matrix */
-
-	i__1 = *n;
-	for (j = 1; j <= i__1; ++j) {
-	    i__2 = *m;
-	    for (l = *k + 1; l <= i__2; ++l) {
-		a[l + j * a_dim1] = 0.;
-/* L10: */
-	    }
-	    if (j > *k && j <= *m) {
-		a[j + j * a_dim1] = 1.;
-	    }
-/* L20: */
-	}
-    }
-
-    for (i__ = *k; i__ >= 1; --i__) {
-
-/*        Apply H(i) to A(i:m,i:n) from the right */
-
-	if (i__ < *n) {
-	    if (i__ < *m) {
-		a[i__ + i__ * a_dim1] = 1.;
-		i__1 = *m - i__;
-		i__2 = *n - i__ + 1;
-		_starpu_dlarf_("Right", &i__1, &i__2, &a[i__ + i__ * a_dim1], lda, &
-			tau[i__], &a[i__ + 1 + i__ * a_dim1], lda, &work[1]);
-	    }
-	    i__1 = *n - i__;
-	    d__1 = -tau[i__];
-	    _starpu_dscal_(&i__1, &d__1, &a[i__ + (i__ + 1) * a_dim1], lda);
-	}
-	a[i__ + i__ * a_dim1] = 1. - tau[i__];
-
-/*        Set A(i,1:i-1) to zero */
-
-	i__1 = i__ - 1;
-	for (l = 1; l <= i__1; ++l) {
-	    a[i__ + l * a_dim1] = 0.;
-/* L30: */
-	}
-/* L40: */
-    }
-    return 0;
-
-/*     End of DORGL2 */
-
-} /* _starpu_dorgl2_ */
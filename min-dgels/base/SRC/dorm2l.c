@@ -1,231 +0,0 @@
-/* dorm2l.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-/* Table of constant values */
-
-static integer c__1 = 1;
-
-/* Subroutine */ int _starpu_dorm2l_(char *side, char *trans, integer *m, integer *n, 
-	integer *k, doublereal *a, integer *lda, doublereal *tau, doublereal *
-	c__, integer *ldc, doublereal *work, integer *info)
-{
-    /* System generated locals */
-    integer a_dim1, a_offset, c_dim1, c_offset, i__1, i__2;
-
-    /* Local variables */
-    integer i__, i1, i2, i3, mi, ni, nq;
-    doublereal aii;
-    logical left;
-    extern /* Subroutine */ int _starpu_dlarf_(char *, integer *, integer *, 
-	    doublereal *, integer *, doublereal *, doublereal *, integer *, 
-	    doublereal *);
-    extern logical _starpu_lsame_(char *, char *);
-    extern /* Subroutine */ int _starpu_xerbla_(char *, integer *);
-    logical notran;
-
-
-/*  -- LAPACK routine (version 3.2) -- */
-/*     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd.. */
-/*     November 2006 */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  DORM2L overwrites the general real m by n matrix C with */
-
-/*        Q * C  if SIDE = 'L' and TRANS = 'N', or */
-
-/*        Q'* C  if SIDE = 'L' and TRANS = 'T', or */
-
-/*        C * Q  if SIDE = 'R' and TRANS = 'N', or */
-
-/*        C * Q' if SIDE = 'R' and TRANS = 'T', */
-
-/*  where Q is a real orthogonal matrix defined as the product of k */
-/*  elementary reflectors */
-
-/*        Q = H(k) . . . H(2) H(1) */
-
-/*  as returned by DGEQLF. Q is of order m if SIDE = 'L' and of order n */
-/*  if SIDE = 'R'. */
-
-/*  Arguments */
-/*  ========= */
-
-/*  SIDE    (input) CHARACTER*1 */
-/*          = 'L': apply Q or Q' from the Left */
-/*          = 'R': apply Q or Q' from the Right */
-
-/*  TRANS   (input) CHARACTER*1 */
-/*          = 'N': apply Q  (No transpose) */
-/*          = 'T': apply Q' (Transpose) */
-
-/*  M       (input) INTEGER */
-/*          The number of rows of the matrix C. M >= 0. */
-
-/*  N       (input) INTEGER */
-/*          The number of columns of the matrix C. N >= 0. */
-
-/*  K       (input) INTEGER */
-/*          The number of elementary reflectors whose product defines */
-/*          the matrix Q. */
-/*          If SIDE = 'L', M >= K >= 0; */
-/*          if SIDE = 'R', N >= K >= 0. */
-
-/*  A       (input) DOUBLE PRECISION array, dimension (LDA,K) */
-/*          The i-th column must contain the vector which defines the */
-/*          elementary reflector H(i), for i = 1,2,...,k, as returned by */
-/*          DGEQLF in the last k columns of its array argument A. */
-/*          A is modified by the routine but restored on exit. */
-
-/*  LDA     (input) INTEGER */
-/*          The leading dimension of the array A. */
-/*          If SIDE = 'L', LDA >= max(1,M); */
-/*          if SIDE = 'R', LDA >= max(1,N). */
-
-/*  TAU     (input) DOUBLE PRECISION array, dimension (K) */
-/*          TAU(i) must contain the scalar factor of the elementary */
-/*          reflector H(i), as returned by DGEQLF. */
-
-/*  C       (input/output) DOUBLE PRECISION array, dimension (LDC,N) */
-/*          On entry, the m by n matrix C. */
-/*          On exit, C is overwritten by Q*C or Q'*C or C*Q' or C*Q. */
-
-/*  LDC     (input) INTEGER */
-/*          The leading dimension of the array C. LDC >= max(1,M). */
-
-/*  WORK    (workspace) DOUBLE PRECISION array, dimension */
-/*                                   (N) if SIDE = 'L', */
-/*                                   (M) if SIDE = 'R' */
-
-/*  INFO    (output) INTEGER */
-/*          = 0: successful exit */
-/*          < 0: if INFO = -i, the i-th argument had an illegal value */
-
-/*  ===================================================================== */
-
-/*     .. Parameters .. */
-/*     .. */
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. External Functions .. */
-/*     .. */
-/*     .. External Subroutines .. */
-/*     .. */
-/*     .. Intrinsic Functions .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-/*     Test the input arguments */
-
-    /* Parameter adjustments */
-    a_dim1 = *lda;
-    a_offset = 1 + a_dim1;
-    a -= a_offset;
-    --tau;
-    c_dim1 = *ldc;
-    c_offset = 1 + c_dim1;
-    c__ -= c_offset;
-    --work;
-
-    /* Function Body */
-    *info = 0;
-    left = _starpu_lsame_(side, "L");
-    notran = _starpu_lsame_(trans, "N");
-
-/*     NQ is the order of Q */
-
-    if (left) {
-	nq = *m;
-    } else {
-	nq = *n;
-    }
-    if (! left && ! _starpu_lsame_(side, "R")) {
-	*info = -1;
-    } else if (! notran && ! _starpu_lsame_(trans, "T")) {
-	*info = -2;
-    } else if (*m < 0) {
-	*info = -3;
-    } else if (*n < 0) {
-	*info = -4;
-    } else if (*k < 0 || *k > nq) {
-	*info = -5;
-    } else if (*lda < max(1,nq)) {
-	*info = -7;
-    } else if (*ldc < max(1,*m)) {
-	*info = -10;
-    }
-    if (*info != 0) {
-	i__1 = -(*info);
-	_starpu_xerbla_("DORM2L", &i__1);
-	return 0;
-    }
-
-/*     Quick return if possible */
-
-    if (*m == 0 || *n == 0 || *k == 0) {
-	return 0;
-    }
-
-    if (left && notran || ! left && ! notran) {
-	i1 = 1;
-	i2 = *k;
-	i3 = 1;
-    } else {
-	i1 = *k;
-	i2 = 1;
-	i3 = -1;
-    }
-
-    if (left) {
-	ni = *n;
-    } else {
-	mi = *m;
-    }
-
-    i__1 = i2;
-    i__2 = i3;
-    for (i__ = i1; i__2 < 0 ? i__ >= i__1 : i__ <= i__1; i__ += i__2) {
-	if (left) {
-
-/*           H(i) is applied to C(1:m-k+i,1:n) */
-
-	    mi = *m - *k + i__;
-	} else {
-
-/*           H(i) is applied to C(1:m,1:n-k+i) */
-
-	    ni = *n - *k + i__;
-	}
-
-/*        Apply H(i) */
-
-	aii = a[nq - *k + i__ + i__ * a_dim1];
-	a[nq - *k + i__ + i__ * a_dim1] = 1.;
-	_starpu_dlarf_(side, &mi, &ni, &a[i__ * a_dim1 + 1], &c__1, &tau[i__], &c__[
-		c_offset], ldc, &work[1]);
-	a[nq - *k + i__ + i__ * a_dim1] = aii;
-/* L10: */
-    }
-    return 0;
-
-/*     End of DORM2L */
-
-} /* _starpu_dorm2l_ */
@@ -1,360 +0,0 @@
-/* dormbr.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-/* Table of constant values */
-
-static integer c__1 = 1;
-static integer c_n1 = -1;
-static integer c__2 = 2;
-
-/* Subroutine */ int _starpu_dormbr_(char *vect, char *side, char *trans, integer *m, 
-	integer *n, integer *k, doublereal *a, integer *lda, doublereal *tau, 
-	doublereal *c__, integer *ldc, doublereal *work, integer *lwork, 
-	integer *info)
-{
-    /* System generated locals */
-    address a__1[2];
-    integer a_dim1, a_offset, c_dim1, c_offset, i__1, i__2, i__3[2];
-    char ch__1[2];
-
-    /* Builtin functions */
-    /* Subroutine */ int s_cat(char *, char **, integer *, integer *, ftnlen);
-
-    /* Local variables */
-    integer i1, i2, nb, mi, ni, nq, nw;
-    logical left;
-    extern logical _starpu_lsame_(char *, char *);
-    integer iinfo;
-    extern /* Subroutine */ int _starpu_xerbla_(char *, integer *);
-    extern integer _starpu_ilaenv_(integer *, char *, char *, integer *, integer *, 
-	    integer *, integer *);
-    extern /* Subroutine */ int _starpu_dormlq_(char *, char *, integer *, integer *, 
-	    integer *, doublereal *, integer *, doublereal *, doublereal *, 
-	    integer *, doublereal *, integer *, integer *);
-    logical notran;
-    extern /* Subroutine */ int _starpu_dormqr_(char *, char *, integer *, integer *, 
-	    integer *, doublereal *, integer *, doublereal *, doublereal *, 
-	    integer *, doublereal *, integer *, integer *);
-    logical applyq;
-    char transt[1];
-    integer lwkopt;
-    logical lquery;
-
-
-/*  -- LAPACK routine (version 3.2) -- */
-/*     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd.. */
-/*     November 2006 */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  If VECT = 'Q', DORMBR overwrites the general real M-by-N matrix C */
-/*  with */
-/*                  SIDE = 'L'     SIDE = 'R' */
-/*  TRANS = 'N':      Q * C          C * Q */
-/*  TRANS = 'T':      Q**T * C       C * Q**T */
-
-/*  If VECT = 'P', DORMBR overwrites the general real M-by-N matrix C */
-/*  with */
-/*                  SIDE = 'L'     SIDE = 'R' */
-/*  TRANS = 'N':      P * C          C * P */
-/*  TRANS = 'T':      P**T * C       C * P**T */
-
-/*  Here Q and P**T are the orthogonal matrices determined by DGEBRD when */
-/*  reducing a real matrix A to bidiagonal form: A = Q * B * P**T. Q and */
-/*  P**T are defined as products of elementary reflectors H(i) and G(i) */
-/*  respectively. */
-
-/*  Let nq = m if SIDE = 'L' and nq = n if SIDE = 'R'. Thus nq is the */
-/*  order of the orthogonal matrix Q or P**T that is applied. */
-
-/*  If VECT = 'Q', A is assumed to have been an NQ-by-K matrix: */
-/*  if nq >= k, Q = H(1) H(2) . . . H(k); */
-/*  if nq < k, Q = H(1) H(2) . . . H(nq-1). */
-
-/*  If VECT = 'P', A is assumed to have been a K-by-NQ matrix: */
-/*  if k < nq, P = G(1) G(2) . . . G(k); */
-/*  if k >= nq, P = G(1) G(2) . . . G(nq-1). */
-
-/*  Arguments */
-/*  ========= */
-
-/*  VECT    (input) CHARACTER*1 */
-/*          = 'Q': apply Q or Q**T; */
-/*          = 'P': apply P or P**T. */
-
-/*  SIDE    (input) CHARACTER*1 */
-/*          = 'L': apply Q, Q**T, P or P**T from the Left; */
-/*          = 'R': apply Q, Q**T, P or P**T from the Right. */
-
-/*  TRANS   (input) CHARACTER*1 */
-/*          = 'N':  No transpose, apply Q  or P; */
-/*          = 'T':  Transpose, apply Q**T or P**T. */
-
-/*  M       (input) INTEGER */
-/*          The number of rows of the matrix C. M >= 0. */
-
-/*  N       (input) INTEGER */
-/*          The number of columns of the matrix C. N >= 0. */
-
-/*  K       (input) INTEGER */
-/*          If VECT = 'Q', the number of columns in the original */
-/*          matrix reduced by DGEBRD. */
-/*          If VECT = 'P', the number of rows in the original */
-/*          matrix reduced by DGEBRD. */
-/*          K >= 0. */
-
-/*  A       (input) DOUBLE PRECISION array, dimension */
-/*                                (LDA,min(nq,K)) if VECT = 'Q' */
-/*                                (LDA,nq)        if VECT = 'P' */
-/*          The vectors which define the elementary reflectors H(i) and */
-/*          G(i), whose products determine the matrices Q and P, as */
-/*          returned by DGEBRD. */
-
-/*  LDA     (input) INTEGER */
-/*          The leading dimension of the array A. */
-/*          If VECT = 'Q', LDA >= max(1,nq); */
-/*          if VECT = 'P', LDA >= max(1,min(nq,K)). */
-
-/*  TAU     (input) DOUBLE PRECISION array, dimension (min(nq,K)) */
-/*          TAU(i) must contain the scalar factor of the elementary */
-/*          reflector H(i) or G(i) which determines Q or P, as returned */
-/*          by DGEBRD in the array argument TAUQ or TAUP. */
-
-/*  C       (input/output) DOUBLE PRECISION array, dimension (LDC,N) */
-/*          On entry, the M-by-N matrix C. */
-/*          On exit, C is overwritten by Q*C or Q**T*C or C*Q**T or C*Q */
-/*          or P*C or P**T*C or C*P or C*P**T. */
-
-/*  LDC     (input) INTEGER */
-/*          The leading dimension of the array C. LDC >= max(1,M). */
-
-/*  WORK    (workspace/output) DOUBLE PRECISION array, dimension (MAX(1,LWORK)) */
-/*          On exit, if INFO = 0, WORK(1) returns the optimal LWORK. */
-
-/*  LWORK   (input) INTEGER */
-/*          The dimension of the array WORK. */
-/*          If SIDE = 'L', LWORK >= max(1,N); */
-/*          if SIDE = 'R', LWORK >= max(1,M). */
-/*          For optimum performance LWORK >= N*NB if SIDE = 'L', and */
-/*          LWORK >= M*NB if SIDE = 'R', where NB is the optimal */
-/*          blocksize. */
-
-/*          If LWORK = -1, then a workspace query is assumed; the routine */
-/*          only calculates the optimal size of the WORK array, returns */
-/*          this value as the first entry of the WORK array, and no error */
-/*          message related to LWORK is issued by XERBLA. */
-
-/*  INFO    (output) INTEGER */
-/*          = 0:  successful exit */
-/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
-
-/*  ===================================================================== */
-
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. External Functions .. */
-/*     .. */
-/*     .. External Subroutines .. */
-/*     .. */
-/*     .. Intrinsic Functions .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-/*     Test the input arguments */
-
-    /* Parameter adjustments */
-    a_dim1 = *lda;
-    a_offset = 1 + a_dim1;
-    a -= a_offset;
-    --tau;
-    c_dim1 = *ldc;
-    c_offset = 1 + c_dim1;
-    c__ -= c_offset;
-    --work;
-
-    /* Function Body */
-    *info = 0;
-    applyq = _starpu_lsame_(vect, "Q");
-    left = _starpu_lsame_(side, "L");
-    notran = _starpu_lsame_(trans, "N");
-    lquery = *lwork == -1;
-
-/*     NQ is the order of Q or P and NW is the minimum dimension of WORK */
-
-    if (left) {
-	nq = *m;
-	nw = *n;
-    } else {
-	nq = *n;
-	nw = *m;
-    }
-    if (! applyq && ! _starpu_lsame_(vect, "P")) {
-	*info = -1;
-    } else if (! left && ! _starpu_lsame_(side, "R")) {
-	*info = -2;
-    } else if (! notran && ! _starpu_lsame_(trans, "T")) {
-	*info = -3;
-    } else if (*m < 0) {
-	*info = -4;
-    } else if (*n < 0) {
-	*info = -5;
-    } else if (*k < 0) {
-	*info = -6;
-    } else /* if(complicated condition) */ {
-/* Computing MAX */
-	i__1 = 1, i__2 = min(nq,*k);
-	if (applyq && *lda < max(1,nq) || ! applyq && *lda < max(i__1,i__2)) {
-	    *info = -8;
-	} else if (*ldc < max(1,*m)) {
-	    *info = -11;
-	} else if (*lwork < max(1,nw) && ! lquery) {
-	    *info = -13;
-	}
-    }
-
-    if (*info == 0) {
-	if (applyq) {
-	    if (left) {
-/* Writing concatenation */
-		i__3[0] = 1, a__1[0] = side;
-		i__3[1] = 1, a__1[1] = trans;
-		s_cat(ch__1, a__1, i__3, &c__2, (ftnlen)2);
-		i__1 = *m - 1;
-		i__2 = *m - 1;
-		nb = _starpu_ilaenv_(&c__1, "DORMQR", ch__1, &i__1, n, &i__2, &c_n1);
-	    } else {
-/* Writing concatenation */
-		i__3[0] = 1, a__1[0] = side;
-		i__3[1] = 1, a__1[1] = trans;
-		s_cat(ch__1, a__1, i__3, &c__2, (ftnlen)2);
-		i__1 = *n - 1;
-		i__2 = *n - 1;
-		nb = _starpu_ilaenv_(&c__1, "DORMQR", ch__1, m, &i__1, &i__2, &c_n1);
-	    }
-	} else {
-	    if (left) {
-/* Writing concatenation */
-		i__3[0] = 1, a__1[0] = side;
-		i__3[1] = 1, a__1[1] = trans;
-		s_cat(ch__1, a__1, i__3, &c__2, (ftnlen)2);
-		i__1 = *m - 1;
-		i__2 = *m - 1;
-		nb = _starpu_ilaenv_(&c__1, "DORMLQ", ch__1, &i__1, n, &i__2, &c_n1);
-	    } else {
-/* Writing concatenation */
-		i__3[0] = 1, a__1[0] = side;
-		i__3[1] = 1, a__1[1] = trans;
-		s_cat(ch__1, a__1, i__3, &c__2, (ftnlen)2);
-		i__1 = *n - 1;
-		i__2 = *n - 1;
-		nb = _starpu_ilaenv_(&c__1, "DORMLQ", ch__1, m, &i__1, &i__2, &c_n1);
-	    }
-	}
-	lwkopt = max(1,nw) * nb;
-	work[1] = (doublereal) lwkopt;
-    }
-
-    if (*info != 0) {
-	i__1 = -(*info);
-	_starpu_xerbla_("DORMBR", &i__1);
-	return 0;
-    } else if (lquery) {
-	return 0;
-    }
-
-/*     Quick return if possible */
-
-    work[1] = 1.;
-    if (*m == 0 || *n == 0) {
-	return 0;
-    }
-
-    if (applyq) {
-
-/*        Apply Q */
-
-	if (nq >= *k) {
-
-/*           Q was determined by a call to DGEBRD with nq >= k */
-
-	    _starpu_dormqr_(side, trans, m, n, k, &a[a_offset], lda, &tau[1], &c__[
-		    c_offset], ldc, &work[1], lwork, &iinfo);
-	} else if (nq > 1) {
-
-/*           Q was determined by a call to DGEBRD with nq < k */
-
-	    if (left) {
-		mi = *m - 1;
-		ni = *n;
-		i1 = 2;
-		i2 = 1;
-	    } else {
-		mi = *m;
-		ni = *n - 1;
-		i1 = 1;
-		i2 = 2;
-	    }
-	    i__1 = nq - 1;
-	    _starpu_dormqr_(side, trans, &mi, &ni, &i__1, &a[a_dim1 + 2], lda, &tau[1]
-, &c__[i1 + i2 * c_dim1], ldc, &work[1], lwork, &iinfo);
-	}
-    } else {
-
-/*        Apply P */
-
-	if (notran) {
-	    *(unsigned char *)transt = 'T';
-	} else {
-	    *(unsigned char *)transt = 'N';
-	}
-	if (nq > *k) {
-
-/*           P was determined by a call to DGEBRD with nq > k */
-
-	    _starpu_dormlq_(side, transt, m, n, k, &a[a_offset], lda, &tau[1], &c__[
-		    c_offset], ldc, &work[1], lwork, &iinfo);
-	} else if (nq > 1) {
-
-/*           P was determined by a call to DGEBRD with nq <= k */
-
-	    if (left) {
-		mi = *m - 1;
-		ni = *n;
-		i1 = 2;
-		i2 = 1;
-	    } else {
-		mi = *m;
-		ni = *n - 1;
-		i1 = 1;
-		i2 = 2;
-	    }
-	    i__1 = nq - 1;
-	    _starpu_dormlq_(side, transt, &mi, &ni, &i__1, &a[(a_dim1 << 1) + 1], lda, 
-		     &tau[1], &c__[i1 + i2 * c_dim1], ldc, &work[1], lwork, &
-		    iinfo);
-	}
-    }
-    work[1] = (doublereal) lwkopt;
-    return 0;
-
-/*     End of DORMBR */
-
-} /* _starpu_dormbr_ */
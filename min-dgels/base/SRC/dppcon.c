@@ -1,215 +0,0 @@
-/* dppcon.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-/* Table of constant values */
-
-static integer c__1 = 1;
-
-/* Subroutine */ int _starpu_dppcon_(char *uplo, integer *n, doublereal *ap, 
-	doublereal *anorm, doublereal *rcond, doublereal *work, integer *
-	iwork, integer *info)
-{
-    /* System generated locals */
-    integer i__1;
-    doublereal d__1;
-
-    /* Local variables */
-    integer ix, kase;
-    doublereal scale;
-    extern logical _starpu_lsame_(char *, char *);
-    integer isave[3];
-    extern /* Subroutine */ int _starpu_drscl_(integer *, doublereal *, doublereal *, 
-	    integer *);
-    logical upper;
-    extern /* Subroutine */ int _starpu_dlacn2_(integer *, doublereal *, doublereal *, 
-	     integer *, doublereal *, integer *, integer *);
-    extern doublereal _starpu_dlamch_(char *);
-    doublereal scalel;
-    extern integer _starpu_idamax_(integer *, doublereal *, integer *);
-    doublereal scaleu;
-    extern /* Subroutine */ int _starpu_xerbla_(char *, integer *), _starpu_dlatps_(
-	    char *, char *, char *, char *, integer *, doublereal *, 
-	    doublereal *, doublereal *, doublereal *, integer *);
-    doublereal ainvnm;
-    char normin[1];
-    doublereal smlnum;
-
-
-/*  -- LAPACK routine (version 3.2) -- */
-/*     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd.. */
-/*     November 2006 */
-
-/*     Modified to call DLACN2 in place of DLACON, 5 Feb 03, SJH. */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  DPPCON estimates the reciprocal of the condition number (in the */
-/*  1-norm) of a real symmetric positive definite packed matrix using */
-/*  the Cholesky factorization A = U**T*U or A = L*L**T computed by */
-/*  DPPTRF. */
-
-/*  An estimate is obtained for norm(inv(A)), and the reciprocal of the */
-/*  condition number is computed as RCOND = 1 / (ANORM * norm(inv(A))). */
-
-/*  Arguments */
-/*  ========= */
-
-/*  UPLO    (input) CHARACTER*1 */
-/*          = 'U':  Upper triangle of A is stored; */
-/*          = 'L':  Lower triangle of A is stored. */
-
-/*  N       (input) INTEGER */
-/*          The order of the matrix A.  N >= 0. */
-
-/*  AP      (input) DOUBLE PRECISION array, dimension (N*(N+1)/2) */
-/*          The triangular factor U or L from the Cholesky factorization */
-/*          A = U**T*U or A = L*L**T, packed columnwise in a linear */
-/*          array.  The j-th column of U or L is stored in the array AP */
-/*          as follows: */
-/*          if UPLO = 'U', AP(i + (j-1)*j/2) = U(i,j) for 1<=i<=j; */
-/*          if UPLO = 'L', AP(i + (j-1)*(2n-j)/2) = L(i,j) for j<=i<=n. */
-
-/*  ANORM   (input) DOUBLE PRECISION */
-/*          The 1-norm (or infinity-norm) of the symmetric matrix A. */
-
-/*  RCOND   (output) DOUBLE PRECISION */
-/*          The reciprocal of the condition number of the matrix A, */
-/*          computed as RCOND = 1/(ANORM * AINVNM), where AINVNM is an */
-/*          estimate of the 1-norm of inv(A) computed in this routine. */
-
-/*  WORK    (workspace) DOUBLE PRECISION array, dimension (3*N) */
-
-/*  IWORK   (workspace) INTEGER array, dimension (N) */
-
-/*  INFO    (output) INTEGER */
-/*          = 0:  successful exit */
-/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
-
-/*  ===================================================================== */
-
-/*     .. Parameters .. */
-/*     .. */
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. Local Arrays .. */
-/*     .. */
-/*     .. External Functions .. */
-/*     .. */
-/*     .. External Subroutines .. */
-/*     .. */
-/*     .. Intrinsic Functions .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-/*     Test the input parameters. */
-
-    /* Parameter adjustments */
-    --iwork;
-    --work;
-    --ap;
-
-    /* Function Body */
-    *info = 0;
-    upper = _starpu_lsame_(uplo, "U");
-    if (! upper && ! _starpu_lsame_(uplo, "L")) {
-	*info = -1;
-    } else if (*n < 0) {
-	*info = -2;
-    } else if (*anorm < 0.) {
-	*info = -4;
-    }
-    if (*info != 0) {
-	i__1 = -(*info);
-	_starpu_xerbla_("DPPCON", &i__1);
-	return 0;
-    }
-
-/*     Quick return if possible */
-
-    *rcond = 0.;
-    if (*n == 0) {
-	*rcond = 1.;
-	return 0;
-    } else if (*anorm == 0.) {
-	return 0;
-    }
-
-    smlnum = _starpu_dlamch_("Safe minimum");
-
-/*     Estimate the 1-norm of the inverse. */
-
-    kase = 0;
-    *(unsigned char *)normin = 'N';
-L10:
-    _starpu_dlacn2_(n, &work[*n + 1], &work[1], &iwork[1], &ainvnm, &kase, isave);
-    if (kase != 0) {
-	if (upper) {
-
-/*           Multiply by inv(U'). */
-
-	    _starpu_dlatps_("Upper", "Transpose", "Non-unit", normin, n, &ap[1], &
-		    work[1], &scalel, &work[(*n << 1) + 1], info);
-	    *(unsigned char *)normin = 'Y';
-
-/*           Multiply by inv(U). */
-
-	    _starpu_dlatps_("Upper", "No transpose", "Non-unit", normin, n, &ap[1], &
-		    work[1], &scaleu, &work[(*n << 1) + 1], info);
-	} else {
-
-/*           Multiply by inv(L). */
-
-	    _starpu_dlatps_("Lower", "No transpose", "Non-unit", normin, n, &ap[1], &
-		    work[1], &scalel, &work[(*n << 1) + 1], info);
-	    *(unsigned char *)normin = 'Y';
-
-/*           Multiply by inv(L'). */
-
-	    _starpu_dlatps_("Lower", "Transpose", "Non-unit", normin, n, &ap[1], &
-		    work[1], &scaleu, &work[(*n << 1) + 1], info);
-	}
-
-/*        Multiply by 1/SCALE if doing so will not cause overflow. */
-
-	scale = scalel * scaleu;
-	if (scale != 1.) {
-	    ix = _starpu_idamax_(n, &work[1], &c__1);
-	    if (scale < (d__1 = work[ix], abs(d__1)) * smlnum || scale == 0.) 
-		    {
-		goto L20;
-	    }
-	    _starpu_drscl_(n, &scale, &work[1], &c__1);
-	}
-	goto L10;
-    }
-
-/*     Compute the estimate of the reciprocal condition number. */
-
-    if (ainvnm != 0.) {
-	*rcond = 1. / ainvnm / *anorm;
-    }
-
-L20:
-    return 0;
-
-/*     End of DPPCON */
-
-} /* _starpu_dppcon_ */
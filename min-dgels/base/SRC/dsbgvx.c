@@ -1,466 +0,0 @@
-/* dsbgvx.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-/* Table of constant values */
-
-static integer c__1 = 1;
-static doublereal c_b25 = 1.;
-static doublereal c_b27 = 0.;
-
-/* Subroutine */ int _starpu_dsbgvx_(char *jobz, char *range, char *uplo, integer *n, 
-	integer *ka, integer *kb, doublereal *ab, integer *ldab, doublereal *
-	bb, integer *ldbb, doublereal *q, integer *ldq, doublereal *vl, 
-	doublereal *vu, integer *il, integer *iu, doublereal *abstol, integer 
-	*m, doublereal *w, doublereal *z__, integer *ldz, doublereal *work, 
-	integer *iwork, integer *ifail, integer *info)
-{
-    /* System generated locals */
-    integer ab_dim1, ab_offset, bb_dim1, bb_offset, q_dim1, q_offset, z_dim1, 
-	    z_offset, i__1, i__2;
-
-    /* Local variables */
-    integer i__, j, jj;
-    doublereal tmp1;
-    integer indd, inde;
-    char vect[1];
-    logical test;
-    integer itmp1, indee;
-    extern logical _starpu_lsame_(char *, char *);
-    extern /* Subroutine */ int _starpu_dgemv_(char *, integer *, integer *, 
-	    doublereal *, doublereal *, integer *, doublereal *, integer *, 
-	    doublereal *, doublereal *, integer *);
-    integer iinfo;
-    char order[1];
-    extern /* Subroutine */ int _starpu_dcopy_(integer *, doublereal *, integer *, 
-	    doublereal *, integer *), _starpu_dswap_(integer *, doublereal *, integer 
-	    *, doublereal *, integer *);
-    logical upper, wantz, alleig, indeig;
-    integer indibl;
-    logical valeig;
-    extern /* Subroutine */ int _starpu_dlacpy_(char *, integer *, integer *, 
-	    doublereal *, integer *, doublereal *, integer *), 
-	    _starpu_xerbla_(char *, integer *), _starpu_dpbstf_(char *, integer *, 
-	    integer *, doublereal *, integer *, integer *), _starpu_dsbtrd_(
-	    char *, char *, integer *, integer *, doublereal *, integer *, 
-	    doublereal *, doublereal *, doublereal *, integer *, doublereal *, 
-	     integer *);
-    integer indisp;
-    extern /* Subroutine */ int _starpu_dsbgst_(char *, char *, integer *, integer *, 
-	    integer *, doublereal *, integer *, doublereal *, integer *, 
-	    doublereal *, integer *, doublereal *, integer *),
-	     _starpu_dstein_(integer *, doublereal *, doublereal *, integer *, 
-	    doublereal *, integer *, integer *, doublereal *, integer *, 
-	    doublereal *, integer *, integer *, integer *);
-    integer indiwo;
-    extern /* Subroutine */ int _starpu_dsterf_(integer *, doublereal *, doublereal *, 
-	     integer *), _starpu_dstebz_(char *, char *, integer *, doublereal *, 
-	    doublereal *, integer *, integer *, doublereal *, doublereal *, 
-	    doublereal *, integer *, integer *, doublereal *, integer *, 
-	    integer *, doublereal *, integer *, integer *);
-    integer indwrk;
-    extern /* Subroutine */ int _starpu_dsteqr_(char *, integer *, doublereal *, 
-	    doublereal *, doublereal *, integer *, doublereal *, integer *);
-    integer nsplit;
-
-
-/*  -- LAPACK driver routine (version 3.2) -- */
-/*     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd.. */
-/*     November 2006 */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  DSBGVX computes selected eigenvalues, and optionally, eigenvectors */
-/*  of a real generalized symmetric-definite banded eigenproblem, of */
-/*  the form A*x=(lambda)*B*x.  Here A and B are assumed to be symmetric */
-/*  and banded, and B is also positive definite.  Eigenvalues and */
-/*  eigenvectors can be selected by specifying either all eigenvalues, */
-/*  a range of values or a range of indices for the desired eigenvalues. */
-
-/*  Arguments */
-/*  ========= */
-
-/*  JOBZ    (input) CHARACTER*1 */
-/*          = 'N':  Compute eigenvalues only; */
-/*          = 'V':  Compute eigenvalues and eigenvectors. */
-
-/*  RANGE   (input) CHARACTER*1 */
-/*          = 'A': all eigenvalues will be found. */
-/*          = 'V': all eigenvalues in the half-open interval (VL,VU] */
-/*                 will be found. */
-/*          = 'I': the IL-th through IU-th eigenvalues will be found. */
-
-/*  UPLO    (input) CHARACTER*1 */
-/*          = 'U':  Upper triangles of A and B are stored; */
-/*          = 'L':  Lower triangles of A and B are stored. */
-
-/*  N       (input) INTEGER */
-/*          The order of the matrices A and B.  N >= 0. */
-
-/*  KA      (input) INTEGER */
-/*          The number of superdiagonals of the matrix A if UPLO = 'U', */
-/*          or the number of subdiagonals if UPLO = 'L'.  KA >= 0. */
-
-/*  KB      (input) INTEGER */
-/*          The number of superdiagonals of the matrix B if UPLO = 'U', */
-/*          or the number of subdiagonals if UPLO = 'L'.  KB >= 0. */
-
-/*  AB      (input/output) DOUBLE PRECISION array, dimension (LDAB, N) */
-/*          On entry, the upper or lower triangle of the symmetric band */
-/*          matrix A, stored in the first ka+1 rows of the array.  The */
-/*          j-th column of A is stored in the j-th column of the array AB */
-/*          as follows: */
-/*          if UPLO = 'U', AB(ka+1+i-j,j) = A(i,j) for max(1,j-ka)<=i<=j; */
-/*          if UPLO = 'L', AB(1+i-j,j)    = A(i,j) for j<=i<=min(n,j+ka). */
-
-/*          On exit, the contents of AB are destroyed. */
-
-/*  LDAB    (input) INTEGER */
-/*          The leading dimension of the array AB.  LDAB >= KA+1. */
-
-/*  BB      (input/output) DOUBLE PRECISION array, dimension (LDBB, N) */
-/*          On entry, the upper or lower triangle of the symmetric band */
-/*          matrix B, stored in the first kb+1 rows of the array.  The */
-/*          j-th column of B is stored in the j-th column of the array BB */
-/*          as follows: */
-/*          if UPLO = 'U', BB(ka+1+i-j,j) = B(i,j) for max(1,j-kb)<=i<=j; */
-/*          if UPLO = 'L', BB(1+i-j,j)    = B(i,j) for j<=i<=min(n,j+kb). */
-
-/*          On exit, the factor S from the split Cholesky factorization */
-/*          B = S**T*S, as returned by DPBSTF. */
-
-/*  LDBB    (input) INTEGER */
-/*          The leading dimension of the array BB.  LDBB >= KB+1. */
-
-/*  Q       (output) DOUBLE PRECISION array, dimension (LDQ, N) */
-/*          If JOBZ = 'V', the n-by-n matrix used in the reduction of */
-/*          A*x = (lambda)*B*x to standard form, i.e. C*x = (lambda)*x, */
-/*          and consequently C to tridiagonal form. */
-/*          If JOBZ = 'N', the array Q is not referenced. */
-
-/*  LDQ     (input) INTEGER */
-/*          The leading dimension of the array Q.  If JOBZ = 'N', */
-/*          LDQ >= 1. If JOBZ = 'V', LDQ >= max(1,N). */
-
-/*  VL      (input) DOUBLE PRECISION */
-/*  VU      (input) DOUBLE PRECISION */
-/*          If RANGE='V', the lower and upper bounds of the interval to */
-/*          be searched for eigenvalues. VL < VU. */
-/*          Not referenced if RANGE = 'A' or 'I'. */
-
-/*  IL      (input) INTEGER */
-/*  IU      (input) INTEGER */
-/*          If RANGE='I', the indices (in ascending order) of the */
-/*          smallest and largest eigenvalues to be returned. */
-/*          1 <= IL <= IU <= N, if N > 0; IL = 1 and IU = 0 if N = 0. */
-/*          Not referenced if RANGE = 'A' or 'V'. */
-
-/*  ABSTOL  (input) DOUBLE PRECISION */
-/*          The absolute error tolerance for the eigenvalues. */
-/*          An approximate eigenvalue is accepted as converged */
-/*          when it is determined to lie in an interval [a,b] */
-/*          of width less than or equal to */
-
-/*                  ABSTOL + EPS *   max( |a|,|b| ) , */
-
-/*          where EPS is the machine precision.  If ABSTOL is less than */
-/*          or equal to zero, then  EPS*|T|  will be used in its place, */
-/*          where |T| is the 1-norm of the tridiagonal matrix obtained */
-/*          by reducing A to tridiagonal form. */
-
-/*          Eigenvalues will be computed most accurately when ABSTOL is */
-/*          set to twice the underflow threshold 2*DLAMCH('S'), not zero. */
-/*          If this routine returns with INFO>0, indicating that some */
-/*          eigenvectors did not converge, try setting ABSTOL to */
-/*          2*DLAMCH('S'). */
-
-/*  M       (output) INTEGER */
-/*          The total number of eigenvalues found.  0 <= M <= N. */
-/*          If RANGE = 'A', M = N, and if RANGE = 'I', M = IU-IL+1. */
-
-/*  W       (output) DOUBLE PRECISION array, dimension (N) */
-/*          If INFO = 0, the eigenvalues in ascending order. */
-
-/*  Z       (output) DOUBLE PRECISION array, dimension (LDZ, N) */
-/*          If JOBZ = 'V', then if INFO = 0, Z contains the matrix Z of */
-/*          eigenvectors, with the i-th column of Z holding the */
-/*          eigenvector associated with W(i).  The eigenvectors are */
-/*          normalized so Z**T*B*Z = I. */
-/*          If JOBZ = 'N', then Z is not referenced. */
-
-/*  LDZ     (input) INTEGER */
-/*          The leading dimension of the array Z.  LDZ >= 1, and if */
-/*          JOBZ = 'V', LDZ >= max(1,N). */
-
-/*  WORK    (workspace/output) DOUBLE PRECISION array, dimension (7*N) */
-
-/*  IWORK   (workspace/output) INTEGER array, dimension (5*N) */
-
-/*  IFAIL   (output) INTEGER array, dimension (M) */
-/*          If JOBZ = 'V', then if INFO = 0, the first M elements of */
-/*          IFAIL are zero.  If INFO > 0, then IFAIL contains the */
-/*          indices of the eigenvalues that failed to converge. */
-/*          If JOBZ = 'N', then IFAIL is not referenced. */
-
-/*  INFO    (output) INTEGER */
-/*          = 0 : successful exit */
-/*          < 0 : if INFO = -i, the i-th argument had an illegal value */
-/*          <= N: if INFO = i, then i eigenvectors failed to converge. */
-/*                  Their indices are stored in IFAIL. */
-/*          > N : DPBSTF returned an error code; i.e., */
-/*                if INFO = N + i, for 1 <= i <= N, then the leading */
-/*                minor of order i of B is not positive definite. */
-/*                The factorization of B could not be completed and */
-/*                no eigenvalues or eigenvectors were computed. */
-
-/*  Further Details */
-/*  =============== */
-
-/*  Based on contributions by */
-/*     Mark Fahey, Department of Mathematics, Univ. of Kentucky, USA */
-
-/*  ===================================================================== */
-
-/*     .. Parameters .. */
-/*     .. */
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. External Functions .. */
-/*     .. */
-/*     .. External Subroutines .. */
-/*     .. */
-/*     .. Intrinsic Functions .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-/*     Test the input parameters. */
-
-    /* Parameter adjustments */
-    ab_dim1 = *ldab;
-    ab_offset = 1 + ab_dim1;
-    ab -= ab_offset;
-    bb_dim1 = *ldbb;
-    bb_offset = 1 + bb_dim1;
-    bb -= bb_offset;
-    q_dim1 = *ldq;
-    q_offset = 1 + q_dim1;
-    q -= q_offset;
-    --w;
-    z_dim1 = *ldz;
-    z_offset = 1 + z_dim1;
-    z__ -= z_offset;
-    --work;
-    --iwork;
-    --ifail;
-
-    /* Function Body */
-    wantz = _starpu_lsame_(jobz, "V");
-    upper = _starpu_lsame_(uplo, "U");
-    alleig = _starpu_lsame_(range, "A");
-    valeig = _starpu_lsame_(range, "V");
-    indeig = _starpu_lsame_(range, "I");
-
-    *info = 0;
-    if (! (wantz || _starpu_lsame_(jobz, "N"))) {
-	*info = -1;
-    } else if (! (alleig || valeig || indeig)) {
-	*info = -2;
-    } else if (! (upper || _starpu_lsame_(uplo, "L"))) {
-	*info = -3;
-    } else if (*n < 0) {
-	*info = -4;
-    } else if (*ka < 0) {
-	*info = -5;
-    } else if (*kb < 0 || *kb > *ka) {
-	*info = -6;
-    } else if (*ldab < *ka + 1) {
-	*info = -8;
-    } else if (*ldbb < *kb + 1) {
-	*info = -10;
-    } else if (*ldq < 1 || wantz && *ldq < *n) {
-	*info = -12;
-    } else {
-	if (valeig) {
-	    if (*n > 0 && *vu <= *vl) {
-		*info = -14;
-	    }
-	} else if (indeig) {
-	    if (*il < 1 || *il > max(1,*n)) {
-		*info = -15;
-	    } else if (*iu < min(*n,*il) || *iu > *n) {
-		*info = -16;
-	    }
-	}
-    }
-    if (*info == 0) {
-	if (*ldz < 1 || wantz && *ldz < *n) {
-	    *info = -21;
-	}
-    }
-
-    if (*info != 0) {
-	i__1 = -(*info);
-	_starpu_xerbla_("DSBGVX", &i__1);
-	return 0;
-    }
-
-/*     Quick return if possible */
-
-    *m = 0;
-    if (*n == 0) {
-	return 0;
-    }
-
-/*     Form a split Cholesky factorization of B. */
-
-    _starpu_dpbstf_(uplo, n, kb, &bb[bb_offset], ldbb, info);
-    if (*info != 0) {
-	*info = *n + *info;
-	return 0;
-    }
-
-/*     Transform problem to standard eigenvalue problem. */
-
-    _starpu_dsbgst_(jobz, uplo, n, ka, kb, &ab[ab_offset], ldab, &bb[bb_offset], ldbb, 
-	     &q[q_offset], ldq, &work[1], &iinfo);
-
-/*     Reduce symmetric band matrix to tridiagonal form. */
-
-    indd = 1;
-    inde = indd + *n;
-    indwrk = inde + *n;
-    if (wantz) {
-	*(unsigned char *)vect = 'U';
-    } else {
-	*(unsigned char *)vect = 'N';
-    }
-    _starpu_dsbtrd_(vect, uplo, n, ka, &ab[ab_offset], ldab, &work[indd], &work[inde], 
-	     &q[q_offset], ldq, &work[indwrk], &iinfo);
-
-/*     If all eigenvalues are desired and ABSTOL is less than or equal */
-/*     to zero, then call DSTERF or SSTEQR.  If this fails for some */
-/*     eigenvalue, then try DSTEBZ. */
-
-    test = FALSE_;
-    if (indeig) {
-	if (*il == 1 && *iu == *n) {
-	    test = TRUE_;
-	}
-    }
-    if ((alleig || test) && *abstol <= 0.) {
-	_starpu_dcopy_(n, &work[indd], &c__1, &w[1], &c__1);
-	indee = indwrk + (*n << 1);
-	i__1 = *n - 1;
-	_starpu_dcopy_(&i__1, &work[inde], &c__1, &work[indee], &c__1);
-	if (! wantz) {
-	    _starpu_dsterf_(n, &w[1], &work[indee], info);
-	} else {
-	    _starpu_dlacpy_("A", n, n, &q[q_offset], ldq, &z__[z_offset], ldz);
-	    _starpu_dsteqr_(jobz, n, &w[1], &work[indee], &z__[z_offset], ldz, &work[
-		    indwrk], info);
-	    if (*info == 0) {
-		i__1 = *n;
-		for (i__ = 1; i__ <= i__1; ++i__) {
-		    ifail[i__] = 0;
-/* L10: */
-		}
-	    }
-	}
-	if (*info == 0) {
-	    *m = *n;
-	    goto L30;
-	}
-	*info = 0;
-    }
-
-/*     Otherwise, call DSTEBZ and, if eigenvectors are desired, */
-/*     call DSTEIN. */
-
-    if (wantz) {
-	*(unsigned char *)order = 'B';
-    } else {
-	*(unsigned char *)order = 'E';
-    }
-    indibl = 1;
-    indisp = indibl + *n;
-    indiwo = indisp + *n;
-    _starpu_dstebz_(range, order, n, vl, vu, il, iu, abstol, &work[indd], &work[inde], 
-	     m, &nsplit, &w[1], &iwork[indibl], &iwork[indisp], &work[indwrk], 
-	     &iwork[indiwo], info);
-
-    if (wantz) {
-	_starpu_dstein_(n, &work[indd], &work[inde], m, &w[1], &iwork[indibl], &iwork[
-		indisp], &z__[z_offset], ldz, &work[indwrk], &iwork[indiwo], &
-		ifail[1], info);
-
-/*        Apply transformation matrix used in reduction to tridiagonal */
-/*        form to eigenvectors returned by DSTEIN. */
-
-	i__1 = *m;
-	for (j = 1; j <= i__1; ++j) {
-	    _starpu_dcopy_(n, &z__[j * z_dim1 + 1], &c__1, &work[1], &c__1);
-	    _starpu_dgemv_("N", n, n, &c_b25, &q[q_offset], ldq, &work[1], &c__1, &
-		    c_b27, &z__[j * z_dim1 + 1], &c__1);
-/* L20: */
-	}
-    }
-
-L30:
-
-/*     If eigenvalues are not in order, then sort them, along with */
-/*     eigenvectors. */
-
-    if (wantz) {
-	i__1 = *m - 1;
-	for (j = 1; j <= i__1; ++j) {
-	    i__ = 0;
-	    tmp1 = w[j];
-	    i__2 = *m;
-	    for (jj = j + 1; jj <= i__2; ++jj) {
-		if (w[jj] < tmp1) {
-		    i__ = jj;
-		    tmp1 = w[jj];
-		}
-/* L40: */
-	    }
-
-	    if (i__ != 0) {
-		itmp1 = iwork[indibl + i__ - 1];
-		w[i__] = w[j];
-		iwork[indibl + i__ - 1] = iwork[indibl + j - 1];
-		w[j] = tmp1;
-		iwork[indibl + j - 1] = itmp1;
-		_starpu_dswap_(n, &z__[i__ * z_dim1 + 1], &c__1, &z__[j * z_dim1 + 1], 
-			 &c__1);
-		if (*info != 0) {
-		    itmp1 = ifail[i__];
-		    ifail[i__] = ifail[j];
-		    ifail[j] = itmp1;
-		}
-	    }
-/* L50: */
-	}
-    }
-
-    return 0;
-
-/*     End of DSBGVX */
-
-} /* _starpu_dsbgvx_ */
@@ -1,314 +0,0 @@
-/* dspevd.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-/* Table of constant values */
-
-static integer c__1 = 1;
-
-/* Subroutine */ int _starpu_dspevd_(char *jobz, char *uplo, integer *n, doublereal *
-	ap, doublereal *w, doublereal *z__, integer *ldz, doublereal *work, 
-	integer *lwork, integer *iwork, integer *liwork, integer *info)
-{
-    /* System generated locals */
-    integer z_dim1, z_offset, i__1;
-    doublereal d__1;
-
-    /* Builtin functions */
-    double sqrt(doublereal);
-
-    /* Local variables */
-    doublereal eps;
-    integer inde;
-    doublereal anrm, rmin, rmax;
-    extern /* Subroutine */ int _starpu_dscal_(integer *, doublereal *, doublereal *, 
-	    integer *);
-    doublereal sigma;
-    extern logical _starpu_lsame_(char *, char *);
-    integer iinfo, lwmin;
-    logical wantz;
-    extern doublereal _starpu_dlamch_(char *);
-    integer iscale;
-    extern /* Subroutine */ int _starpu_dstedc_(char *, integer *, doublereal *, 
-	    doublereal *, doublereal *, integer *, doublereal *, integer *, 
-	    integer *, integer *, integer *);
-    doublereal safmin;
-    extern /* Subroutine */ int _starpu_xerbla_(char *, integer *);
-    doublereal bignum;
-    extern doublereal _starpu_dlansp_(char *, char *, integer *, doublereal *, 
-	    doublereal *);
-    integer indtau;
-    extern /* Subroutine */ int _starpu_dsterf_(integer *, doublereal *, doublereal *, 
-	     integer *);
-    integer indwrk, liwmin;
-    extern /* Subroutine */ int _starpu_dsptrd_(char *, integer *, doublereal *, 
-	    doublereal *, doublereal *, doublereal *, integer *), 
-	    _starpu_dopmtr_(char *, char *, char *, integer *, integer *, doublereal *
-, doublereal *, doublereal *, integer *, doublereal *, integer *);
-    integer llwork;
-    doublereal smlnum;
-    logical lquery;
-
-
-/*  -- LAPACK driver routine (version 3.2) -- */
-/*     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd.. */
-/*     November 2006 */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  DSPEVD computes all the eigenvalues and, optionally, eigenvectors */
-/*  of a real symmetric matrix A in packed storage. If eigenvectors are */
-/*  desired, it uses a divide and conquer algorithm. */
-
-/*  The divide and conquer algorithm makes very mild assumptions about */
-/*  floating point arithmetic. It will work on machines with a guard */
-/*  digit in add/subtract, or on those binary machines without guard */
-/*  digits which subtract like the Cray X-MP, Cray Y-MP, Cray C-90, or */
-/*  Cray-2. It could conceivably fail on hexadecimal or decimal machines */
-/*  without guard digits, but we know of none. */
-
-/*  Arguments */
-/*  ========= */
-
-/*  JOBZ    (input) CHARACTER*1 */
-/*          = 'N':  Compute eigenvalues only; */
-/*          = 'V':  Compute eigenvalues and eigenvectors. */
-
-/*  UPLO    (input) CHARACTER*1 */
-/*          = 'U':  Upper triangle of A is stored; */
-/*          = 'L':  Lower triangle of A is stored. */
-
-/*  N       (input) INTEGER */
-/*          The order of the matrix A.  N >= 0. */
-
-/*  AP      (input/output) DOUBLE PRECISION array, dimension (N*(N+1)/2) */
-/*          On entry, the upper or lower triangle of the symmetric matrix */
-/*          A, packed columnwise in a linear array.  The j-th column of A */
-/*          is stored in the array AP as follows: */
-/*          if UPLO = 'U', AP(i + (j-1)*j/2) = A(i,j) for 1<=i<=j; */
-/*          if UPLO = 'L', AP(i + (j-1)*(2*n-j)/2) = A(i,j) for j<=i<=n. */
-
-/*          On exit, AP is overwritten by values generated during the */
-/*          reduction to tridiagonal form.  If UPLO = 'U', the diagonal */
-/*          and first superdiagonal of the tridiagonal matrix T overwrite */
-/*          the corresponding elements of A, and if UPLO = 'L', the */
-/*          diagonal and first subdiagonal of T overwrite the */
-/*          corresponding elements of A. */
-
-/*  W       (output) DOUBLE PRECISION array, dimension (N) */
-/*          If INFO = 0, the eigenvalues in ascending order. */
-
-/*  Z       (output) DOUBLE PRECISION array, dimension (LDZ, N) */
-/*          If JOBZ = 'V', then if INFO = 0, Z contains the orthonormal */
-/*          eigenvectors of the matrix A, with the i-th column of Z */
-/*          holding the eigenvector associated with W(i). */
-/*          If JOBZ = 'N', then Z is not referenced. */
-
-/*  LDZ     (input) INTEGER */
-/*          The leading dimension of the array Z.  LDZ >= 1, and if */
-/*          JOBZ = 'V', LDZ >= max(1,N). */
-
-/*  WORK    (workspace/output) DOUBLE PRECISION array, */
-/*                                         dimension (LWORK) */
-/*          On exit, if INFO = 0, WORK(1) returns the required LWORK. */
-
-/*  LWORK   (input) INTEGER */
-/*          The dimension of the array WORK. */
-/*          If N <= 1,               LWORK must be at least 1. */
-/*          If JOBZ = 'N' and N > 1, LWORK must be at least 2*N. */
-/*          If JOBZ = 'V' and N > 1, LWORK must be at least */
-/*                                                 1 + 6*N + N**2. */
-
-/*          If LWORK = -1, then a workspace query is assumed; the routine */
-/*          only calculates the required sizes of the WORK and IWORK */
-/*          arrays, returns these values as the first entries of the WORK */
-/*          and IWORK arrays, and no error message related to LWORK or */
-/*          LIWORK is issued by XERBLA. */
-
-/*  IWORK   (workspace/output) INTEGER array, dimension (MAX(1,LIWORK)) */
-/*          On exit, if INFO = 0, IWORK(1) returns the required LIWORK. */
-
-/*  LIWORK  (input) INTEGER */
-/*          The dimension of the array IWORK. */
-/*          If JOBZ  = 'N' or N <= 1, LIWORK must be at least 1. */
-/*          If JOBZ  = 'V' and N > 1, LIWORK must be at least 3 + 5*N. */
-
-/*          If LIWORK = -1, then a workspace query is assumed; the */
-/*          routine only calculates the required sizes of the WORK and */
-/*          IWORK arrays, returns these values as the first entries of */
-/*          the WORK and IWORK arrays, and no error message related to */
-/*          LWORK or LIWORK is issued by XERBLA. */
-
-/*  INFO    (output) INTEGER */
-/*          = 0:  successful exit */
-/*          < 0:  if INFO = -i, the i-th argument had an illegal value. */
-/*          > 0:  if INFO = i, the algorithm failed to converge; i */
-/*                off-diagonal elements of an intermediate tridiagonal */
-/*                form did not converge to zero. */
-
-/*  ===================================================================== */
-
-/*     .. Parameters .. */
-/*     .. */
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. External Functions .. */
-/*     .. */
-/*     .. External Subroutines .. */
-/*     .. */
-/*     .. Intrinsic Functions .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-/*     Test the input parameters. */
-
-    /* Parameter adjustments */
-    --ap;
-    --w;
-    z_dim1 = *ldz;
-    z_offset = 1 + z_dim1;
-    z__ -= z_offset;
-    --work;
-    --iwork;
-
-    /* Function Body */
-    wantz = _starpu_lsame_(jobz, "V");
-    lquery = *lwork == -1 || *liwork == -1;
-
-    *info = 0;
-    if (! (wantz || _starpu_lsame_(jobz, "N"))) {
-	*info = -1;
-    } else if (! (_starpu_lsame_(uplo, "U") || _starpu_lsame_(uplo, 
-	    "L"))) {
-	*info = -2;
-    } else if (*n < 0) {
-	*info = -3;
-    } else if (*ldz < 1 || wantz && *ldz < *n) {
-	*info = -7;
-    }
-
-    if (*info == 0) {
-	if (*n <= 1) {
-	    liwmin = 1;
-	    lwmin = 1;
-	} else {
-	    if (wantz) {
-		liwmin = *n * 5 + 3;
-/* Computing 2nd power */
-		i__1 = *n;
-		lwmin = *n * 6 + 1 + i__1 * i__1;
-	    } else {
-		liwmin = 1;
-		lwmin = *n << 1;
-	    }
-	}
-	iwork[1] = liwmin;
-	work[1] = (doublereal) lwmin;
-
-	if (*lwork < lwmin && ! lquery) {
-	    *info = -9;
-	} else if (*liwork < liwmin && ! lquery) {
-	    *info = -11;
-	}
-    }
-
-    if (*info != 0) {
-	i__1 = -(*info);
-	_starpu_xerbla_("DSPEVD", &i__1);
-	return 0;
-    } else if (lquery) {
-	return 0;
-    }
-
-/*     Quick return if possible */
-
-    if (*n == 0) {
-	return 0;
-    }
-
-    if (*n == 1) {
-	w[1] = ap[1];
-	if (wantz) {
-	    z__[z_dim1 + 1] = 1.;
-	}
-	return 0;
-    }
-
-/*     Get machine constants. */
-
-    safmin = _starpu_dlamch_("Safe minimum");
-    eps = _starpu_dlamch_("Precision");
-    smlnum = safmin / eps;
-    bignum = 1. / smlnum;
-    rmin = sqrt(smlnum);
-    rmax = sqrt(bignum);
-
-/*     Scale matrix to allowable range, if necessary. */
-
-    anrm = _starpu_dlansp_("M", uplo, n, &ap[1], &work[1]);
-    iscale = 0;
-    if (anrm > 0. && anrm < rmin) {
-	iscale = 1;
-	sigma = rmin / anrm;
-    } else if (anrm > rmax) {
-	iscale = 1;
-	sigma = rmax / anrm;
-    }
-    if (iscale == 1) {
-	i__1 = *n * (*n + 1) / 2;
-	_starpu_dscal_(&i__1, &sigma, &ap[1], &c__1);
-    }
-
-/*     Call DSPTRD to reduce symmetric packed matrix to tridiagonal form. */
-
-    inde = 1;
-    indtau = inde + *n;
-    _starpu_dsptrd_(uplo, n, &ap[1], &w[1], &work[inde], &work[indtau], &iinfo);
-
-/*     For eigenvalues only, call DSTERF.  For eigenvectors, first call */
-/*     DSTEDC to generate the eigenvector matrix, WORK(INDWRK), of the */
-/*     tridiagonal matrix, then call DOPMTR to multiply it by the */
-/*     Householder transformations represented in AP. */
-
-    if (! wantz) {
-	_starpu_dsterf_(n, &w[1], &work[inde], info);
-    } else {
-	indwrk = indtau + *n;
-	llwork = *lwork - indwrk + 1;
-	_starpu_dstedc_("I", n, &w[1], &work[inde], &z__[z_offset], ldz, &work[indwrk]
-, &llwork, &iwork[1], liwork, info);
-	_starpu_dopmtr_("L", uplo, "N", n, n, &ap[1], &work[indtau], &z__[z_offset], 
-		ldz, &work[indwrk], &iinfo);
-    }
-
-/*     If matrix was scaled, then rescale eigenvalues appropriately. */
-
-    if (iscale == 1) {
-	d__1 = 1. / sigma;
-	_starpu_dscal_(n, &d__1, &w[1], &c__1);
-    }
-
-    work[1] = (doublereal) lwmin;
-    iwork[1] = liwmin;
-    return 0;
-
-/*     End of DSPEVD */
-
-} /* _starpu_dspevd_ */
@@ -1,334 +0,0 @@
-/* dspgvd.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-/* Table of constant values */
-
-static integer c__1 = 1;
-
-/* Subroutine */ int _starpu_dspgvd_(integer *itype, char *jobz, char *uplo, integer *
-	n, doublereal *ap, doublereal *bp, doublereal *w, doublereal *z__, 
-	integer *ldz, doublereal *work, integer *lwork, integer *iwork, 
-	integer *liwork, integer *info)
-{
-    /* System generated locals */
-    integer z_dim1, z_offset, i__1;
-    doublereal d__1, d__2;
-
-    /* Local variables */
-    integer j, neig;
-    extern logical _starpu_lsame_(char *, char *);
-    integer lwmin;
-    char trans[1];
-    logical upper;
-    extern /* Subroutine */ int _starpu_dtpmv_(char *, char *, char *, integer *, 
-	    doublereal *, doublereal *, integer *), 
-	    _starpu_dtpsv_(char *, char *, char *, integer *, doublereal *, 
-	    doublereal *, integer *);
-    logical wantz;
-    extern /* Subroutine */ int _starpu_xerbla_(char *, integer *), _starpu_dspevd_(
-	    char *, char *, integer *, doublereal *, doublereal *, doublereal 
-	    *, integer *, doublereal *, integer *, integer *, integer *, 
-	    integer *);
-    integer liwmin;
-    extern /* Subroutine */ int _starpu_dpptrf_(char *, integer *, doublereal *, 
-	    integer *), _starpu_dspgst_(integer *, char *, integer *, 
-	    doublereal *, doublereal *, integer *);
-    logical lquery;
-
-
-/*  -- LAPACK driver routine (version 3.2) -- */
-/*     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd.. */
-/*     November 2006 */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  DSPGVD computes all the eigenvalues, and optionally, the eigenvectors */
-/*  of a real generalized symmetric-definite eigenproblem, of the form */
-/*  A*x=(lambda)*B*x,  A*Bx=(lambda)*x,  or B*A*x=(lambda)*x.  Here A and */
-/*  B are assumed to be symmetric, stored in packed format, and B is also */
-/*  positive definite. */
-/*  If eigenvectors are desired, it uses a divide and conquer algorithm. */
-
-/*  The divide and conquer algorithm makes very mild assumptions about */
-/*  floating point arithmetic. It will work on machines with a guard */
-/*  digit in add/subtract, or on those binary machines without guard */
-/*  digits which subtract like the Cray X-MP, Cray Y-MP, Cray C-90, or */
-/*  Cray-2. It could conceivably fail on hexadecimal or decimal machines */
-/*  without guard digits, but we know of none. */
-
-/*  Arguments */
-/*  ========= */
-
-/*  ITYPE   (input) INTEGER */
-/*          Specifies the problem type to be solved: */
-/*          = 1:  A*x = (lambda)*B*x */
-/*          = 2:  A*B*x = (lambda)*x */
-/*          = 3:  B*A*x = (lambda)*x */
-
-/*  JOBZ    (input) CHARACTER*1 */
-/*          = 'N':  Compute eigenvalues only; */
-/*          = 'V':  Compute eigenvalues and eigenvectors. */
-
-/*  UPLO    (input) CHARACTER*1 */
-/*          = 'U':  Upper triangles of A and B are stored; */
-/*          = 'L':  Lower triangles of A and B are stored. */
-
-/*  N       (input) INTEGER */
-/*          The order of the matrices A and B.  N >= 0. */
-
-/*  AP      (input/output) DOUBLE PRECISION array, dimension (N*(N+1)/2) */
-/*          On entry, the upper or lower triangle of the symmetric matrix */
-/*          A, packed columnwise in a linear array.  The j-th column of A */
-/*          is stored in the array AP as follows: */
-/*          if UPLO = 'U', AP(i + (j-1)*j/2) = A(i,j) for 1<=i<=j; */
-/*          if UPLO = 'L', AP(i + (j-1)*(2*n-j)/2) = A(i,j) for j<=i<=n. */
-
-/*          On exit, the contents of AP are destroyed. */
-
-/*  BP      (input/output) DOUBLE PRECISION array, dimension (N*(N+1)/2) */
-/*          On entry, the upper or lower triangle of the symmetric matrix */
-/*          B, packed columnwise in a linear array.  The j-th column of B */
-/*          is stored in the array BP as follows: */
-/*          if UPLO = 'U', BP(i + (j-1)*j/2) = B(i,j) for 1<=i<=j; */
-/*          if UPLO = 'L', BP(i + (j-1)*(2*n-j)/2) = B(i,j) for j<=i<=n. */
-
-/*          On exit, the triangular factor U or L from the Cholesky */
-/*          factorization B = U**T*U or B = L*L**T, in the same storage */
-/*          format as B. */
-
-/*  W       (output) DOUBLE PRECISION array, dimension (N) */
-/*          If INFO = 0, the eigenvalues in ascending order. */
-
-/*  Z       (output) DOUBLE PRECISION array, dimension (LDZ, N) */
-/*          If JOBZ = 'V', then if INFO = 0, Z contains the matrix Z of */
-/*          eigenvectors.  The eigenvectors are normalized as follows: */
-/*          if ITYPE = 1 or 2, Z**T*B*Z = I; */
-/*          if ITYPE = 3, Z**T*inv(B)*Z = I. */
-/*          If JOBZ = 'N', then Z is not referenced. */
-
-/*  LDZ     (input) INTEGER */
-/*          The leading dimension of the array Z.  LDZ >= 1, and if */
-/*          JOBZ = 'V', LDZ >= max(1,N). */
-
-/*  WORK    (workspace/output) DOUBLE PRECISION array, dimension (MAX(1,LWORK)) */
-/*          On exit, if INFO = 0, WORK(1) returns the required LWORK. */
-
-/*  LWORK   (input) INTEGER */
-/*          The dimension of the array WORK. */
-/*          If N <= 1,               LWORK >= 1. */
-/*          If JOBZ = 'N' and N > 1, LWORK >= 2*N. */
-/*          If JOBZ = 'V' and N > 1, LWORK >= 1 + 6*N + 2*N**2. */
-
-/*          If LWORK = -1, then a workspace query is assumed; the routine */
-/*          only calculates the required sizes of the WORK and IWORK */
-/*          arrays, returns these values as the first entries of the WORK */
-/*          and IWORK arrays, and no error message related to LWORK or */
-/*          LIWORK is issued by XERBLA. */
-
-/*  IWORK   (workspace/output) INTEGER array, dimension (MAX(1,LIWORK)) */
-/*          On exit, if INFO = 0, IWORK(1) returns the required LIWORK. */
-
-/*  LIWORK  (input) INTEGER */
-/*          The dimension of the array IWORK. */
-/*          If JOBZ  = 'N' or N <= 1, LIWORK >= 1. */
-/*          If JOBZ  = 'V' and N > 1, LIWORK >= 3 + 5*N. */
-
-/*          If LIWORK = -1, then a workspace query is assumed; the */
-/*          routine only calculates the required sizes of the WORK and */
-/*          IWORK arrays, returns these values as the first entries of */
-/*          the WORK and IWORK arrays, and no error message related to */
-/*          LWORK or LIWORK is issued by XERBLA. */
-
-/*  INFO    (output) INTEGER */
-/*          = 0:  successful exit */
-/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
-/*          > 0:  DPPTRF or DSPEVD returned an error code: */
-/*             <= N:  if INFO = i, DSPEVD failed to converge; */
-/*                    i off-diagonal elements of an intermediate */
-/*                    tridiagonal form did not converge to zero; */
-/*             > N:   if INFO = N + i, for 1 <= i <= N, then the leading */
-/*                    minor of order i of B is not positive definite. */
-/*                    The factorization of B could not be completed and */
-/*                    no eigenvalues or eigenvectors were computed. */
-
-/*  Further Details */
-/*  =============== */
-
-/*  Based on contributions by */
-/*     Mark Fahey, Department of Mathematics, Univ. of Kentucky, USA */
-
-/*  ===================================================================== */
-
-/*     .. Parameters .. */
-/*     .. */
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. External Functions .. */
-/*     .. */
-/*     .. External Subroutines .. */
-/*     .. */
-/*     .. Intrinsic Functions .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-/*     Test the input parameters. */
-
-    /* Parameter adjustments */
-    --ap;
-    --bp;
-    --w;
-    z_dim1 = *ldz;
-    z_offset = 1 + z_dim1;
-    z__ -= z_offset;
-    --work;
-    --iwork;
-
-    /* Function Body */
-    wantz = _starpu_lsame_(jobz, "V");
-    upper = _starpu_lsame_(uplo, "U");
-    lquery = *lwork == -1 || *liwork == -1;
-
-    *info = 0;
-    if (*itype < 1 || *itype > 3) {
-	*info = -1;
-    } else if (! (wantz || _starpu_lsame_(jobz, "N"))) {
-	*info = -2;
-    } else if (! (upper || _starpu_lsame_(uplo, "L"))) {
-	*info = -3;
-    } else if (*n < 0) {
-	*info = -4;
-    } else if (*ldz < 1 || wantz && *ldz < *n) {
-	*info = -9;
-    }
-
-    if (*info == 0) {
-	if (*n <= 1) {
-	    liwmin = 1;
-	    lwmin = 1;
-	} else {
-	    if (wantz) {
-		liwmin = *n * 5 + 3;
-/* Computing 2nd power */
-		i__1 = *n;
-		lwmin = *n * 6 + 1 + (i__1 * i__1 << 1);
-	    } else {
-		liwmin = 1;
-		lwmin = *n << 1;
-	    }
-	}
-	work[1] = (doublereal) lwmin;
-	iwork[1] = liwmin;
-
-	if (*lwork < lwmin && ! lquery) {
-	    *info = -11;
-	} else if (*liwork < liwmin && ! lquery) {
-	    *info = -13;
-	}
-    }
-
-    if (*info != 0) {
-	i__1 = -(*info);
-	_starpu_xerbla_("DSPGVD", &i__1);
-	return 0;
-    } else if (lquery) {
-	return 0;
-    }
-
-/*     Quick return if possible */
-
-    if (*n == 0) {
-	return 0;
-    }
-
-/*     Form a Cholesky factorization of BP. */
-
-    _starpu_dpptrf_(uplo, n, &bp[1], info);
-    if (*info != 0) {
-	*info = *n + *info;
-	return 0;
-    }
-
-/*     Transform problem to standard eigenvalue problem and solve. */
-
-    _starpu_dspgst_(itype, uplo, n, &ap[1], &bp[1], info);
-    _starpu_dspevd_(jobz, uplo, n, &ap[1], &w[1], &z__[z_offset], ldz, &work[1], 
-	    lwork, &iwork[1], liwork, info);
-/* Computing MAX */
-    d__1 = (doublereal) lwmin;
-    lwmin = (integer) max(d__1,work[1]);
-/* Computing MAX */
-    d__1 = (doublereal) liwmin, d__2 = (doublereal) iwork[1];
-    liwmin = (integer) max(d__1,d__2);
-
-    if (wantz) {
-
-/*        Backtransform eigenvectors to the original problem. */
-
-	neig = *n;
-	if (*info > 0) {
-	    neig = *info - 1;
-	}
-	if (*itype == 1 || *itype == 2) {
-
-/*           For A*x=(lambda)*B*x and A*B*x=(lambda)*x; */
-/*           backtransform eigenvectors: x = inv(L)'*y or inv(U)*y */
-
-	    if (upper) {
-		*(unsigned char *)trans = 'N';
-	    } else {
-		*(unsigned char *)trans = 'T';
-	    }
-
-	    i__1 = neig;
-	    for (j = 1; j <= i__1; ++j) {
-		_starpu_dtpsv_(uplo, trans, "Non-unit", n, &bp[1], &z__[j * z_dim1 + 
-			1], &c__1);
-/* L10: */
-	    }
-
-	} else if (*itype == 3) {
-
-/*           For B*A*x=(lambda)*x; */
-/*           backtransform eigenvectors: x = L*y or U'*y */
-
-	    if (upper) {
-		*(unsigned char *)trans = 'T';
-	    } else {
-		*(unsigned char *)trans = 'N';
-	    }
-
-	    i__1 = neig;
-	    for (j = 1; j <= i__1; ++j) {
-		_starpu_dtpmv_(uplo, trans, "Non-unit", n, &bp[1], &z__[j * z_dim1 + 
-			1], &c__1);
-/* L20: */
-	    }
-	}
-    }
-
-    work[1] = (doublereal) lwmin;
-    iwork[1] = liwmin;
-
-    return 0;
-
-/*     End of DSPGVD */
-
-} /* _starpu_dspgvd_ */
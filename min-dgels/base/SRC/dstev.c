@@ -1,212 +0,0 @@
-/* dstev.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-/* Table of constant values */
-
-static integer c__1 = 1;
-
-/* Subroutine */ int _starpu_dstev_(char *jobz, integer *n, doublereal *d__, 
-	doublereal *e, doublereal *z__, integer *ldz, doublereal *work, 
-	integer *info)
-{
-    /* System generated locals */
-    integer z_dim1, z_offset, i__1;
-    doublereal d__1;
-
-    /* Builtin functions */
-    double sqrt(doublereal);
-
-    /* Local variables */
-    doublereal eps;
-    integer imax;
-    doublereal rmin, rmax, tnrm;
-    extern /* Subroutine */ int _starpu_dscal_(integer *, doublereal *, doublereal *, 
-	    integer *);
-    doublereal sigma;
-    extern logical _starpu_lsame_(char *, char *);
-    logical wantz;
-    extern doublereal _starpu_dlamch_(char *);
-    integer iscale;
-    doublereal safmin;
-    extern /* Subroutine */ int _starpu_xerbla_(char *, integer *);
-    doublereal bignum;
-    extern doublereal _starpu_dlanst_(char *, integer *, doublereal *, doublereal *);
-    extern /* Subroutine */ int _starpu_dsterf_(integer *, doublereal *, doublereal *, 
-	     integer *), _starpu_dsteqr_(char *, integer *, doublereal *, doublereal *
-, doublereal *, integer *, doublereal *, integer *);
-    doublereal smlnum;
-
-
-/*  -- LAPACK driver routine (version 3.2) -- */
-/*     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd.. */
-/*     November 2006 */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  DSTEV computes all eigenvalues and, optionally, eigenvectors of a */
-/*  real symmetric tridiagonal matrix A. */
-
-/*  Arguments */
-/*  ========= */
-
-/*  JOBZ    (input) CHARACTER*1 */
-/*          = 'N':  Compute eigenvalues only; */
-/*          = 'V':  Compute eigenvalues and eigenvectors. */
-
-/*  N       (input) INTEGER */
-/*          The order of the matrix.  N >= 0. */
-
-/*  D       (input/output) DOUBLE PRECISION array, dimension (N) */
-/*          On entry, the n diagonal elements of the tridiagonal matrix */
-/*          A. */
-/*          On exit, if INFO = 0, the eigenvalues in ascending order. */
-
-/*  E       (input/output) DOUBLE PRECISION array, dimension (N-1) */
-/*          On entry, the (n-1) subdiagonal elements of the tridiagonal */
-/*          matrix A, stored in elements 1 to N-1 of E. */
-/*          On exit, the contents of E are destroyed. */
-
-/*  Z       (output) DOUBLE PRECISION array, dimension (LDZ, N) */
-/*          If JOBZ = 'V', then if INFO = 0, Z contains the orthonormal */
-/*          eigenvectors of the matrix A, with the i-th column of Z */
-/*          holding the eigenvector associated with D(i). */
-/*          If JOBZ = 'N', then Z is not referenced. */
-
-/*  LDZ     (input) INTEGER */
-/*          The leading dimension of the array Z.  LDZ >= 1, and if */
-/*          JOBZ = 'V', LDZ >= max(1,N). */
-
-/*  WORK    (workspace) DOUBLE PRECISION array, dimension (max(1,2*N-2)) */
-/*          If JOBZ = 'N', WORK is not referenced. */
-
-/*  INFO    (output) INTEGER */
-/*          = 0:  successful exit */
-/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
-/*          > 0:  if INFO = i, the algorithm failed to converge; i */
-/*                off-diagonal elements of E did not converge to zero. */
-
-/*  ===================================================================== */
-
-/*     .. Parameters .. */
-/*     .. */
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. External Functions .. */
-/*     .. */
-/*     .. External Subroutines .. */
-/*     .. */
-/*     .. Intrinsic Functions .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-/*     Test the input parameters. */
-
-    /* Parameter adjustments */
-    --d__;
-    --e;
-    z_dim1 = *ldz;
-    z_offset = 1 + z_dim1;
-    z__ -= z_offset;
-    --work;
-
-    /* Function Body */
-    wantz = _starpu_lsame_(jobz, "V");
-
-    *info = 0;
-    if (! (wantz || _starpu_lsame_(jobz, "N"))) {
-	*info = -1;
-    } else if (*n < 0) {
-	*info = -2;
-    } else if (*ldz < 1 || wantz && *ldz < *n) {
-	*info = -6;
-    }
-
-    if (*info != 0) {
-	i__1 = -(*info);
-	_starpu_xerbla_("DSTEV ", &i__1);
-	return 0;
-    }
-
-/*     Quick return if possible */
-
-    if (*n == 0) {
-	return 0;
-    }
-
-    if (*n == 1) {
-	if (wantz) {
-	    z__[z_dim1 + 1] = 1.;
-	}
-	return 0;
-    }
-
-/*     Get machine constants. */
-
-    safmin = _starpu_dlamch_("Safe minimum");
-    eps = _starpu_dlamch_("Precision");
-    smlnum = safmin / eps;
-    bignum = 1. / smlnum;
-    rmin = sqrt(smlnum);
-    rmax = sqrt(bignum);
-
-/*     Scale matrix to allowable range, if necessary. */
-
-    iscale = 0;
-    tnrm = _starpu_dlanst_("M", n, &d__[1], &e[1]);
-    if (tnrm > 0. && tnrm < rmin) {
-	iscale = 1;
-	sigma = rmin / tnrm;
-    } else if (tnrm > rmax) {
-	iscale = 1;
-	sigma = rmax / tnrm;
-    }
-    if (iscale == 1) {
-	_starpu_dscal_(n, &sigma, &d__[1], &c__1);
-	i__1 = *n - 1;
-	_starpu_dscal_(&i__1, &sigma, &e[1], &c__1);
-    }
-
-/*     For eigenvalues only, call DSTERF.  For eigenvalues and */
-/*     eigenvectors, call DSTEQR. */
-
-    if (! wantz) {
-	_starpu_dsterf_(n, &d__[1], &e[1], info);
-    } else {
-	_starpu_dsteqr_("I", n, &d__[1], &e[1], &z__[z_offset], ldz, &work[1], info);
-    }
-
-/*     If matrix was scaled, then rescale eigenvalues appropriately. */
-
-    if (iscale == 1) {
-	if (*info == 0) {
-	    imax = *n;
-	} else {
-	    imax = *info - 1;
-	}
-	d__1 = 1. / sigma;
-	_starpu_dscal_(&imax, &d__1, &d__[1], &c__1);
-    }
-
-    return 0;
-
-/*     End of DSTEV */
-
-} /* _starpu_dstev_ */
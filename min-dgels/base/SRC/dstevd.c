@@ -1,273 +0,0 @@
-/* dstevd.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-/* Table of constant values */
-
-static integer c__1 = 1;
-
-/* Subroutine */ int _starpu_dstevd_(char *jobz, integer *n, doublereal *d__, 
-	doublereal *e, doublereal *z__, integer *ldz, doublereal *work, 
-	integer *lwork, integer *iwork, integer *liwork, integer *info)
-{
-    /* System generated locals */
-    integer z_dim1, z_offset, i__1;
-    doublereal d__1;
-
-    /* Builtin functions */
-    double sqrt(doublereal);
-
-    /* Local variables */
-    doublereal eps, rmin, rmax, tnrm;
-    extern /* Subroutine */ int _starpu_dscal_(integer *, doublereal *, doublereal *, 
-	    integer *);
-    doublereal sigma;
-    extern logical _starpu_lsame_(char *, char *);
-    integer lwmin;
-    logical wantz;
-    extern doublereal _starpu_dlamch_(char *);
-    integer iscale;
-    extern /* Subroutine */ int _starpu_dstedc_(char *, integer *, doublereal *, 
-	    doublereal *, doublereal *, integer *, doublereal *, integer *, 
-	    integer *, integer *, integer *);
-    doublereal safmin;
-    extern /* Subroutine */ int _starpu_xerbla_(char *, integer *);
-    doublereal bignum;
-    extern doublereal _starpu_dlanst_(char *, integer *, doublereal *, doublereal *);
-    extern /* Subroutine */ int _starpu_dsterf_(integer *, doublereal *, doublereal *, 
-	     integer *);
-    integer liwmin;
-    doublereal smlnum;
-    logical lquery;
-
-
-/*  -- LAPACK driver routine (version 3.2) -- */
-/*     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd.. */
-/*     November 2006 */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  DSTEVD computes all eigenvalues and, optionally, eigenvectors of a */
-/*  real symmetric tridiagonal matrix. If eigenvectors are desired, it */
-/*  uses a divide and conquer algorithm. */
-
-/*  The divide and conquer algorithm makes very mild assumptions about */
-/*  floating point arithmetic. It will work on machines with a guard */
-/*  digit in add/subtract, or on those binary machines without guard */
-/*  digits which subtract like the Cray X-MP, Cray Y-MP, Cray C-90, or */
-/*  Cray-2. It could conceivably fail on hexadecimal or decimal machines */
-/*  without guard digits, but we know of none. */
-
-/*  Arguments */
-/*  ========= */
-
-/*  JOBZ    (input) CHARACTER*1 */
-/*          = 'N':  Compute eigenvalues only; */
-/*          = 'V':  Compute eigenvalues and eigenvectors. */
-
-/*  N       (input) INTEGER */
-/*          The order of the matrix.  N >= 0. */
-
-/*  D       (input/output) DOUBLE PRECISION array, dimension (N) */
-/*          On entry, the n diagonal elements of the tridiagonal matrix */
-/*          A. */
-/*          On exit, if INFO = 0, the eigenvalues in ascending order. */
-
-/*  E       (input/output) DOUBLE PRECISION array, dimension (N-1) */
-/*          On entry, the (n-1) subdiagonal elements of the tridiagonal */
-/*          matrix A, stored in elements 1 to N-1 of E. */
-/*          On exit, the contents of E are destroyed. */
-
-/*  Z       (output) DOUBLE PRECISION array, dimension (LDZ, N) */
-/*          If JOBZ = 'V', then if INFO = 0, Z contains the orthonormal */
-/*          eigenvectors of the matrix A, with the i-th column of Z */
-/*          holding the eigenvector associated with D(i). */
-/*          If JOBZ = 'N', then Z is not referenced. */
-
-/*  LDZ     (input) INTEGER */
-/*          The leading dimension of the array Z.  LDZ >= 1, and if */
-/*          JOBZ = 'V', LDZ >= max(1,N). */
-
-/*  WORK    (workspace/output) DOUBLE PRECISION array, */
-/*                                         dimension (LWORK) */
-/*          On exit, if INFO = 0, WORK(1) returns the optimal LWORK. */
-
-/*  LWORK   (input) INTEGER */
-/*          The dimension of the array WORK. */
-/*          If JOBZ  = 'N' or N <= 1 then LWORK must be at least 1. */
-/*          If JOBZ  = 'V' and N > 1 then LWORK must be at least */
-/*                         ( 1 + 4*N + N**2 ). */
-
-/*          If LWORK = -1, then a workspace query is assumed; the routine */
-/*          only calculates the optimal sizes of the WORK and IWORK */
-/*          arrays, returns these values as the first entries of the WORK */
-/*          and IWORK arrays, and no error message related to LWORK or */
-/*          LIWORK is issued by XERBLA. */
-
-/*  IWORK   (workspace/output) INTEGER array, dimension (MAX(1,LIWORK)) */
-/*          On exit, if INFO = 0, IWORK(1) returns the optimal LIWORK. */
-
-/*  LIWORK  (input) INTEGER */
-/*          The dimension of the array IWORK. */
-/*          If JOBZ  = 'N' or N <= 1 then LIWORK must be at least 1. */
-/*          If JOBZ  = 'V' and N > 1 then LIWORK must be at least 3+5*N. */
-
-/*          If LIWORK = -1, then a workspace query is assumed; the */
-/*          routine only calculates the optimal sizes of the WORK and */
-/*          IWORK arrays, returns these values as the first entries of */
-/*          the WORK and IWORK arrays, and no error message related to */
-/*          LWORK or LIWORK is issued by XERBLA. */
-
-/*  INFO    (output) INTEGER */
-/*          = 0:  successful exit */
-/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
-/*          > 0:  if INFO = i, the algorithm failed to converge; i */
-/*                off-diagonal elements of E did not converge to zero. */
-
-/*  ===================================================================== */
-
-/*     .. Parameters .. */
-/*     .. */
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. External Functions .. */
-/*     .. */
-/*     .. External Subroutines .. */
-/*     .. */
-/*     .. Intrinsic Functions .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-/*     Test the input parameters. */
-
-    /* Parameter adjustments */
-    --d__;
-    --e;
-    z_dim1 = *ldz;
-    z_offset = 1 + z_dim1;
-    z__ -= z_offset;
-    --work;
-    --iwork;
-
-    /* Function Body */
-    wantz = _starpu_lsame_(jobz, "V");
-    lquery = *lwork == -1 || *liwork == -1;
-
-    *info = 0;
-    liwmin = 1;
-    lwmin = 1;
-    if (*n > 1 && wantz) {
-/* Computing 2nd power */
-	i__1 = *n;
-	lwmin = (*n << 2) + 1 + i__1 * i__1;
-	liwmin = *n * 5 + 3;
-    }
-
-    if (! (wantz || _starpu_lsame_(jobz, "N"))) {
-	*info = -1;
-    } else if (*n < 0) {
-	*info = -2;
-    } else if (*ldz < 1 || wantz && *ldz < *n) {
-	*info = -6;
-    }
-
-    if (*info == 0) {
-	work[1] = (doublereal) lwmin;
-	iwork[1] = liwmin;
-
-	if (*lwork < lwmin && ! lquery) {
-	    *info = -8;
-	} else if (*liwork < liwmin && ! lquery) {
-	    *info = -10;
-	}
-    }
-
-    if (*info != 0) {
-	i__1 = -(*info);
-	_starpu_xerbla_("DSTEVD", &i__1);
-	return 0;
-    } else if (lquery) {
-	return 0;
-    }
-
-/*     Quick return if possible */
-
-    if (*n == 0) {
-	return 0;
-    }
-
-    if (*n == 1) {
-	if (wantz) {
-	    z__[z_dim1 + 1] = 1.;
-	}
-	return 0;
-    }
-
-/*     Get machine constants. */
-
-    safmin = _starpu_dlamch_("Safe minimum");
-    eps = _starpu_dlamch_("Precision");
-    smlnum = safmin / eps;
-    bignum = 1. / smlnum;
-    rmin = sqrt(smlnum);
-    rmax = sqrt(bignum);
-
-/*     Scale matrix to allowable range, if necessary. */
-
-    iscale = 0;
-    tnrm = _starpu_dlanst_("M", n, &d__[1], &e[1]);
-    if (tnrm > 0. && tnrm < rmin) {
-	iscale = 1;
-	sigma = rmin / tnrm;
-    } else if (tnrm > rmax) {
-	iscale = 1;
-	sigma = rmax / tnrm;
-    }
-    if (iscale == 1) {
-	_starpu_dscal_(n, &sigma, &d__[1], &c__1);
-	i__1 = *n - 1;
-	_starpu_dscal_(&i__1, &sigma, &e[1], &c__1);
-    }
-
-/*     For eigenvalues only, call DSTERF.  For eigenvalues and */
-/*     eigenvectors, call DSTEDC. */
-
-    if (! wantz) {
-	_starpu_dsterf_(n, &d__[1], &e[1], info);
-    } else {
-	_starpu_dstedc_("I", n, &d__[1], &e[1], &z__[z_offset], ldz, &work[1], lwork, 
-		&iwork[1], liwork, info);
-    }
-
-/*     If matrix was scaled, then rescale eigenvalues appropriately. */
-
-    if (iscale == 1) {
-	d__1 = 1. / sigma;
-	_starpu_dscal_(n, &d__1, &d__[1], &c__1);
-    }
-
-    work[1] = (doublereal) lwmin;
-    iwork[1] = liwmin;
-
-    return 0;
-
-/*     End of DSTEVD */
-
-} /* _starpu_dstevd_ */
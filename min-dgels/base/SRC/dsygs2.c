@@ -1,299 +0,0 @@
-/* dsygs2.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-/* Table of constant values */
-
-static doublereal c_b6 = -1.;
-static integer c__1 = 1;
-static doublereal c_b27 = 1.;
-
-/* Subroutine */ int _starpu_dsygs2_(integer *itype, char *uplo, integer *n, 
-	doublereal *a, integer *lda, doublereal *b, integer *ldb, integer *
-	info)
-{
-    /* System generated locals */
-    integer a_dim1, a_offset, b_dim1, b_offset, i__1, i__2;
-    doublereal d__1;
-
-    /* Local variables */
-    integer k;
-    doublereal ct, akk, bkk;
-    extern /* Subroutine */ int _starpu_dsyr2_(char *, integer *, doublereal *, 
-	    doublereal *, integer *, doublereal *, integer *, doublereal *, 
-	    integer *), _starpu_dscal_(integer *, doublereal *, doublereal *, 
-	    integer *);
-    extern logical _starpu_lsame_(char *, char *);
-    extern /* Subroutine */ int _starpu_daxpy_(integer *, doublereal *, doublereal *, 
-	    integer *, doublereal *, integer *);
-    logical upper;
-    extern /* Subroutine */ int _starpu_dtrmv_(char *, char *, char *, integer *, 
-	    doublereal *, integer *, doublereal *, integer *), _starpu_dtrsv_(char *, char *, char *, integer *, doublereal *, 
-	    integer *, doublereal *, integer *), 
-	    _starpu_xerbla_(char *, integer *);
-
-
-/*  -- LAPACK routine (version 3.2) -- */
-/*     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd.. */
-/*     November 2006 */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  DSYGS2 reduces a real symmetric-definite generalized eigenproblem */
-/*  to standard form. */
-
-/*  If ITYPE = 1, the problem is A*x = lambda*B*x, */
-/*  and A is overwritten by inv(U')*A*inv(U) or inv(L)*A*inv(L') */
-
-/*  If ITYPE = 2 or 3, the problem is A*B*x = lambda*x or */
-/*  B*A*x = lambda*x, and A is overwritten by U*A*U` or L'*A*L. */
-
-/*  B must have been previously factorized as U'*U or L*L' by DPOTRF. */
-
-/*  Arguments */
-/*  ========= */
-
-/*  ITYPE   (input) INTEGER */
-/*          = 1: compute inv(U')*A*inv(U) or inv(L)*A*inv(L'); */
-/*          = 2 or 3: compute U*A*U' or L'*A*L. */
-
-/*  UPLO    (input) CHARACTER*1 */
-/*          Specifies whether the upper or lower triangular part of the */
-/*          symmetric matrix A is stored, and how B has been factorized. */
-/*          = 'U':  Upper triangular */
-/*          = 'L':  Lower triangular */
-
-/*  N       (input) INTEGER */
-/*          The order of the matrices A and B.  N >= 0. */
-
-/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA,N) */
-/*          On entry, the symmetric matrix A.  If UPLO = 'U', the leading */
-/*          n by n upper triangular part of A contains the upper */
-/*          triangular part of the matrix A, and the strictly lower */
-/*          triangular part of A is not referenced.  If UPLO = 'L', the */
-/*          leading n by n lower triangular part of A contains the lower */
-/*          triangular part of the matrix A, and the strictly upper */
-/*          triangular part of A is not referenced. */
-
-/*          On exit, if INFO = 0, the transformed matrix, stored in the */
-/*          same format as A. */
-
-/*  LDA     (input) INTEGER */
-/*          The leading dimension of the array A.  LDA >= max(1,N). */
-
-/*  B       (input) DOUBLE PRECISION array, dimension (LDB,N) */
-/*          The triangular factor from the Cholesky factorization of B, */
-/*          as returned by DPOTRF. */
-
-/*  LDB     (input) INTEGER */
-/*          The leading dimension of the array B.  LDB >= max(1,N). */
-
-/*  INFO    (output) INTEGER */
-/*          = 0:  successful exit. */
-/*          < 0:  if INFO = -i, the i-th argument had an illegal value. */
-
-/*  ===================================================================== */
-
-/*     .. Parameters .. */
-/*     .. */
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. External Subroutines .. */
-/*     .. */
-/*     .. Intrinsic Functions .. */
-/*     .. */
-/*     .. External Functions .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-/*     Test the input parameters. */
-
-    /* Parameter adjustments */
-    a_dim1 = *lda;
-    a_offset = 1 + a_dim1;
-    a -= a_offset;
-    b_dim1 = *ldb;
-    b_offset = 1 + b_dim1;
-    b -= b_offset;
-
-    /* Function Body */
-    *info = 0;
-    upper = _starpu_lsame_(uplo, "U");
-    if (*itype < 1 || *itype > 3) {
-	*info = -1;
-    } else if (! upper && ! _starpu_lsame_(uplo, "L")) {
-	*info = -2;
-    } else if (*n < 0) {
-	*info = -3;
-    } else if (*lda < max(1,*n)) {
-	*info = -5;
-    } else if (*ldb < max(1,*n)) {
-	*info = -7;
-    }
-    if (*info != 0) {
-	i__1 = -(*info);
-	_starpu_xerbla_("DSYGS2", &i__1);
-	return 0;
-    }
-
-    if (*itype == 1) {
-	if (upper) {
-
-/*           Compute inv(U')*A*inv(U) */
-
-	    i__1 = *n;
-	    for (k = 1; k <= i__1; ++k) {
-
-/*              Update the upper triangle of A(k:n,k:n) */
-
-		akk = a[k + k * a_dim1];
-		bkk = b[k + k * b_dim1];
-/* Computing 2nd power */
-		d__1 = bkk;
-		akk /= d__1 * d__1;
-		a[k + k * a_dim1] = akk;
-		if (k < *n) {
-		    i__2 = *n - k;
-		    d__1 = 1. / bkk;
-		    _starpu_dscal_(&i__2, &d__1, &a[k + (k + 1) * a_dim1], lda);
-		    ct = akk * -.5;
-		    i__2 = *n - k;
-		    _starpu_daxpy_(&i__2, &ct, &b[k + (k + 1) * b_dim1], ldb, &a[k + (
-			    k + 1) * a_dim1], lda);
-		    i__2 = *n - k;
-		    _starpu_dsyr2_(uplo, &i__2, &c_b6, &a[k + (k + 1) * a_dim1], lda, 
-			    &b[k + (k + 1) * b_dim1], ldb, &a[k + 1 + (k + 1) 
-			    * a_dim1], lda);
-		    i__2 = *n - k;
-		    _starpu_daxpy_(&i__2, &ct, &b[k + (k + 1) * b_dim1], ldb, &a[k + (
-			    k + 1) * a_dim1], lda);
-		    i__2 = *n - k;
-		    _starpu_dtrsv_(uplo, "Transpose", "Non-unit", &i__2, &b[k + 1 + (
-			    k + 1) * b_dim1], ldb, &a[k + (k + 1) * a_dim1], 
-			    lda);
-		}
-/* L10: */
-	    }
-	} else {
-
-/*           Compute inv(L)*A*inv(L') */
-
-	    i__1 = *n;
-	    for (k = 1; k <= i__1; ++k) {
-
-/*              Update the lower triangle of A(k:n,k:n) */
-
-		akk = a[k + k * a_dim1];
-		bkk = b[k + k * b_dim1];
-/* Computing 2nd power */
-		d__1 = bkk;
-		akk /= d__1 * d__1;
-		a[k + k * a_dim1] = akk;
-		if (k < *n) {
-		    i__2 = *n - k;
-		    d__1 = 1. / bkk;
-		    _starpu_dscal_(&i__2, &d__1, &a[k + 1 + k * a_dim1], &c__1);
-		    ct = akk * -.5;
-		    i__2 = *n - k;
-		    _starpu_daxpy_(&i__2, &ct, &b[k + 1 + k * b_dim1], &c__1, &a[k + 
-			    1 + k * a_dim1], &c__1);
-		    i__2 = *n - k;
-		    _starpu_dsyr2_(uplo, &i__2, &c_b6, &a[k + 1 + k * a_dim1], &c__1, 
-			    &b[k + 1 + k * b_dim1], &c__1, &a[k + 1 + (k + 1) 
-			    * a_dim1], lda);
-		    i__2 = *n - k;
-		    _starpu_daxpy_(&i__2, &ct, &b[k + 1 + k * b_dim1], &c__1, &a[k + 
-			    1 + k * a_dim1], &c__1);
-		    i__2 = *n - k;
-		    _starpu_dtrsv_(uplo, "No transpose", "Non-unit", &i__2, &b[k + 1 
-			    + (k + 1) * b_dim1], ldb, &a[k + 1 + k * a_dim1], 
-			    &c__1);
-		}
-/* L20: */
-	    }
-	}
-    } else {
-	if (upper) {
-
-/*           Compute U*A*U' */
-
-	    i__1 = *n;
-	    for (k = 1; k <= i__1; ++k) {
-
-/*              Update the upper triangle of A(1:k,1:k) */
-
-		akk = a[k + k * a_dim1];
-		bkk = b[k + k * b_dim1];
-		i__2 = k - 1;
-		_starpu_dtrmv_(uplo, "No transpose", "Non-unit", &i__2, &b[b_offset], 
-			ldb, &a[k * a_dim1 + 1], &c__1);
-		ct = akk * .5;
-		i__2 = k - 1;
-		_starpu_daxpy_(&i__2, &ct, &b[k * b_dim1 + 1], &c__1, &a[k * a_dim1 + 
-			1], &c__1);
-		i__2 = k - 1;
-		_starpu_dsyr2_(uplo, &i__2, &c_b27, &a[k * a_dim1 + 1], &c__1, &b[k * 
-			b_dim1 + 1], &c__1, &a[a_offset], lda);
-		i__2 = k - 1;
-		_starpu_daxpy_(&i__2, &ct, &b[k * b_dim1 + 1], &c__1, &a[k * a_dim1 + 
-			1], &c__1);
-		i__2 = k - 1;
-		_starpu_dscal_(&i__2, &bkk, &a[k * a_dim1 + 1], &c__1);
-/* Computing 2nd power */
-		d__1 = bkk;
-		a[k + k * a_dim1] = akk * (d__1 * d__1);
-/* L30: */
-	    }
-	} else {
-
-/*           Compute L'*A*L */
-
-	    i__1 = *n;
-	    for (k = 1; k <= i__1; ++k) {
-
-/*              Update the lower triangle of A(1:k,1:k) */
-
-		akk = a[k + k * a_dim1];
-		bkk = b[k + k * b_dim1];
-		i__2 = k - 1;
-		_starpu_dtrmv_(uplo, "Transpose", "Non-unit", &i__2, &b[b_offset], 
-			ldb, &a[k + a_dim1], lda);
-		ct = akk * .5;
-		i__2 = k - 1;
-		_starpu_daxpy_(&i__2, &ct, &b[k + b_dim1], ldb, &a[k + a_dim1], lda);
-		i__2 = k - 1;
-		_starpu_dsyr2_(uplo, &i__2, &c_b27, &a[k + a_dim1], lda, &b[k + 
-			b_dim1], ldb, &a[a_offset], lda);
-		i__2 = k - 1;
-		_starpu_daxpy_(&i__2, &ct, &b[k + b_dim1], ldb, &a[k + a_dim1], lda);
-		i__2 = k - 1;
-		_starpu_dscal_(&i__2, &bkk, &a[k + a_dim1], lda);
-/* Computing 2nd power */
-		d__1 = bkk;
-		a[k + k * a_dim1] = akk * (d__1 * d__1);
-/* L40: */
-	    }
-	}
-    }
-    return 0;
-
-/*     End of DSYGS2 */
-
-} /* _starpu_dsygs2_ */
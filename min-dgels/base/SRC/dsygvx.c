@@ -1,396 +0,0 @@
-/* dsygvx.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-/* Table of constant values */
-
-static integer c__1 = 1;
-static integer c_n1 = -1;
-static doublereal c_b19 = 1.;
-
-/* Subroutine */ int _starpu_dsygvx_(integer *itype, char *jobz, char *range, char *
-	uplo, integer *n, doublereal *a, integer *lda, doublereal *b, integer 
-	*ldb, doublereal *vl, doublereal *vu, integer *il, integer *iu, 
-	doublereal *abstol, integer *m, doublereal *w, doublereal *z__, 
-	integer *ldz, doublereal *work, integer *lwork, integer *iwork, 
-	integer *ifail, integer *info)
-{
-    /* System generated locals */
-    integer a_dim1, a_offset, b_dim1, b_offset, z_dim1, z_offset, i__1, i__2;
-
-    /* Local variables */
-    integer nb;
-    extern logical _starpu_lsame_(char *, char *);
-    extern /* Subroutine */ int _starpu_dtrmm_(char *, char *, char *, char *, 
-	    integer *, integer *, doublereal *, doublereal *, integer *, 
-	    doublereal *, integer *);
-    char trans[1];
-    extern /* Subroutine */ int _starpu_dtrsm_(char *, char *, char *, char *, 
-	    integer *, integer *, doublereal *, doublereal *, integer *, 
-	    doublereal *, integer *);
-    logical upper, wantz, alleig, indeig, valeig;
-    extern /* Subroutine */ int _starpu_xerbla_(char *, integer *);
-    extern integer _starpu_ilaenv_(integer *, char *, char *, integer *, integer *, 
-	    integer *, integer *);
-    extern /* Subroutine */ int _starpu_dpotrf_(char *, integer *, doublereal *, 
-	    integer *, integer *);
-    integer lwkmin;
-    extern /* Subroutine */ int _starpu_dsygst_(integer *, char *, integer *, 
-	    doublereal *, integer *, doublereal *, integer *, integer *);
-    integer lwkopt;
-    logical lquery;
-    extern /* Subroutine */ int _starpu_dsyevx_(char *, char *, char *, integer *, 
-	    doublereal *, integer *, doublereal *, doublereal *, integer *, 
-	    integer *, doublereal *, integer *, doublereal *, doublereal *, 
-	    integer *, doublereal *, integer *, integer *, integer *, integer 
-	    *);
-
-
-/*  -- LAPACK driver routine (version 3.2) -- */
-/*     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd.. */
-/*     November 2006 */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  DSYGVX computes selected eigenvalues, and optionally, eigenvectors */
-/*  of a real generalized symmetric-definite eigenproblem, of the form */
-/*  A*x=(lambda)*B*x,  A*Bx=(lambda)*x,  or B*A*x=(lambda)*x.  Here A */
-/*  and B are assumed to be symmetric and B is also positive definite. */
-/*  Eigenvalues and eigenvectors can be selected by specifying either a */
-/*  range of values or a range of indices for the desired eigenvalues. */
-
-/*  Arguments */
-/*  ========= */
-
-/*  ITYPE   (input) INTEGER */
-/*          Specifies the problem type to be solved: */
-/*          = 1:  A*x = (lambda)*B*x */
-/*          = 2:  A*B*x = (lambda)*x */
-/*          = 3:  B*A*x = (lambda)*x */
-
-/*  JOBZ    (input) CHARACTER*1 */
-/*          = 'N':  Compute eigenvalues only; */
-/*          = 'V':  Compute eigenvalues and eigenvectors. */
-
-/*  RANGE   (input) CHARACTER*1 */
-/*          = 'A': all eigenvalues will be found. */
-/*          = 'V': all eigenvalues in the half-open interval (VL,VU] */
-/*                 will be found. */
-/*          = 'I': the IL-th through IU-th eigenvalues will be found. */
-
-/*  UPLO    (input) CHARACTER*1 */
-/*          = 'U':  Upper triangle of A and B are stored; */
-/*          = 'L':  Lower triangle of A and B are stored. */
-
-/*  N       (input) INTEGER */
-/*          The order of the matrix pencil (A,B).  N >= 0. */
-
-/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA, N) */
-/*          On entry, the symmetric matrix A.  If UPLO = 'U', the */
-/*          leading N-by-N upper triangular part of A contains the */
-/*          upper triangular part of the matrix A.  If UPLO = 'L', */
-/*          the leading N-by-N lower triangular part of A contains */
-/*          the lower triangular part of the matrix A. */
-
-/*          On exit, the lower triangle (if UPLO='L') or the upper */
-/*          triangle (if UPLO='U') of A, including the diagonal, is */
-/*          destroyed. */
-
-/*  LDA     (input) INTEGER */
-/*          The leading dimension of the array A.  LDA >= max(1,N). */
-
-/*  B       (input/output) DOUBLE PRECISION array, dimension (LDA, N) */
-/*          On entry, the symmetric matrix B.  If UPLO = 'U', the */
-/*          leading N-by-N upper triangular part of B contains the */
-/*          upper triangular part of the matrix B.  If UPLO = 'L', */
-/*          the leading N-by-N lower triangular part of B contains */
-/*          the lower triangular part of the matrix B. */
-
-/*          On exit, if INFO <= N, the part of B containing the matrix is */
-/*          overwritten by the triangular factor U or L from the Cholesky */
-/*          factorization B = U**T*U or B = L*L**T. */
-
-/*  LDB     (input) INTEGER */
-/*          The leading dimension of the array B.  LDB >= max(1,N). */
-
-/*  VL      (input) DOUBLE PRECISION */
-/*  VU      (input) DOUBLE PRECISION */
-/*          If RANGE='V', the lower and upper bounds of the interval to */
-/*          be searched for eigenvalues. VL < VU. */
-/*          Not referenced if RANGE = 'A' or 'I'. */
-
-/*  IL      (input) INTEGER */
-/*  IU      (input) INTEGER */
-/*          If RANGE='I', the indices (in ascending order) of the */
-/*          smallest and largest eigenvalues to be returned. */
-/*          1 <= IL <= IU <= N, if N > 0; IL = 1 and IU = 0 if N = 0. */
-/*          Not referenced if RANGE = 'A' or 'V'. */
-
-/*  ABSTOL  (input) DOUBLE PRECISION */
-/*          The absolute error tolerance for the eigenvalues. */
-/*          An approximate eigenvalue is accepted as converged */
-/*          when it is determined to lie in an interval [a,b] */
-/*          of width less than or equal to */
-
-/*                  ABSTOL + EPS *   max( |a|,|b| ) , */
-
-/*          where EPS is the machine precision.  If ABSTOL is less than */
-/*          or equal to zero, then  EPS*|T|  will be used in its place, */
-/*          where |T| is the 1-norm of the tridiagonal matrix obtained */
-/*          by reducing A to tridiagonal form. */
-
-/*          Eigenvalues will be computed most accurately when ABSTOL is */
-/*          set to twice the underflow threshold 2*DLAMCH('S'), not zero. */
-/*          If this routine returns with INFO>0, indicating that some */
-/*          eigenvectors did not converge, try setting ABSTOL to */
-/*          2*DLAMCH('S'). */
-
-/*  M       (output) INTEGER */
-/*          The total number of eigenvalues found.  0 <= M <= N. */
-/*          If RANGE = 'A', M = N, and if RANGE = 'I', M = IU-IL+1. */
-
-/*  W       (output) DOUBLE PRECISION array, dimension (N) */
-/*          On normal exit, the first M elements contain the selected */
-/*          eigenvalues in ascending order. */
-
-/*  Z       (output) DOUBLE PRECISION array, dimension (LDZ, max(1,M)) */
-/*          If JOBZ = 'N', then Z is not referenced. */
-/*          If JOBZ = 'V', then if INFO = 0, the first M columns of Z */
-/*          contain the orthonormal eigenvectors of the matrix A */
-/*          corresponding to the selected eigenvalues, with the i-th */
-/*          column of Z holding the eigenvector associated with W(i). */
-/*          The eigenvectors are normalized as follows: */
-/*          if ITYPE = 1 or 2, Z**T*B*Z = I; */
-/*          if ITYPE = 3, Z**T*inv(B)*Z = I. */
-
-/*          If an eigenvector fails to converge, then that column of Z */
-/*          contains the latest approximation to the eigenvector, and the */
-/*          index of the eigenvector is returned in IFAIL. */
-/*          Note: the user must ensure that at least max(1,M) columns are */
-/*          supplied in the array Z; if RANGE = 'V', the exact value of M */
-/*          is not known in advance and an upper bound must be used. */
-
-/*  LDZ     (input) INTEGER */
-/*          The leading dimension of the array Z.  LDZ >= 1, and if */
-/*          JOBZ = 'V', LDZ >= max(1,N). */
-
-/*  WORK    (workspace/output) DOUBLE PRECISION array, dimension (MAX(1,LWORK)) */
-/*          On exit, if INFO = 0, WORK(1) returns the optimal LWORK. */
-
-/*  LWORK   (input) INTEGER */
-/*          The length of the array WORK.  LWORK >= max(1,8*N). */
-/*          For optimal efficiency, LWORK >= (NB+3)*N, */
-/*          where NB is the blocksize for DSYTRD returned by ILAENV. */
-
-/*          If LWORK = -1, then a workspace query is assumed; the routine */
-/*          only calculates the optimal size of the WORK array, returns */
-/*          this value as the first entry of the WORK array, and no error */
-/*          message related to LWORK is issued by XERBLA. */
-
-/*  IWORK   (workspace) INTEGER array, dimension (5*N) */
-
-/*  IFAIL   (output) INTEGER array, dimension (N) */
-/*          If JOBZ = 'V', then if INFO = 0, the first M elements of */
-/*          IFAIL are zero.  If INFO > 0, then IFAIL contains the */
-/*          indices of the eigenvectors that failed to converge. */
-/*          If JOBZ = 'N', then IFAIL is not referenced. */
-
-/*  INFO    (output) INTEGER */
-/*          = 0:  successful exit */
-/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
-/*          > 0:  DPOTRF or DSYEVX returned an error code: */
-/*             <= N:  if INFO = i, DSYEVX failed to converge; */
-/*                    i eigenvectors failed to converge.  Their indices */
-/*                    are stored in array IFAIL. */
-/*             > N:   if INFO = N + i, for 1 <= i <= N, then the leading */
-/*                    minor of order i of B is not positive definite. */
-/*                    The factorization of B could not be completed and */
-/*                    no eigenvalues or eigenvectors were computed. */
-
-/*  Further Details */
-/*  =============== */
-
-/*  Based on contributions by */
-/*     Mark Fahey, Department of Mathematics, Univ. of Kentucky, USA */
-
-/* ===================================================================== */
-
-/*     .. Parameters .. */
-/*     .. */
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. External Functions .. */
-/*     .. */
-/*     .. External Subroutines .. */
-/*     .. */
-/*     .. Intrinsic Functions .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-/*     Test the input parameters. */
-
-    /* Parameter adjustments */
-    a_dim1 = *lda;
-    a_offset = 1 + a_dim1;
-    a -= a_offset;
-    b_dim1 = *ldb;
-    b_offset = 1 + b_dim1;
-    b -= b_offset;
-    --w;
-    z_dim1 = *ldz;
-    z_offset = 1 + z_dim1;
-    z__ -= z_offset;
-    --work;
-    --iwork;
-    --ifail;
-
-    /* Function Body */
-    upper = _starpu_lsame_(uplo, "U");
-    wantz = _starpu_lsame_(jobz, "V");
-    alleig = _starpu_lsame_(range, "A");
-    valeig = _starpu_lsame_(range, "V");
-    indeig = _starpu_lsame_(range, "I");
-    lquery = *lwork == -1;
-
-    *info = 0;
-    if (*itype < 1 || *itype > 3) {
-	*info = -1;
-    } else if (! (wantz || _starpu_lsame_(jobz, "N"))) {
-	*info = -2;
-    } else if (! (alleig || valeig || indeig)) {
-	*info = -3;
-    } else if (! (upper || _starpu_lsame_(uplo, "L"))) {
-	*info = -4;
-    } else if (*n < 0) {
-	*info = -5;
-    } else if (*lda < max(1,*n)) {
-	*info = -7;
-    } else if (*ldb < max(1,*n)) {
-	*info = -9;
-    } else {
-	if (valeig) {
-	    if (*n > 0 && *vu <= *vl) {
-		*info = -11;
-	    }
-	} else if (indeig) {
-	    if (*il < 1 || *il > max(1,*n)) {
-		*info = -12;
-	    } else if (*iu < min(*n,*il) || *iu > *n) {
-		*info = -13;
-	    }
-	}
-    }
-    if (*info == 0) {
-	if (*ldz < 1 || wantz && *ldz < *n) {
-	    *info = -18;
-	}
-    }
-
-    if (*info == 0) {
-/* Computing MAX */
-	i__1 = 1, i__2 = *n << 3;
-	lwkmin = max(i__1,i__2);
-	nb = _starpu_ilaenv_(&c__1, "DSYTRD", uplo, n, &c_n1, &c_n1, &c_n1);
-/* Computing MAX */
-	i__1 = lwkmin, i__2 = (nb + 3) * *n;
-	lwkopt = max(i__1,i__2);
-	work[1] = (doublereal) lwkopt;
-
-	if (*lwork < lwkmin && ! lquery) {
-	    *info = -20;
-	}
-    }
-
-    if (*info != 0) {
-	i__1 = -(*info);
-	_starpu_xerbla_("DSYGVX", &i__1);
-	return 0;
-    } else if (lquery) {
-	return 0;
-    }
-
-/*     Quick return if possible */
-
-    *m = 0;
-    if (*n == 0) {
-	return 0;
-    }
-
-/*     Form a Cholesky factorization of B. */
-
-    _starpu_dpotrf_(uplo, n, &b[b_offset], ldb, info);
-    if (*info != 0) {
-	*info = *n + *info;
-	return 0;
-    }
-
-/*     Transform problem to standard eigenvalue problem and solve. */
-
-    _starpu_dsygst_(itype, uplo, n, &a[a_offset], lda, &b[b_offset], ldb, info);
-    _starpu_dsyevx_(jobz, range, uplo, n, &a[a_offset], lda, vl, vu, il, iu, abstol, 
-	    m, &w[1], &z__[z_offset], ldz, &work[1], lwork, &iwork[1], &ifail[
-	    1], info);
-
-    if (wantz) {
-
-/*        Backtransform eigenvectors to the original problem. */
-
-	if (*info > 0) {
-	    *m = *info - 1;
-	}
-	if (*itype == 1 || *itype == 2) {
-
-/*           For A*x=(lambda)*B*x and A*B*x=(lambda)*x; */
-/*           backtransform eigenvectors: x = inv(L)'*y or inv(U)*y */
-
-	    if (upper) {
-		*(unsigned char *)trans = 'N';
-	    } else {
-		*(unsigned char *)trans = 'T';
-	    }
-
-	    _starpu_dtrsm_("Left", uplo, trans, "Non-unit", n, m, &c_b19, &b[b_offset]
-, ldb, &z__[z_offset], ldz);
-
-	} else if (*itype == 3) {
-
-/*           For B*A*x=(lambda)*x; */
-/*           backtransform eigenvectors: x = L*y or U'*y */
-
-	    if (upper) {
-		*(unsigned char *)trans = 'T';
-	    } else {
-		*(unsigned char *)trans = 'N';
-	    }
-
-	    _starpu_dtrmm_("Left", uplo, trans, "Non-unit", n, m, &c_b19, &b[b_offset]
-, ldb, &z__[z_offset], ldz);
-	}
-    }
-
-/*     Set WORK(1) to optimal workspace size. */
-
-    work[1] = (doublereal) lwkopt;
-
-    return 0;
-
-/*     End of DSYGVX */
-
-} /* _starpu_dsygvx_ */
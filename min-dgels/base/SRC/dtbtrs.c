@@ -1,204 +0,0 @@
-/* dtbtrs.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-/* Table of constant values */
-
-static integer c__1 = 1;
-
-/* Subroutine */ int _starpu_dtbtrs_(char *uplo, char *trans, char *diag, integer *n, 
-	integer *kd, integer *nrhs, doublereal *ab, integer *ldab, doublereal 
-	*b, integer *ldb, integer *info)
-{
-    /* System generated locals */
-    integer ab_dim1, ab_offset, b_dim1, b_offset, i__1;
-
-    /* Local variables */
-    integer j;
-    extern logical _starpu_lsame_(char *, char *);
-    extern /* Subroutine */ int _starpu_dtbsv_(char *, char *, char *, integer *, 
-	    integer *, doublereal *, integer *, doublereal *, integer *);
-    logical upper;
-    extern /* Subroutine */ int _starpu_xerbla_(char *, integer *);
-    logical nounit;
-
-
-/*  -- LAPACK routine (version 3.2) -- */
-/*     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd.. */
-/*     November 2006 */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  DTBTRS solves a triangular system of the form */
-
-/*     A * X = B  or  A**T * X = B, */
-
-/*  where A is a triangular band matrix of order N, and B is an */
-/*  N-by NRHS matrix.  A check is made to verify that A is nonsingular. */
-
-/*  Arguments */
-/*  ========= */
-
-/*  UPLO    (input) CHARACTER*1 */
-/*          = 'U':  A is upper triangular; */
-/*          = 'L':  A is lower triangular. */
-
-/*  TRANS   (input) CHARACTER*1 */
-/*          Specifies the form the system of equations: */
-/*          = 'N':  A * X = B  (No transpose) */
-/*          = 'T':  A**T * X = B  (Transpose) */
-/*          = 'C':  A**H * X = B  (Conjugate transpose = Transpose) */
-
-/*  DIAG    (input) CHARACTER*1 */
-/*          = 'N':  A is non-unit triangular; */
-/*          = 'U':  A is unit triangular. */
-
-/*  N       (input) INTEGER */
-/*          The order of the matrix A.  N >= 0. */
-
-/*  KD      (input) INTEGER */
-/*          The number of superdiagonals or subdiagonals of the */
-/*          triangular band matrix A.  KD >= 0. */
-
-/*  NRHS    (input) INTEGER */
-/*          The number of right hand sides, i.e., the number of columns */
-/*          of the matrix B.  NRHS >= 0. */
-
-/*  AB      (input) DOUBLE PRECISION array, dimension (LDAB,N) */
-/*          The upper or lower triangular band matrix A, stored in the */
-/*          first kd+1 rows of AB.  The j-th column of A is stored */
-/*          in the j-th column of the array AB as follows: */
-/*          if UPLO = 'U', AB(kd+1+i-j,j) = A(i,j) for max(1,j-kd)<=i<=j; */
-/*          if UPLO = 'L', AB(1+i-j,j)    = A(i,j) for j<=i<=min(n,j+kd). */
-/*          If DIAG = 'U', the diagonal elements of A are not referenced */
-/*          and are assumed to be 1. */
-
-/*  LDAB    (input) INTEGER */
-/*          The leading dimension of the array AB.  LDAB >= KD+1. */
-
-/*  B       (input/output) DOUBLE PRECISION array, dimension (LDB,NRHS) */
-/*          On entry, the right hand side matrix B. */
-/*          On exit, if INFO = 0, the solution matrix X. */
-
-/*  LDB     (input) INTEGER */
-/*          The leading dimension of the array B.  LDB >= max(1,N). */
-
-/*  INFO    (output) INTEGER */
-/*          = 0:  successful exit */
-/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
-/*          > 0:  if INFO = i, the i-th diagonal element of A is zero, */
-/*                indicating that the matrix is singular and the */
-/*                solutions X have not been computed. */
-
-/*  ===================================================================== */
-
-/*     .. Parameters .. */
-/*     .. */
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. External Functions .. */
-/*     .. */
-/*     .. External Subroutines .. */
-/*     .. */
-/*     .. Intrinsic Functions .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-/*     Test the input parameters. */
-
-    /* Parameter adjustments */
-    ab_dim1 = *ldab;
-    ab_offset = 1 + ab_dim1;
-    ab -= ab_offset;
-    b_dim1 = *ldb;
-    b_offset = 1 + b_dim1;
-    b -= b_offset;
-
-    /* Function Body */
-    *info = 0;
-    nounit = _starpu_lsame_(diag, "N");
-    upper = _starpu_lsame_(uplo, "U");
-    if (! upper && ! _starpu_lsame_(uplo, "L")) {
-	*info = -1;
-    } else if (! _starpu_lsame_(trans, "N") && ! _starpu_lsame_(trans, 
-	    "T") && ! _starpu_lsame_(trans, "C")) {
-	*info = -2;
-    } else if (! nounit && ! _starpu_lsame_(diag, "U")) {
-	*info = -3;
-    } else if (*n < 0) {
-	*info = -4;
-    } else if (*kd < 0) {
-	*info = -5;
-    } else if (*nrhs < 0) {
-	*info = -6;
-    } else if (*ldab < *kd + 1) {
-	*info = -8;
-    } else if (*ldb < max(1,*n)) {
-	*info = -10;
-    }
-    if (*info != 0) {
-	i__1 = -(*info);
-	_starpu_xerbla_("DTBTRS", &i__1);
-	return 0;
-    }
-
-/*     Quick return if possible */
-
-    if (*n == 0) {
-	return 0;
-    }
-
-/*     Check for singularity. */
-
-    if (nounit) {
-	if (upper) {
-	    i__1 = *n;
-	    for (*info = 1; *info <= i__1; ++(*info)) {
-		if (ab[*kd + 1 + *info * ab_dim1] == 0.) {
-		    return 0;
-		}
-/* L10: */
-	    }
-	} else {
-	    i__1 = *n;
-	    for (*info = 1; *info <= i__1; ++(*info)) {
-		if (ab[*info * ab_dim1 + 1] == 0.) {
-		    return 0;
-		}
-/* L20: */
-	    }
-	}
-    }
-    *info = 0;
-
-/*     Solve A * X = B  or  A' * X = B. */
-
-    i__1 = *nrhs;
-    for (j = 1; j <= i__1; ++j) {
-	_starpu_dtbsv_(uplo, trans, diag, n, kd, &ab[ab_offset], ldab, &b[j * b_dim1 
-		+ 1], &c__1);
-/* L30: */
-    }
-
-    return 0;
-
-/*     End of DTBTRS */
-
-} /* _starpu_dtbtrs_ */
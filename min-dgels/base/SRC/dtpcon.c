@@ -1,233 +0,0 @@
-/* dtpcon.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-/* Table of constant values */
-
-static integer c__1 = 1;
-
-/* Subroutine */ int _starpu_dtpcon_(char *norm, char *uplo, char *diag, integer *n, 
-	doublereal *ap, doublereal *rcond, doublereal *work, integer *iwork, 
-	integer *info)
-{
-    /* System generated locals */
-    integer i__1;
-    doublereal d__1;
-
-    /* Local variables */
-    integer ix, kase, kase1;
-    doublereal scale;
-    extern logical _starpu_lsame_(char *, char *);
-    integer isave[3];
-    extern /* Subroutine */ int _starpu_drscl_(integer *, doublereal *, doublereal *, 
-	    integer *);
-    doublereal anorm;
-    logical upper;
-    doublereal xnorm;
-    extern /* Subroutine */ int _starpu_dlacn2_(integer *, doublereal *, doublereal *, 
-	     integer *, doublereal *, integer *, integer *);
-    extern doublereal _starpu_dlamch_(char *);
-    extern integer _starpu_idamax_(integer *, doublereal *, integer *);
-    extern /* Subroutine */ int _starpu_xerbla_(char *, integer *);
-    extern doublereal _starpu_dlantp_(char *, char *, char *, integer *, doublereal *, 
-	     doublereal *);
-    doublereal ainvnm;
-    extern /* Subroutine */ int _starpu_dlatps_(char *, char *, char *, char *, 
-	    integer *, doublereal *, doublereal *, doublereal *, doublereal *, 
-	     integer *);
-    logical onenrm;
-    char normin[1];
-    doublereal smlnum;
-    logical nounit;
-
-
-/*  -- LAPACK routine (version 3.2) -- */
-/*     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd.. */
-/*     November 2006 */
-
-/*     Modified to call DLACN2 in place of DLACON, 5 Feb 03, SJH. */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  DTPCON estimates the reciprocal of the condition number of a packed */
-/*  triangular matrix A, in either the 1-norm or the infinity-norm. */
-
-/*  The norm of A is computed and an estimate is obtained for */
-/*  norm(inv(A)), then the reciprocal of the condition number is */
-/*  computed as */
-/*     RCOND = 1 / ( norm(A) * norm(inv(A)) ). */
-
-/*  Arguments */
-/*  ========= */
-
-/*  NORM    (input) CHARACTER*1 */
-/*          Specifies whether the 1-norm condition number or the */
-/*          infinity-norm condition number is required: */
-/*          = '1' or 'O':  1-norm; */
-/*          = 'I':         Infinity-norm. */
-
-/*  UPLO    (input) CHARACTER*1 */
-/*          = 'U':  A is upper triangular; */
-/*          = 'L':  A is lower triangular. */
-
-/*  DIAG    (input) CHARACTER*1 */
-/*          = 'N':  A is non-unit triangular; */
-/*          = 'U':  A is unit triangular. */
-
-/*  N       (input) INTEGER */
-/*          The order of the matrix A.  N >= 0. */
-
-/*  AP      (input) DOUBLE PRECISION array, dimension (N*(N+1)/2) */
-/*          The upper or lower triangular matrix A, packed columnwise in */
-/*          a linear array.  The j-th column of A is stored in the array */
-/*          AP as follows: */
-/*          if UPLO = 'U', AP(i + (j-1)*j/2) = A(i,j) for 1<=i<=j; */
-/*          if UPLO = 'L', AP(i + (j-1)*(2n-j)/2) = A(i,j) for j<=i<=n. */
-/*          If DIAG = 'U', the diagonal elements of A are not referenced */
-/*          and are assumed to be 1. */
-
-/*  RCOND   (output) DOUBLE PRECISION */
-/*          The reciprocal of the condition number of the matrix A, */
-/*          computed as RCOND = 1/(norm(A) * norm(inv(A))). */
-
-/*  WORK    (workspace) DOUBLE PRECISION array, dimension (3*N) */
-
-/*  IWORK   (workspace) INTEGER array, dimension (N) */
-
-/*  INFO    (output) INTEGER */
-/*          = 0:  successful exit */
-/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
-
-/*  ===================================================================== */
-
-/*     .. Parameters .. */
-/*     .. */
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. Local Arrays .. */
-/*     .. */
-/*     .. External Functions .. */
-/*     .. */
-/*     .. External Subroutines .. */
-/*     .. */
-/*     .. Intrinsic Functions .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-/*     Test the input parameters. */
-
-    /* Parameter adjustments */
-    --iwork;
-    --work;
-    --ap;
-
-    /* Function Body */
-    *info = 0;
-    upper = _starpu_lsame_(uplo, "U");
-    onenrm = *(unsigned char *)norm == '1' || _starpu_lsame_(norm, "O");
-    nounit = _starpu_lsame_(diag, "N");
-
-    if (! onenrm && ! _starpu_lsame_(norm, "I")) {
-	*info = -1;
-    } else if (! upper && ! _starpu_lsame_(uplo, "L")) {
-	*info = -2;
-    } else if (! nounit && ! _starpu_lsame_(diag, "U")) {
-	*info = -3;
-    } else if (*n < 0) {
-	*info = -4;
-    }
-    if (*info != 0) {
-	i__1 = -(*info);
-	_starpu_xerbla_("DTPCON", &i__1);
-	return 0;
-    }
-
-/*     Quick return if possible */
-
-    if (*n == 0) {
-	*rcond = 1.;
-	return 0;
-    }
-
-    *rcond = 0.;
-    smlnum = _starpu_dlamch_("Safe minimum") * (doublereal) max(1,*n);
-
-/*     Compute the norm of the triangular matrix A. */
-
-    anorm = _starpu_dlantp_(norm, uplo, diag, n, &ap[1], &work[1]);
-
-/*     Continue only if ANORM > 0. */
-
-    if (anorm > 0.) {
-
-/*        Estimate the norm of the inverse of A. */
-
-	ainvnm = 0.;
-	*(unsigned char *)normin = 'N';
-	if (onenrm) {
-	    kase1 = 1;
-	} else {
-	    kase1 = 2;
-	}
-	kase = 0;
-L10:
-	_starpu_dlacn2_(n, &work[*n + 1], &work[1], &iwork[1], &ainvnm, &kase, isave);
-	if (kase != 0) {
-	    if (kase == kase1) {
-
-/*              Multiply by inv(A). */
-
-		_starpu_dlatps_(uplo, "No transpose", diag, normin, n, &ap[1], &work[
-			1], &scale, &work[(*n << 1) + 1], info);
-	    } else {
-
-/*              Multiply by inv(A'). */
-
-		_starpu_dlatps_(uplo, "Transpose", diag, normin, n, &ap[1], &work[1], 
-			&scale, &work[(*n << 1) + 1], info);
-	    }
-	    *(unsigned char *)normin = 'Y';
-
-/*           Multiply by 1/SCALE if doing so will not cause overflow. */
-
-	    if (scale != 1.) {
-		ix = _starpu_idamax_(n, &work[1], &c__1);
-		xnorm = (d__1 = work[ix], abs(d__1));
-		if (scale < xnorm * smlnum || scale == 0.) {
-		    goto L20;
-		}
-		_starpu_drscl_(n, &scale, &work[1], &c__1);
-	    }
-	    goto L10;
-	}
-
-/*        Compute the estimate of the reciprocal condition number. */
-
-	if (ainvnm != 0.) {
-	    *rcond = 1. / anorm / ainvnm;
-	}
-    }
-
-L20:
-    return 0;
-
-/*     End of DTPCON */
-
-} /* _starpu_dtpcon_ */
@@ -1,96 +0,0 @@
-/* ilaclr.f -- translated by f2c (version 20061008).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include "f2c.h"
-#include "blaswrap.h"
-
-integer _starpu_ilaclr_(integer *m, integer *n, complex *a, integer *lda)
-{
-    /* System generated locals */
-    integer a_dim1, a_offset, ret_val, i__1, i__2;
-
-    /* Local variables */
-    integer i__, j;
-
-
-/*  -- LAPACK auxiliary routine (version 3.2.1)                        -- */
-
-/*  -- April 2009                                                      -- */
-
-/*  -- LAPACK is a software package provided by Univ. of Tennessee,    -- */
-/*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..-- */
-
-/*     .. Scalar Arguments .. */
-/*     .. */
-/*     .. Array Arguments .. */
-/*     .. */
-
-/*  Purpose */
-/*  ======= */
-
-/*  ILACLR scans A for its last non-zero row. */
-
-/*  Arguments */
-/*  ========= */
-
-/*  M       (input) INTEGER */
-/*          The number of rows of the matrix A. */
-
-/*  N       (input) INTEGER */
-/*          The number of columns of the matrix A. */
-
-/*  A       (input) COMPLEX          array, dimension (LDA,N) */
-/*          The m by n matrix A. */
-
-/*  LDA     (input) INTEGER */
-/*          The leading dimension of the array A. LDA >= max(1,M). */
-
-/*  ===================================================================== */
-
-/*     .. Parameters .. */
-/*     .. */
-/*     .. Local Scalars .. */
-/*     .. */
-/*     .. Executable Statements .. */
-
-/*     Quick test for the common case where one corner is non-zero. */
-    /* Parameter adjustments */
-    a_dim1 = *lda;
-    a_offset = 1 + a_dim1;
-    a -= a_offset;
-
-    /* Function Body */
-    if (*m == 0) {
-	ret_val = *m;
-    } else /* if(complicated condition) */ {
-	i__1 = *m + a_dim1;
-	i__2 = *m + *n * a_dim1;
-	if (a[i__1].r != 0.f || a[i__1].i != 0.f || (a[i__2].r != 0.f || a[
-		i__2].i != 0.f)) {
-	    ret_val = *m;
-	} else {
-/*     Scan up each column tracking the last zero row seen. */
-	    ret_val = 0;
-	    i__1 = *n;
-	    for (j = 1; j <= i__1; ++j) {
-		for (i__ = *m; i__ >= 1; --i__) {
-		    i__2 = i__ + j * a_dim1;
-		    if (a[i__2].r != 0.f || a[i__2].i != 0.f) {
-			break;
-		    }
-		}
-		ret_val = max(ret_val,i__);
-	    }
-	}
-    }
-    return ret_val;
-} /* _starpu_ilaclr_ */
@@ -32,6 +32,7 @@
 #include <datawizard/memory_nodes.h>
 #include <datawizard/memory_manager.h>
 #include <datawizard/memalloc.h>
+#include <datawizard/ooc_prefetch.h>
 
 #include <drivers/cuda/driver_cuda.h>
 #include <drivers/opencl/driver_opencl.h>
@@ -153,6 +154,7 @@ int starpu_disk_register(struct starpu_disk_ops *func, void *parameter, starpu_s
 		_starpu_memory_manager_set_global_memory_size(disk_memnode, size);
 
 	_starpu_mem_chunk_disk_register(disk_memnode);
+	_starpu_ooc_prefetch_register_disk(disk_memnode);
 
 	return disk_memnode;
 }
@@ -161,6 +163,8 @@ void _starpu_disk_unregister(void)
 {
 	int i;
 
+	_starpu_ooc_prefetch_shutdown();
+
 	/* search disk and delete it */
 	for (i = 0; i < STARPU_NMAXDEVS; ++i)
 	{
@@ -472,6 +476,21 @@ static int add_disk_in_list(int devid,  struct starpu_disk_ops *func, void *base
 	return devid;
 }
 
+int _starpu_disk_can_map(int devid)
+{
+	return disk_register_list[devid]->functions->map != NULL;
+}
+
+void *_starpu_disk_map(int devid, void *obj, off_t offset, size_t size)
+{
+	return disk_register_list[devid]->functions->map(disk_register_list[devid]->base, obj, offset, size);
+}
+
+int _starpu_disk_unmap(int devid, void *obj, void *ptr, off_t offset, size_t size)
+{
+	return disk_register_list[devid]->functions->unmap(disk_register_list[devid]->base, obj, ptr, offset, size);
+}
+
 int _starpu_disk_can_copy(int devid1, int devid2)
 {
 	if (disk_register_list[devid1]->functions == disk_register_list[devid2]->functions)
@@ -524,6 +543,19 @@ void _starpu_swap_init(void)
 		return;
 #endif
 
+	}
+	else if (!strcmp(backend, "unistd_mmap"))
+	{
+		ops = &starpu_disk_unistd_mmap_ops;
+	}
+	else if (!strcmp(backend, "unistd_uring"))
+	{
+#ifdef STARPU_HAVE_IO_URING
+		ops = &starpu_disk_unistd_uring_ops;
+#else
+		_STARPU_DISP("Warning: io_uring support is not compiled in, could not enable disk swap\n");
+		return;
+#endif
 	}
 	else if (!strcmp(backend, "leveldb"))
 	{
@@ -551,7 +583,20 @@ void _starpu_swap_init(void)
 
 	size = starpu_getenv_number_default("STARPU_DISK_SWAP_SIZE", -1);
 
-	starpu_disk_swap_node = starpu_disk_register(ops, path, ((size_t) size) << 20);
+	if (starpu_getenv_number_default("STARPU_DISK_SWAP_COMPRESS", 0))
+	{
+		/* starpu_disk_compress_ops only reads the structure while
+		 * registering, path is then handed to the plug method of ops */
+		struct starpu_disk_compress_param param =
+		{
+			.ops = ops,
+			.parameter = path,
+			.threshold = 0,
+		};
+		starpu_disk_swap_node = starpu_disk_register(&starpu_disk_compress_ops, &param, ((size_t) size) << 20);
+	}
+	else
+		starpu_disk_swap_node = starpu_disk_register(ops, path, ((size_t) size) << 20);
 	if (starpu_disk_swap_node < 0)
 	{
 		_STARPU_DISP("Warning: could not enable disk swap %s on %s with size %ld, could not enable disk swap\n", backend, path, (long) size);
@@ -56,6 +56,12 @@ void starpu_disk_free_request(struct _starpu_async_channel *async_channel);
 /** interface to compare memory disk */
 int _starpu_disk_can_copy(int devid1, int devid2);
 
+/** whether the disk backend can map its data in the main memory */
+int _starpu_disk_can_map(int devid);
+/** map \p size bytes of \p obj at \p offset in the main memory, return NULL on failure */
+void *_starpu_disk_map(int devid, void *obj, off_t offset, size_t size);
+int _starpu_disk_unmap(int devid, void *obj, void *ptr, off_t offset, size_t size);
+
 /** change disk flag */
 void _starpu_set_disk_flag(int devid, int flag);
 int _starpu_get_disk_flag(int devid);
@@ -0,0 +1,791 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2013-2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+
+#include <common/config.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef STARPU_HAVE_LZ4
+#include <lz4.h>
+#elif defined(STARPU_HAVE_ZLIB)
+#include <zlib.h>
+#endif
+
+#include <starpu.h>
+#include <common/list.h>
+#include <common/utils.h>
+#include <core/disk.h>
+#include <core/perfmodel/perfmodel.h>
+#include <datawizard/malloc.h>
+
+/* ------------------- compress data before giving it to another backend -------------------  */
+
+/* Data smaller than this are not worth compressing */
+#define STARPU_COMPRESS_THRESHOLD (64*1024)
+/* Re-estimate the compression ratio after writing that many bytes */
+#define STARPU_COMPRESS_RATIO_PERIOD (64*1024*1024)
+
+enum starpu_compress_request_type
+{
+	STARPU_COMPRESS_READ,
+	STARPU_COMPRESS_WRITE,
+	STARPU_COMPRESS_FULL_WRITE
+};
+
+LIST_TYPE(starpu_compress_request,
+	enum starpu_compress_request_type type;
+	struct starpu_compress_base *base;
+	/* Request submitted to the backend, or NULL if the request is
+	 * processed by the I/O thread */
+	void *backend_event;
+	void *obj;
+	void *buf;
+	off_t offset;
+	size_t size;
+	starpu_sem_t finished;
+	int done;
+);
+
+struct starpu_compress_base
+{
+	struct starpu_disk_ops *ops;
+	void *base;
+	size_t threshold;
+	/* Compressed payloads are padded to this, for o_direct-like backends */
+	size_t align;
+	/* Thread measuring the bandwidth of the backend, which gets objects of
+	 * the backend itself, recorded in \p raw */
+	int measuring;
+	starpu_pthread_t measuring_thread;
+	struct starpu_compress_raw *raw;
+	/* I/O thread which compresses and decompresses the asynchronous
+	 * requests, off the path of the driver */
+	int io_run;
+	starpu_pthread_t io_thread;
+	starpu_pthread_mutex_t io_mutex;
+	starpu_pthread_cond_t io_cond;
+	struct starpu_compress_request_list io_list;
+	int node;
+	starpu_pthread_mutex_t mutex;
+	/* Amount of bytes given by StarPU, and actually stored */
+	double logical;
+	double stored;
+	/* Compression ratio currently taken into account in the bus performance */
+	double ratio;
+};
+
+struct starpu_compress_obj
+{
+	void *obj;
+	size_t size;
+	/* Size of the compressed payload, 0 when the data is stored uncompressed */
+	size_t csize;
+};
+
+/* Object of the backend, used by the backend to measure its bandwidth */
+struct starpu_compress_raw
+{
+	struct starpu_compress_raw *next;
+	void *obj;
+};
+
+/* ------------------- codec -------------------  */
+
+/* Compress \p size bytes from \p src into \p dst, return the compressed size,
+ * or 0 if it does not fit in \p dst_size bytes */
+static size_t _starpu_compress(void *dst, size_t dst_size, const void *src, size_t size)
+{
+#ifdef STARPU_HAVE_LZ4
+	if (size > LZ4_MAX_INPUT_SIZE)
+		return 0;
+	int res = LZ4_compress_default(src, dst, size, dst_size > (size_t) INT_MAX ? INT_MAX : (int) dst_size);
+	return res > 0 ? (size_t) res : 0;
+#elif defined(STARPU_HAVE_ZLIB)
+	uLongf dst_len = dst_size;
+	if (compress2(dst, &dst_len, src, size, Z_BEST_SPEED) != Z_OK)
+		return 0;
+	return dst_len;
+#else
+	(void) dst;
+	(void) dst_size;
+	(void) src;
+	(void) size;
+	return 0;
+#endif
+}
+
+static void _starpu_decompress(void *dst, size_t size, const void *src, size_t csize)
+{
+#ifdef STARPU_HAVE_LZ4
+	int res = LZ4_decompress_safe(src, dst, csize, size);
+	STARPU_ASSERT_MSG(res >= 0 && (size_t) res == size, "Corrupted compressed data on disk (got %d bytes instead of %lu)", res, (unsigned long) size);
+#elif defined(STARPU_HAVE_ZLIB)
+	uLongf dst_len = size;
+	int res = uncompress(dst, &dst_len, src, csize);
+	STARPU_ASSERT_MSG(res == Z_OK && dst_len == size, "Corrupted compressed data on disk (zlib error %d)", res);
+#else
+	(void) dst;
+	(void) size;
+	(void) src;
+	(void) csize;
+	STARPU_ABORT_MSG("no compression library was available, data can not have been compressed");
+#endif
+}
+
+/* ------------------- helpers -------------------  */
+
+static size_t _starpu_compress_stored_size(struct starpu_compress_base *base, size_t csize)
+{
+	return (csize + base->align - 1) / base->align * base->align;
+}
+
+/* Size of the buffer receiving the compressed payload: compressing has to save
+ * at least 1/8th of the transfer */
+static size_t _starpu_compress_max_size(struct starpu_compress_base *base, size_t size)
+{
+	size_t max = size - size / 8;
+	return max - max % base->align;
+}
+
+/* Record that \p logical bytes were written, which took \p stored bytes on
+ * the disk, and update the bus performance if the compression ratio changed
+ * noticeably */
+static void _starpu_compress_account(struct starpu_compress_base *base, size_t logical, size_t stored)
+{
+	STARPU_PTHREAD_MUTEX_LOCK(&base->mutex);
+	base->logical += logical;
+	base->stored += stored;
+	if (base->logical >= STARPU_COMPRESS_RATIO_PERIOD)
+	{
+		double ratio = base->logical / base->stored;
+		if (base->node >= 0 && fabs(ratio - base->ratio) > base->ratio / 10)
+		{
+			_STARPU_DEBUG("compression ratio on disk node %d is now %f\n", base->node, ratio);
+			base->ratio = ratio;
+			_starpu_set_bandwidth_disk_ratio(base->node, ratio);
+		}
+		/* Progressively forget about the past */
+		base->logical /= 2;
+		base->stored /= 2;
+	}
+	STARPU_PTHREAD_MUTEX_UNLOCK(&base->mutex);
+}
+
+/* Try to compress \p size bytes from \p buf. On success, return the buffer to
+ * be written to the backend, of size \p stored, containing \p csize bytes of
+ * compressed data. Return NULL if it is not worth it. */
+static void *_starpu_compress_payload(struct starpu_compress_base *base, const void *buf, size_t size, size_t *csize, size_t *stored)
+{
+	void *payload;
+	size_t max;
+
+	if (size < base->threshold)
+		return NULL;
+
+	max = _starpu_compress_max_size(base, size);
+	if (max == 0)
+		return NULL;
+
+	starpu_malloc_flags(&payload, max, 0);
+	*csize = _starpu_compress(payload, max, buf, size);
+	if (*csize == 0)
+	{
+		starpu_free_flags(payload, max, 0);
+		return NULL;
+	}
+	*stored = _starpu_compress_stored_size(base, *csize);
+	memset((char *) payload + *csize, 0, *stored - *csize);
+	return payload;
+}
+
+/* Read the compressed payload of \p obj */
+static void *_starpu_compress_read_payload(struct starpu_compress_base *base, struct starpu_compress_obj *obj)
+{
+	void *payload;
+	size_t stored = _starpu_compress_stored_size(base, obj->csize);
+
+	starpu_malloc_flags(&payload, stored, 0);
+	base->ops->read(base->base, obj->obj, payload, 0, stored);
+	return payload;
+}
+
+/* Decompress the payload into the requested part of the data */
+static void _starpu_compress_unpack(void *payload, size_t csize, size_t obj_size, void *buf, off_t offset, size_t size)
+{
+	if (offset == 0 && size == obj_size)
+		_starpu_decompress(buf, size, payload, csize);
+	else
+	{
+		void *raw;
+		starpu_malloc_flags(&raw, obj_size, 0);
+		_starpu_decompress(raw, obj_size, payload, csize);
+		memcpy(buf, (char *) raw + offset, size);
+		starpu_free_flags(raw, obj_size, 0);
+	}
+}
+
+/* Store \p obj uncompressed again, so that it can be partially modified */
+static void _starpu_compress_expand(struct starpu_compress_base *base, struct starpu_compress_obj *obj)
+{
+	void *payload, *raw;
+
+	payload = _starpu_compress_read_payload(base, obj);
+	starpu_malloc_flags(&raw, obj->size, 0);
+	_starpu_decompress(raw, obj->size, payload, obj->csize);
+	starpu_free_flags(payload, _starpu_compress_stored_size(base, obj->csize), 0);
+
+	if (base->ops->full_write)
+		base->ops->full_write(base->base, obj->obj, raw, obj->size);
+	else
+		base->ops->write(base->base, obj->obj, raw, 0, obj->size);
+	obj->csize = 0;
+	starpu_free_flags(raw, obj->size, 0);
+}
+
+/* Whether \p obj is an object of the backend rather than ours. This is only
+ * the case for the objects that the backend uses to measure its bandwidth,
+ * from the measuring thread. */
+static int _starpu_compress_is_raw(struct starpu_compress_base *base, void *obj)
+{
+	struct starpu_compress_raw *raw;
+	int ret = 0;
+
+	if (!base->raw)
+		return 0;
+
+	STARPU_PTHREAD_MUTEX_LOCK(&base->mutex);
+	for (raw = base->raw; raw; raw = raw->next)
+		if (raw->obj == obj)
+		{
+			ret = 1;
+			break;
+		}
+	STARPU_PTHREAD_MUTEX_UNLOCK(&base->mutex);
+	return ret;
+}
+
+/* ------------------- I/O thread -------------------  */
+
+static int starpu_compress_read(void *base_, void *obj_, void *buf, off_t offset, size_t size);
+static int starpu_compress_write(void *base_, void *obj_, const void *buf, off_t offset, size_t size);
+static int starpu_compress_full_write(void *base_, void *obj_, void *ptr, size_t size);
+
+static void *_starpu_compress_io_thread(void *arg)
+{
+	struct starpu_compress_base *base = arg;
+
+	STARPU_PTHREAD_MUTEX_LOCK(&base->io_mutex);
+	while (base->io_run || !starpu_compress_request_list_empty(&base->io_list))
+	{
+		struct starpu_compress_request *req;
+
+		if (starpu_compress_request_list_empty(&base->io_list))
+		{
+			STARPU_PTHREAD_COND_WAIT(&base->io_cond, &base->io_mutex);
+			continue;
+		}
+		req = starpu_compress_request_list_pop_back(&base->io_list);
+		STARPU_PTHREAD_MUTEX_UNLOCK(&base->io_mutex);
+
+		switch (req->type)
+		{
+			case STARPU_COMPRESS_READ:
+				starpu_compress_read(base, req->obj, req->buf, req->offset, req->size);
+				break;
+			case STARPU_COMPRESS_WRITE:
+				starpu_compress_write(base, req->obj, req->buf, req->offset, req->size);
+				break;
+			case STARPU_COMPRESS_FULL_WRITE:
+				starpu_compress_full_write(base, req->obj, req->buf, req->size);
+				break;
+		}
+		starpu_sem_post(&req->finished);
+
+		STARPU_PTHREAD_MUTEX_LOCK(&base->io_mutex);
+	}
+	STARPU_PTHREAD_MUTEX_UNLOCK(&base->io_mutex);
+
+	return NULL;
+}
+
+/* ------------------- disk operations -------------------  */
+
+static void *starpu_compress_plug(void *parameter, starpu_ssize_t size)
+{
+	struct starpu_disk_compress_param *param = parameter;
+	struct starpu_compress_base *base;
+
+	STARPU_ASSERT_MSG(param && param->ops, "starpu_disk_compress_ops needs a struct starpu_disk_compress_param parameter");
+
+	_STARPU_CALLOC(base, 1, sizeof(*base));
+	base->ops = param->ops;
+	base->threshold = param->threshold ? param->threshold : STARPU_COMPRESS_THRESHOLD;
+	base->align = getpagesize();
+	base->node = -1;
+	base->ratio = 1.;
+	STARPU_PTHREAD_MUTEX_INIT(&base->mutex, NULL);
+	STARPU_HG_DISABLE_CHECKING(base->raw);
+
+#if !defined(STARPU_HAVE_LZ4) && !defined(STARPU_HAVE_ZLIB)
+	_STARPU_DISP("Warning: no compression library was available at compilation time, data will be stored on disk uncompressed\n");
+#endif
+
+	base->base = base->ops->plug(param->parameter, size);
+	if (!base->base)
+	{
+		STARPU_PTHREAD_MUTEX_DESTROY(&base->mutex);
+		free(base);
+		return NULL;
+	}
+
+	STARPU_PTHREAD_MUTEX_INIT(&base->io_mutex, NULL);
+	STARPU_PTHREAD_COND_INIT(&base->io_cond, NULL);
+	starpu_compress_request_list_init(&base->io_list);
+	base->io_run = 1;
+	STARPU_PTHREAD_CREATE(&base->io_thread, NULL, _starpu_compress_io_thread, base);
+
+	return base;
+}
+
+static void starpu_compress_unplug(void *base_)
+{
+	struct starpu_compress_base *base = base_;
+
+	STARPU_PTHREAD_MUTEX_LOCK(&base->io_mutex);
+	base->io_run = 0;
+	STARPU_PTHREAD_COND_BROADCAST(&base->io_cond);
+	STARPU_PTHREAD_MUTEX_UNLOCK(&base->io_mutex);
+	STARPU_PTHREAD_JOIN(base->io_thread, NULL);
+	STARPU_PTHREAD_MUTEX_DESTROY(&base->io_mutex);
+	STARPU_PTHREAD_COND_DESTROY(&base->io_cond);
+
+	base->ops->unplug(base->base);
+	STARPU_PTHREAD_MUTEX_DESTROY(&base->mutex);
+	free(base);
+}
+
+static int starpu_compress_bandwidth(unsigned node, void *base_)
+{
+	struct starpu_compress_base *base = base_;
+	int ret;
+
+	/* The backend measures its raw bandwidth, with objects which it
+	 * allocates from this thread */
+	base->measuring_thread = starpu_pthread_self();
+	base->measuring = 1;
+	ret = base->ops->bandwidth(node, base->base);
+	base->measuring = 0;
+	base->node = node;
+
+	return ret;
+}
+
+static struct starpu_compress_obj *_starpu_compress_obj(void *inner, size_t size)
+{
+	struct starpu_compress_obj *obj;
+
+	_STARPU_MALLOC(obj, sizeof(*obj));
+	obj->obj = inner;
+	obj->size = size;
+	obj->csize = 0;
+	return obj;
+}
+
+static void *starpu_compress_alloc(void *base_, size_t size)
+{
+	struct starpu_compress_base *base = base_;
+	void *inner;
+
+	inner = base->ops->alloc(base->base, size);
+	if (!inner)
+		return NULL;
+
+	if (base->measuring && starpu_pthread_equal(base->measuring_thread, starpu_pthread_self()))
+	{
+		/* The backend expects its own object */
+		struct starpu_compress_raw *raw;
+		_STARPU_MALLOC(raw, sizeof(*raw));
+		raw->obj = inner;
+		STARPU_PTHREAD_MUTEX_LOCK(&base->mutex);
+		raw->next = base->raw;
+		base->raw = raw;
+		STARPU_PTHREAD_MUTEX_UNLOCK(&base->mutex);
+		return inner;
+	}
+
+	return _starpu_compress_obj(inner, size);
+}
+
+static void starpu_compress_free(void *base_, void *obj_, size_t size)
+{
+	struct starpu_compress_base *base = base_;
+	struct starpu_compress_obj *obj = obj_;
+
+	if (_starpu_compress_is_raw(base, obj_))
+	{
+		struct starpu_compress_raw **raw, *next;
+		STARPU_PTHREAD_MUTEX_LOCK(&base->mutex);
+		for (raw = &base->raw; (*raw)->obj != obj_; raw = &(*raw)->next)
+			;
+		next = (*raw)->next;
+		free(*raw);
+		*raw = next;
+		STARPU_PTHREAD_MUTEX_UNLOCK(&base->mutex);
+		base->ops->free(base->base, obj_, size);
+		return;
+	}
+
+	base->ops->free(base->base, obj->obj, size);
+	free(obj);
+}
+
+static void *starpu_compress_open(void *base_, void *pos, size_t size)
+{
+	struct starpu_compress_base *base = base_;
+	void *inner;
+
+	inner = base->ops->open(base->base, pos, size);
+	if (!inner)
+		return NULL;
+
+	/* Existing data is not compressed */
+	return _starpu_compress_obj(inner, size);
+}
+
+static void starpu_compress_close(void *base_, void *obj_, size_t size)
+{
+	struct starpu_compress_base *base = base_;
+	struct starpu_compress_obj *obj = obj_;
+
+	/* Leave the data in its original format for the application */
+	if (obj->csize)
+		_starpu_compress_expand(base, obj);
+
+	base->ops->close(base->base, obj->obj, size);
+	free(obj);
+}
+
+static int starpu_compress_read(void *base_, void *obj_, void *buf, off_t offset, size_t size)
+{
+	struct starpu_compress_base *base = base_;
+	struct starpu_compress_obj *obj = obj_;
+	void *payload;
+
+	if (_starpu_compress_is_raw(base, obj_))
+		return base->ops->read(base->base, obj_, buf, offset, size);
+
+	if (!obj->csize)
+		return base->ops->read(base->base, obj->obj, buf, offset, size);
+
+	payload = _starpu_compress_read_payload(base, obj);
+	_starpu_compress_unpack(payload, obj->csize, obj->size, buf, offset, size);
+	starpu_free_flags(payload, _starpu_compress_stored_size(base, obj->csize), 0);
+	return size;
+}
+
+static int starpu_compress_write(void *base_, void *obj_, const void *buf, off_t offset, size_t size)
+{
+	struct starpu_compress_base *base = base_;
+	struct starpu_compress_obj *obj = obj_;
+	int ret;
+
+	if (_starpu_compress_is_raw(base, obj_))
+		return base->ops->write(base->base, obj_, buf, offset, size);
+
+	if (offset == 0 && size == obj->size)
+	{
+		size_t csize, stored;
+		void *payload = _starpu_compress_payload(base, buf, size, &csize, &stored);
+		if (payload)
+		{
+			ret = base->ops->write(base->base, obj->obj, payload, 0, stored);
+			obj->csize = csize;
+			starpu_free_flags(payload, _starpu_compress_max_size(base, size), 0);
+			_starpu_compress_account(base, size, stored);
+			return ret;
+		}
+		obj->csize = 0;
+	}
+	else if (obj->csize)
+		_starpu_compress_expand(base, obj);
+
+	ret = base->ops->write(base->base, obj->obj, buf, offset, size);
+	_starpu_compress_account(base, size, size);
+	return ret;
+}
+
+static int starpu_compress_full_read(void *base_, void *obj_, void **ptr, size_t *size, unsigned dst_node)
+{
+	struct starpu_compress_base *base = base_;
+	struct starpu_compress_obj *obj = obj_;
+
+	if (_starpu_compress_is_raw(base, obj_))
+		return base->ops->full_read(base->base, obj_, ptr, size, dst_node);
+
+	if (!obj->csize)
+		return base->ops->full_read(base->base, obj->obj, ptr, size, dst_node);
+
+	*size = obj->size;
+	_starpu_malloc_flags_on_node(dst_node, ptr, *size, 0);
+	return starpu_compress_read(base, obj, *ptr, 0, *size);
+}
+
+static int starpu_compress_full_write(void *base_, void *obj_, void *ptr, size_t size)
+{
+	struct starpu_compress_base *base = base_;
+	struct starpu_compress_obj *obj = obj_;
+	size_t csize, stored;
+	void *payload;
+	int ret;
+
+	if (_starpu_compress_is_raw(base, obj_))
+		return base->ops->full_write(base->base, obj_, ptr, size);
+
+	obj->size = size;
+	payload = _starpu_compress_payload(base, ptr, size, &csize, &stored);
+	if (!payload)
+	{
+		obj->csize = 0;
+		ret = base->ops->full_write(base->base, obj->obj, ptr, size);
+		_starpu_compress_account(base, size, size);
+		return ret;
+	}
+
+	ret = base->ops->full_write(base->base, obj->obj, payload, stored);
+	obj->csize = csize;
+	starpu_free_flags(payload, _starpu_compress_max_size(base, size), 0);
+	_starpu_compress_account(base, size, stored);
+	return ret;
+}
+
+/* ------------------- asynchronous operations -------------------  */
+
+/* Requests which do not involve compression are submitted to the backend
+ * directly, the others are processed by the I/O thread */
+
+static struct starpu_compress_request *_starpu_compress_request(struct starpu_compress_base *base, enum starpu_compress_request_type type, void *obj)
+{
+	struct starpu_compress_request *req;
+	_STARPU_CALLOC(req, 1, sizeof(*req));
+	req->type = type;
+	req->base = base;
+	req->obj = obj;
+	return req;
+}
+
+static void *_starpu_compress_backend_request(struct starpu_compress_base *base, enum starpu_compress_request_type type, void *obj, void *backend_event)
+{
+	struct starpu_compress_request *req;
+
+	if (!backend_event)
+		return NULL;
+	req = _starpu_compress_request(base, type, obj);
+	req->backend_event = backend_event;
+	return req;
+}
+
+static void *_starpu_compress_submit(struct starpu_compress_base *base, enum starpu_compress_request_type type, void *obj, void *buf, off_t offset, size_t size)
+{
+	struct starpu_compress_request *req = _starpu_compress_request(base, type, obj);
+
+	req->buf = buf;
+	req->offset = offset;
+	req->size = size;
+	starpu_sem_init(&req->finished, 0, 0);
+
+	STARPU_PTHREAD_MUTEX_LOCK(&base->io_mutex);
+	starpu_compress_request_list_push_front(&base->io_list, req);
+	STARPU_PTHREAD_COND_SIGNAL(&base->io_cond);
+	STARPU_PTHREAD_MUTEX_UNLOCK(&base->io_mutex);
+	return req;
+}
+
+static void *starpu_compress_async_read(void *base_, void *obj_, void *buf, off_t offset, size_t size)
+{
+	struct starpu_compress_base *base = base_;
+	struct starpu_compress_obj *obj = obj_;
+
+	if (base->ops->async_read)
+	{
+		if (_starpu_compress_is_raw(base, obj_))
+			return _starpu_compress_backend_request(base, STARPU_COMPRESS_READ, obj_,
+					base->ops->async_read(base->base, obj_, buf, offset, size));
+		if (!obj->csize)
+			return _starpu_compress_backend_request(base, STARPU_COMPRESS_READ, obj_,
+					base->ops->async_read(base->base, obj->obj, buf, offset, size));
+	}
+
+	/* Decompression happens in the I/O thread */
+	return _starpu_compress_submit(base, STARPU_COMPRESS_READ, obj_, buf, offset, size);
+}
+
+static void *starpu_compress_async_write(void *base_, void *obj_, void *buf, off_t offset, size_t size)
+{
+	struct starpu_compress_base *base = base_;
+	struct starpu_compress_obj *obj = obj_;
+	void *event;
+
+	if (base->ops->async_write)
+	{
+		int full;
+
+		if (_starpu_compress_is_raw(base, obj_))
+			return _starpu_compress_backend_request(base, STARPU_COMPRESS_WRITE, obj_,
+					base->ops->async_write(base->base, obj_, buf, offset, size));
+
+		/* Neither compressing nor expanding */
+		full = offset == 0 && size == obj->size;
+		if (full ? size < base->threshold : !obj->csize)
+		{
+			event = base->ops->async_write(base->base, obj->obj, buf, offset, size);
+			if (event)
+			{
+				if (full)
+					obj->csize = 0;
+				_starpu_compress_account(base, size, size);
+			}
+			return _starpu_compress_backend_request(base, STARPU_COMPRESS_WRITE, obj_, event);
+		}
+	}
+
+	/* Compression happens in the I/O thread */
+	return _starpu_compress_submit(base, STARPU_COMPRESS_WRITE, obj_, buf, offset, size);
+}
+
+static void *starpu_compress_async_full_read(void *base_, void *obj_, void **ptr, size_t *size, unsigned dst_node)
+{
+	struct starpu_compress_base *base = base_;
+	struct starpu_compress_obj *obj = obj_;
+
+	if (_starpu_compress_is_raw(base, obj_))
+	{
+		if (!base->ops->async_full_read)
+			return NULL;
+		return _starpu_compress_backend_request(base, STARPU_COMPRESS_READ, obj_,
+				base->ops->async_full_read(base->base, obj_, ptr, size, dst_node));
+	}
+
+	if (!obj->csize && base->ops->async_full_read)
+		return _starpu_compress_backend_request(base, STARPU_COMPRESS_READ, obj_,
+				base->ops->async_full_read(base->base, obj->obj, ptr, size, dst_node));
+
+	/* Decompression happens in the I/O thread */
+	*size = obj->size;
+	_starpu_malloc_flags_on_node(dst_node, ptr, *size, 0);
+	return _starpu_compress_submit(base, STARPU_COMPRESS_READ, obj_, *ptr, 0, *size);
+}
+
+static void *starpu_compress_async_full_write(void *base_, void *obj_, void *ptr, size_t size)
+{
+	struct starpu_compress_base *base = base_;
+	struct starpu_compress_obj *obj = obj_;
+	void *event;
+
+	if (base->ops->async_full_write)
+	{
+		if (_starpu_compress_is_raw(base, obj_))
+			return _starpu_compress_backend_request(base, STARPU_COMPRESS_FULL_WRITE, obj_,
+					base->ops->async_full_write(base->base, obj_, ptr, size));
+
+		/* Not worth compressing */
+		if (size < base->threshold)
+		{
+			event = base->ops->async_full_write(base->base, obj->obj, ptr, size);
+			if (event)
+			{
+				obj->size = size;
+				obj->csize = 0;
+				_starpu_compress_account(base, size, size);
+			}
+			return _starpu_compress_backend_request(base, STARPU_COMPRESS_FULL_WRITE, obj_, event);
+		}
+	}
+
+	/* Compression happens in the I/O thread */
+	return _starpu_compress_submit(base, STARPU_COMPRESS_FULL_WRITE, obj_, ptr, 0, size);
+}
+
+static void starpu_compress_wait_request(void *async_channel)
+{
+	struct starpu_compress_request *req = async_channel;
+
+	if (req->done)
+		return;
+	if (req->backend_event)
+		req->base->ops->wait_request(req->backend_event);
+	else
+		starpu_sem_wait(&req->finished);
+	req->done = 1;
+}
+
+static int starpu_compress_test_request(void *async_channel)
+{
+	struct starpu_compress_request *req = async_channel;
+
+	if (req->done)
+		return 1;
+	if (req->backend_event)
+		req->done = req->base->ops->test_request(req->backend_event);
+	else
+		req->done = starpu_sem_trywait(&req->finished) == 0;
+	return req->done;
+}
+
+static void starpu_compress_free_request(void *async_channel)
+{
+	struct starpu_compress_request *req = async_channel;
+
+	if (req->backend_event)
+		req->base->ops->free_request(req->backend_event);
+	else
+	{
+		/* The I/O thread may still be posting */
+		if (!req->done)
+			starpu_sem_wait(&req->finished);
+		starpu_sem_destroy(&req->finished);
+	}
+	free(req);
+}
+
+struct starpu_disk_ops starpu_disk_compress_ops =
+{
+	.alloc = starpu_compress_alloc,
+	.free = starpu_compress_free,
+	.open = starpu_compress_open,
+	.close = starpu_compress_close,
+	.read = starpu_compress_read,
+	.write = starpu_compress_write,
+	.plug = starpu_compress_plug,
+	.unplug = starpu_compress_unplug,
+	.copy = NULL,
+	.bandwidth = starpu_compress_bandwidth,
+	.async_read = starpu_compress_async_read,
+	.async_write = starpu_compress_async_write,
+	.async_full_read = starpu_compress_async_full_read,
+	.async_full_write = starpu_compress_async_full_write,
+	.wait_request = starpu_compress_wait_request,
+	.test_request = starpu_compress_test_request,
+	.free_request = starpu_compress_free_request,
+	.full_read = starpu_compress_full_read,
+	.full_write = starpu_compress_full_write,
+	.map = NULL,
+	.unmap = NULL,
+};
@@ -31,6 +31,12 @@
 #  include <unistd.h>
 #endif
 #include <starpu.h>
+#ifdef STARPU_HAVE_IO_URING
+#include <linux/io_uring.h>
+#endif
+#if defined(HAVE_MMAP) || defined(STARPU_HAVE_IO_URING)
+#include <sys/mman.h>
+#endif
 #include <core/disk.h>
 #include <core/perfmodel/perfmodel.h>
 #include <core/disk_ops/unistd/disk_unistd_global.h>
@@ -107,6 +113,10 @@ struct starpu_unistd_base
 	struct starpu_unistd_aiocb_link * hashtable;
 	starpu_pthread_mutex_t mutex;
 #endif
+#ifdef STARPU_HAVE_IO_URING
+	/* NULL for the non-uring variants, or if the ring could not be set up */
+	struct starpu_unistd_uring * uring;
+#endif
 };
 
 #if defined(HAVE_LIBAIO_H)
@@ -132,7 +142,62 @@ struct starpu_unistd_aiocb
 };
 #endif
 
-enum starpu_unistd_wait_type { STARPU_UNISTD_AIOCB, STARPU_UNISTD_COPY };
+#ifdef STARPU_HAVE_IO_URING
+/* Largest transfer Linux performs in one read/write, see read(2) */
+#define URING_MAX_LEN 0x7ffff000
+/* Number of queued requests which triggers a submission without waiting for
+ * the next test/wait */
+#define URING_BATCH 8
+
+/* Submission and completion rings shared with the kernel */
+struct starpu_unistd_uring
+{
+	int fd;
+	unsigned entries;
+	/* Number of SQEs queued in the ring but not submitted to the kernel yet */
+	unsigned to_submit;
+	/* Protects the submission ring and the reaping of the completion ring */
+	starpu_pthread_mutex_t mutex;
+	/* Set while a thread sleeps in the kernel for completions, without
+	 * the mutex. Only that thread reaps completions meanwhile, the other
+	 * waiters sleep on cond until it has reaped them. */
+	int waiting;
+	starpu_pthread_cond_t cond;
+	/* Truncated requests whose remainder could not be queued yet */
+	struct starpu_unistd_uring_req *retry;
+
+	void *sq_ring;
+	size_t sq_ring_size;
+	unsigned *sq_tail;
+	unsigned *sq_mask;
+	unsigned *sq_array;
+	struct io_uring_sqe *sqes;
+	size_t sqes_size;
+
+	void *cq_ring;
+	size_t cq_ring_size;
+	unsigned *cq_head;
+	volatile unsigned *cq_tail;
+	unsigned *cq_mask;
+	struct io_uring_cqe *cqes;
+};
+
+struct starpu_unistd_uring_req
+{
+	volatile int finished;
+	int opcode;
+	int fd;
+	struct starpu_unistd_global_obj *obj;
+	struct starpu_unistd_uring *ring;
+	struct starpu_unistd_uring_req *next;
+	/* What remains to be transferred, advanced on short reads/writes */
+	char *buf;
+	off_t offset;
+	size_t len;
+};
+#endif
+
+enum starpu_unistd_wait_type { STARPU_UNISTD_AIOCB, STARPU_UNISTD_COPY, STARPU_UNISTD_URING };
 
 union starpu_unistd_wait_event
 {
@@ -140,6 +205,9 @@ union starpu_unistd_wait_event
 #if defined(HAVE_LIBAIO_H) || defined(HAVE_AIO_H)
 	struct starpu_unistd_aiocb event_aiocb;
 #endif
+#ifdef STARPU_HAVE_IO_URING
+	struct starpu_unistd_uring_req event_uring;
+#endif
 };
 
 struct starpu_unistd_wait
@@ -204,6 +272,46 @@ static void _starpu_unistd_fini(struct starpu_unistd_global_obj *obj)
 	free(obj);
 }
 
+/* get the current size of the file */
+static size_t _starpu_unistd_get_size(struct starpu_unistd_global_obj *obj)
+{
+	size_t size;
+	int fd = obj->descriptor;
+
+	if (fd < 0)
+		fd = _starpu_unistd_reopen(obj);
+#ifdef STARPU_HAVE_WINDOWS
+	size = _filelength(fd);
+#else
+	struct stat st;
+	int ret = fstat(fd, &st);
+	STARPU_ASSERT(ret==0);
+
+	size = st.st_size;
+#endif
+	if (obj->descriptor < 0)
+		_starpu_unistd_reclose(fd);
+
+	return size;
+}
+
+/* update file size to realise the next good full_read */
+static void _starpu_unistd_set_size(struct starpu_unistd_global_obj *obj, size_t size)
+{
+	if (size == obj->size)
+		return;
+
+	int fd = obj->descriptor;
+
+	if (fd < 0)
+		fd = _starpu_unistd_reopen(obj);
+	int val = _starpu_ftruncate(fd,size);
+	if (obj->descriptor < 0)
+		_starpu_unistd_reclose(fd);
+	STARPU_ASSERT(val == 0);
+	obj->size = size;
+}
+
 /* allocation memory on disk */
 void *starpu_unistd_global_alloc(struct starpu_unistd_global_obj *obj, void *base, size_t size)
 {
@@ -402,22 +510,7 @@ void *starpu_unistd_global_async_read(void *base STARPU_ATTRIBUTE_UNUSED, void *
 
 int starpu_unistd_global_full_read(void *base STARPU_ATTRIBUTE_UNUSED, void *obj, void **ptr, size_t *size, unsigned dst_node)
 {
-	struct starpu_unistd_global_obj *tmp = (struct starpu_unistd_global_obj *) obj;
-	int fd = tmp->descriptor;
-
-	if (fd < 0)
-		fd = _starpu_unistd_reopen(obj);
-#ifdef STARPU_HAVE_WINDOWS
-	*size = _filelength(fd);
-#else
-	struct stat st;
-	int ret = fstat(fd, &st);
-	STARPU_ASSERT(ret==0);
-
-	*size = st.st_size;
-#endif
-	if (tmp->descriptor < 0)
-		_starpu_unistd_reclose(fd);
+	*size = _starpu_unistd_get_size(obj);
 
 	/* Allocated aligned buffer */
 	_starpu_malloc_flags_on_node(dst_node, ptr, *size, 0);
@@ -548,42 +641,65 @@ void *starpu_unistd_global_async_write(void *base STARPU_ATTRIBUTE_UNUSED, void
 
 int starpu_unistd_global_full_write(void *base STARPU_ATTRIBUTE_UNUSED, void *obj, void *ptr, size_t size)
 {
-	struct starpu_unistd_global_obj *tmp = (struct starpu_unistd_global_obj *) obj;
-
-	/* update file size to realise the next good full_read */
-	if(size != tmp->size)
-	{
-		int fd = tmp->descriptor;
-
-		if (fd < 0)
-			fd = _starpu_unistd_reopen(obj);
-		int val = _starpu_ftruncate(fd,size);
-		if (tmp->descriptor < 0)
-			_starpu_unistd_reclose(fd);
-		STARPU_ASSERT(val == 0);
-		tmp->size = size;
-	}
+	_starpu_unistd_set_size(obj, size);
 
 	return starpu_unistd_global_write(base, obj, ptr, 0, size);
 }
 
-#if defined(HAVE_AIO_H)
-void * starpu_unistd_global_async_full_read (void * base, void * obj, void ** ptr, size_t * size, unsigned dst_node)
+#ifdef HAVE_MMAP
+/* map the memory disk in the main memory */
+void *starpu_unistd_global_map(void *base STARPU_ATTRIBUTE_UNUSED, void *obj, off_t offset, size_t size)
 {
 	struct starpu_unistd_global_obj *tmp = (struct starpu_unistd_global_obj *) obj;
+	/* mmap needs a page-aligned offset in the file */
+	size_t shift = offset % getpagesize();
 	int fd = tmp->descriptor;
+	void *ptr;
 
 	if (fd < 0)
 		fd = _starpu_unistd_reopen(obj);
-#ifdef STARPU_HAVE_WINDOWS
-	*size = _filelength(fd);
-#else
-	struct stat st;
-	int ret = fstat(fd, &st);
-	STARPU_ASSERT(ret==0);
 
-	*size = st.st_size;
+	ptr = mmap(NULL, size + shift, PROT_READ | PROT_WRITE, MAP_SHARED, fd, offset - shift);
+
+	/* the mapping keeps a reference on the file by itself */
+	if (tmp->descriptor < 0)
+		_starpu_unistd_reclose(fd);
+
+	if (ptr == MAP_FAILED)
+	{
+		_STARPU_DISP("Warning: could not map %s, mmap failed with error '%s'\n", tmp->path, strerror(errno));
+		return NULL;
+	}
+
+#ifdef MADV_WILLNEED
+	/* We are called when the data is fetched or prefetched, let the
+	 * kernel start reading it into the page cache before the task
+	 * actually touches it */
+	madvise(ptr, size + shift, MADV_WILLNEED);
 #endif
+
+	return (char *) ptr + shift;
+}
+
+/* unmap the memory disk from the main memory */
+int starpu_unistd_global_unmap(void *base STARPU_ATTRIBUTE_UNUSED, void *obj STARPU_ATTRIBUTE_UNUSED, void *ptr, off_t offset, size_t size)
+{
+	size_t shift = offset % getpagesize();
+
+	/* The mapping is shared with the page cache, which read and write
+	 * go through, so there is no need to msync: the kernel writes
+	 * dirty pages back by itself */
+	int ret = munmap((char *) ptr - shift, size + shift);
+	STARPU_ASSERT_MSG(ret == 0, "Starpu Disk unistd munmap failed: errno %d", errno);
+
+	return ret;
+}
+#endif
+
+#if defined(HAVE_AIO_H)
+void * starpu_unistd_global_async_full_read (void * base, void * obj, void ** ptr, size_t * size, unsigned dst_node)
+{
+	*size = _starpu_unistd_get_size(obj);
 #ifdef STARPU_LINUX_SYS
 	/* on Linux, read() (and similar system calls) will transfer at most 0x7ffff000 bytes, see read(2) */
 	/* FIXME: make starpu_unistd_global_test_request and starpu_unistd_global_wait_request
@@ -592,9 +708,6 @@ void * starpu_unistd_global_async_full_read (void * base, void * obj, void ** pt
 		return NULL;
 #endif
 
-	if (tmp->descriptor < 0)
-		_starpu_unistd_reclose(fd);
-
 	/* Allocated aligned buffer */
 	_starpu_malloc_flags_on_node(dst_node, ptr, *size, 0);
 	return starpu_unistd_global_async_read(base, obj, *ptr, 0, *size);
@@ -602,8 +715,6 @@ void * starpu_unistd_global_async_full_read (void * base, void * obj, void ** pt
 
 void * starpu_unistd_global_async_full_write (void * base, void * obj, void * ptr, size_t size)
 {
-	struct starpu_unistd_global_obj *tmp = (struct starpu_unistd_global_obj *) obj;
-
 #ifdef STARPU_LINUX_SYS
 	/* on Linux, write() (and similar system calls) will transfer at most 0x7ffff000 bytes, see write(2) */
 	/* FIXME: make starpu_unistd_global_test_request and starpu_unistd_global_wait_request
@@ -612,21 +723,303 @@ void * starpu_unistd_global_async_full_write (void * base, void * obj, void * pt
 		return NULL;
 #endif
 
-	/* update file size to realise the next good full_read */
-	if(size != tmp->size)
+	_starpu_unistd_set_size(obj, size);
+
+	return starpu_unistd_global_async_write(base, obj, ptr, 0, size);
+}
+#endif
+
+#ifdef STARPU_HAVE_IO_URING
+/* ------------------- io_uring support -------------------  */
+
+static int _starpu_unistd_uring_enter(struct starpu_unistd_uring *ring, unsigned to_submit, unsigned min_complete, unsigned flags)
+{
+	return syscall(__NR_io_uring_enter, ring->fd, to_submit, min_complete, flags, NULL, 0);
+}
+
+static struct starpu_unistd_uring *_starpu_unistd_uring_setup(unsigned entries)
+{
+	struct starpu_unistd_uring *ring;
+	struct io_uring_params p;
+	int fd;
+
+	memset(&p, 0, sizeof(p));
+	fd = syscall(__NR_io_uring_setup, entries, &p);
+	if (fd < 0)
 	{
-		int fd = tmp->descriptor;
+		_STARPU_DISP("Warning: io_uring_setup failed with error '%s', the unistd_uring disk backend will use synchronous I/O\n", strerror(errno));
+		return NULL;
+	}
+	if (!(p.features & IORING_FEAT_RW_CUR_POS))
+	{
+		/* IORING_OP_READ/WRITE appeared along this feature in Linux 5.6 */
+		_STARPU_DISP("Warning: io_uring is too old, the unistd_uring disk backend will use synchronous I/O\n");
+		close(fd);
+		return NULL;
+	}
 
-		if (fd < 0)
-			fd = _starpu_unistd_reopen(obj);
-		int val = _starpu_ftruncate(fd,size);
-		if (tmp->descriptor < 0)
-			_starpu_unistd_reclose(fd);
-		STARPU_ASSERT(val == 0);
-		tmp->size = size;
+	_STARPU_CALLOC(ring, 1, sizeof(*ring));
+	ring->fd = fd;
+	ring->entries = p.sq_entries;
+
+	ring->sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+	ring->cq_ring_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	if (p.features & IORING_FEAT_SINGLE_MMAP)
+	{
+		/* Both rings live in the same mapping */
+		if (ring->cq_ring_size > ring->sq_ring_size)
+			ring->sq_ring_size = ring->cq_ring_size;
+		ring->cq_ring_size = ring->sq_ring_size;
 	}
 
-	return starpu_unistd_global_async_write(base, obj, ptr, 0, size);
+	ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+	if (ring->sq_ring == MAP_FAILED)
+		goto err_sq;
+	if (p.features & IORING_FEAT_SINGLE_MMAP)
+		ring->cq_ring = ring->sq_ring;
+	else
+	{
+		ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+		if (ring->cq_ring == MAP_FAILED)
+			goto err_cq;
+	}
+	ring->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+	ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+	if (ring->sqes == MAP_FAILED)
+		goto err_sqes;
+
+	ring->sq_tail = (unsigned *) ((char *) ring->sq_ring + p.sq_off.tail);
+	ring->sq_mask = (unsigned *) ((char *) ring->sq_ring + p.sq_off.ring_mask);
+	ring->sq_array = (unsigned *) ((char *) ring->sq_ring + p.sq_off.array);
+	ring->cq_head = (unsigned *) ((char *) ring->cq_ring + p.cq_off.head);
+	ring->cq_tail = (volatile unsigned *) ((char *) ring->cq_ring + p.cq_off.tail);
+	ring->cq_mask = (unsigned *) ((char *) ring->cq_ring + p.cq_off.ring_mask);
+	ring->cqes = (struct io_uring_cqe *) ((char *) ring->cq_ring + p.cq_off.cqes);
+
+	STARPU_PTHREAD_MUTEX_INIT(&ring->mutex, NULL);
+	STARPU_PTHREAD_COND_INIT(&ring->cond, NULL);
+
+	return ring;
+
+err_sqes:
+	if (ring->cq_ring != ring->sq_ring)
+		munmap(ring->cq_ring, ring->cq_ring_size);
+err_cq:
+	munmap(ring->sq_ring, ring->sq_ring_size);
+err_sq:
+	_STARPU_DISP("Warning: could not map io_uring rings, mmap failed with error '%s', the unistd_uring disk backend will use synchronous I/O\n", strerror(errno));
+	close(fd);
+	free(ring);
+	return NULL;
+}
+
+static void _starpu_unistd_uring_destroy(struct starpu_unistd_uring *ring)
+{
+	STARPU_ASSERT(ring->to_submit == 0 && !ring->retry);
+	munmap(ring->sqes, ring->sqes_size);
+	if (ring->cq_ring != ring->sq_ring)
+		munmap(ring->cq_ring, ring->cq_ring_size);
+	munmap(ring->sq_ring, ring->sq_ring_size);
+	close(ring->fd);
+	STARPU_PTHREAD_COND_DESTROY(&ring->cond);
+	STARPU_PTHREAD_MUTEX_DESTROY(&ring->mutex);
+	free(ring);
+}
+
+/* Hand all queued SQEs to the kernel with one system call. Must be called with the ring mutex held */
+static void _starpu_unistd_uring_submit(struct starpu_unistd_uring *ring)
+{
+	while (ring->to_submit)
+	{
+		int ret = _starpu_unistd_uring_enter(ring, ring->to_submit, 0, 0);
+		if (ret < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			/* The kernel is short on resources, we will retry on next test/wait */
+			STARPU_ASSERT_MSG(errno == EAGAIN || errno == EBUSY, "Starpu Disk unistd io_uring_enter failed: errno %d", errno);
+			return;
+		}
+		if (ret == 0)
+			return;
+		ring->to_submit -= ret;
+	}
+}
+
+/* Write the SQE of the request, the submission ring must have room for it.
+ * Must be called with the ring mutex held */
+static void _starpu_unistd_uring_push(struct starpu_unistd_uring *ring, struct starpu_unistd_uring_req *req)
+{
+	unsigned tail = *ring->sq_tail;
+	unsigned index = tail & *ring->sq_mask;
+	struct io_uring_sqe *sqe = &ring->sqes[index];
+
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->opcode = req->opcode;
+	sqe->fd = req->fd;
+	sqe->addr = (uintptr_t) req->buf;
+	sqe->len = STARPU_MIN(req->len, URING_MAX_LEN);
+	sqe->off = req->offset;
+	sqe->user_data = (uintptr_t) req;
+	ring->sq_array[index] = index;
+
+	/* The kernel must see the SQE before the new tail */
+	STARPU_WMB();
+	*ring->sq_tail = tail + 1;
+	ring->to_submit++;
+}
+
+/* Queue the remainders of the truncated requests, as long as there is room */
+static void _starpu_unistd_uring_retry(struct starpu_unistd_uring *ring)
+{
+	while (ring->retry && ring->to_submit < ring->entries)
+	{
+		struct starpu_unistd_uring_req *req = ring->retry;
+		ring->retry = req->next;
+		_starpu_unistd_uring_push(ring, req);
+	}
+	_starpu_unistd_uring_submit(ring);
+}
+
+/* Process the available completions, this does not need any system call.
+ * Returns the number of completions. Must be called with the ring mutex held,
+ * and while no other thread waits for completions */
+static unsigned _starpu_unistd_uring_reap(struct starpu_unistd_uring *ring)
+{
+	unsigned head = *ring->cq_head;
+	unsigned tail = *ring->cq_tail;
+
+	if (head == tail)
+	{
+		_starpu_unistd_uring_retry(ring);
+		return 0;
+	}
+
+	/* Read the CQEs only after having read the tail */
+	STARPU_RMB();
+	while (head != tail)
+	{
+		struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cq_mask];
+		struct starpu_unistd_uring_req *req = (struct starpu_unistd_uring_req *) (uintptr_t) cqe->user_data;
+		int res = cqe->res;
+		head++;
+
+		STARPU_ASSERT_MSG(res >= 0, "Starpu Disk unistd io_uring %s failed: offset %lu got errno %d", req->opcode == IORING_OP_READ ? "read" : "write", (unsigned long) req->offset, -res);
+		STARPU_ASSERT_MSG(res > 0 || req->len == 0, "Starpu Disk unistd io_uring %s hit end of file: offset %lu", req->opcode == IORING_OP_READ ? "read" : "write", (unsigned long) req->offset);
+		if ((size_t) res < req->len)
+		{
+			/* Truncated transfer, queue the remainder once we are
+			 * done with the completion ring */
+			req->buf += res;
+			req->offset += res;
+			req->len -= res;
+			req->next = ring->retry;
+			ring->retry = req;
+		}
+		else
+			req->finished = 1;
+	}
+
+	/* We are done reading the CQEs, let the kernel reuse them */
+	STARPU_SYNCHRONIZE();
+	tail -= *ring->cq_head;
+	*ring->cq_head = head;
+
+	_starpu_unistd_uring_retry(ring);
+	return tail;
+}
+
+/* Put the request in the submission ring. Must be called with the ring mutex held */
+static void _starpu_unistd_uring_queue(struct starpu_unistd_uring *ring, struct starpu_unistd_uring_req *req)
+{
+	while (ring->to_submit == ring->entries)
+	{
+		/* Submission ring is full, flush it */
+		_starpu_unistd_uring_submit(ring);
+		if (ring->to_submit < ring->entries)
+			break;
+
+		/* The kernel is short on resources, make room by reaping
+		 * completions, unless the waiting thread does it */
+		if (!ring->waiting && _starpu_unistd_uring_reap(ring))
+			continue;
+
+		/* Back off to let the requests in flight complete */
+		STARPU_PTHREAD_MUTEX_UNLOCK(&ring->mutex);
+		starpu_usleep(10);
+		STARPU_PTHREAD_MUTEX_LOCK(&ring->mutex);
+	}
+
+	_starpu_unistd_uring_push(ring, req);
+}
+
+static void *_starpu_unistd_uring_async_rw(struct starpu_unistd_base *fileBase, struct starpu_unistd_global_obj *obj, void *buf, off_t offset, size_t size, int opcode)
+{
+	struct starpu_unistd_uring *ring = fileBase->uring;
+
+	if (!ring)
+		/* Let the caller fall back to synchronous I/O */
+		return NULL;
+
+	struct starpu_unistd_wait * event;
+	_STARPU_CALLOC(event, 1,sizeof(*event));
+	event->type = STARPU_UNISTD_URING;
+	struct starpu_unistd_uring_req *req = &event->event.event_uring;
+	req->opcode = opcode;
+	req->fd = obj->descriptor;
+	if (req->fd < 0)
+		req->fd = _starpu_unistd_reopen(obj);
+	req->obj = obj;
+	req->ring = ring;
+	req->buf = buf;
+	req->offset = offset;
+	req->len = size;
+
+	STARPU_PTHREAD_MUTEX_LOCK(&ring->mutex);
+	_starpu_unistd_uring_queue(ring, req);
+	/* Requests are otherwise submitted in batch by the next test/wait */
+	if (ring->to_submit >= URING_BATCH)
+		_starpu_unistd_uring_submit(ring);
+	STARPU_PTHREAD_MUTEX_UNLOCK(&ring->mutex);
+
+	return event;
+}
+
+void *starpu_unistd_global_uring_async_read(void *base, void *obj, void *buf, off_t offset, size_t size)
+{
+	return _starpu_unistd_uring_async_rw(base, obj, buf, offset, size, IORING_OP_READ);
+}
+
+void *starpu_unistd_global_uring_async_write(void *base, void *obj, void *buf, off_t offset, size_t size)
+{
+	return _starpu_unistd_uring_async_rw(base, obj, buf, offset, size, IORING_OP_WRITE);
+}
+
+void *starpu_unistd_global_uring_async_full_read(void *base, void *obj, void **ptr, size_t *size, unsigned dst_node)
+{
+	struct starpu_unistd_base *fileBase = (struct starpu_unistd_base *) base;
+
+	if (!fileBase->uring)
+		return NULL;
+
+	*size = _starpu_unistd_get_size(obj);
+
+	/* Allocated aligned buffer */
+	_starpu_malloc_flags_on_node(dst_node, ptr, *size, 0);
+	/* Truncated transfers are resubmitted, so there is no size limitation here */
+	return starpu_unistd_global_uring_async_read(base, obj, *ptr, 0, *size);
+}
+
+void *starpu_unistd_global_uring_async_full_write(void *base, void *obj, void *ptr, size_t size)
+{
+	struct starpu_unistd_base *fileBase = (struct starpu_unistd_base *) base;
+
+	if (!fileBase->uring)
+		return NULL;
+
+	_starpu_unistd_set_size(obj, size);
+
+	return starpu_unistd_global_uring_async_write(base, obj, ptr, 0, size);
 }
 #endif
 
@@ -706,6 +1099,9 @@ void *starpu_unistd_global_plug(void *parameter, starpu_ssize_t size STARPU_ATTR
 	base->created = 0;
 	base->path = strdup((char *) parameter);
 	STARPU_ASSERT(base->path);
+#ifdef STARPU_HAVE_IO_URING
+	base->uring = NULL;
+#endif
 
 	if (!(stat(base->path, &buf) == 0 && S_ISDIR(buf.st_mode)))
 	{
@@ -739,6 +1135,19 @@ void *starpu_unistd_global_plug(void *parameter, starpu_ssize_t size STARPU_ATTR
 	return (void *) base;
 }
 
+#ifdef STARPU_HAVE_IO_URING
+/* same as starpu_unistd_global_plug, with an io_uring ring for asynchronous requests */
+void *starpu_unistd_global_uring_plug(void *parameter, starpu_ssize_t size)
+{
+	struct starpu_unistd_base * base = starpu_unistd_global_plug(parameter, size);
+	unsigned nb_event = MAX_PENDING_REQUESTS_PER_NODE + MAX_PENDING_PREFETCH_REQUESTS_PER_NODE + MAX_PENDING_IDLE_REQUESTS_PER_NODE;
+
+	base->uring = _starpu_unistd_uring_setup(nb_event);
+
+	return (void *) base;
+}
+#endif
+
 #ifdef STARPU_UNISTD_USE_COPY
 static void ending_working_thread(struct starpu_unistd_copy_thread *internal_copy_thread)
 {
@@ -761,6 +1170,10 @@ void starpu_unistd_global_unplug(void *base)
 #if defined(HAVE_LIBAIO_H)
 	STARPU_PTHREAD_MUTEX_DESTROY(&fileBase->mutex);
 	io_destroy(fileBase->ctx);
+#endif
+#ifdef STARPU_HAVE_IO_URING
+	if (fileBase->uring)
+		_starpu_unistd_uring_destroy(fileBase->uring);
 #endif
 	if (fileBase->created)
 		rmdir(fileBase->path);
@@ -932,6 +1345,55 @@ void starpu_unistd_global_wait_request(void *async_channel)
 		}
 #endif
 
+#ifdef STARPU_HAVE_IO_URING
+		case STARPU_UNISTD_URING :
+		{
+			struct starpu_unistd_uring_req *req = &event->event.event_uring;
+			struct starpu_unistd_uring *ring = req->ring;
+
+			STARPU_PTHREAD_MUTEX_LOCK(&ring->mutex);
+			if (!ring->waiting)
+				_starpu_unistd_uring_reap(ring);
+			while (!req->finished)
+			{
+				int ret;
+
+				if (ring->waiting)
+				{
+					/* Another thread is sleeping for completions, it will
+					 * reap ours */
+					STARPU_PTHREAD_COND_WAIT(&ring->cond, &ring->mutex);
+					continue;
+				}
+
+				/* Submit what is pending, and sleep until a completion
+				 * comes, letting the other threads submit meanwhile */
+				_starpu_unistd_uring_retry(ring);
+				if (ring->to_submit)
+				{
+					/* The kernel is short on resources, our request
+					 * may not even be in flight, back off */
+					STARPU_PTHREAD_MUTEX_UNLOCK(&ring->mutex);
+					starpu_usleep(10);
+					STARPU_PTHREAD_MUTEX_LOCK(&ring->mutex);
+					if (!ring->waiting)
+						_starpu_unistd_uring_reap(ring);
+					continue;
+				}
+				ring->waiting = 1;
+				STARPU_PTHREAD_MUTEX_UNLOCK(&ring->mutex);
+				ret = _starpu_unistd_uring_enter(ring, 0, 1, IORING_ENTER_GETEVENTS);
+				STARPU_ASSERT_MSG(ret >= 0 || errno == EINTR || errno == EAGAIN || errno == EBUSY, "Starpu Disk unistd io_uring_enter failed: errno %d", errno);
+				STARPU_PTHREAD_MUTEX_LOCK(&ring->mutex);
+				ring->waiting = 0;
+				_starpu_unistd_uring_reap(ring);
+				STARPU_PTHREAD_COND_BROADCAST(&ring->cond);
+			}
+			STARPU_PTHREAD_MUTEX_UNLOCK(&ring->mutex);
+			break;
+		}
+#endif
+
 		default :
 			STARPU_ABORT_MSG();
 			break;
@@ -1018,6 +1480,27 @@ int starpu_unistd_global_test_request(void *async_channel)
 		}
 #endif
 
+#ifdef STARPU_HAVE_IO_URING
+		case STARPU_UNISTD_URING :
+		{
+			struct starpu_unistd_uring_req *req = &event->event.event_uring;
+			struct starpu_unistd_uring *ring = req->ring;
+
+			if (req->finished)
+				return 1;
+
+			/* Flush the batch and poll the completion ring, unless a
+			 * waiting thread is about to reap it */
+			STARPU_PTHREAD_MUTEX_LOCK(&ring->mutex);
+			_starpu_unistd_uring_submit(ring);
+			if (!ring->waiting)
+				_starpu_unistd_uring_reap(ring);
+			STARPU_PTHREAD_MUTEX_UNLOCK(&ring->mutex);
+
+			return req->finished;
+		}
+#endif
+
 		default :
 			STARPU_ABORT_MSG();
 			break;
@@ -1067,6 +1550,17 @@ void starpu_unistd_global_free_request(void *async_channel)
 		}
 #endif
 
+#ifdef STARPU_HAVE_IO_URING
+		case STARPU_UNISTD_URING :
+		{
+			struct starpu_unistd_uring_req *req = &event->event.event_uring;
+			if (req->obj->descriptor < 0)
+				_starpu_unistd_reclose(req->fd);
+			free(event);
+			break;
+		}
+#endif
+
 		default :
 			STARPU_ABORT_MSG();
 			break;
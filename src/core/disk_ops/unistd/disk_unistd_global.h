@@ -72,6 +72,17 @@ int starpu_unistd_global_full_write (void * base, void * obj, void * ptr, size_t
 #ifdef STARPU_UNISTD_USE_COPY
 void *	starpu_unistd_global_copy(void *base_src, void* obj_src, off_t offset_src,  void *base_dst, void* obj_dst, off_t offset_dst, size_t size);
 #endif
+#ifdef HAVE_MMAP
+void * starpu_unistd_global_map (void *base, void *obj, off_t offset, size_t size);
+int starpu_unistd_global_unmap (void *base, void *obj, void *ptr, off_t offset, size_t size);
+#endif
+#ifdef STARPU_HAVE_IO_URING
+void * starpu_unistd_global_uring_plug (void *parameter, starpu_ssize_t size);
+void * starpu_unistd_global_uring_async_read (void *base, void *obj, void *buf, off_t offset, size_t size);
+void * starpu_unistd_global_uring_async_write (void *base, void *obj, void *buf, off_t offset, size_t size);
+void * starpu_unistd_global_uring_async_full_read (void * base, void * obj, void ** ptr, size_t * size, unsigned dst_node);
+void * starpu_unistd_global_uring_async_full_write (void * base, void * obj, void * ptr, size_t size);
+#endif
 
 #pragma GCC visibility pop
 
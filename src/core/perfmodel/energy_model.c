@@ -291,3 +291,391 @@ static int add_event(int eventSet, int socket)
 }
 #endif
 #endif
+
+/*
+ * Sampling mode: a helper thread periodically reads the RAPL energy counters
+ * exposed by the Linux powercap interface, and the package and DRAM energy of
+ * each socket is attributed to the tasks which ran on it in proportion to
+ * their duration. The energy consumed by a socket during a sampling period,
+ * divided by the time spent by tasks on it during that period, gives the
+ * energy consumed by one microsecond of task, which is applied to the tasks
+ * running during the next period.
+ */
+
+int _starpu_energy_sampling_enabled;
+
+#if defined(STARPU_LINUX_SYS) && !defined(STARPU_SIMGRID)
+#include <dirent.h>
+
+#define POWERCAP_DIR "/sys/class/powercap"
+
+struct energy_zone
+{
+	/** The energy_uj file of the zone */
+	char path[PATH_LENGTH];
+	unsigned socket;
+	/** Value at which the counter wraps around, in µJ */
+	unsigned long long max_range;
+	/** Value read at the previous sample, in µJ */
+	unsigned long long last;
+};
+
+struct energy_socket
+{
+	starpu_pthread_mutex_t mutex;
+	/** Time spent by the tasks completed on the socket, in µs */
+	double busy;
+	/** Number of tasks currently running on the socket, and the sum of
+	 * their start times */
+	unsigned nrunning;
+	double running_start;
+	/** Tasks time at the previous sample */
+	double last_busy;
+	/** Energy read since the previous sample, in J */
+	double energy;
+	/** Whether a counter could not be read at the current sample */
+	unsigned unread;
+	/** Time of the previous sample */
+	double last_time;
+	/** Energy consumed by one µs of task from the initialization until
+	 * the previous sample, and since the previous sample, per µs */
+	double integral;
+	double rate;
+};
+
+static struct energy_zone *energy_zones;
+static unsigned energy_nzones;
+static struct energy_socket *energy_sockets;
+static unsigned energy_nsockets;
+
+/* Socket of each worker, -1 if its energy is not sampled */
+static int energy_worker_socket[STARPU_NMAXWORKERS];
+/* Start time of the task running on each worker, and the value of the
+ * integral of its socket at that time */
+static double energy_worker_start[STARPU_NMAXWORKERS];
+static double energy_worker_integral[STARPU_NMAXWORKERS];
+
+static unsigned energy_sampling_period;
+static volatile int energy_sampling_stop;
+static starpu_pthread_t energy_sampling_thread;
+
+static int read_ull(const char *path, unsigned long long *val)
+{
+	FILE *f = fopen(path, "r");
+	int ret;
+	if (!f)
+		return -1;
+	ret = fscanf(f, "%llu", val);
+	fclose(f);
+	return ret == 1 ? 0 : -1;
+}
+
+static int read_name(const char *dir, char *name, size_t maxlen)
+{
+	char path[PATH_LENGTH];
+	FILE *f;
+	snprintf(path, sizeof(path), "%s/name", dir);
+	f = fopen(path, "r");
+	if (!f)
+		return -1;
+	if (!fgets(name, maxlen, f))
+	{
+		fclose(f);
+		return -1;
+	}
+	fclose(f);
+	name[strcspn(name, "\n")] = 0;
+	return 0;
+}
+
+static void add_zone(const char *dir, unsigned socket)
+{
+	struct energy_zone zone;
+
+	if (snprintf(zone.path, sizeof(zone.path), "%s/energy_uj", dir) >= (int) sizeof(zone.path) || read_ull(zone.path, &zone.last))
+	{
+		_STARPU_DISP("Warning: could not read %s, its energy will not be sampled. Perhaps your system requires to run measurements as root?\n", zone.path);
+		return;
+	}
+
+	char path[PATH_LENGTH];
+	snprintf(path, sizeof(path), "%s/max_energy_range_uj", dir);
+	if (read_ull(path, &zone.max_range))
+		zone.max_range = 0;
+	zone.socket = socket;
+
+	_STARPU_REALLOC(energy_zones, (energy_nzones + 1) * sizeof(*energy_zones));
+	energy_zones[energy_nzones++] = zone;
+	if (socket >= energy_nsockets)
+		energy_nsockets = socket + 1;
+}
+
+/* Find the package zones and their DRAM subzones */
+static void find_zones(const char *powercap_dir)
+{
+	DIR *dir = opendir(powercap_dir);
+	struct dirent *entry;
+	if (!dir)
+		return;
+
+	while ((entry = readdir(dir)))
+	{
+		char zone_dir[PATH_LENGTH], name[32];
+		unsigned zone, socket;
+		int n;
+
+		if (sscanf(entry->d_name, "intel-rapl:%u%n", &zone, &n) != 1 || entry->d_name[n])
+			continue;
+		if (snprintf(zone_dir, sizeof(zone_dir), "%s/%s", powercap_dir, entry->d_name) >= (int) sizeof(zone_dir))
+			continue;
+		if (read_name(zone_dir, name, sizeof(name)) || sscanf(name, "package-%u", &socket) != 1)
+			continue;
+		add_zone(zone_dir, socket);
+
+		DIR *subdir = opendir(zone_dir);
+		struct dirent *subentry;
+		if (!subdir)
+			continue;
+		while ((subentry = readdir(subdir)))
+		{
+			char subzone_dir[PATH_LENGTH];
+			unsigned parent, subzone;
+
+			if (sscanf(subentry->d_name, "intel-rapl:%u:%u%n", &parent, &subzone, &n) != 2 || subentry->d_name[n] || parent != zone)
+				continue;
+			if (snprintf(subzone_dir, sizeof(subzone_dir), "%s/%s", zone_dir, subentry->d_name) >= (int) sizeof(subzone_dir))
+				continue;
+			if (read_name(subzone_dir, name, sizeof(name)) || strcmp(name, "dram"))
+				continue;
+			add_zone(subzone_dir, socket);
+		}
+		closedir(subdir);
+	}
+	closedir(dir);
+}
+
+/* Return the package of the core the worker is bound to */
+static int get_worker_socket(struct _starpu_worker *worker)
+{
+	unsigned long long package;
+	char path[PATH_LENGTH];
+	unsigned cpu = worker->bindid;
+
+	if (worker->arch != STARPU_CPU_WORKER || worker->bindid < 0)
+		return -1;
+
+#ifdef STARPU_HAVE_HWLOC
+	struct _starpu_machine_config *config = _starpu_get_machine_config();
+	hwloc_obj_t obj = hwloc_get_obj_by_depth(config->topology.hwtopology, config->pu_depth, worker->bindid);
+	if (!obj)
+		return -1;
+	cpu = obj->os_index;
+#endif
+
+	snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", cpu);
+	if (read_ull(path, &package))
+		package = 0;
+	return package < energy_nsockets ? (int) package : -1;
+}
+
+/* Time spent by the tasks on the socket until now, called with the socket mutex held */
+static double socket_busy(struct energy_socket *socket, double now)
+{
+	return socket->busy + socket->nrunning * now - socket->running_start;
+}
+
+static void sample_energy(void)
+{
+	unsigned i;
+	double now;
+
+	for (i = 0; i < energy_nzones; i++)
+	{
+		struct energy_zone *zone = &energy_zones[i];
+		unsigned long long val, delta;
+
+		if (read_ull(zone->path, &val))
+		{
+			/* Its energy will be read at the next sample */
+			energy_sockets[zone->socket].unread = 1;
+			continue;
+		}
+		if (val >= zone->last)
+			delta = val - zone->last;
+		else
+			/* The counter wrapped around */
+			delta = val + zone->max_range - zone->last;
+		zone->last = val;
+		energy_sockets[zone->socket].energy += delta / 1e6;
+	}
+
+	now = starpu_timing_now();
+	for (i = 0; i < energy_nsockets; i++)
+	{
+		struct energy_socket *socket = &energy_sockets[i];
+
+		STARPU_PTHREAD_MUTEX_LOCK(&socket->mutex);
+		double busy = socket_busy(socket, now);
+		double delta = busy - socket->last_busy;
+
+		socket->integral += socket->rate * (now - socket->last_time);
+		socket->last_time = now;
+		if (socket->unread)
+			/* Compute the rate over this period and the next one */
+			socket->unread = 0;
+		else if (delta > 0.)
+		{
+			/* Otherwise no task ran, keep the previous rate */
+			socket->rate = socket->energy / delta;
+			socket->energy = 0.;
+			socket->last_busy = busy;
+		}
+		STARPU_PTHREAD_MUTEX_UNLOCK(&socket->mutex);
+	}
+}
+
+static void *energy_sampling_func(void *arg)
+{
+	(void) arg;
+	starpu_pthread_setname("energy sampling");
+
+	while (!energy_sampling_stop)
+	{
+		unsigned slept;
+		/* Sleep by small steps to terminate quickly */
+		for (slept = 0; slept < energy_sampling_period && !energy_sampling_stop; slept += 10)
+			starpu_usleep(STARPU_MIN(10, energy_sampling_period - slept) * 1000);
+		sample_energy();
+	}
+	return NULL;
+}
+
+void _starpu_energy_sampling_init(void)
+{
+	struct _starpu_machine_config *config = _starpu_get_machine_config();
+	unsigned worker, i;
+	const char *powercap_dir;
+	int nsampled = 0;
+
+	energy_sampling_period = starpu_getenv_number_default("STARPU_ENERGY_SAMPLING", 0);
+	if (!energy_sampling_period)
+		return;
+
+	powercap_dir = starpu_getenv("STARPU_POWERCAP_DIR");
+	if (!powercap_dir)
+		powercap_dir = POWERCAP_DIR;
+
+	find_zones(powercap_dir);
+	if (!energy_nzones)
+	{
+		_STARPU_DISP("Warning: no RAPL energy counter found in %s, energy sampling is disabled\n", powercap_dir);
+		return;
+	}
+
+	_STARPU_CALLOC(energy_sockets, energy_nsockets, sizeof(*energy_sockets));
+	double now = starpu_timing_now();
+	for (i = 0; i < energy_nsockets; i++)
+	{
+		STARPU_PTHREAD_MUTEX_INIT(&energy_sockets[i].mutex, NULL);
+		energy_sockets[i].last_time = now;
+	}
+
+	for (worker = 0; worker < STARPU_NMAXWORKERS; worker++)
+	{
+		energy_worker_socket[worker] = worker < config->topology.nworkers ? get_worker_socket(&config->workers[worker]) : -1;
+		energy_worker_start[worker] = 0.;
+		if (energy_worker_socket[worker] != -1)
+			nsampled++;
+	}
+	if (!nsampled)
+	{
+		_STARPU_DISP("Warning: no CPU worker runs on a socket with a RAPL energy counter, energy sampling is disabled\n");
+		_starpu_energy_sampling_shutdown();
+		return;
+	}
+
+	_STARPU_DEBUG("Sampling %u RAPL energy counters every %ums\n", energy_nzones, energy_sampling_period);
+	energy_sampling_stop = 0;
+	STARPU_PTHREAD_CREATE(&energy_sampling_thread, NULL, energy_sampling_func, NULL);
+	_starpu_energy_sampling_enabled = 1;
+}
+
+void _starpu_energy_sampling_shutdown(void)
+{
+	unsigned i;
+
+	if (_starpu_energy_sampling_enabled)
+	{
+		_starpu_energy_sampling_enabled = 0;
+		energy_sampling_stop = 1;
+		STARPU_PTHREAD_JOIN(energy_sampling_thread, NULL);
+	}
+
+	for (i = 0; energy_sockets && i < energy_nsockets; i++)
+		STARPU_PTHREAD_MUTEX_DESTROY(&energy_sockets[i].mutex);
+	free(energy_sockets);
+	energy_sockets = NULL;
+	energy_nsockets = 0;
+	free(energy_zones);
+	energy_zones = NULL;
+	energy_nzones = 0;
+}
+
+void _starpu_energy_sampling_start_job(int workerid)
+{
+	int s = energy_worker_socket[workerid];
+	if (s == -1)
+		return;
+
+	struct energy_socket *socket = &energy_sockets[s];
+	STARPU_PTHREAD_MUTEX_LOCK(&socket->mutex);
+	double now = starpu_timing_now();
+	energy_worker_start[workerid] = now;
+	energy_worker_integral[workerid] = socket->integral + socket->rate * (now - socket->last_time);
+	socket->nrunning++;
+	socket->running_start += now;
+	STARPU_PTHREAD_MUTEX_UNLOCK(&socket->mutex);
+}
+
+double _starpu_energy_sampling_end_job(int workerid)
+{
+	int s = energy_worker_socket[workerid];
+	double energy = 0.;
+	if (s == -1)
+		return 0.;
+
+	struct energy_socket *socket = &energy_sockets[s];
+	STARPU_PTHREAD_MUTEX_LOCK(&socket->mutex);
+	double start = energy_worker_start[workerid];
+	if (start != 0.)
+	{
+		double now = starpu_timing_now();
+		energy = socket->integral + socket->rate * (now - socket->last_time) - energy_worker_integral[workerid];
+		socket->nrunning--;
+		socket->running_start -= start;
+		socket->busy += now - start;
+		energy_worker_start[workerid] = 0.;
+	}
+	STARPU_PTHREAD_MUTEX_UNLOCK(&socket->mutex);
+	return energy;
+}
+#else
+void _starpu_energy_sampling_init(void)
+{
+	if (starpu_getenv_number_default("STARPU_ENERGY_SAMPLING", 0))
+		_STARPU_DISP("Warning: energy sampling is only available on Linux\n");
+}
+
+void _starpu_energy_sampling_shutdown(void)
+{
+}
+
+void _starpu_energy_sampling_start_job(int workerid STARPU_ATTRIBUTE_UNUSED)
+{
+}
+
+double _starpu_energy_sampling_end_job(int workerid STARPU_ATTRIBUTE_UNUSED)
+{
+	return 0.;
+}
+#endif
@@ -19,240 +19,123 @@
 
 #include <core/perfmodel/multiple_regression.h>
 
-typedef long int integer;
-typedef double doublereal;
+/*
+ * The coefficients are computed by recursive least squares: instead of
+ * keeping all measurements and solving the least squares problem again from
+ * scratch, we keep the triangular factor R of the QR factorization of the
+ * matrix of the measured terms, and z = Q^T y. Each new measurement is a row
+ * which is merged into R and z by Givens rotations, and the coefficients are
+ * the solution of the triangular system R coeff = z. The previous
+ * measurements can be given an exponentially decreasing weight by scaling R
+ * and z by the square root of a forgetting factor before merging a new row.
+ */
 
-#ifdef STARPU_MLR_MODEL
-#ifdef STARPU_BUILT_IN_MIN_DGELS
-int _starpu_dgels_(char *trans, integer *m, integer *n, integer *nrhs, doublereal *a, integer *lda, doublereal *b, integer *ldb, doublereal *work, integer *lwork, integer *info);
-#else
-int dgels_(char *trans, integer *m, integer *n, integer *nrhs, doublereal *a, integer *lda, doublereal *b, integer *ldb, doublereal *work, integer *lwork, integer *info);
-#endif
-#endif //STARPU_MLR_MODEL
+/* Index of R(i,j), j >= i, in the packed upper triangle */
+#define RLS_R(ncoeff, i, j) ((i)*(ncoeff) - (i)*((i)-1)/2 + (j) - (i))
 
-static unsigned long count_file_lines(FILE *f)
+unsigned _starpu_multiple_regression_rls_size(unsigned ncoeff)
 {
-	unsigned long  lines=0;
-	while(!feof(f))
-	{
-		int ch = fgetc(f);
-		if(ch == '\n')
-		{
-			lines++;
-		}
-	}
-	rewind(f);
-
-	return lines;
+	return ncoeff*(ncoeff+1)/2 + ncoeff;
 }
 
-static void dump_multiple_regression_list(double *mpar, double *my, int start, unsigned nparameters, struct starpu_perfmodel_history_list *list_history)
+void _starpu_multiple_regression_update(struct starpu_perfmodel_regression_model *reg_model, const double *parameters, unsigned nparameters, unsigned **combinations, double measured, unsigned number, double forgetting)
 {
-	struct starpu_perfmodel_history_list *ptr = list_history;
-	int i = start;
-	unsigned j;
-	while (ptr)
-	{
-		my[i] = ptr->entry->duration;
-		for(j=0; j<nparameters; j++)
-			mpar[i*nparameters+j] = ptr->entry->parameters[j];
-		ptr = ptr->next;
-		i++;
-	}
-
-}
-
-static void load_old_calibration(double *mx, double *my, unsigned nparameters, char *filepath)
-{
-	char buffer[1024];
-	char *line;
-	int i=0;
+	unsigned ncoeff = reg_model->ncoeff;
+	double *r, *z, *x;
+	double scale = sqrt((double) number), y;
+	unsigned i, j, k;
 
-	FILE *f = fopen(filepath, "a+");
-	STARPU_ASSERT_MSG(f, "Could not load performance model from file %s\n", filepath);
-
-	line = fgets(buffer,sizeof(buffer),f);//skipping first line
-	STARPU_ASSERT(line);
-	while((line=fgets(buffer,sizeof(buffer),f))!=NULL)
+	STARPU_ASSERT(ncoeff > 0);
+	if (!reg_model->rls_r)
 	{
-		char *record = strtok(line,",");
-		STARPU_ASSERT_MSG(record, "Could not load performance model from file %s\n", filepath);
-		my[i] = atof(record);
-		record = strtok(NULL,",");
-		int j=0;
-		while(record != NULL)
-		{
-			mx[i*nparameters+j] = atof(record) ;
-			++j;
-			record = strtok(NULL,",");
-		}
-		++i ;
+		_STARPU_CALLOC(reg_model->rls_r, ncoeff*(ncoeff+1)/2, sizeof(double));
+		_STARPU_CALLOC(reg_model->rls_z, ncoeff, sizeof(double));
+		reg_model->rls_weight = 0.;
 	}
+	r = reg_model->rls_r;
+	z = reg_model->rls_z;
 
-	fclose(f);
-}
-
-static unsigned long find_long_list_size(struct starpu_perfmodel_history_list *list_history)
-{
-	long cnt = 0;
-
-	struct starpu_perfmodel_history_list *ptr = list_history;
-	while (ptr)
+	if (forgetting < 1.)
 	{
-		cnt++;
-		ptr = ptr->next;
+		double sqrt_forgetting = sqrt(forgetting);
+		for (i = 0; i < ncoeff*(ncoeff+1)/2; i++)
+			r[i] *= sqrt_forgetting;
+		for (i = 0; i < ncoeff; i++)
+			z[i] *= sqrt_forgetting;
+		reg_model->rls_weight *= forgetting;
 	}
 
-	return cnt;
-}
-
-#ifdef STARPU_MLR_MODEL
-int dgels_multiple_reg_coeff(double *mpar, double *my, unsigned long nn, unsigned ncoeff, unsigned nparameters, double *coeff, unsigned **combinations)
-{
-/*  Arguments */
-/*  ========= */
-
-/*  TRANS   (input) CHARACTER*1 */
-/*	    = 'N': the linear system involves A; */
-/*	    = 'T': the linear system involves A**T. */
-
-/*  M	    (input) INTEGER */
-/*	    The number of rows of the matrix A.	 M >= 0. */
-
-/*  N	    (input) INTEGER */
-/*	    The number of columns of the matrix A.  N >= 0. */
-
-/*  NRHS    (input) INTEGER */
-/*	    The number of right hand sides, i.e., the number of */
-/*	    columns of the matrices B and X. NRHS >=0. */
-
-/*  A	    (input/output) DOUBLE PRECISION array, dimension (LDA,N) */
-/*	    On entry, the M-by-N matrix A. */
-/*	    On exit, */
-/*	      if M >= N, A is overwritten by details of its QR */
-/*			 factorization as returned by DGEQRF; */
-/*	      if M <  N, A is overwritten by details of its LQ */
-/*			 factorization as returned by DGELQF. */
-
-/*  LDA	    (input) INTEGER */
-/*	    The leading dimension of the array A.  LDA >= max(1,M). */
-
-/*  B	    (input/output) DOUBLE PRECISION array, dimension (LDB,NRHS) */
-/*	    On entry, the matrix B of right hand side vectors, stored */
-/*	    columnwise; B is M-by-NRHS if TRANS = 'N', or N-by-NRHS */
-/*	    if TRANS = 'T'. */
-/*	    On exit, if INFO = 0, B is overwritten by the solution */
-/*	    vectors, stored columnwise: */
-/*	    if TRANS = 'N' and m >= n, rows 1 to n of B contain the least */
-/*	    squares solution vectors; the residual sum of squares for the */
-/*	    solution in each column is given by the sum of squares of */
-/*	    elements N+1 to M in that column; */
-/*	    if TRANS = 'N' and m < n, rows 1 to N of B contain the */
-/*	    minimum norm solution vectors; */
-/*	    if TRANS = 'T' and m >= n, rows 1 to M of B contain the */
-/*	    minimum norm solution vectors; */
-/*	    if TRANS = 'T' and m < n, rows 1 to M of B contain the */
-/*	    least squares solution vectors; the residual sum of squares */
-/*	    for the solution in each column is given by the sum of */
-/*	    squares of elements M+1 to N in that column. */
-
-/*  LDB	    (input) INTEGER */
-/*	    The leading dimension of the array B. LDB >= MAX(1,M,N). */
-
-/*  WORK    (workspace/output) DOUBLE PRECISION array, dimension (MAX(1,LWORK)) */
-/*	    On exit, if INFO = 0, WORK(1) returns the optimal LWORK. */
-
-/*  LWORK   (input) INTEGER */
-/*	    The dimension of the array WORK. */
-/*	    LWORK >= max(1, MN + max(MN, NRHS)). */
-/*	    For optimal performance, */
-/*	    LWORK >= max(1, MN + max(MN, NRHS) * NB). */
-/*	    where MN = min(M,N) and NB is the optimum block size. */
-
-/*	    If LWORK = -1, then a workspace query is assumed; the routine */
-/*	    only calculates the optimal size of the WORK array, returns */
-/*	    this value as the first entry of the WORK array, and no error */
-/*	    message related to LWORK is issued by XERBLA. */
-
-/*  INFO    (output) INTEGER */
-/*	    = 0:  successful exit */
-/*	    < 0:  if INFO = -i, the i-th argument had an illegal value */
-/*	    > 0:  if INFO =  i, the i-th diagonal element of the */
-/*		  triangular factor of A is zero, so that A does not have */
-/*		  full rank; the least squares solution could not be */
-/*		  computed. */
-
-/*  ===================================================================== */
-
-	if(nn <= ncoeff)
+	/* The new row, weighted by the number of measurements it stands for */
+	_STARPU_MALLOC(x, ncoeff*sizeof(double));
+	x[0] = scale;
+	for (j = 1; j < ncoeff; j++)
 	{
-		_STARPU_DISP("Warning: This function is not intended for the use when number of parameters is larger than the number of observations. Check how your matrices A and B were allocated or simply add more benchmarks.\n Multiple linear regression model will not be written into perfmodel file.\n");
-		return 1;
+		double term = 1.;
+		for (k = 0; k < nparameters; k++)
+			term *= pow(parameters[k], combinations[j-1][k]);
+		x[j] = scale * term;
 	}
+	y = scale * measured;
 
-	char trans = 'N';
-	integer m = nn;
-	integer n = ncoeff;
-	integer nrhs = 1; // number of columns of B and X (which are vectors therefore nrhs=1)
-	doublereal *X;
-	_STARPU_MALLOC(X, sizeof(double)*n*m); // (/!\ modified at the output) contain the model and the different values of pararmters
-	doublereal *Y;
-	_STARPU_MALLOC(Y, sizeof(double)*m);
-
-	double coefficient;
-	int i, j;
-	unsigned k;
-	for (i=0; i < m; i++)
+	/* Rotate it into R and z */
+	for (i = 0; i < ncoeff; i++)
 	{
-		Y[i] = my[i];
-		X[i] = 1.;
-		for (j=1; j < n; j++)
+		double rii = r[RLS_R(ncoeff, i, i)];
+		double h, c, s;
+
+		if (x[i] == 0.)
+			continue;
+		h = hypot(rii, x[i]);
+		c = rii / h;
+		s = x[i] / h;
+		r[RLS_R(ncoeff, i, i)] = h;
+		for (j = i+1; j < ncoeff; j++)
 		{
-			coefficient = 1.;
-			for(k=0; k < nparameters; k++)
-			{
-				coefficient *= pow(mpar[i*nparameters+k],combinations[j-1][k]);
-			}
-			X[i+j*m] = coefficient;
+			double rij = r[RLS_R(ncoeff, i, j)];
+			r[RLS_R(ncoeff, i, j)] = c*rij + s*x[j];
+			x[j] = c*x[j] - s*rij;
 		}
+		double zi = z[i];
+		z[i] = c*zi + s*y;
+		y = c*y - s*zi;
 	}
+	free(x);
 
-	integer lda = m;
-	integer ldb = m; //
-	integer info = 0;
+	reg_model->rls_weight += number;
+	reg_model->nsample += number;
+}
 
-	integer lwork = n*2;
-	doublereal *work; // (output)
-	_STARPU_MALLOC(work, sizeof(double)*lwork);
+int _starpu_multiple_regression_solve(const struct starpu_perfmodel_regression_model *reg_model, double *coeff)
+{
+	unsigned ncoeff = reg_model->ncoeff;
+	const double *r = reg_model->rls_r;
+	const double *z = reg_model->rls_z;
+	double maxdiag = 0.;
+	unsigned i, j;
+
+	/* Same requirement as a least squares fit: more measurements than
+	 * coefficients. With a forgetting factor, the weight of the
+	 * measurements stays bounded, so count them instead */
+	if (!r || (reg_model->nsample <= ncoeff && reg_model->rls_weight <= ncoeff))
+		return 1;
 
-	/* // Running LAPACK dgels_ */
-#ifdef STARPU_BUILT_IN_MIN_DGELS
-	_starpu_dgels_(&trans, &m, &n, &nrhs, X, &lda, Y, &ldb, work, &lwork, &info);
-#else
-	dgels_(&trans, &m, &n, &nrhs, X, &lda, Y, &ldb, work, &lwork, &info);
-#endif
+	for (i = 0; i < ncoeff; i++)
+		maxdiag = STARPU_MAX(maxdiag, fabs(r[RLS_R(ncoeff, i, i)]));
+	/* Not full rank, e.g. some parameter never varied */
+	for (i = 0; i < ncoeff; i++)
+		if (fabs(r[RLS_R(ncoeff, i, i)]) <= maxdiag * 1e-12)
+			return 1;
 
-	/* Check for the full rank */
-	if(info != 0)
+	for (i = ncoeff; i-- > 0; )
 	{
-		_STARPU_DISP("Warning: Problems when executing dgels_ function. It seems like the diagonal element %ld is zero.\n Multiple linear regression model will not be written into perfmodel file.\n", info);
-		free(X);
-		free(Y);
-		free(work);
-		return 1;
+		double sum = z[i];
+		for (j = i+1; j < ncoeff; j++)
+			sum -= r[RLS_R(ncoeff, i, j)] * coeff[j];
+		coeff[i] = sum / r[RLS_R(ncoeff, i, i)];
 	}
 
-	/* Copy computed coefficients */
-	for(i=0; i<(int) ncoeff; i++)
-		coeff[i] = Y[i];
-
-	free(X);
-	free(Y);
-	free(work);
-
 	return 0;
 }
-#endif //STARPU_MLR_MODEL
 
 /*
  * Validating the accuracy of the coefficients.
@@ -269,16 +152,14 @@ void starpu_validate_mlr(double *coeff, unsigned ncoeff, const char *codelet_nam
 			_STARPU_DISP("Warning: Coefficient computed by least square method is extremely small (%f). The model %s is likely to be inaccurate.\n", coeff[i], codelet_name);
 }
 
-int _starpu_multiple_regression(struct starpu_perfmodel_history_list *ptr, double *coeff, unsigned ncoeff, unsigned nparameters, const char **parameters_names, unsigned **combinations, const char *codelet_name)
+void _starpu_multiple_regression_dump_observations(struct starpu_perfmodel_history_list *ptr, unsigned nparameters, const char **parameters_names, const char *codelet_name)
 {
-	unsigned long i;
 	unsigned j;
+	int calibrate = _starpu_get_calibrate_flag();
+	FILE *f;
 
-	/* Computing number of rows */
-	unsigned n=find_long_list_size(ptr);
-
-	/* Reading old calibrations if necessary */
-	FILE *f=NULL;
+	if (calibrate != 1 && calibrate != 2)
+		return;
 
 	char directory[300];
 	snprintf(directory, sizeof(directory), "%s/.starpu/sampling/codelets/tmp", _starpu_get_home_path());
@@ -287,89 +168,29 @@ int _starpu_multiple_regression(struct starpu_perfmodel_history_list *ptr, doubl
 	char filepath[400];
 	snprintf(filepath, sizeof(filepath), "%s/%s.out", directory,codelet_name);
 
-	unsigned long old_lines=0;
-	int calibrate = _starpu_get_calibrate_flag();
-	if (calibrate==1)
+	/* Append to the observations of the previous runs when calibrating,
+	 * start over when recalibrating */
+	f = fopen(filepath, calibrate == 1 ? "a+" : "w+");
+	STARPU_ASSERT_MSG(f, "Could not save performance model into the file %s\n", filepath);
+	fseek(f, 0, SEEK_END);
+	if (ftell(f) == 0)
 	{
-		f = fopen(filepath, "a+");
-		STARPU_ASSERT_MSG(f, "Could not save performance model into the file %s\n", filepath);
-
-		old_lines=count_file_lines(f);
-		/* If the program is run for the first time the old_lines will be 0 */
-		//STARPU_ASSERT(old_lines);
-
-		n+=old_lines;
-
-		fclose(f);
-	}
-
-	/* Allocating X and Y matrices */
-	double *mpar;
-	_STARPU_MALLOC(mpar, nparameters*n*sizeof(double));
-	double *my;
-	_STARPU_MALLOC(my, n*sizeof(double));
-
-	/* Loading old calibration */
-	if (calibrate==1 && old_lines > 0)
-		load_old_calibration(mpar, my, nparameters, filepath);
-
-	/* Filling X and Y matrices with measured values */
-	dump_multiple_regression_list(mpar, my, old_lines, nparameters, ptr);
-
-	if (ncoeff!=0 && combinations!=NULL)
-	{
-#ifdef STARPU_MLR_MODEL
-		/* Computing coefficients using multiple linear regression */
-		if(dgels_multiple_reg_coeff(mpar, my, n, ncoeff, nparameters, coeff, combinations))
+		fprintf(f, "Duration");
+		for(j=0; j<nparameters; j++)
 		{
-			free(mpar);
-			free(my);
-			return 1;
+			if(parameters_names != NULL && parameters_names[j]!= NULL)
+				fprintf(f, ", %s", parameters_names[j]);
+			else
+				fprintf(f, ", P%u", j);
 		}
-		/* Basic validation of the model accuracy */
-		starpu_validate_mlr(coeff, ncoeff, codelet_name);
-#else
-		_STARPU_DISP("Warning: StarPU was compiled without '--enable-mlr' option, thus multiple linear regression model will not be computed.\n");
-		for(i=0; i<ncoeff; i++)
-			coeff[i] = 0.;
-#endif //STARPU_MLR_MODEL
 	}
 
-	if (calibrate==1 || calibrate==2)
+	/* Writing parameters to calibration file */
+	for (; ptr; ptr = ptr->next)
 	{
-		/* Preparing new output calibration file */
-		if (old_lines > 0)
-		{
-			f = fopen(filepath, "a+");
-			STARPU_ASSERT_MSG(f, "Could not save performance model into the file %s\n", filepath);
-		}
-		else
-		{
-			f = fopen(filepath, "w+");
-			STARPU_ASSERT_MSG(f, "Could not save performance model into the file %s\n", filepath);
-			fprintf(f, "Duration");
-			for(j=0; j<nparameters; j++)
-			{
-				if(parameters_names != NULL && parameters_names[j]!= NULL)
-					fprintf(f, ", %s", parameters_names[j]);
-				else
-					fprintf(f, ", P%u", j);
-			}
-		}
-
-		/* Writing parameters to calibration file */
-		for(i=old_lines; i<n; i++)
-		{
-			fprintf(f, "\n%f", my[i]);
-			for(j=0; j<nparameters; j++)
-				fprintf(f, ", %f", mpar[i*nparameters+j]);
-		}
-		fclose(f);
+		fprintf(f, "\n%f", ptr->entry->duration);
+		for(j=0; j<nparameters; j++)
+			fprintf(f, ", %f", ptr->entry->parameters[j]);
 	}
-
-	/* Cleanup */
-	free(mpar);
-	free(my);
-
-	return 0;
+	fclose(f);
 }
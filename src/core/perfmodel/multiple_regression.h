@@ -1,6 +1,6 @@
 /* StarPU --- Runtime system for heterogeneous multicore architectures.
  *
- * Copyright (C) 2009-2021  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ * Copyright (C) 2009-2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
  *
  * StarPU is free software; you can redistribute it and/or modify
  * it under the terms of the GNU Lesser General Public License as published by
@@ -27,7 +27,19 @@
 
 #pragma GCC visibility push(hidden)
 
-int _starpu_multiple_regression(struct starpu_perfmodel_history_list *ptr, double *coeff, unsigned ncoeff, unsigned nparameters, const char **parameters_names, unsigned **combinations, const char *codelet_name);
+/** Number of doubles of the sufficient statistics rls_r and rls_z for \p ncoeff coefficients */
+unsigned _starpu_multiple_regression_rls_size(unsigned ncoeff);
+/** Merge \p number measurements of duration \p measured with \p parameters
+ * into the sufficient statistics of \p reg_model, after weighting the
+ * previous ones by \p forgetting */
+void _starpu_multiple_regression_update(struct starpu_perfmodel_regression_model *reg_model, const double *parameters, unsigned nparameters, unsigned **combinations, double measured, unsigned number, double forgetting);
+/** Compute the coefficients from the sufficient statistics of \p reg_model.
+ * Return non-zero if there is not enough information yet. */
+int _starpu_multiple_regression_solve(const struct starpu_perfmodel_regression_model *reg_model, double *coeff);
+/** Write the measurements of \p ptr in the sampling tmp directory, for
+ * analysing models whose combinations are not defined yet */
+void _starpu_multiple_regression_dump_observations(struct starpu_perfmodel_history_list *ptr, unsigned nparameters, const char **parameters_names, const char *codelet_name);
+void starpu_validate_mlr(double *coeff, unsigned ncoeff, const char *codelet_name);
 
 #pragma GCC visibility pop
 
@@ -182,6 +182,7 @@ void _starpu_init_and_load_perfmodel(struct starpu_perfmodel *model)
 			break;
 		case STARPU_HISTORY_BASED:
 		case STARPU_NL_REGRESSION_BASED:
+		case STARPU_INTERPOLATION_BASED:
 			_starpu_load_history_based_model(model, 1);
 			break;
 		case STARPU_REGRESSION_BASED:
@@ -231,6 +232,10 @@ static double starpu_model_expected_perf(struct starpu_task *task, struct starpu
 				exp_perf = _starpu_multiple_regression_based_job_expected_perf(model, arch, j, nimpl);
 				STARPU_ASSERT_MSG(isnan(exp_perf)||exp_perf>=0,"exp_perf=%lf\n",exp_perf);
 				break;
+			case STARPU_INTERPOLATION_BASED:
+				exp_perf = _starpu_interpolation_based_job_expected_perf(model, arch, j, nimpl, NULL);
+				STARPU_ASSERT_MSG(isnan(exp_perf)||exp_perf>=0,"exp_perf=%lf\n",exp_perf);
+				break;
 			default:
 				STARPU_ABORT();
 		}
@@ -262,6 +267,24 @@ double starpu_task_expected_length(struct starpu_task *task, struct starpu_perfm
 	return starpu_model_expected_perf(task, task->cl->model, arch, nimpl);
 }
 
+double starpu_task_expected_length_confidence(struct starpu_task *task, struct starpu_perfmodel_arch* arch, unsigned nimpl, double *confidence)
+{
+	struct starpu_perfmodel *model = task->cl ? task->cl->model : NULL;
+	double exp;
+
+	if (model && model->type == STARPU_INTERPOLATION_BASED)
+	{
+		_starpu_init_and_load_perfmodel(model);
+		return _starpu_interpolation_based_job_expected_perf(model, arch, _starpu_get_job_associated_to_task(task), nimpl, confidence);
+	}
+
+	/* Other models either know the duration or not */
+	exp = starpu_task_expected_length(task, arch, nimpl);
+	if (confidence)
+		*confidence = isnan(exp) ? 0. : 1.;
+	return exp;
+}
+
 double starpu_task_worker_expected_length(struct starpu_task *task, unsigned workerid, unsigned sched_ctx_id, unsigned nimpl)
 {
 	if (!task->cl)
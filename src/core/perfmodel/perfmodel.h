@@ -63,11 +63,33 @@ struct _starpu_perfmodel_state
 	/** The number of combinations allocated in the array nimpls and ncombs */
 	int ncombs_set;
 	int *combs;
+
+	/** When loaded from a binary model file, its content, which the
+	 * mapped_history fields of per_arch point into */
+	void *mapped;
+	size_t mapped_size;
+
+	/** Arrays and history snapshots replaced while predictions may still
+	 * be reading them without the model lock. */
+	struct _starpu_perfmodel_retired *retired;
+	/** Those retired before the last flip of \p epoch, freed once the
+	 * readers of the previous epoch are gone */
+	struct _starpu_perfmodel_retired *retiring;
+	/** Number of predictions reading the model without its lock, counted
+	 * in the slot of the epoch parity they started in */
+	unsigned epoch;
+	int readers[2];
+
+	/** When shared with the other processes of the machine, the store of
+	 * the history entries, see STARPU_PERF_MODEL_SHARED */
+	struct _starpu_perfmodel_shm *shm;
 };
 
 struct starpu_data_descr;
 struct _starpu_job;
 struct starpu_perfmodel_arch;
+struct _starpu_perfmodel_shm;
+struct _starpu_perfmodel_shm_entry;
 
 extern unsigned _starpu_calibration_minimum;
 extern int _starpu_benchmarking_bus;
@@ -82,6 +104,7 @@ char *_starpu_get_perf_model_dir_bus();
 
 double _starpu_history_based_job_expected_perf(struct starpu_perfmodel *model, struct starpu_perfmodel_arch* arch, struct _starpu_job *j, unsigned nimpl);
 double _starpu_history_based_job_expected_deviation(struct starpu_perfmodel *model, struct starpu_perfmodel_arch* arch, struct _starpu_job *j, unsigned nimpl);
+double _starpu_interpolation_based_job_expected_perf(struct starpu_perfmodel *model, struct starpu_perfmodel_arch* arch, struct _starpu_job *j, unsigned nimpl, double *confidence);
 void _starpu_load_history_based_model(struct starpu_perfmodel *model, unsigned scan_history);
 void _starpu_init_and_load_perfmodel(struct starpu_perfmodel *model);
 void _starpu_initialize_registered_performance_models(void);
@@ -98,16 +121,49 @@ int _starpu_create_bus_sampling_directory_if_needed(int location);
 void _starpu_create_codelet_sampling_directory_if_needed(int location);
 
 void _starpu_load_bus_performance_files(void);
+/** Wait for the background measurement of the bus started when its
+ * performance was only estimated, see STARPU_BUS_CALIBRATE_ESTIMATE */
+void _starpu_wait_bus_calibration(void) STARPU_ATTRIBUTE_VISIBILITY_DEFAULT;
 
 int _starpu_get_perf_model_bus();
 int _starpu_set_default_perf_model_bus();
 
+/** Whether the energy of the tasks is sampled from the RAPL counters, see
+ * STARPU_ENERGY_SAMPLING */
+extern int _starpu_energy_sampling_enabled;
+void _starpu_energy_sampling_init(void);
+void _starpu_energy_sampling_shutdown(void);
+/** Record that a task starts or ends on \p workerid. The latter returns the
+ * energy attributed to the task, in J. */
+void _starpu_energy_sampling_start_job(int workerid);
+double _starpu_energy_sampling_end_job(int workerid);
+
+/** Node-local shared store of the history entries of the model saved in
+ * \p path, see STARPU_PERF_MODEL_SHARED. \p created is set when this
+ * process created it, and then has to seed it before calling
+ * _starpu_perfmodel_shm_ready(). */
+struct _starpu_perfmodel_shm *_starpu_perfmodel_shm_open(const char *path, int *created);
+void _starpu_perfmodel_shm_ready(struct _starpu_perfmodel_shm *shm);
+/** Record that the model file \p path was saved from the store */
+void _starpu_perfmodel_shm_saved(struct _starpu_perfmodel_shm *shm, const char *path);
+/** Detach from the store, the last process removes it */
+void _starpu_perfmodel_shm_close(struct _starpu_perfmodel_shm *shm);
+void _starpu_perfmodel_shm_unlink(const char *path);
+/** Find the entry of the store, or add it. Returns NULL when the store is
+ * full or the combination has too many devices. */
+struct _starpu_perfmodel_shm_entry *_starpu_perfmodel_shm_find(struct _starpu_perfmodel_shm *shm, struct starpu_perfmodel_arch *arch, unsigned impl, uint32_t footprint, size_t size);
+void _starpu_perfmodel_shm_add(struct _starpu_perfmodel_shm_entry *entry, unsigned nsample, double sum, double sum2);
+void _starpu_perfmodel_shm_set(struct _starpu_perfmodel_shm_entry *entry, unsigned nsample, double sum, double sum2);
+void _starpu_perfmodel_shm_get(struct _starpu_perfmodel_shm_entry *entry, unsigned *nsample, double *sum, double *sum2);
+void _starpu_perfmodel_shm_foreach(struct _starpu_perfmodel_shm *shm, void (*func)(struct _starpu_perfmodel_shm_entry *entry, struct starpu_perfmodel_arch *arch, unsigned impl, uint32_t footprint, size_t size, void *arg), void *arg);
+
 void _starpu_set_calibrate_flag(unsigned val);
 unsigned _starpu_get_calibrate_flag(void);
 
 unsigned *_starpu_get_affinity_vector_by_kind(unsigned gpuid, enum starpu_node_kind kind);
 
 void _starpu_save_bandwidth_and_latency_disk(double bandwidth_write, double bandwidth_read, double latency_write, double latency_read, unsigned node, const char *name);
+void _starpu_set_bandwidth_disk_ratio(unsigned node, double ratio);
 
 void _starpu_write_double(FILE *f, const char *format, double val) STARPU_ATTRIBUTE_VISIBILITY_DEFAULT;
 int _starpu_read_double(FILE *f, char *format, double *val) STARPU_ATTRIBUTE_VISIBILITY_DEFAULT;
@@ -115,6 +171,10 @@ void _starpu_simgrid_get_platform_path(int version, char *path, size_t maxlen);
 
 void _starpu_perfmodel_realloc(struct starpu_perfmodel *model, int nb);
 
+/** Copy the history entries mapped from a binary model file into the
+ * history tables and lists of \p model */
+void _starpu_perfmodel_materialize_history(struct starpu_perfmodel *model);
+
 void _starpu_free_arch_combs(void);
 
 #if defined(STARPU_HAVE_HWLOC)
@@ -72,8 +72,15 @@
 #define SIZE	(32*1024*1024*sizeof(char))
 #define NITER	32
 
+/* Nominal values used when the bus performance is only estimated from the
+ * hwloc topology, see STARPU_BUS_CALIBRATE_ESTIMATE */
+#define ESTIMATE_NUMA_BANDWIDTH	10000.	/* MB/s */
+#define ESTIMATE_DEV_BANDWIDTH	10000.	/* MB/s */
+#define ESTIMATE_DEV_LATENCY	10.	/* µs */
+
 #ifndef STARPU_SIMGRID
 static void _starpu_bus_force_sampling(int location);
+static void write_bus_measurements_file_content(void);
 
 int _starpu_benchmarking_bus;
 #endif
@@ -89,8 +96,14 @@ struct dev_timing
 	double latency_dtoh;
 };
 
-static double bandwidth_matrix[STARPU_MAXNODES][STARPU_MAXNODES]; /* MB/s */
-static double latency_matrix[STARPU_MAXNODES][STARPU_MAXNODES]; /* µs */
+static double bandwidth_matrices[2][STARPU_MAXNODES][STARPU_MAXNODES]; /* MB/s */
+static double latency_matrices[2][STARPU_MAXNODES][STARPU_MAXNODES]; /* µs */
+/* The matrices used by the predictions. The background calibration fills the
+ * other copy and swaps them, so that readers never see a partial update */
+static double (*bandwidth_matrix)[STARPU_MAXNODES] = bandwidth_matrices[0];
+static double (*latency_matrix)[STARPU_MAXNODES] = latency_matrices[0];
+/* Serializes the updates of the matrices after initialization */
+static starpu_pthread_mutex_t bus_matrix_mutex = STARPU_PTHREAD_MUTEX_INITIALIZER;
 static unsigned was_benchmarked = 0;
 #ifndef STARPU_SIMGRID
 static unsigned ncpus = 0;
@@ -124,8 +137,22 @@ static double timing_dtod[STARPU_NRAM][STARPU_NMAXDEVS][STARPU_NMAXDEVS];
 static double latency_dtod[STARPU_NRAM][STARPU_NMAXDEVS][STARPU_NMAXDEVS];
 
 static struct dev_timing timing_per_numa[STARPU_NRAM][STARPU_NMAXDEVS][STARPU_MAXNUMANODES];
+
+/* Whether the values above were actually measured, during this run or a
+ * previous one (see the measurements file), or only estimated */
+static unsigned numa_measured[STARPU_MAXNUMANODES][STARPU_MAXNUMANODES];
+static unsigned dev_measured[STARPU_NRAM][STARPU_NMAXDEVS];
+static unsigned dtod_measured[STARPU_NRAM][STARPU_NMAXDEVS][STARPU_NMAXDEVS];
+
+/* Thread measuring the NUMA nodes in the background after an estimation */
+static starpu_pthread_t bus_calibration_thread;
+static unsigned bus_calibration_pending;
+static unsigned bus_calibration_running;
 #endif
 
+/* Whether transfer predictions account for the transfers queued on the link */
+static int transfer_contention = 1;
+
 #ifdef STARPU_HAVE_HWLOC
 static hwloc_topology_t hwtopology;
 #if HAVE_DECL_HWLOC_DISTANCES_OBJ_PAIR_VALUES
@@ -463,7 +490,9 @@ static void measure_bandwidth_between_dev_and_dev(int src, int dst, enum starpu_
 #endif
 }
 
-static void measure_bandwidth_between_host_and_dev(int dev, struct dev_timing dev_timing_per_numa[STARPU_NMAXDEVS][STARPU_MAXNUMANODES], enum starpu_node_kind type)
+/* When \p measure is 0, only gather the hwloc information about the device,
+ * its timings are already known */
+static void measure_bandwidth_between_host_and_dev(int dev, struct dev_timing dev_timing_per_numa[STARPU_NMAXDEVS][STARPU_MAXNUMANODES], enum starpu_node_kind type, unsigned measure)
 {
 	enum starpu_worker_archtype arch = starpu_memory_node_get_worker_archtype(type);
 
@@ -482,11 +511,14 @@ static void measure_bandwidth_between_host_and_dev(int dev, struct dev_timing de
 		if (cpu_id < 0)
 			continue;
 
-		_STARPU_DISP("with NUMA %d...\n", numa_id);
-
 		/* Check hwloc location of GPU */
 		set_numa_distance(dev, numa_id, arch, &dev_timing_per_numa[dev][numa_id]);
 
+		if (!measure)
+			continue;
+
+		_STARPU_DISP("with NUMA %d...\n", numa_id);
+
 		if (starpu_memory_driver_info[type].ops->calibrate_bus)
 			measure_bandwidth_between_host_and_dev_on_numa(dev, type, numa_id, cpu_id,
 								       &dev_timing_per_numa[dev][numa_id],
@@ -587,10 +619,268 @@ no_calibration:
 #endif
 	{
 		/* Cannot make a real calibration */
-		numa_timing[numa_src][numa_dst] = 0.01;
-		numa_latency[numa_src][numa_dst] = 0;
+		*timing_nton = 0.01;
+		*latency_nton = 0;
+	}
+}
+
+static void load_bus_topology(void)
+{
+#ifdef STARPU_HAVE_HWLOC
+	int ret;
+	ret  = hwloc_topology_init(&hwtopology);
+	STARPU_ASSERT_MSG(ret == 0, "Could not initialize Hwloc topology (%s)\n", strerror(errno));
+	_starpu_topology_filter(hwtopology);
+	ret = hwloc_topology_load(hwtopology);
+	STARPU_ASSERT_MSG(ret == 0, "Could not load Hwloc topology (%s)\n", strerror(errno));
+#if HAVE_DECL_HWLOC_DISTANCES_OBJ_PAIR_VALUES
+	unsigned n = 1;
+	hwloc_distances_get_by_name(hwtopology, "NUMALatency", &n, &numa_distances, 0);
+	if (!n)
+		numa_distances = NULL;
+#endif
+#endif
+}
+
+static void release_bus_topology(void)
+{
+#ifdef STARPU_HAVE_HWLOC
+#if HAVE_DECL_HWLOC_DISTANCES_OBJ_PAIR_VALUES
+	if (numa_distances)
+		hwloc_distances_release(hwtopology, numa_distances);
+	numa_distances = NULL;
+#endif
+	hwloc_topology_destroy(hwtopology);
+#endif
+}
+
+struct numa_pair
+{
+	unsigned src;
+	unsigned dst;
+	/* Measured while the workers run */
+	unsigned background;
+};
+
+/* Measure both directions between two NUMA nodes, unless already known. A
+ * background measurement competes with the workers, it is thus only used
+ * during this run and not recorded as measured. */
+static void *measure_numa_pair(void *arg)
+{
+	struct numa_pair *pair = arg;
+
+	if (!numa_measured[pair->src][pair->dst])
+	{
+		if (!pair->background)
+			_STARPU_DISP("NUMA %u -> %u...\n", pair->src, pair->dst);
+		measure_bandwidth_latency_between_numa(pair->src, pair->dst, &numa_timing[pair->src][pair->dst], &numa_latency[pair->src][pair->dst]);
+		numa_measured[pair->src][pair->dst] = !pair->background;
+	}
+	if (!numa_measured[pair->dst][pair->src])
+	{
+		if (!pair->background)
+			_STARPU_DISP("NUMA %u -> %u...\n", pair->dst, pair->src);
+		measure_bandwidth_latency_between_numa(pair->dst, pair->src, &numa_timing[pair->dst][pair->src], &numa_latency[pair->dst][pair->src]);
+		numa_measured[pair->dst][pair->src] = !pair->background;
+	}
+	return NULL;
+}
+
+/* Measure the NUMA node pairs which are not known yet. The pairs are
+ * scheduled in rounds following a round-robin tournament, so that within a
+ * round each NUMA node belongs to at most one pair. The pairs of a round thus
+ * use disjoint sets of cores and memory, and are measured concurrently. */
+static void benchmark_numa_nodes(unsigned background)
+{
+	unsigned parallel = starpu_getenv_number_default("STARPU_BUS_CALIBRATE_PARALLEL", 1);
+	/* Add a dummy node to get an even number of nodes */
+	unsigned n = nnumas + nnumas % 2;
+	unsigned round;
+
+	for (round = 0; round + 1 < n; round++)
+	{
+		struct numa_pair pairs[STARPU_MAXNUMANODES/2 + 1];
+		starpu_pthread_t threads[STARPU_MAXNUMANODES/2 + 1];
+		unsigned npairs = 0, k;
+
+		for (k = 0; k < n/2; k++)
+		{
+			unsigned a = k ? (round + k) % (n-1) : n-1;
+			unsigned b = (round + n-1 - k) % (n-1);
+
+			if (a >= nnumas || b >= nnumas)
+				/* Paired with the dummy node */
+				continue;
+			if (numa_measured[a][b] && numa_measured[b][a])
+				continue;
+			pairs[npairs].src = a;
+			pairs[npairs].dst = b;
+			pairs[npairs].background = background;
+			npairs++;
+		}
+
+		if (!parallel)
+		{
+			for (k = 0; k < npairs; k++)
+				measure_numa_pair(&pairs[k]);
+			continue;
+		}
+
+		for (k = 1; k < npairs; k++)
+			STARPU_PTHREAD_CREATE(&threads[k], NULL, measure_numa_pair, &pairs[k]);
+		if (npairs)
+			measure_numa_pair(&pairs[0]);
+		for (k = 1; k < npairs; k++)
+			STARPU_PTHREAD_JOIN(threads[k], NULL);
 	}
 }
+
+static int numa_all_measured(void)
+{
+	unsigned i, j;
+
+	for (i = 0; i < nnumas; i++)
+		for (j = 0; j < nnumas; j++)
+			if (i != j && !numa_measured[i][j])
+				return 0;
+	return 1;
+}
+
+static int bus_all_measured(void)
+{
+	enum starpu_node_kind type;
+	unsigned i, j;
+
+	if (!numa_all_measured())
+		return 0;
+
+	for (type = STARPU_CPU_RAM+1; type < STARPU_NRAM; ++type)
+	{
+		if (!starpu_memory_driver_info[type].ops ||
+		    !starpu_memory_driver_info[type].ops->calibrate_bus)
+			continue;
+		for (i = 0; i < nmem[type]; i++)
+		{
+			if (!dev_measured[type][i])
+				return 0;
+			for (j = 0; j < nmem[type]; j++)
+				if (i != j && !dtod_measured[type][i][j])
+					return 0;
+		}
+	}
+	return 1;
+}
+
+/* Relative slowness of accessing NUMA node \p dst from NUMA node \p src,
+ * according to the hwloc distances */
+static double estimate_numa_ratio(unsigned src, unsigned dst)
+{
+#if defined(STARPU_HAVE_HWLOC) && HAVE_DECL_HWLOC_DISTANCES_OBJ_PAIR_VALUES
+	hwloc_obj_t src_obj = hwloc_get_obj_by_type(hwtopology, HWLOC_OBJ_NUMANODE, src);
+	hwloc_obj_t dst_obj = hwloc_get_obj_by_type(hwtopology, HWLOC_OBJ_NUMANODE, dst);
+	hwloc_uint64_t local, remote, dummy;
+
+	if (numa_distances && src_obj && dst_obj
+	    && hwloc_distances_obj_pair_values(numa_distances, src_obj, src_obj, &local, &dummy) == 0
+	    && hwloc_distances_obj_pair_values(numa_distances, src_obj, dst_obj, &remote, &dummy) == 0
+	    && local)
+		return (double) remote / local;
+#else
+	(void) src;
+	(void) dst;
+#endif
+	return 1.;
+}
+
+/* Bandwidth of the PCI link of the device, in MB/s */
+static double estimate_dev_bandwidth(int dev, enum starpu_node_kind type)
+{
+#ifdef STARPU_HAVE_HWLOC
+	enum starpu_worker_archtype arch = starpu_memory_node_get_worker_archtype(type);
+	hwloc_obj_t obj = NULL;
+
+	if (starpu_driver_info[arch].get_hwloc_obj)
+		obj = starpu_driver_info[arch].get_hwloc_obj(hwtopology, dev);
+	while (obj && obj->type != HWLOC_OBJ_PCI_DEVICE)
+		obj = obj->parent;
+	if (obj && obj->attr->pcidev.linkspeed > 0)
+		/* GB/s */
+		return obj->attr->pcidev.linkspeed * 1000.;
+#else
+	(void) dev;
+	(void) type;
+#endif
+	return ESTIMATE_DEV_BANDWIDTH;
+}
+
+/* Fill the timings which are not known yet with rough estimations from the
+ * hwloc NUMA distances and PCI link speeds. The hwloc topology is kept
+ * loaded for the background measurement. */
+static void estimate_all_memory_nodes(void)
+{
+	enum starpu_node_kind type;
+	unsigned i, j, numa;
+
+	_STARPU_DEBUG("Estimating the speed of the bus\n");
+
+	load_bus_topology();
+
+	for (i = 0; i < nnumas; i++)
+		for (j = 0; j < nnumas; j++)
+			if (i != j && !numa_measured[i][j])
+			{
+				numa_timing[i][j] = estimate_numa_ratio(i, j) / ESTIMATE_NUMA_BANDWIDTH;
+				/* memcpy latency is negligible */
+				numa_latency[i][j] = 0.;
+			}
+
+	for (type = STARPU_CPU_RAM+1; type < STARPU_NRAM; ++type)
+	{
+		const struct _starpu_node_ops *ops = starpu_memory_driver_info[type].ops;
+		if (!ops || !ops->calibrate_bus)
+			continue;
+
+		for (i = 0; i < nmem[type]; i++)
+		{
+			/* Get the hwloc location of the device */
+			measure_bandwidth_between_host_and_dev(i, timing_per_numa[type], type, 0);
+			if (dev_measured[type][i])
+				continue;
+
+			ops->device_name(i, device_name[type][i], DEV_MAXLENGTH);
+			device_memory[type][i] = ops->total_memory(i);
+
+			double timing = 1. / estimate_dev_bandwidth(i, type);
+			int dev_numa = gpu_numa[type][i];
+			for (numa = 0; numa < nnumas; numa++)
+			{
+				struct dev_timing *dev_timing = &timing_per_numa[type][i][numa];
+				dev_timing->timing_htod = timing;
+				dev_timing->timing_dtoh = timing;
+				if (dev_numa >= 0 && (unsigned) dev_numa != numa)
+				{
+					/* Add the hop between the NUMA nodes */
+					dev_timing->timing_htod += numa_timing[numa][dev_numa];
+					dev_timing->timing_dtoh += numa_timing[dev_numa][numa];
+				}
+				dev_timing->latency_htod = ESTIMATE_DEV_LATENCY;
+				dev_timing->latency_dtoh = ESTIMATE_DEV_LATENCY;
+			}
+
+			/* Assume that transfers between devices go through the host */
+			for (j = 0; j < nmem[type]; j++)
+				if (j != i && !dtod_measured[type][i][j])
+				{
+					timing_dtod[type][i][j] = 0.;
+					latency_dtod[type][i][j] = 0.;
+					device_peer_access[type][i][j] = 0;
+				}
+		}
+	}
+
+	was_benchmarked = 1;
+}
+
 #endif /* !defined(STARPU_SIMGRID) */
 
 static void benchmark_all_memory_nodes(void)
@@ -609,20 +899,7 @@ static void benchmark_all_memory_nodes(void)
 #warning FIXME: when running several StarPU processes on the same node (MPI rank per numa), we need to use a lock to avoid concurrent benchmarking.
 #endif
 
-#ifdef STARPU_HAVE_HWLOC
-	int ret;
-	ret  = hwloc_topology_init(&hwtopology);
-	STARPU_ASSERT_MSG(ret == 0, "Could not initialize Hwloc topology (%s)\n", strerror(errno));
-	_starpu_topology_filter(hwtopology);
-	ret = hwloc_topology_load(hwtopology);
-	STARPU_ASSERT_MSG(ret == 0, "Could not load Hwloc topology (%s)\n", strerror(errno));
-#if HAVE_DECL_HWLOC_DISTANCES_OBJ_PAIR_VALUES
-	unsigned n = 1;
-	hwloc_distances_get_by_name(hwtopology, "NUMALatency", &n, &numa_distances, 0);
-	if (!n)
-		numa_distances = NULL;
-#endif
-#endif
+	load_bus_topology();
 
 #ifdef STARPU_HAVE_HWLOC
 	hwloc_bitmap_t former_cpuset = hwloc_bitmap_alloc();
@@ -641,13 +918,7 @@ static void benchmark_all_memory_nodes(void)
 #warning Missing binding support, StarPU will not be able to properly benchmark NUMA topology
 #endif
 
-	for (i = 0; i < nnumas; i++)
-		for (j = 0; j < nnumas; j++)
-			if (i != j)
-			{
-				_STARPU_DISP("NUMA %d -> %d...\n", i, j);
-				measure_bandwidth_latency_between_numa(i, j, &numa_timing[i][j], &numa_latency[i][j]);
-			}
+	benchmark_numa_nodes(0);
 
 #ifndef STARPU_SIMGRID
 	struct _starpu_machine_topology *topology = &_starpu_get_machine_config()->topology;
@@ -662,14 +933,16 @@ static void benchmark_all_memory_nodes(void)
 			nmem[type] = topology->nhwdevices[arch];
 			for (i = 0; i < nmem[type]; i++)
 			{
-				_STARPU_DISP("%s %u...\n", type_str, i);
+				if (!dev_measured[type][i])
+					_STARPU_DISP("%s %u...\n", type_str, i);
 				/* measure bandwidth between Host and Device i */
-				measure_bandwidth_between_host_and_dev(i, timing_per_numa[type], type);
+				measure_bandwidth_between_host_and_dev(i, timing_per_numa[type], type, !dev_measured[type][i]);
+				dev_measured[type][i] = 1;
 			}
 			for (i = 0; i < nmem[type]; i++)
 			{
 				for (j = 0; j < nmem[type]; j++)
-					if (i != j)
+					if (i != j && !dtod_measured[type][i][j])
 					{
 						_STARPU_DISP("%s %u -> %u...\n", type_str, i, j);
 						measure_bandwidth_between_dev_and_dev(i, j, type,
@@ -677,6 +950,7 @@ static void benchmark_all_memory_nodes(void)
 										      &latency_dtod[type][i][j],
 										      device_peer_access[type],
 										      device_memory[type]);
+						dtod_measured[type][i][j] = 1;
 					}
 			}
 
@@ -743,18 +1017,13 @@ static void benchmark_all_memory_nodes(void)
 	}
 #endif
 
-#ifdef STARPU_HAVE_HWLOC
-#if HAVE_DECL_HWLOC_DISTANCES_OBJ_PAIR_VALUES
-	if (numa_distances)
-		hwloc_distances_release(hwtopology, numa_distances);
-	numa_distances = NULL;
-#endif
-	hwloc_topology_destroy(hwtopology);
-#endif
+	release_bus_topology();
 
 	_STARPU_DEBUG("Benchmarking the speed of the bus is done.\n");
 	_starpu_benchmarking_bus = 0;
 	was_benchmarked = 1;
+
+	write_bus_measurements_file_content();
 #endif /* !SIMGRID */
 }
 
@@ -768,6 +1037,225 @@ static void get_bus_path(const char *type, char *path, size_t maxlen)
 	snprintf(path, maxlen, "%s%s.%s", bus?_starpu_get_perf_model_dir_bus():"INVALID_LOCATION/", hostname, type);
 }
 
+/*
+ *	Measurements
+ */
+
+#ifndef STARPU_SIMGRID
+static void get_measurements_path(char *path, size_t maxlen)
+{
+	get_bus_path("measurements", path, maxlen);
+}
+
+static enum starpu_node_kind get_bus_kind_by_name(const char *name)
+{
+	enum starpu_node_kind type;
+
+	for (type = STARPU_CPU_RAM+1; type < STARPU_NRAM; type++)
+		if (starpu_memory_driver_info[type].ops &&
+		    starpu_memory_driver_info[type].ops->calibrate_bus &&
+		    !strcmp(starpu_memory_driver_info[type].name_upper, name))
+			return type;
+	return STARPU_NRAM;
+}
+
+/* Load the raw measurements of the previous calibrations whose endpoints did
+ * not change, so that only the other ones need to be measured. Return 0 if
+ * the NUMA nodes changed, in which case nothing can be kept. */
+static int load_bus_measurements_file(void)
+{
+	FILE *f;
+	int locked;
+	int ret;
+	unsigned read_cpus, read_numas;
+	unsigned nknown[STARPU_NRAM][STARPU_NMAXDEVS];
+	enum starpu_node_kind type;
+	char keyword[16], kind[16];
+	char path[PATH_LENGTH];
+
+	get_measurements_path(path, sizeof(path));
+
+	f = fopen(path, "r");
+	if (!f)
+		return 0;
+
+	_STARPU_DEBUG("loading measurements from %s\n", path);
+
+	locked = _starpu_frdlock(f) == 0;
+	memset(nknown, 0, sizeof(nknown));
+
+	_starpu_drop_comments(f);
+	ret = fscanf(f, "%u\t%u\n", &read_cpus, &read_numas);
+	if (ret != 2 || read_cpus != ncpus || read_numas != nnumas)
+	{
+		ret = 0;
+		goto out;
+	}
+
+	while (1)
+	{
+		unsigned src, dst, dev, numa;
+
+		_starpu_drop_comments(f);
+		if (fscanf(f, "%15s", keyword) != 1)
+			break;
+
+		if (!strcmp(keyword, "numa"))
+		{
+			double timing, latency;
+			if (fscanf(f, "%u\t%u\t%le\t%le\n", &src, &dst, &timing, &latency) != 4)
+				break;
+			if (src >= nnumas || dst >= nnumas)
+				continue;
+			numa_timing[src][dst] = timing;
+			numa_latency[src][dst] = latency;
+			numa_measured[src][dst] = 1;
+		}
+		else if (!strcmp(keyword, "device"))
+		{
+			unsigned long memory;
+			char name[DEV_MAXLENGTH], current_name[DEV_MAXLENGTH];
+			if (fscanf(f, "%15s\t%u\t%lu\t", kind, &dev, &memory) != 3
+			    || !fgets(name, sizeof(name), f))
+				break;
+			name[strcspn(name, "\n")] = 0;
+			type = get_bus_kind_by_name(kind);
+			if (type == STARPU_NRAM || dev >= nmem[type])
+				continue;
+
+			/* Check that this is still the same device */
+			const struct _starpu_node_ops *ops = starpu_memory_driver_info[type].ops;
+			ops->device_name(dev, current_name, sizeof(current_name));
+			if (strcmp(name, current_name) || memory != (unsigned long) ops->total_memory(dev))
+				continue;
+
+			strcpy(device_name[type][dev], name);
+			device_memory[type][dev] = memory;
+			nknown[type][dev] = 1;
+		}
+		else if (!strcmp(keyword, "host"))
+		{
+			struct dev_timing timing;
+			if (fscanf(f, "%15s\t%u\t%u\t%le\t%le\t%le\t%le\n", kind, &dev, &numa,
+				   &timing.timing_htod, &timing.latency_htod,
+				   &timing.timing_dtoh, &timing.latency_dtoh) != 7)
+				break;
+			type = get_bus_kind_by_name(kind);
+			if (type == STARPU_NRAM || dev >= nmem[type] || !nknown[type][dev] || numa >= nnumas)
+				continue;
+
+			timing.numa_id = numa;
+			timing.numa_distance = -1;
+			timing_per_numa[type][dev][numa] = timing;
+			nknown[type][dev]++;
+		}
+		else if (!strcmp(keyword, "peer"))
+		{
+			int access;
+			double timing, latency;
+			if (fscanf(f, "%15s\t%u\t%u\t%d\t%le\t%le\n", kind, &src, &dst, &access, &timing, &latency) != 6)
+				break;
+			type = get_bus_kind_by_name(kind);
+			if (type == STARPU_NRAM || src >= nmem[type] || dst >= nmem[type]
+			    || !nknown[type][src] || !nknown[type][dst])
+				continue;
+
+			device_peer_access[type][src][dst] = access;
+			timing_dtod[type][src][dst] = timing;
+			latency_dtod[type][src][dst] = latency;
+			dtod_measured[type][src][dst] = 1;
+		}
+		else
+		{
+			_STARPU_DISP("Unknown entry '%s' in bus measurements file %s, ignoring the rest\n", keyword, path);
+			break;
+		}
+	}
+
+	/* A device is known only along all its NUMA nodes */
+	for (type = STARPU_CPU_RAM+1; type < STARPU_NRAM; type++)
+	{
+		unsigned dev;
+		for (dev = 0; dev < nmem[type]; dev++)
+			dev_measured[type][dev] = nknown[type][dev] == nnumas + 1;
+	}
+	ret = 1;
+
+out:
+	if (locked)
+		_starpu_frdunlock(f);
+	fclose(f);
+	return ret;
+}
+
+static void write_bus_measurements_file_content(void)
+{
+	FILE *f;
+	char path[PATH_LENGTH];
+	int locked;
+	enum starpu_node_kind type;
+	unsigned src, dst, numa;
+
+	get_measurements_path(path, sizeof(path));
+
+	_STARPU_DEBUG("writing measurements to %s\n", path);
+
+	f = fopen(path, "a+");
+	STARPU_ASSERT_MSG(f, "Error when opening file (writing) '%s'", path);
+	locked = _starpu_fwrlock(f) == 0;
+	fseek(f, 0, SEEK_SET);
+	_starpu_fftruncate(f, 0);
+
+	fprintf(f, "# Number of CPUs and of NUMA nodes\n");
+	fprintf(f, "%u\t%u\n", ncpus, nnumas);
+	fprintf(f, "# Timings are in µs per byte, latencies in µs\n");
+	fprintf(f, "# numa\tSRC\tDST\tTIMING\tLATENCY\n");
+	fprintf(f, "# device\tKIND\tDEV\tMEMORY\tNAME\n");
+	fprintf(f, "# host\tKIND\tDEV\tNUMA\tTIMING_HTOD\tLATENCY_HTOD\tTIMING_DTOH\tLATENCY_DTOH\n");
+	fprintf(f, "# peer\tKIND\tSRC\tDST\tACCESS\tTIMING\tLATENCY\n");
+
+	for (src = 0; src < nnumas; src++)
+		for (dst = 0; dst < nnumas; dst++)
+			if (src != dst && numa_measured[src][dst])
+				fprintf(f, "numa\t%u\t%u\t%e\t%e\n", src, dst, numa_timing[src][dst], numa_latency[src][dst]);
+
+	for (type = STARPU_CPU_RAM+1; type < STARPU_NRAM; type++)
+	{
+		const char *kind = starpu_memory_driver_info[type].name_upper;
+
+		if (!starpu_memory_driver_info[type].ops ||
+		    !starpu_memory_driver_info[type].ops->calibrate_bus)
+			continue;
+
+		for (src = 0; src < nmem[type]; src++)
+		{
+			if (!dev_measured[type][src])
+				continue;
+
+			fprintf(f, "device\t%s\t%u\t%lu\t%s\n", kind, src, (unsigned long) device_memory[type][src], device_name[type][src]);
+			for (numa = 0; numa < nnumas; numa++)
+			{
+				struct dev_timing *timing = &timing_per_numa[type][src][numa];
+				fprintf(f, "host\t%s\t%u\t%u\t%e\t%e\t%e\t%e\n", kind, src, numa,
+					timing->timing_htod, timing->latency_htod,
+					timing->timing_dtoh, timing->latency_dtoh);
+			}
+		}
+
+		for (src = 0; src < nmem[type]; src++)
+			for (dst = 0; dst < nmem[type]; dst++)
+				if (src != dst && dtod_measured[type][src][dst])
+					fprintf(f, "peer\t%s\t%u\t%u\t%d\t%e\t%e\n", kind, src, dst,
+						device_peer_access[type][src][dst],
+						timing_dtod[type][src][dst], latency_dtod[type][src][dst]);
+	}
+
+	if (locked)
+		_starpu_fwrunlock(f);
+	fclose(f);
+}
+#endif /* !SIMGRID */
+
 /*
  *	Affinity
  */
@@ -1691,7 +2179,7 @@ static int mpi_check_recalibrate(int my_recalibrate)
 }
 #endif
 
-static void compare_value_and_recalibrate(enum starpu_node_kind type, const char * msg, unsigned val_file, unsigned val_detected)
+static int compare_value_and_recalibrate(enum starpu_node_kind type, const char * msg, unsigned val_file, unsigned val_detected)
 {
 	int recalibrate = 0;
 	if (val_file != val_detected &&
@@ -1711,15 +2199,8 @@ static void compare_value_and_recalibrate(enum starpu_node_kind type, const char
 		if (_starpu_mpi_common_is_src_node())
 #endif
 			_STARPU_DISP("Current configuration does not match the bus performance model (%s: (stored) %d != (current) %d), recalibrating...\n", msg, val_file, val_detected);
-
-		int location = _starpu_get_perf_model_bus();
-		_starpu_bus_force_sampling(location);
-
-#ifdef STARPU_USE_MPI_MASTER_SLAVE
-		if (_starpu_mpi_common_is_src_node())
-#endif
-			_STARPU_DISP("... done\n");
 	}
+	return recalibrate;
 }
 
 static void check_bus_config_file(void)
@@ -1727,11 +2208,20 @@ static void check_bus_config_file(void)
 	struct _starpu_machine_config *config = _starpu_get_machine_config();
 	struct _starpu_machine_topology *topology = &config->topology;
 	int recalibrate = 0;
+	int incomplete = 0;
 	char path[PATH_LENGTH];
 
 	int location = _starpu_get_perf_model_bus();
 	if (location < 0 || config->conf.bus_calibrate > 0)
 		recalibrate = 1;
+	else
+	{
+		/* The configuration is only written once everything was
+		 * measured */
+		get_config_path(path, sizeof(path));
+		if (access(path, F_OK))
+			recalibrate = incomplete = 1;
+	}
 
 #if defined(STARPU_USE_MPI_MASTER_SLAVE)
 	if (_starpu_config.conf.nmpi_ms != 0)
@@ -1743,8 +2233,10 @@ static void check_bus_config_file(void)
 	{
 		if (location < 0)
 			_STARPU_DISP("No performance model for the bus, calibrating...\n");
+		else if (incomplete)
+			_STARPU_DISP("The performance model for the bus is incomplete, calibrating...\n");
 		_starpu_bus_force_sampling(location);
-		if (location < 0)
+		if (location < 0 || incomplete)
 			_STARPU_DISP("... done\n");
 	}
 	else
@@ -1758,8 +2250,6 @@ static void check_bus_config_file(void)
 		int locked;
 		unsigned ok;
 
-		get_config_path(path, sizeof(path));
-
 		// Loading configuration from file
 		f = fopen(path, "r");
 		STARPU_ASSERT_MSG(f, "Error when reading from file '%s'", path);
@@ -1803,12 +2293,25 @@ static void check_bus_config_file(void)
 			}
 		}
 
-		// Checking if both configurations match
-		compare_value_and_recalibrate(STARPU_CPU_RAM, "CPUS", read_cpus, ncpus);
+		// Checking if both configurations match, the pairs whose
+		// endpoints did not change will not be measured again
+		if (compare_value_and_recalibrate(STARPU_CPU_RAM, "CPUS", read_cpus, ncpus))
+			recalibrate = 1;
 		for (type = STARPU_CPU_RAM; type < STARPU_NRAM; type++)
 		{
-			compare_value_and_recalibrate(type,
-				starpu_memory_driver_info[type].name_upper, n_read[type], nmem[type]);
+			if (compare_value_and_recalibrate(type,
+				starpu_memory_driver_info[type].name_upper, n_read[type], nmem[type]))
+				recalibrate = 1;
+		}
+
+		if (recalibrate)
+		{
+			_starpu_bus_force_sampling(location);
+
+#ifdef STARPU_USE_MPI_MASTER_SLAVE
+			if (_starpu_mpi_common_is_src_node())
+#endif
+				_STARPU_DISP("... done\n");
 		}
 	}
 }
@@ -2838,8 +3341,72 @@ static void check_bus_platform_file(void)
  *	Generic
  */
 
+static void *bus_calibration_func(void *arg)
+{
+	unsigned i, j;
+	(void) arg;
+
+	starpu_pthread_setname("bus calibration");
+
+	_STARPU_DEBUG("Benchmarking the speed of the NUMA nodes in the background\n");
+	benchmark_numa_nodes(1);
+	release_bus_topology();
+
+	/* Fill the other copy of the matrices and swap them */
+	STARPU_PTHREAD_MUTEX_LOCK(&bus_matrix_mutex);
+	double (*bandwidth)[STARPU_MAXNODES] = bandwidth_matrices[bandwidth_matrix == bandwidth_matrices[0]];
+	double (*latency)[STARPU_MAXNODES] = latency_matrices[latency_matrix == latency_matrices[0]];
+	memcpy(bandwidth, bandwidth_matrix, sizeof(bandwidth_matrices[0]));
+	memcpy(latency, latency_matrix, sizeof(latency_matrices[0]));
+	for (i = 0; i < nnumas; i++)
+		for (j = 0; j < nnumas; j++)
+			if (i != j)
+			{
+				bandwidth[i][j] = 1. / numa_timing[i][j];
+				latency[i][j] = numa_latency[i][j];
+			}
+	STARPU_WMB();
+	bandwidth_matrix = bandwidth;
+	latency_matrix = latency;
+	STARPU_PTHREAD_MUTEX_UNLOCK(&bus_matrix_mutex);
+
+	/* The NUMA nodes are still not recorded as measured, so that the
+	 * next initialization measures them without the workers running, but
+	 * record the devices which are known */
+	write_bus_measurements_file_content();
+	write_bus_latency_file_content();
+	write_bus_bandwidth_file_content();
+	write_bus_platform_file_content(3);
+	write_bus_platform_file_content(4);
+
+	_STARPU_DEBUG("Benchmarking the speed of the NUMA nodes is done.\n");
+	return NULL;
+}
+
+/* Measure in the background the NUMA nodes which were only estimated, to
+ * improve the predictions of this run. The devices can not be measured while
+ * their drivers are running. Everything is measured during the next
+ * initialization. */
+static void start_bus_calibration(void)
+{
+	bus_calibration_pending = 0;
+
+	if (numa_all_measured())
+	{
+		release_bus_topology();
+		write_bus_measurements_file_content();
+		return;
+	}
+
+	bus_calibration_running = 1;
+	STARPU_PTHREAD_CREATE(&bus_calibration_thread, NULL, bus_calibration_func, NULL);
+}
+
 static void _starpu_bus_force_sampling(int location)
 {
+	struct _starpu_machine_config *config = _starpu_get_machine_config();
+	int estimated = 0;
+
 	_STARPU_DEBUG("Force bus sampling ...\n");
 	if (location < 0)
 	{
@@ -2847,14 +3414,54 @@ static void _starpu_bus_force_sampling(int location)
 	}
 	_starpu_create_bus_sampling_directory_if_needed(location);
 
+	_starpu_wait_bus_calibration();
+	if (!was_benchmarked)
+	{
+		int known = 0;
+
+		/* Only measure what changed since the previous calibration */
+		memset(numa_measured, 0, sizeof(numa_measured));
+		memset(dev_measured, 0, sizeof(dev_measured));
+		memset(dtod_measured, 0, sizeof(dtod_measured));
+		if (config->conf.bus_calibrate <= 0)
+			known = load_bus_measurements_file();
+
+		/* The first time, possibly only estimate to start quickly */
+		if (!known && !nmpims && !ntcpip_ms &&
+		    starpu_getenv_number_default("STARPU_BUS_CALIBRATE_ESTIMATE", 0) > 0)
+		{
+			estimate_all_memory_nodes();
+			estimated = 1;
+		}
+	}
+	else if (!bus_all_measured())
+		/* Measure what was only estimated */
+		was_benchmarked = 0;
+
 	generate_bus_affinity_file();
 	generate_bus_latency_file();
 	generate_bus_bandwidth_file();
-	generate_bus_config_file();
+	/* Keep recalibrating at initialization until everything was measured */
+	if (bus_all_measured())
+		generate_bus_config_file();
 	generate_bus_platform_file();
+
+	/* Started once the bus files are loaded */
+	bus_calibration_pending = estimated;
 }
 #endif /* !SIMGRID */
 
+void _starpu_wait_bus_calibration(void)
+{
+#ifndef STARPU_SIMGRID
+	if (bus_calibration_running)
+	{
+		STARPU_PTHREAD_JOIN(bus_calibration_thread, NULL);
+		bus_calibration_running = 0;
+	}
+#endif
+}
+
 void _starpu_load_bus_performance_files(void)
 {
 	_starpu_create_bus_sampling_directory_if_needed(-1);
@@ -2865,6 +3472,7 @@ void _starpu_load_bus_performance_files(void)
 #ifndef STARPU_SIMGRID
 	ncpus = _starpu_topology_get_nhwcpu(config);
 #endif
+	transfer_contention = starpu_getenv_number_default("STARPU_TRANSFER_CONTENTION", 1);
 
 	enum starpu_worker_archtype arch;
 	enum starpu_node_kind type;
@@ -2894,6 +3502,8 @@ void _starpu_load_bus_performance_files(void)
 	load_bus_bandwidth_file();
 #ifndef STARPU_SIMGRID
 	check_bus_platform_file();
+	if (bus_calibration_pending)
+		start_bus_calibration();
 #endif
 }
 
@@ -2944,8 +3554,43 @@ double starpu_transfer_predict(unsigned src_node, unsigned dst_node, size_t size
 	}
 #endif
 
+	double predicted = latency + (size/bandwidth)*2*ngpus;
+
+	if (transfer_contention)
+	{
+		/* The link is shared fairly with the transfers already queued
+		 * on it: each of them delays ours by at most our own size */
+		unsigned nqueued;
+		size_t queued = starpu_transfer_queued(src_node, dst_node, &nqueued);
+		if (queued > (size_t) nqueued * size)
+			queued = (size_t) nqueued * size;
+		predicted += queued/bandwidth;
+	}
+
+	return predicted;
+}
+
+/* bandwidth measured by the disk backends, before any scaling */
+static double disk_bandwidth_write[STARPU_MAXNODES];
+static double disk_bandwidth_read[STARPU_MAXNODES];
+
+/* bandwidth of a transfer through the main ram, in MB/s */
+static double _starpu_bandwidth_through_main_ram(double bandwidth_disk, double bandwidth_main_ram)
+{
+	double slowness_disk_between_main_ram, slowness_main_ram_between_node;
+
+	/* convert in slowness */
+	if(bandwidth_disk != 0)
+		slowness_disk_between_main_ram = 1/bandwidth_disk;
+	else
+		slowness_disk_between_main_ram = 0;
+
+	if(bandwidth_main_ram != 0)
+		slowness_main_ram_between_node = 1/bandwidth_main_ram;
+	else
+		slowness_main_ram_between_node = 0;
 
-	return latency + (size/bandwidth)*2*ngpus;
+	return 1/(slowness_disk_between_main_ram+slowness_main_ram_between_node);
 }
 
 /* calculate save bandwidth and latency */
@@ -2953,7 +3598,6 @@ double starpu_transfer_predict(unsigned src_node, unsigned dst_node, size_t size
 void _starpu_save_bandwidth_and_latency_disk(double bandwidth_write, double bandwidth_read, double latency_write, double latency_read, unsigned node, const char *name)
 {
 	unsigned int i, j;
-	double slowness_disk_between_main_ram, slowness_main_ram_between_node;
 	int print_stats = starpu_getenv_number_default("STARPU_BUS_STATS", 0);
 
 	if (print_stats)
@@ -2962,6 +3606,10 @@ void _starpu_save_bandwidth_and_latency_disk(double bandwidth_write, double band
 		fprintf(stderr, "Data transfer speed for %s (node %u):\n", name, node);
 	}
 
+	STARPU_PTHREAD_MUTEX_LOCK(&bus_matrix_mutex);
+	disk_bandwidth_write[node] = bandwidth_write;
+	disk_bandwidth_read[node] = bandwidth_read;
+
 	/* save bandwidth */
 	for(i = 0; i < STARPU_MAXNODES; ++i)
 	{
@@ -2973,36 +3621,14 @@ void _starpu_save_bandwidth_and_latency_disk(double bandwidth_write, double band
 			}
 			else if (i == node) /* source == disk */
 			{
-				/* convert in slowness */
-				if(bandwidth_read != 0)
-					slowness_disk_between_main_ram = 1/bandwidth_read;
-				else
-					slowness_disk_between_main_ram = 0;
-
-				if(bandwidth_matrix[STARPU_MAIN_RAM][j] != 0)
-					slowness_main_ram_between_node = 1/bandwidth_matrix[STARPU_MAIN_RAM][j];
-				else
-					slowness_main_ram_between_node = 0;
-
-				bandwidth_matrix[i][j] = 1/(slowness_disk_between_main_ram+slowness_main_ram_between_node);
+				bandwidth_matrix[i][j] = _starpu_bandwidth_through_main_ram(bandwidth_read, bandwidth_matrix[STARPU_MAIN_RAM][j]);
 
 				if (!isnan(bandwidth_matrix[i][j]) && print_stats)
 					fprintf(stderr,"%u -> %u: %.0f MB/s\n", i, j, bandwidth_matrix[i][j]);
 			}
 			else if (j == node) /* destination == disk */
 			{
-				/* convert in slowness */
-				if(bandwidth_write != 0)
-					slowness_disk_between_main_ram = 1/bandwidth_write;
-				else
-					slowness_disk_between_main_ram = 0;
-
-				if(bandwidth_matrix[i][STARPU_MAIN_RAM] != 0)
-					slowness_main_ram_between_node = 1/bandwidth_matrix[i][STARPU_MAIN_RAM];
-				else
-					slowness_main_ram_between_node = 0;
-
-				bandwidth_matrix[i][j] = 1/(slowness_disk_between_main_ram+slowness_main_ram_between_node);
+				bandwidth_matrix[i][j] = _starpu_bandwidth_through_main_ram(bandwidth_write, bandwidth_matrix[i][STARPU_MAIN_RAM]);
 
 				if (!isnan(bandwidth_matrix[i][j]) && print_stats)
 					fprintf(stderr,"%u -> %u: %.0f MB/s\n", i, j, bandwidth_matrix[i][j]);
@@ -3044,6 +3670,26 @@ void _starpu_save_bandwidth_and_latency_disk(double bandwidth_write, double band
 		}
 	}
 
+	STARPU_PTHREAD_MUTEX_UNLOCK(&bus_matrix_mutex);
+
 	if (print_stats)
 		fprintf(stderr, "\n#---------------------\n");
 }
+
+/* Scale the bandwidth measured for the disk \p node by \p ratio, e.g. the
+ * compression ratio achieved by the disk backend, so that transfer estimations
+ * are based on the effective bandwidth */
+void _starpu_set_bandwidth_disk_ratio(unsigned node, double ratio)
+{
+	unsigned int i;
+
+	STARPU_PTHREAD_MUTEX_LOCK(&bus_matrix_mutex);
+	for(i = 0; i < STARPU_MAXNODES; ++i)
+	{
+		if (i == node || isnan(bandwidth_matrix[i][node]))
+			continue;
+		bandwidth_matrix[node][i] = _starpu_bandwidth_through_main_ram(disk_bandwidth_read[node] * ratio, bandwidth_matrix[STARPU_MAIN_RAM][i]);
+		bandwidth_matrix[i][node] = _starpu_bandwidth_through_main_ram(disk_bandwidth_write[node] * ratio, bandwidth_matrix[i][STARPU_MAIN_RAM]);
+	}
+	STARPU_PTHREAD_MUTEX_UNLOCK(&bus_matrix_mutex);
+}
@@ -41,6 +41,10 @@
 #include <windows.h>
 #endif
 
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
+
 #define HASH_ADD_UINT32_T(head,field,add) HASH_ADD(hh,head,field,sizeof(uint32_t),add)
 #define HASH_FIND_UINT32_T(head,find,out) HASH_FIND(hh,head,find,sizeof(uint32_t),out)
 
@@ -50,6 +54,31 @@ static int nb_arch_combs;
 static starpu_pthread_rwlock_t arch_combs_mutex = STARPU_PTHREAD_RWLOCK_INITIALIZER;
 static int historymaxerror;
 static char ignore_devid[STARPU_NARCH];
+/* Whether to save models in the binary format */
+static int binary_models;
+/* Below this confidence, interpolated predictions are considered unknown */
+static double interpolation_min_confidence;
+static double mlr_forgetting_factor;
+/* Whether to share the history entries with the other processes of the
+ * machine */
+static int shared_models;
+/* How many measurements a combination needs before predictions get
+ * transferred to it from another combination, 0 to disable */
+static unsigned transfer_min;
+
+/* How history entries estimate the duration from their measurements */
+enum history_estimator
+{
+	HISTORY_ESTIMATOR_MEAN,
+	HISTORY_ESTIMATOR_MEDIAN,
+	HISTORY_ESTIMATOR_TRIMMED
+};
+static enum history_estimator history_estimator;
+/* How many of the last measurements the robust estimators consider */
+static unsigned history_window;
+/* CUSUM threshold, in standard deviations, above which the distribution of
+ * the measurements is considered to have changed, 0 to disable */
+static double history_change_threshold;
 
 /* How many executions a codelet will have to be measured before we
  * consider that calibration will provide a value good enough for scheduling */
@@ -85,6 +114,17 @@ void starpu_perfmodel_initialize(void)
 	STARPU_PTHREAD_RWLOCK_INIT(&arch_combs_mutex, NULL);
 
 	_starpu_gethostname(_starpu_perfmodel_hostname, sizeof(_starpu_perfmodel_hostname));
+
+	binary_models = starpu_getenv_number_default("STARPU_PERF_MODEL_BINARY", 0);
+	shared_models = starpu_getenv_number_default("STARPU_PERF_MODEL_SHARED", 0);
+	transfer_min = starpu_getenv_number_default("STARPU_PERF_MODEL_TRANSFER", 0);
+	/* Read here rather than at starpu_init, since tools which only load
+	 * models, such as starpu_perfmodel_display, need it to tell
+	 * calibrated entries apart */
+	_starpu_calibration_minimum = starpu_getenv_number_default("STARPU_CALIBRATE_MINIMUM", 10);
+	interpolation_min_confidence = starpu_getenv_float_default("STARPU_INTERPOLATION_MIN_CONFIDENCE", 0.5);
+	mlr_forgetting_factor = starpu_getenv_float_default("STARPU_MLR_FORGETTING_FACTOR", 1.);
+	STARPU_ASSERT_MSG(mlr_forgetting_factor > 0. && mlr_forgetting_factor <= 1., "STARPU_MLR_FORGETTING_FACTOR must be in ]0,1], not %f", mlr_forgetting_factor);
 }
 
 void _starpu_initialize_registered_performance_models(void)
@@ -114,7 +154,20 @@ void _starpu_initialize_registered_performance_models(void)
 	_STARPU_MALLOC(arch_combs, nb_arch_combs*sizeof(struct starpu_perfmodel_arch*));
 	current_arch_comb = 0;
 	historymaxerror = starpu_getenv_number_default("STARPU_HISTORY_MAX_ERROR", STARPU_HISTORYMAXERROR);
-	_starpu_calibration_minimum = starpu_getenv_number_default("STARPU_CALIBRATE_MINIMUM", 10);
+	history_estimator = HISTORY_ESTIMATOR_MEAN;
+	const char *estimator = starpu_getenv("STARPU_HISTORY_ESTIMATOR");
+	if (estimator)
+	{
+		if (!strcmp(estimator, "median"))
+			history_estimator = HISTORY_ESTIMATOR_MEDIAN;
+		else if (!strcmp(estimator, "trimmed"))
+			history_estimator = HISTORY_ESTIMATOR_TRIMMED;
+		else if (strcmp(estimator, "mean"))
+			_STARPU_DISP("Warning: unknown STARPU_HISTORY_ESTIMATOR value %s, using mean\n", estimator);
+	}
+	history_window = starpu_getenv_number_default("STARPU_HISTORY_WINDOW", 32);
+	STARPU_ASSERT_MSG(history_window >= 3, "STARPU_HISTORY_WINDOW must be at least 3");
+	history_change_threshold = starpu_getenv_float_default("STARPU_HISTORY_CHANGE_THRESHOLD", 0.);
 
 	for (archtype = 0; archtype < STARPU_NARCH; archtype++)
 	{
@@ -129,12 +182,20 @@ void _starpu_initialize_registered_performance_models(void)
 void _starpu_perfmodel_malloc_per_arch(struct starpu_perfmodel *model, int comb, int nb_impl)
 {
 	int i;
+	struct starpu_perfmodel_per_arch *per_arch;
 
-	_STARPU_MALLOC(model->state->per_arch[comb], nb_impl*sizeof(struct starpu_perfmodel_per_arch));
+	_STARPU_MALLOC(per_arch, nb_impl*sizeof(struct starpu_perfmodel_per_arch));
 	for(i = 0; i < nb_impl; i++)
 	{
-		memset(&model->state->per_arch[comb][i], 0, sizeof(struct starpu_perfmodel_per_arch));
+		memset(&per_arch[i], 0, sizeof(struct starpu_perfmodel_per_arch));
+		STARPU_HG_DISABLE_CHECKING(per_arch[i].history_snapshot);
+		STARPU_HG_DISABLE_CHECKING(per_arch[i].history_unpublished);
+		STARPU_HG_DISABLE_CHECKING(per_arch[i].transfer_log_ratio);
+		STARPU_HG_DISABLE_CHECKING(per_arch[i].transfer_nsample);
 	}
+	/* Predictions may be looking at it without the model lock */
+	STARPU_WMB();
+	model->state->per_arch[comb] = per_arch;
 	model->state->nimpls_set[comb] = nb_impl;
 }
 
@@ -313,6 +374,226 @@ static void insert_history_entry(struct starpu_perfmodel_history_entry *entry, s
 	HASH_ADD_UINT32_T(*history_ptr, footprint, table);
 }
 
+/*
+ * Lock-free history lookups
+ *
+ * Predictions are computed on every push of every task, while measurements
+ * are recorded at the end of every calibrated task. So that the former do not
+ * wait for the latter, predictions do not take the model lock: they look the
+ * footprint up by dichotomy in a snapshot of the history table, which is never
+ * modified once published. Writers insert new entries in the history table
+ * under the model lock, and publish a new snapshot once enough of them have
+ * accumulated, or some time after the previous publication. Lookups which miss
+ * the snapshot while some entries are not published yet fall back to the
+ * history table under the model lock.
+ *
+ * The samples of the entries are still updated in place, we do not care about
+ * racing reads of the mean and deviation, we only want a good-enough
+ * estimation.
+ *
+ * Predictions may still be reading the snapshots and per_arch arrays which get
+ * replaced, so these are retired rather than freed. Predictions count
+ * themselves in one of two reader counters, selected by the parity of the
+ * epoch of the model. Once some structures are retired, the writer flips the
+ * epoch: new predictions can not see them any more, so they can be freed as
+ * soon as the counter of the previous epoch drops to zero. This is checked
+ * again at each retirement, which is enough since structures only get retired
+ * when the model changes.
+ */
+
+/* Minimum number of new entries to publish at once */
+#define HISTORY_PUBLISH_BATCH 16
+/* Delay in µs after which new entries get published even if there are fewer
+ * than the batch */
+#define HISTORY_PUBLISH_PERIOD 100000.
+/* But still not before they make up this fraction of the table, since the
+ * whole table gets copied */
+#define HISTORY_PUBLISH_PERIOD_RATIO 64
+
+struct _starpu_perfmodel_retired
+{
+	struct _starpu_perfmodel_retired *next;
+	void *ptr;
+};
+
+struct _starpu_perfmodel_history_snapshot
+{
+	unsigned long nentries;
+	/** For ::STARPU_INTERPOLATION_BASED, the same entries sorted by size,
+	 * stored after \p entries */
+	struct starpu_perfmodel_history_entry **by_size;
+	/** Sorted by footprint */
+	struct starpu_perfmodel_history_entry *entries[];
+};
+
+static void perfmodel_free_retired_list(struct _starpu_perfmodel_retired **list)
+{
+	while (*list)
+	{
+		struct _starpu_perfmodel_retired *next = (*list)->next;
+		free((*list)->ptr);
+		free(*list);
+		*list = next;
+	}
+}
+
+/* Free the retired structures which no prediction may be reading any more.
+ * The model lock must be held in write mode. */
+static void perfmodel_reclaim(struct _starpu_perfmodel_state *state)
+{
+	unsigned current = state->epoch & 1;
+
+	/* The predictions started before the previous flip are still there */
+	if (state->readers[!current])
+		return;
+	perfmodel_free_retired_list(&state->retiring);
+
+	if (!state->retired)
+		return;
+
+	/* Predictions starting from now can not see the retired structures,
+	 * since they were replaced before being retired */
+	STARPU_WMB();
+	state->retiring = state->retired;
+	state->retired = NULL;
+	state->epoch++;
+	STARPU_SYNCHRONIZE();
+	if (!state->readers[current])
+		perfmodel_free_retired_list(&state->retiring);
+}
+
+/* Free \p ptr once no prediction may be reading it. The model lock must be
+ * held in write mode. */
+static void perfmodel_retire(struct _starpu_perfmodel_state *state, void *ptr)
+{
+	struct _starpu_perfmodel_retired *retired;
+
+	_STARPU_MALLOC(retired, sizeof(*retired));
+	retired->ptr = ptr;
+	retired->next = state->retired;
+	state->retired = retired;
+	perfmodel_reclaim(state);
+}
+
+/* Free all the retired structures, when nobody may be using the model any
+ * more */
+static void perfmodel_free_retired(struct _starpu_perfmodel_state *state)
+{
+	perfmodel_free_retired_list(&state->retiring);
+	perfmodel_free_retired_list(&state->retired);
+}
+
+/* Start reading the model without its lock, return what to pass to
+ * perfmodel_read_end() */
+static unsigned perfmodel_read_begin(struct _starpu_perfmodel_state *state)
+{
+	unsigned epoch = state->epoch & 1;
+	/* This is a full barrier, so the reads of the section can not happen
+	 * before we get counted */
+	(void) STARPU_ATOMIC_ADD(&state->readers[epoch], 1);
+	return epoch;
+}
+
+static void perfmodel_read_end(struct _starpu_perfmodel_state *state, unsigned epoch)
+{
+	(void) STARPU_ATOMIC_ADD(&state->readers[epoch], -1);
+}
+
+static int history_entry_ptr_cmp(const void *a, const void *b)
+{
+	uint32_t fa = (*(struct starpu_perfmodel_history_entry * const *) a)->footprint;
+	uint32_t fb = (*(struct starpu_perfmodel_history_entry * const *) b)->footprint;
+	return fa < fb ? -1 : fa > fb;
+}
+
+static int history_entry_ptr_size_cmp(const void *a, const void *b)
+{
+	size_t sa = (*(struct starpu_perfmodel_history_entry * const *) a)->size;
+	size_t sb = (*(struct starpu_perfmodel_history_entry * const *) b)->size;
+	return sa < sb ? -1 : sa > sb;
+}
+
+static struct starpu_perfmodel_history_entry *history_snapshot_find(const struct _starpu_perfmodel_history_snapshot *snapshot, uint32_t footprint)
+{
+	unsigned long lo = 0, hi = snapshot->nentries;
+
+	while (lo < hi)
+	{
+		unsigned long mid = (lo + hi) / 2;
+		uint32_t f = snapshot->entries[mid]->footprint;
+		if (f == footprint)
+			return snapshot->entries[mid];
+		if (f < footprint)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return NULL;
+}
+
+/* Publish a snapshot of the whole history table. The model lock must be held
+ * in write mode. */
+static void history_publish(struct starpu_perfmodel *model, struct starpu_perfmodel_per_arch *per_arch_model)
+{
+	struct _starpu_perfmodel_history_snapshot *snapshot, *old = per_arch_model->history_snapshot;
+	struct starpu_perfmodel_history_table *elt, *tmp;
+	unsigned long n = HASH_COUNT(per_arch_model->history), i = 0;
+	int by_size = model->type == STARPU_INTERPOLATION_BASED;
+
+	_STARPU_MALLOC(snapshot, sizeof(*snapshot) + (by_size ? 2 : 1) * n * sizeof(snapshot->entries[0]));
+	HASH_ITER(hh, per_arch_model->history, elt, tmp)
+		snapshot->entries[i++] = elt->history_entry;
+	snapshot->nentries = n;
+	qsort(snapshot->entries, n, sizeof(snapshot->entries[0]), history_entry_ptr_cmp);
+	snapshot->by_size = NULL;
+	if (by_size)
+	{
+		snapshot->by_size = &snapshot->entries[n];
+		memcpy(snapshot->by_size, snapshot->entries, n * sizeof(snapshot->entries[0]));
+		qsort(snapshot->by_size, n, sizeof(snapshot->entries[0]), history_entry_ptr_size_cmp);
+	}
+
+	/* Make the content of the snapshot visible before the snapshot itself */
+	STARPU_WMB();
+	per_arch_model->history_snapshot = snapshot;
+	per_arch_model->history_unpublished = 0;
+	per_arch_model->history_published = starpu_timing_now();
+	if (old)
+		perfmodel_retire(model->state, old);
+}
+
+/* Whether the entries inserted in the history table since the last
+ * publication should be published now */
+static int history_should_publish(const struct starpu_perfmodel_per_arch *per_arch_model)
+{
+	const struct _starpu_perfmodel_history_snapshot *snapshot = per_arch_model->history_snapshot;
+	unsigned long published = snapshot ? snapshot->nentries : 0;
+
+	if (!per_arch_model->history_unpublished)
+		return 0;
+	/* Publishing copies the whole table, so batch proportionally to its size */
+	if (per_arch_model->history_unpublished >= STARPU_MAX(HISTORY_PUBLISH_BATCH, published / 8))
+		return 1;
+	/* Lookups of the few unpublished entries take the lock meanwhile */
+	if (per_arch_model->history_unpublished < published / HISTORY_PUBLISH_PERIOD_RATIO)
+		return 0;
+	return starpu_timing_now() - per_arch_model->history_published >= HISTORY_PUBLISH_PERIOD;
+}
+
+static void history_publish_all(struct starpu_perfmodel *model)
+{
+	int comb, impl;
+
+	for (comb = 0; comb < model->state->ncombs_set; comb++)
+		if (model->state->per_arch[comb])
+			for (impl = 0; impl < model->state->nimpls_set[comb]; impl++)
+			{
+				struct starpu_perfmodel_per_arch *per_arch_model = &model->state->per_arch[comb][impl];
+				if (per_arch_model->history_unpublished)
+					history_publish(model, per_arch_model);
+			}
+}
+
 #ifndef STARPU_SIMGRID
 static void check_reg_model(struct starpu_perfmodel *model, int comb, int impl)
 {
@@ -325,7 +606,7 @@ static void check_reg_model(struct starpu_perfmodel *model, int comb, int impl)
 
 	/* Unless we have enough measurements, we put NaN in the file to indicate the model is invalid */
 	double alpha = nan(""), beta = nan("");
-	if (model->type == STARPU_REGRESSION_BASED || model->type == STARPU_NL_REGRESSION_BASED)
+	if (model->type == STARPU_REGRESSION_BASED || model->type == STARPU_NL_REGRESSION_BASED || model->type == STARPU_INTERPOLATION_BASED)
 	{
 		if (reg_model->nsample > 1)
 		{
@@ -353,7 +634,7 @@ static void check_reg_model(struct starpu_perfmodel *model, int comb, int impl)
 
 	double a = nan(""), b = nan(""), c = nan("");
 
-	if (model->type == STARPU_NL_REGRESSION_BASED)
+	if (model->type == STARPU_NL_REGRESSION_BASED || model->type == STARPU_INTERPOLATION_BASED)
 		_starpu_regression_non_linear_power(per_arch_model->list, &a, &b, &c);
 
 	/* TODO: check:
@@ -386,7 +667,7 @@ static void dump_reg_model(FILE *f, struct starpu_perfmodel *model, int comb, in
 
 	/* Unless we have enough measurements, we put NaN in the file to indicate the model is invalid */
 	double alpha = nan(""), beta = nan("");
-	if (model->type == STARPU_REGRESSION_BASED || model->type == STARPU_NL_REGRESSION_BASED)
+	if (model->type == STARPU_REGRESSION_BASED || model->type == STARPU_NL_REGRESSION_BASED || model->type == STARPU_INTERPOLATION_BASED)
 	{
 		if (reg_model->nsample > 1)
 		{
@@ -408,7 +689,7 @@ static void dump_reg_model(FILE *f, struct starpu_perfmodel *model, int comb, in
 
 	double a = nan(""), b = nan(""), c = nan("");
 
-	if (model->type == STARPU_NL_REGRESSION_BASED)
+	if (model->type == STARPU_NL_REGRESSION_BASED || model->type == STARPU_INTERPOLATION_BASED)
 	{
 		if (_starpu_regression_non_linear_power(per_arch_model->list, &a, &b, &c) != 0)
 			_STARPU_DISP("Warning: could not compute a non-linear regression for model %s\n", model->symbol);
@@ -433,13 +714,11 @@ static void dump_reg_model(FILE *f, struct starpu_perfmodel *model, int comb, in
 	}
 	else
 	{
-		if (reg_model->ncoeff==0 && model->ncombinations!=0 && model->combinations!=NULL)
-		{
-			reg_model->ncoeff = model->ncombinations + 1;
-		}
-
-		_STARPU_MALLOC(reg_model->coeff,  reg_model->ncoeff*sizeof(double));
-		_starpu_multiple_regression(per_arch_model->list, reg_model->coeff, reg_model->ncoeff, model->nparameters, model->parameters_names, model->combinations, model->symbol);
+		if (model->ncombinations==0 || model->combinations==NULL)
+			/* Keep the measurements for analysing what combinations to use */
+			_starpu_multiple_regression_dump_observations(per_arch_model->list, model->nparameters, model->parameters_names, model->symbol);
+		else if (reg_model->coeff)
+			starpu_validate_mlr(reg_model->coeff, reg_model->ncoeff, model->symbol);
 
 		fprintf(f, "# n\tintercept\t");
 		if (reg_model->ncoeff==0 || model->ncombinations==0 || model->combinations==NULL)
@@ -479,7 +758,19 @@ static void dump_reg_model(FILE *f, struct starpu_perfmodel *model, int comb, in
 
 			fprintf(f, "\n%u", reg_model->ncoeff);
 			for (i=0; i < reg_model->ncoeff; i++)
-				fprintf(f, "\t%-15e", reg_model->coeff[i]);
+			{
+				fprintf(f, "\t");
+				_starpu_write_double(f, "%-15e", reg_model->coeff ? reg_model->coeff[i] : nan(""));
+			}
+
+			/* Sufficient statistics for continuing the regression */
+			if (reg_model->rls_r)
+			{
+				unsigned size = _starpu_multiple_regression_rls_size(reg_model->ncoeff);
+				fprintf(f, "\t%-15e", reg_model->rls_weight);
+				for (i=0; i < size; i++)
+					fprintf(f, "\t%-15e", i < size - reg_model->ncoeff ? reg_model->rls_r[i] : reg_model->rls_z[i - (size - reg_model->ncoeff)]);
+			}
 		}
 	}
 }
@@ -549,6 +840,33 @@ static void scan_reg_model(FILE *f, const char *path, struct starpu_perfmodel_re
 			multi_invalid = (multi_invalid||isnan(reg_model->coeff[i]));
 		}
 		reg_model->multi_valid = !multi_invalid;
+		if (!reg_model->multi_valid)
+		{
+			free(reg_model->coeff);
+			reg_model->coeff = NULL;
+		}
+
+		/* Files written by older versions do not have the sufficient
+		 * statistics of the regression */
+		int c;
+		do
+			c = getc(f);
+		while (c == ' ' || c == '\t');
+		if (c != EOF)
+			ungetc(c, f);
+		if (c != '\n' && c != EOF)
+		{
+			unsigned size = _starpu_multiple_regression_rls_size(reg_model->ncoeff);
+			_STARPU_MALLOC(reg_model->rls_r, (size - reg_model->ncoeff)*sizeof(double));
+			_STARPU_MALLOC(reg_model->rls_z, reg_model->ncoeff*sizeof(double));
+			res = fscanf(f, "%le", &reg_model->rls_weight);
+			STARPU_ASSERT_MSG(res == 1, "Incorrect performance model file %s", path);
+			for (i=0; i < size; i++)
+			{
+				res = fscanf(f, "%le", i < size - reg_model->ncoeff ? &reg_model->rls_r[i] : &reg_model->rls_z[i - (size - reg_model->ncoeff)]);
+				STARPU_ASSERT_MSG(res == 1, "Incorrect performance model file %s", path);
+			}
+		}
 	}
 	res = fscanf(f, "\n");
 	STARPU_ASSERT_MSG(res == 0, "Incorrect performance model file %s", path);
@@ -659,7 +977,10 @@ static void parse_per_arch_model_file(FILE *f, const char *path, struct starpu_p
 		/* TODO: Insert it at the end of the list, to avoid reversing
 		 * the order... But efficiently! We may have a lot of entries */
 		if (scan_history)
+		{
 			insert_history_entry(entry, &per_arch_model->list, &per_arch_model->history);
+			per_arch_model->history_unpublished++;
+		}
 	}
 
 	if (model && model->type == STARPU_PERFMODEL_INVALID)
@@ -804,123 +1125,665 @@ static int parse_model_file(FILE *f, const char *path, struct starpu_perfmodel *
 	return 0;
 }
 
-#ifndef STARPU_SIMGRID
-static void check_per_arch_model(struct starpu_perfmodel *model, int comb, unsigned impl)
+/*
+ * Binary model files
+ *
+ * They contain the same information as the text model files, laid out so
+ * that they can be mapped in memory and used directly: the history entries
+ * of each combination and implementation are stored sorted by footprint, and
+ * looked up by dichotomy in the mapped file. They are only copied into the
+ * history table and list once some measurement needs to be recorded, or the
+ * list needs to be walked. Structures are stored in the native layout, so
+ * the files are not portable, which is fine since models are per-host anyway.
+ */
+#define _STARPU_PERFMODEL_BINARY_MAGIC "STARPUPM"
+#define _STARPU_PERFMODEL_BINARY_ENDIANNESS 0x01020304
+
+struct _starpu_perfmodel_binary_header
+{
+	char magic[8];
+	/** _STARPU_PERFMODEL_VERSION */
+	uint32_t version;
+	uint32_t endianness;
+	/** Sizes of the structures, to detect incompatible layouts */
+	uint32_t entry_size;
+	uint32_t regression_size;
+	uint32_t device_size;
+	int32_t ncombs;
+	/** Size of the whole file */
+	uint64_t size;
+	/** Then follow ncombs struct _starpu_perfmodel_binary_comb */
+};
+
+struct _starpu_perfmodel_binary_comb
 {
-	struct starpu_perfmodel_per_arch *per_arch_model;
+	int32_t ndevices;
+	int32_t nimpls;
+	/** Offset of the ndevices struct starpu_perfmodel_device */
+	uint64_t devices;
+	/** Offset of the nimpls struct _starpu_perfmodel_binary_per_arch */
+	uint64_t per_arch;
+};
 
-	per_arch_model = &model->state->per_arch[comb][impl];
-	/* count the number of elements in the lists */
-	struct starpu_perfmodel_history_list *ptr = NULL;
-	unsigned nentries = 0;
+struct _starpu_perfmodel_binary_per_arch
+{
+	/** coeff, rls_r and rls_z are meaningless in the file */
+	struct starpu_perfmodel_regression_model regression;
+	/** Offset of the regression.ncoeff coefficients */
+	uint64_t coeff;
+	/** Offset of the rls_r then rls_z sufficient statistics, if any */
+	uint64_t rls;
+	uint64_t nentries;
+	/** Offset of the nentries struct starpu_perfmodel_history_entry, sorted by footprint */
+	uint64_t entries;
+};
 
-	if (model->type == STARPU_HISTORY_BASED || model->type == STARPU_NL_REGRESSION_BASED  || model->type == STARPU_REGRESSION_BASED)
+#define BINARY_CHECK(path, filesize, offset, len) \
+	STARPU_ASSERT_MSG((offset) <= (filesize) && (len) <= (filesize) - (offset) && (offset) % 8 == 0, "Incorrect performance model file %s", path)
+
+static int history_entry_cmp(const void *a, const void *b)
+{
+	uint32_t fa = ((const struct starpu_perfmodel_history_entry *) a)->footprint;
+	uint32_t fb = ((const struct starpu_perfmodel_history_entry *) b)->footprint;
+	return fa < fb ? -1 : fa > fb;
+}
+
+/* Find the history entry for \p footprint, in the history table or in the
+ * mapped binary model file. The model lock must be held. Mapped entries are
+ * read-only, the history has to be materialized before updating entries. */
+static const struct starpu_perfmodel_history_entry *history_find(struct starpu_perfmodel_per_arch *per_arch_model, uint32_t footprint)
+{
+	struct starpu_perfmodel_history_table *elt;
+
+	if (per_arch_model->mapped_history && !per_arch_model->history_snapshot)
 	{
-		/* Dump the list of all entries in the history */
-		ptr = per_arch_model->list;
-		while(ptr)
-		{
-			nentries++;
-			ptr = ptr->next;
-		}
+		struct starpu_perfmodel_history_entry key = { .footprint = footprint };
+		return bsearch(&key, per_arch_model->mapped_history, per_arch_model->mapped_nentries, sizeof(key), history_entry_cmp);
 	}
 
-	/* header */
-	char archname[STR_SHORT_LENGTH];
-	starpu_perfmodel_get_arch_name(arch_combs[comb], archname,  sizeof(archname), impl);
-	STARPU_ASSERT(strlen(archname)>0);
-	check_reg_model(model, comb, impl);
+	HASH_FIND_UINT32_T(per_arch_model->history, &footprint, elt);
+	return elt ? elt->history_entry : NULL;
+}
 
-	/* Dump the history into the model file in case it is necessary */
-	if (model->type == STARPU_HISTORY_BASED || model->type == STARPU_NL_REGRESSION_BASED || model->type == STARPU_REGRESSION_BASED)
+/* Nobody may be recording measurements any more, publish them ourself if
+ * it is late, but do not wait for it */
+static void history_publish_if_late(struct starpu_perfmodel *model, struct starpu_perfmodel_per_arch *per_arch_model)
+{
+	if (history_should_publish(per_arch_model) &&
+	    STARPU_PTHREAD_RWLOCK_TRYWRLOCK(&model->state->model_rwlock) == 0)
 	{
-		ptr = per_arch_model->list;
-		while (ptr)
-		{
-			check_history_entry(ptr->entry);
-			ptr = ptr->next;
-		}
+		if (history_should_publish(per_arch_model))
+			history_publish(model, per_arch_model);
+		STARPU_PTHREAD_RWLOCK_UNLOCK(&model->state->model_rwlock);
 	}
 }
-static void dump_per_arch_model_file(FILE *f, struct starpu_perfmodel *model, int comb, unsigned impl)
+
+/* Find the history entry for \p footprint, without taking the model lock
+ * unless it was not published yet */
+static const struct starpu_perfmodel_history_entry *history_lookup(struct starpu_perfmodel *model, struct starpu_perfmodel_per_arch *per_arch_model, uint32_t footprint)
+{
+	/* The data dependency orders the reads of the snapshot content */
+	const struct _starpu_perfmodel_history_snapshot *snapshot = per_arch_model->history_snapshot;
+	const struct starpu_perfmodel_history_entry *entry = NULL;
+
+	if (snapshot)
+		entry = history_snapshot_find(snapshot, footprint);
+	else if (per_arch_model->mapped_history)
+	{
+		/* Not materialized yet, or being materialized, in which case
+		 * the mapped entries are still valid, only a bit outdated */
+		struct starpu_perfmodel_history_entry key = { .footprint = footprint };
+		entry = bsearch(&key, per_arch_model->mapped_history, per_arch_model->mapped_nentries, sizeof(key), history_entry_cmp);
+	}
+	if (entry || !per_arch_model->history_unpublished)
+		return entry;
+
+	STARPU_PTHREAD_RWLOCK_RDLOCK(&model->state->model_rwlock);
+	entry = history_find(per_arch_model, footprint);
+	STARPU_PTHREAD_RWLOCK_UNLOCK(&model->state->model_rwlock);
+
+	if (entry)
+		history_publish_if_late(model, per_arch_model);
+	return entry;
+}
+
+/* Copy the mapped entries into the history table and list. The model lock
+ * must be held in write mode. The mapped entries are kept referenced, since
+ * predictions may be reading them concurrently. */
+static void history_materialize(struct starpu_perfmodel *model, struct starpu_perfmodel_per_arch *per_arch_model)
+{
+	const struct starpu_perfmodel_history_entry *mapped = per_arch_model->mapped_history;
+	unsigned long i;
+
+	if (!mapped || per_arch_model->history_snapshot)
+		return;
+
+	/* Insert from the end, to keep the list sorted */
+	for (i = per_arch_model->mapped_nentries; i-- > 0; )
+	{
+		struct starpu_perfmodel_history_entry *entry;
+		_STARPU_MALLOC(entry, sizeof(*entry));
+		*entry = mapped[i];
+		entry->parameters = NULL;
+		entry->window = NULL;
+		STARPU_HG_DISABLE_CHECKING(entry->nsample);
+		STARPU_HG_DISABLE_CHECKING(entry->mean);
+		insert_history_entry(entry, &per_arch_model->list, &per_arch_model->history);
+	}
+	history_publish(model, per_arch_model);
+}
+
+/* The model lock has to be held */
+static void history_materialize_all(struct starpu_perfmodel *model)
+{
+	int comb, impl;
+
+	for (comb = 0; comb < model->state->ncombs_set; comb++)
+		if (model->state->per_arch[comb])
+			for (impl = 0; impl < model->state->nimpls_set[comb]; impl++)
+				history_materialize(model, &model->state->per_arch[comb][impl]);
+}
+
+void _starpu_perfmodel_materialize_history(struct starpu_perfmodel *model)
+{
+	if (!model->state || !model->state->mapped)
+		return;
+
+	STARPU_PTHREAD_RWLOCK_WRLOCK(&model->state->model_rwlock);
+	history_materialize_all(model);
+	STARPU_PTHREAD_RWLOCK_UNLOCK(&model->state->model_rwlock);
+}
+
+/* Get the per-arch model of \p comb and \p impl, adding them to the model if
+ * needed. The model lock has to be held */
+static struct starpu_perfmodel_per_arch *perfmodel_get_per_arch(struct starpu_perfmodel *model, int comb, unsigned impl)
 {
 	struct starpu_perfmodel_per_arch *per_arch_model;
+	unsigned found = 0;
+	int c;
 
-	per_arch_model = &model->state->per_arch[comb][impl];
-	/* count the number of elements in the lists */
-	struct starpu_perfmodel_history_list *ptr = NULL;
-	unsigned nentries = 0;
+	for(c = 0; c < model->state->ncombs; c++)
+	{
+		if(model->state->combs[c] == comb)
+		{
+			found = 1;
+			break;
+		}
+	}
 
-	if (model->type == STARPU_HISTORY_BASED || model->type == STARPU_NL_REGRESSION_BASED || model->type == STARPU_REGRESSION_BASED)
+	if(!found)
 	{
-		/* Dump the list of all entries in the history */
-		ptr = per_arch_model->list;
-		while(ptr)
+		if (model->state->ncombs + 1 >= model->state->ncombs_set || comb >= model->state->ncombs_set)
 		{
-			nentries++;
-			ptr = ptr->next;
+			// The number of combinations is bigger than the one which was initially allocated, we need to reallocate,
+			// do not only reallocate 1 extra comb, rather reallocate 5 to avoid too frequent calls to _starpu_perfmodel_realloc
+			_starpu_perfmodel_realloc(model, STARPU_MAX(model->state->ncombs_set+5, comb+1));
 		}
+		model->state->combs[model->state->ncombs++] = comb;
 	}
 
-	/* header */
-	char archname[STR_SHORT_LENGTH];
-	starpu_perfmodel_get_arch_name(arch_combs[comb], archname,  sizeof(archname), impl);
-	fprintf(f, "#####\n");
-	fprintf(f, "# Model for %s\n", archname);
-	fprintf(f, "# number of entries\n%u\n", nentries);
+	if(!model->state->per_arch[comb])
+	{
+		_starpu_perfmodel_malloc_per_arch(model, comb, STARPU_MAXIMPLEMENTATIONS);
+		_starpu_perfmodel_malloc_per_arch_is_set(model, comb, STARPU_MAXIMPLEMENTATIONS);
+		model->state->nimpls[comb] = 0;
+	}
 
-	dump_reg_model(f, model, comb, impl);
+	per_arch_model = &model->state->per_arch[comb][impl];
+	history_materialize(model, per_arch_model);
+	if (model->state->per_arch_is_set[comb][impl] == 0)
+	{
+		// We are adding a new implementation for the given comb and the given impl
+		model->state->nimpls[comb]++;
+		model->state->per_arch_is_set[comb][impl] = 1;
+	}
+	return per_arch_model;
+}
 
-	/* Dump the history into the model file in case it is necessary */
-	if (model->type == STARPU_HISTORY_BASED || model->type == STARPU_NL_REGRESSION_BASED || model->type == STARPU_REGRESSION_BASED)
+/* Use the statistics of the entry merged from all the processes sharing the
+ * model */
+static void history_shm_apply(struct starpu_perfmodel_history_entry *entry, struct _starpu_perfmodel_shm_entry *shm_entry)
+{
+	unsigned nsample;
+	double sum, sum2;
+
+	_starpu_perfmodel_shm_get(shm_entry, &nsample, &sum, &sum2);
+	entry->nsample = nsample;
+	entry->sum = sum;
+	entry->sum2 = sum2;
+
+	/* Robust estimators keep estimating from their window of local
+	 * measurements */
+	if (history_estimator == HISTORY_ESTIMATOR_MEAN || !entry->window)
 	{
-		fprintf(f, "# hash\t\tsize\t\tflops\t\tmean (us or J)\tdev (us or J)\tsum\t\tsum2\t\tn\n");
-		ptr = per_arch_model->list;
-		while (ptr)
+		if (nsample)
 		{
-			dump_history_entry(f, ptr->entry);
-			ptr = ptr->next;
+			entry->mean = sum / nsample;
+			entry->deviation = sqrt(fabs(sum2 - (sum*sum)/nsample)/nsample);
+		}
+		else
+		{
+			entry->mean = 0.;
+			entry->deviation = 0.;
 		}
 	}
-
-	fprintf(f, "\n");
 }
 
-static void check_model(struct starpu_perfmodel *model)
+#ifndef STARPU_SIMGRID
+static void history_shm_import_entry(struct _starpu_perfmodel_shm_entry *shm_entry, struct starpu_perfmodel_arch *arch, unsigned impl, uint32_t footprint, size_t size, void *arg)
 {
-	int ncombs = model->state->ncombs;
-	STARPU_ASSERT(ncombs >= 0);
+	struct starpu_perfmodel *model = arg;
+	struct starpu_perfmodel_per_arch *per_arch_model;
+	struct starpu_perfmodel_history_entry *entry;
+	struct starpu_perfmodel_history_table *elt;
 
-	int i, impl, dev;
-	for(i = 0; i < ncombs; i++)
+	if (impl >= STARPU_MAXIMPLEMENTATIONS)
+		return;
+
+	per_arch_model = perfmodel_get_per_arch(model, _starpu_perfmodel_create_comb_if_needed(arch), impl);
+
+	HASH_FIND_UINT32_T(per_arch_model->history, &footprint, elt);
+	entry = (elt == NULL) ? NULL : elt->history_entry;
+	if (!entry)
 	{
-		int comb = model->state->combs[i];
-		STARPU_ASSERT(comb >= 0);
+		/* Measured by another process */
+		_STARPU_CALLOC(entry, 1, sizeof(struct starpu_perfmodel_history_entry));
+		STARPU_HG_DISABLE_CHECKING(entry->nsample);
+		STARPU_HG_DISABLE_CHECKING(entry->mean);
+		entry->footprint = footprint;
+		entry->size = size;
+		insert_history_entry(entry, &per_arch_model->list, &per_arch_model->history);
+		per_arch_model->history_unpublished++;
+	}
+	history_shm_apply(entry, shm_entry);
+}
 
-		int ndevices = arch_combs[comb]->ndevices;
-		STARPU_ASSERT(ndevices >= 1);
+/* Get the entries of the shared store, including the ones measured by the
+ * other processes. The model lock has to be held */
+static void history_shm_import(struct starpu_perfmodel *model)
+{
+	_starpu_perfmodel_shm_foreach(model->state->shm, history_shm_import_entry, model);
+	history_publish_all(model);
+}
 
-		for(dev = 0; dev < ndevices; dev++)
-		{
-			STARPU_ASSERT(arch_combs[comb]->devices[dev].type < STARPU_NARCH);
+/* Fill the shared store we have just created with the entries loaded from
+ * the model file */
+static void history_shm_seed(struct starpu_perfmodel *model)
+{
+	int c, impl;
 
-			STARPU_ASSERT(arch_combs[comb]->devices[dev].devid >= 0);
+	for (c = 0; c < model->state->ncombs; c++)
+	{
+		int comb = model->state->combs[c];
+		struct starpu_perfmodel_arch *arch = starpu_perfmodel_arch_comb_fetch(comb);
 
-			STARPU_ASSERT(arch_combs[comb]->devices[dev].ncores >= 0);
-		}
+		if (!model->state->per_arch[comb])
+			continue;
 
-		int nimpls = model->state->nimpls[comb];
-		STARPU_ASSERT(nimpls >= 1);
-		for (impl = 0; impl < nimpls; impl++)
+		for (impl = 0; impl < model->state->nimpls_set[comb]; impl++)
 		{
-			check_per_arch_model(model, comb, impl);
+			struct starpu_perfmodel_history_list *list;
+			for (list = model->state->per_arch[comb][impl].list; list; list = list->next)
+			{
+				struct starpu_perfmodel_history_entry *entry = list->entry;
+				struct _starpu_perfmodel_shm_entry *shm_entry = _starpu_perfmodel_shm_find(model->state->shm, arch, impl, entry->footprint, entry->size);
+				if (shm_entry)
+					_starpu_perfmodel_shm_set(shm_entry, entry->nsample, entry->sum, entry->sum2);
+			}
 		}
 	}
 }
 
-/* Driver porters: adding your driver here is optional, only needed for performance models.  */
-
-static void dump_model_file(FILE *f, struct starpu_perfmodel *model)
+/* Attach the model to the store shared by the processes of the machine, see
+ * STARPU_PERF_MODEL_SHARED. The model lock has to be held */
+static void history_share(struct starpu_perfmodel *model, const char *path)
+{
+	int created;
+
+	if (_starpu_get_calibrate_flag() == 2)
+		/* Do not start from the measurements of the previous
+		 * processes either */
+		_starpu_perfmodel_shm_unlink(path);
+
+	model->state->shm = _starpu_perfmodel_shm_open(path, &created);
+	if (!model->state->shm)
+		return;
+
+	/* The entries are updated in place from now on */
+	history_materialize_all(model);
+
+	if (created)
+	{
+		history_shm_seed(model);
+		_starpu_perfmodel_shm_ready(model->state->shm);
+	}
+	else
+		history_shm_import(model);
+}
+#endif
+
+static void binary_unmap(void *base, size_t size)
+{
+#ifdef HAVE_MMAP
+	munmap(base, size);
+#else
+	(void) size;
+	free(base);
+#endif
+}
+
+static unsigned parse_binary_per_arch(const char *base, size_t size, const char *path, const struct _starpu_perfmodel_binary_per_arch *binary, struct starpu_perfmodel_per_arch *per_arch_model, unsigned scan_history, struct starpu_perfmodel *model)
+{
+	struct starpu_perfmodel_regression_model *reg_model = &per_arch_model->regression;
+
+	*reg_model = binary->regression;
+	reg_model->coeff = NULL;
+	reg_model->rls_r = NULL;
+	reg_model->rls_z = NULL;
+	reg_model->valid = !isnan(reg_model->alpha) && !isnan(reg_model->beta) && VALID_REGRESSION(reg_model);
+	reg_model->nl_valid = !isnan(reg_model->a) && !isnan(reg_model->b) && !isnan(reg_model->c) && VALID_REGRESSION(reg_model);
+
+	if (reg_model->ncoeff)
+	{
+		unsigned i;
+		unsigned multi_invalid = 0;
+		BINARY_CHECK(path, size, binary->coeff, reg_model->ncoeff * sizeof(double));
+		_STARPU_MALLOC(reg_model->coeff, reg_model->ncoeff * sizeof(double));
+		memcpy(reg_model->coeff, base + binary->coeff, reg_model->ncoeff * sizeof(double));
+		for (i = 0; i < reg_model->ncoeff; i++)
+			multi_invalid = multi_invalid || isnan(reg_model->coeff[i]);
+		reg_model->multi_valid = !multi_invalid;
+		if (!reg_model->multi_valid)
+		{
+			free(reg_model->coeff);
+			reg_model->coeff = NULL;
+		}
+	}
+
+	if (binary->rls)
+	{
+		unsigned rsize = _starpu_multiple_regression_rls_size(reg_model->ncoeff) - reg_model->ncoeff;
+		BINARY_CHECK(path, size, binary->rls, (rsize + reg_model->ncoeff) * sizeof(double));
+		_STARPU_MALLOC(reg_model->rls_r, rsize * sizeof(double));
+		_STARPU_MALLOC(reg_model->rls_z, reg_model->ncoeff * sizeof(double));
+		memcpy(reg_model->rls_r, base + binary->rls, rsize * sizeof(double));
+		memcpy(reg_model->rls_z, base + binary->rls + rsize * sizeof(double), reg_model->ncoeff * sizeof(double));
+	}
+
+	if (scan_history && binary->nentries)
+	{
+		BINARY_CHECK(path, size, binary->entries, binary->nentries * sizeof(struct starpu_perfmodel_history_entry));
+		per_arch_model->mapped_history = (const void *) (base + binary->entries);
+		per_arch_model->mapped_nentries = binary->nentries;
+	}
+
+	if (model->type == STARPU_PERFMODEL_INVALID)
+	{
+		/* Tool loading a perfmodel without having the corresponding codelet */
+		if (reg_model->ncoeff != 0)
+			model->type = STARPU_MULTIPLE_REGRESSION_BASED;
+		else if (!isnan(reg_model->a) && !isnan(reg_model->b) && !isnan(reg_model->c))
+			model->type = STARPU_NL_REGRESSION_BASED;
+		else if (!isnan(reg_model->alpha) && !isnan(reg_model->beta))
+			model->type = STARPU_REGRESSION_BASED;
+		else if (binary->nentries)
+			model->type = STARPU_HISTORY_BASED;
+	}
+
+	return per_arch_model->mapped_history != NULL;
+}
+
+/* Load the binary model file opened as \p f. When \p lazy is set, the file
+ * stays mapped and the history entries are only copied when needed. */
+static int parse_binary_model_file(FILE *f, const char *path, struct starpu_perfmodel *model, unsigned scan_history, unsigned lazy)
+{
+	const struct _starpu_perfmodel_binary_header *header;
+	const struct _starpu_perfmodel_binary_comb *combs;
+	struct stat st;
+	char *base;
+	size_t size;
+	unsigned mapped = 0;
+	int comb;
+
+	if (fstat(fileno(f), &st) < 0)
+	{
+		_STARPU_DISP("Could not stat performance model file %s: %s, ignoring it\n", path, strerror(errno));
+		return 1;
+	}
+	size = st.st_size;
+	if (size < sizeof(*header))
+	{
+		_STARPU_DISP("Performance model file %s is truncated, ignoring it\n", path);
+		return 1;
+	}
+
+#ifdef HAVE_MMAP
+	/* Models are always saved by renaming a new file over the previous one,
+	 * never rewritten in place, so the mapping stays valid while we use it */
+	base = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+	if (base == MAP_FAILED)
+	{
+		_STARPU_DISP("Could not map performance model file %s: %s, ignoring it\n", path, strerror(errno));
+		return 1;
+	}
+#else
+	_STARPU_MALLOC(base, size);
+	rewind(f);
+	if (fread(base, size, 1, f) != 1)
+	{
+		_STARPU_DISP("Could not read performance model file %s, ignoring it\n", path);
+		free(base);
+		return 1;
+	}
+#endif
+
+	header = (const void *) base;
+	if (header->endianness != _STARPU_PERFMODEL_BINARY_ENDIANNESS
+	    || header->entry_size != sizeof(struct starpu_perfmodel_history_entry)
+	    || header->regression_size != sizeof(struct starpu_perfmodel_regression_model)
+	    || header->device_size != sizeof(struct starpu_perfmodel_device))
+	{
+		_STARPU_DISP("Performance model file %s was written on another kind of machine, ignoring it\n", path);
+		binary_unmap(base, size);
+		return 1;
+	}
+	STARPU_ASSERT_MSG(header->version == _STARPU_PERFMODEL_VERSION, "Incorrect performance model file %s with a model version %d not being the current model version (%d)\n", path,
+			  header->version, _STARPU_PERFMODEL_VERSION);
+	STARPU_ASSERT_MSG(header->size == size && header->ncombs >= 0, "Incorrect performance model file %s", path);
+
+	if (header->ncombs > 0)
+		model->state->ncombs = header->ncombs;
+	if (header->ncombs > model->state->ncombs_set)
+		_starpu_perfmodel_realloc(model, header->ncombs);
+
+	BINARY_CHECK(path, size, (uint64_t) sizeof(*header), header->ncombs * sizeof(*combs));
+	combs = (const void *) (base + sizeof(*header));
+
+	for (comb = 0; comb < header->ncombs; comb++)
+	{
+		const struct _starpu_perfmodel_binary_comb *binary_comb = &combs[comb];
+		const struct _starpu_perfmodel_binary_per_arch *per_arch;
+		int id_comb, impl, implmax;
+
+		STARPU_ASSERT_MSG(binary_comb->ndevices > 0 && binary_comb->nimpls >= 0, "Incorrect performance model file %s", path);
+		BINARY_CHECK(path, size, binary_comb->devices, binary_comb->ndevices * sizeof(struct starpu_perfmodel_device));
+		BINARY_CHECK(path, size, binary_comb->per_arch, binary_comb->nimpls * sizeof(*per_arch));
+
+		struct starpu_perfmodel_device *devices = (void *) (base + binary_comb->devices);
+		id_comb = starpu_perfmodel_arch_comb_get(binary_comb->ndevices, devices);
+		if (id_comb == -1)
+			id_comb = starpu_perfmodel_arch_comb_add(binary_comb->ndevices, devices);
+		if (id_comb >= model->state->ncombs_set)
+			_starpu_perfmodel_realloc(model, id_comb+1);
+		model->state->combs[comb] = id_comb;
+
+		implmax = STARPU_MIN(binary_comb->nimpls, STARPU_MAXIMPLEMENTATIONS);
+		model->state->nimpls[id_comb] = implmax;
+		if (!model->state->per_arch[id_comb])
+			_starpu_perfmodel_malloc_per_arch(model, id_comb, STARPU_MAXIMPLEMENTATIONS);
+		if (!model->state->per_arch_is_set[id_comb])
+			_starpu_perfmodel_malloc_per_arch_is_set(model, id_comb, STARPU_MAXIMPLEMENTATIONS);
+
+		per_arch = (const void *) (base + binary_comb->per_arch);
+		for (impl = 0; impl < implmax; impl++)
+		{
+			struct starpu_perfmodel_per_arch *per_arch_model = &model->state->per_arch[id_comb][impl];
+			model->state->per_arch_is_set[id_comb][impl] = 1;
+			mapped |= parse_binary_per_arch(base, size, path, &per_arch[impl], per_arch_model, scan_history, model);
+			if (!lazy)
+			{
+				history_materialize(model, per_arch_model);
+				per_arch_model->mapped_history = NULL;
+				per_arch_model->mapped_nentries = 0;
+			}
+		}
+	}
+
+	if (lazy && mapped)
+	{
+		STARPU_ASSERT(!model->state->mapped);
+		model->state->mapped = base;
+		model->state->mapped_size = size;
+	}
+	else
+		binary_unmap(base, size);
+
+	return 0;
+}
+
+/* Load the model file opened as \p f, in the text or binary format */
+static int load_model_file(FILE *f, const char *path, struct starpu_perfmodel *model, unsigned scan_history, unsigned lazy)
+{
+	char magic[sizeof(((struct _starpu_perfmodel_binary_header *) NULL)->magic)];
+
+	int ret;
+
+	if (fread(magic, sizeof(magic), 1, f) == 1 && !memcmp(magic, _STARPU_PERFMODEL_BINARY_MAGIC, sizeof(magic)))
+		ret = parse_binary_model_file(f, path, model, scan_history, lazy);
+	else
+		ret = parse_model_file(f, path, model, scan_history);
+	if (ret == 0)
+		history_publish_all(model);
+	return ret;
+}
+
+#ifndef STARPU_SIMGRID
+static void check_per_arch_model(struct starpu_perfmodel *model, int comb, unsigned impl)
+{
+	struct starpu_perfmodel_per_arch *per_arch_model;
+
+	per_arch_model = &model->state->per_arch[comb][impl];
+	/* count the number of elements in the lists */
+	struct starpu_perfmodel_history_list *ptr = NULL;
+	unsigned nentries = 0;
+
+	if (model->type == STARPU_HISTORY_BASED || model->type == STARPU_NL_REGRESSION_BASED || model->type == STARPU_REGRESSION_BASED || model->type == STARPU_INTERPOLATION_BASED)
+	{
+		/* Dump the list of all entries in the history */
+		ptr = per_arch_model->list;
+		while(ptr)
+		{
+			nentries++;
+			ptr = ptr->next;
+		}
+	}
+
+	/* header */
+	char archname[STR_SHORT_LENGTH];
+	starpu_perfmodel_get_arch_name(arch_combs[comb], archname,  sizeof(archname), impl);
+	STARPU_ASSERT(strlen(archname)>0);
+	check_reg_model(model, comb, impl);
+
+	/* Dump the history into the model file in case it is necessary */
+	if (model->type == STARPU_HISTORY_BASED || model->type == STARPU_NL_REGRESSION_BASED || model->type == STARPU_REGRESSION_BASED || model->type == STARPU_INTERPOLATION_BASED)
+	{
+		ptr = per_arch_model->list;
+		while (ptr)
+		{
+			check_history_entry(ptr->entry);
+			ptr = ptr->next;
+		}
+	}
+}
+static void dump_per_arch_model_file(FILE *f, struct starpu_perfmodel *model, int comb, unsigned impl)
+{
+	struct starpu_perfmodel_per_arch *per_arch_model;
+
+	per_arch_model = &model->state->per_arch[comb][impl];
+	/* count the number of elements in the lists */
+	struct starpu_perfmodel_history_list *ptr = NULL;
+	unsigned nentries = 0;
+
+	if (model->type == STARPU_HISTORY_BASED || model->type == STARPU_NL_REGRESSION_BASED || model->type == STARPU_REGRESSION_BASED || model->type == STARPU_INTERPOLATION_BASED)
+	{
+		/* Dump the list of all entries in the history */
+		ptr = per_arch_model->list;
+		while(ptr)
+		{
+			nentries++;
+			ptr = ptr->next;
+		}
+	}
+
+	/* header */
+	char archname[STR_SHORT_LENGTH];
+	starpu_perfmodel_get_arch_name(arch_combs[comb], archname,  sizeof(archname), impl);
+	fprintf(f, "#####\n");
+	fprintf(f, "# Model for %s\n", archname);
+	fprintf(f, "# number of entries\n%u\n", nentries);
+
+	dump_reg_model(f, model, comb, impl);
+
+	/* Dump the history into the model file in case it is necessary */
+	if (model->type == STARPU_HISTORY_BASED || model->type == STARPU_NL_REGRESSION_BASED || model->type == STARPU_REGRESSION_BASED || model->type == STARPU_INTERPOLATION_BASED)
+	{
+		fprintf(f, "# hash\t\tsize\t\tflops\t\tmean (us or J)\tdev (us or J)\tsum\t\tsum2\t\tn\n");
+		ptr = per_arch_model->list;
+		while (ptr)
+		{
+			dump_history_entry(f, ptr->entry);
+			ptr = ptr->next;
+		}
+	}
+
+	fprintf(f, "\n");
+}
+
+static void check_model(struct starpu_perfmodel *model)
+{
+	int ncombs = model->state->ncombs;
+	STARPU_ASSERT(ncombs >= 0);
+
+	int i, impl, dev;
+	for(i = 0; i < ncombs; i++)
+	{
+		int comb = model->state->combs[i];
+		STARPU_ASSERT(comb >= 0);
+
+		int ndevices = arch_combs[comb]->ndevices;
+		STARPU_ASSERT(ndevices >= 1);
+
+		for(dev = 0; dev < ndevices; dev++)
+		{
+			STARPU_ASSERT(arch_combs[comb]->devices[dev].type < STARPU_NARCH);
+
+			STARPU_ASSERT(arch_combs[comb]->devices[dev].devid >= 0);
+
+			STARPU_ASSERT(arch_combs[comb]->devices[dev].ncores >= 0);
+		}
+
+		int nimpls = model->state->nimpls[comb];
+		STARPU_ASSERT(nimpls >= 1);
+		for (impl = 0; impl < nimpls; impl++)
+		{
+			check_per_arch_model(model, comb, impl);
+		}
+	}
+}
+
+/* Driver porters: adding your driver here is optional, only needed for performance models.  */
+
+static void dump_model_file(FILE *f, struct starpu_perfmodel *model)
 {
 	fprintf(f, "##################\n");
 	fprintf(f, "# Performance Model Version\n");
@@ -976,6 +1839,165 @@ static void dump_model_file(FILE *f, struct starpu_perfmodel *model)
 		}
 	}
 }
+
+/* Buffer in which binary model files are built */
+struct binary_buffer
+{
+	char *data;
+	size_t size;
+	size_t allocated;
+};
+
+/* Reserve \p len zeroed bytes aligned on 8 bytes, and return their offset */
+static uint64_t binary_reserve(struct binary_buffer *buf, size_t len)
+{
+	size_t offset = (buf->size + 7) & ~(size_t) 7;
+
+	if (offset + len > buf->allocated)
+	{
+		buf->allocated = STARPU_MAX(2 * buf->allocated, STARPU_MAX(offset + len, (size_t) 4096));
+		_STARPU_REALLOC(buf->data, buf->allocated);
+	}
+	memset(buf->data + buf->size, 0, offset + len - buf->size);
+	buf->size = offset + len;
+	return offset;
+}
+
+/* Compute the regression parameters the same way as dump_reg_model does */
+static void binary_prepare_reg_model(struct starpu_perfmodel *model, struct starpu_perfmodel_per_arch *per_arch_model, struct starpu_perfmodel_regression_model *res)
+{
+	struct starpu_perfmodel_regression_model *reg_model = &per_arch_model->regression;
+
+	if (model->type == STARPU_MULTIPLE_REGRESSION_BASED)
+	{
+		if (model->ncombinations==0 || model->combinations==NULL)
+			_starpu_multiple_regression_dump_observations(per_arch_model->list, model->nparameters, model->parameters_names, model->symbol);
+		else if (reg_model->coeff)
+			starpu_validate_mlr(reg_model->coeff, reg_model->ncoeff, model->symbol);
+	}
+
+	*res = *reg_model;
+	res->coeff = NULL;
+	res->rls_r = NULL;
+	res->rls_z = NULL;
+
+	/* Unless we have enough measurements, we put NaN in the file to indicate the model is invalid */
+	if (!((model->type == STARPU_REGRESSION_BASED || model->type == STARPU_NL_REGRESSION_BASED || model->type == STARPU_INTERPOLATION_BASED) && reg_model->nsample > 1))
+		res->alpha = res->beta = nan("");
+
+	res->a = res->b = res->c = nan("");
+	if (model->type == STARPU_NL_REGRESSION_BASED || model->type == STARPU_INTERPOLATION_BASED)
+	{
+		if (_starpu_regression_non_linear_power(per_arch_model->list, &res->a, &res->b, &res->c) != 0)
+			_STARPU_DISP("Warning: could not compute a non-linear regression for model %s\n", model->symbol);
+	}
+
+	if (model->type != STARPU_MULTIPLE_REGRESSION_BASED || model->ncombinations == 0 || model->combinations == NULL)
+		res->ncoeff = 0;
+}
+
+static void dump_binary_per_arch(struct binary_buffer *buf, uint64_t offset, struct starpu_perfmodel *model, int comb, unsigned impl)
+{
+	struct starpu_perfmodel_per_arch *per_arch_model = &model->state->per_arch[comb][impl];
+	struct _starpu_perfmodel_binary_per_arch *binary;
+	struct starpu_perfmodel_regression_model reg;
+	struct starpu_perfmodel_history_list *ptr;
+	struct starpu_perfmodel_history_entry *entries;
+	uint64_t coeff = 0, rls = 0, entries_offset = 0;
+	unsigned long nentries = 0, i;
+
+	binary_prepare_reg_model(model, per_arch_model, &reg);
+
+	if (reg.ncoeff)
+	{
+		struct starpu_perfmodel_regression_model *reg_model = &per_arch_model->regression;
+		coeff = binary_reserve(buf, reg.ncoeff * sizeof(double));
+		for (i = 0; i < reg.ncoeff; i++)
+			((double *) (buf->data + coeff))[i] = reg_model->coeff ? reg_model->coeff[i] : nan("");
+
+		if (reg_model->rls_r)
+		{
+			unsigned rsize = _starpu_multiple_regression_rls_size(reg.ncoeff) - reg.ncoeff;
+			rls = binary_reserve(buf, (rsize + reg.ncoeff) * sizeof(double));
+			memcpy(buf->data + rls, reg_model->rls_r, rsize * sizeof(double));
+			memcpy(buf->data + rls + rsize * sizeof(double), reg_model->rls_z, reg.ncoeff * sizeof(double));
+		}
+	}
+
+	if (model->type == STARPU_HISTORY_BASED || model->type == STARPU_NL_REGRESSION_BASED || model->type == STARPU_REGRESSION_BASED || model->type == STARPU_INTERPOLATION_BASED)
+	{
+		for (ptr = per_arch_model->list; ptr; ptr = ptr->next)
+			nentries++;
+
+		entries_offset = binary_reserve(buf, nentries * sizeof(*entries));
+		entries = (void *) (buf->data + entries_offset);
+		for (ptr = per_arch_model->list, i = 0; ptr; ptr = ptr->next, i++)
+		{
+			entries[i] = *ptr->entry;
+			entries[i].parameters = NULL;
+			entries[i].window = NULL;
+		}
+		qsort(entries, nentries, sizeof(*entries), history_entry_cmp);
+	}
+
+	binary = (void *) (buf->data + offset);
+	binary->regression = reg;
+	binary->coeff = coeff;
+	binary->rls = rls;
+	binary->nentries = nentries;
+	binary->entries = entries_offset;
+}
+
+static int dump_binary_model_file(FILE *f, struct starpu_perfmodel *model)
+{
+	struct binary_buffer buf = { NULL, 0, 0 };
+	struct _starpu_perfmodel_binary_header *header;
+	int ncombs = model->state->ncombs;
+	uint64_t combs;
+	int i, ret = 0;
+
+	binary_reserve(&buf, sizeof(*header));
+	combs = binary_reserve(&buf, ncombs * sizeof(struct _starpu_perfmodel_binary_comb));
+	STARPU_ASSERT(combs == sizeof(*header));
+
+	for (i = 0; i < ncombs; i++)
+	{
+		int comb = model->state->combs[i];
+		int nimpls = model->state->nimpls[comb];
+		int ndevices = arch_combs[comb]->ndevices;
+		struct _starpu_perfmodel_binary_comb *binary_comb;
+		uint64_t devices, per_arch;
+		int impl;
+
+		devices = binary_reserve(&buf, ndevices * sizeof(struct starpu_perfmodel_device));
+		memcpy(buf.data + devices, arch_combs[comb]->devices, ndevices * sizeof(struct starpu_perfmodel_device));
+		per_arch = binary_reserve(&buf, nimpls * sizeof(struct _starpu_perfmodel_binary_per_arch));
+
+		binary_comb = (struct _starpu_perfmodel_binary_comb *) (buf.data + combs) + i;
+		binary_comb->ndevices = ndevices;
+		binary_comb->nimpls = nimpls;
+		binary_comb->devices = devices;
+		binary_comb->per_arch = per_arch;
+
+		for (impl = 0; impl < nimpls; impl++)
+			dump_binary_per_arch(&buf, per_arch + impl * sizeof(struct _starpu_perfmodel_binary_per_arch), model, comb, impl);
+	}
+
+	header = (void *) buf.data;
+	memcpy(header->magic, _STARPU_PERFMODEL_BINARY_MAGIC, sizeof(header->magic));
+	header->version = _STARPU_PERFMODEL_VERSION;
+	header->endianness = _STARPU_PERFMODEL_BINARY_ENDIANNESS;
+	header->entry_size = sizeof(struct starpu_perfmodel_history_entry);
+	header->regression_size = sizeof(struct starpu_perfmodel_regression_model);
+	header->device_size = sizeof(struct starpu_perfmodel_device);
+	header->ncombs = ncombs;
+	header->size = buf.size;
+
+	if (fwrite(buf.data, buf.size, 1, f) != 1)
+		ret = -errno;
+	free(buf.data);
+	return ret;
+}
 #endif
 
 static void dump_history_entry_xml(FILE *f, struct starpu_perfmodel_history_entry *entry)
@@ -1023,7 +2045,7 @@ static void dump_reg_model_xml(FILE *f, struct starpu_perfmodel *model, int comb
 
 	else if (model->type == STARPU_MULTIPLE_REGRESSION_BASED)
 	{
-		if (reg_model->ncoeff==0 || model->ncombinations==0 || model->combinations==NULL)
+		if (reg_model->ncoeff==0 || reg_model->coeff==NULL || model->ncombinations==0 || model->combinations==NULL)
 			fprintf(f, "      <ml_regression constant=\"nan\"/>\n");
 		else
 		{
@@ -1135,24 +2157,37 @@ void starpu_perfmodel_dump_xml(FILE *f, struct starpu_perfmodel *model)
 void _starpu_perfmodel_realloc(struct starpu_perfmodel *model, int nb)
 {
 	int i;
+	struct starpu_perfmodel_per_arch **per_arch, **old;
 
 	STARPU_ASSERT(nb > model->state->ncombs_set);
 #ifdef SSIZE_MAX
 	STARPU_ASSERT((size_t) nb < SSIZE_MAX / sizeof(struct starpu_perfmodel_per_arch*));
 #endif
-	_STARPU_REALLOC(model->state->per_arch, nb*sizeof(struct starpu_perfmodel_per_arch*));
+	/* Predictions may be reading the previous per_arch array without the
+	 * model lock, so publish a new one and keep the previous one */
+	_STARPU_MALLOC(per_arch, nb*sizeof(struct starpu_perfmodel_per_arch*));
+	if (model->state->ncombs_set)
+		memcpy(per_arch, model->state->per_arch, model->state->ncombs_set*sizeof(struct starpu_perfmodel_per_arch*));
 	_STARPU_REALLOC(model->state->per_arch_is_set, nb*sizeof(int*));
 	_STARPU_REALLOC(model->state->nimpls, nb*sizeof(int));
 	_STARPU_REALLOC(model->state->nimpls_set, nb*sizeof(int));
 	_STARPU_REALLOC(model->state->combs, nb*sizeof(int));
 	for(i = model->state->ncombs_set; i < nb; i++)
 	{
-		model->state->per_arch[i] = NULL;
+		per_arch[i] = NULL;
 		model->state->per_arch_is_set[i] = NULL;
 		model->state->nimpls[i] = 0;
 		model->state->nimpls_set[i] = 0;
 	}
+	old = model->state->per_arch;
+	STARPU_WMB();
+	model->state->per_arch = per_arch;
+	/* Publish the array before its size, and before retiring the previous
+	 * one, which predictions starting after the retirement must not see */
+	STARPU_WMB();
 	model->state->ncombs_set = nb;
+	if (old)
+		perfmodel_retire(model->state, old);
 }
 
 void starpu_perfmodel_init(struct starpu_perfmodel *model)
@@ -1193,6 +2228,17 @@ void starpu_perfmodel_init(struct starpu_perfmodel *model)
 	_STARPU_CALLOC(model->state->nimpls_set, ncombs, sizeof(int));
 	_STARPU_MALLOC(model->state->combs, ncombs*sizeof(int));
 	model->state->ncombs = 0;
+	model->state->mapped = NULL;
+	model->state->mapped_size = 0;
+	model->state->retired = NULL;
+	model->state->retiring = NULL;
+	model->state->epoch = 0;
+	model->state->readers[0] = 0;
+	model->state->readers[1] = 0;
+	model->state->shm = NULL;
+	STARPU_HG_DISABLE_CHECKING(model->state->epoch);
+	STARPU_HG_DISABLE_CHECKING(model->state->per_arch);
+	STARPU_HG_DISABLE_CHECKING(model->state->ncombs_set);
 
 	/* add the model to a linked list */
 	struct _starpu_perfmodel *node = _starpu_perfmodel_new();
@@ -1223,12 +2269,43 @@ void starpu_perfmodel_get_model_path_default_location(const char *symbol, char *
 	_starpu_set_default_perf_model_codelet(symbol, _starpu_perfmodel_hostname, path, maxlen);
 }
 
-#ifndef STARPU_SIMGRID
+#ifndef STARPU_SIMGRID
+/* Write \p model into \p path. The file is written aside and renamed over
+ * \p path, so that processes which have mapped the previous file, are loading
+ * it, or are saving it too, keep a consistent view */
+static int save_model_file(const char *path, struct starpu_perfmodel *model, int binary)
+{
+	char tmp[STR_LONG_LENGTH+32];
+	FILE *f;
+	int ret = 0;
+
+	_starpu_perfmodel_materialize_history(model);
+
+	snprintf(tmp, sizeof(tmp), "%s.%d.tmp", path, (int) getpid());
+	f = fopen(tmp, "wb");
+	if (!f)
+		return -errno;
+
+	check_model(model);
+	if (binary)
+		ret = dump_binary_model_file(f, model);
+	else
+		dump_model_file(f, model);
+
+	if (fclose(f) && !ret)
+		ret = -errno;
+	if (!ret && rename(tmp, path))
+		ret = -errno;
+	if (ret)
+		unlink(tmp);
+	return ret;
+}
+
 void starpu_save_history_based_model(struct starpu_perfmodel *model)
 {
 	STARPU_ASSERT(model);
 	STARPU_ASSERT(model->symbol);
-	int locked;
+	int ret;
 
 	/* TODO checks */
 
@@ -1243,23 +2320,35 @@ void starpu_save_history_based_model(struct starpu_perfmodel *model)
 	model->path = strdup(path);
 	_STARPU_DEBUG("Opening performance model file <%s> for model <%s>\n", path, model->symbol);
 
-	/* overwrite existing file, or create it */
-	FILE *f;
-	f = fopen(path, "a+");
-	STARPU_ASSERT_MSG(f, "Could not save performance model %s\n", path);
+	if (model->state->shm)
+	{
+		/* Save what all the processes sharing the model have measured */
+		STARPU_PTHREAD_RWLOCK_WRLOCK(&model->state->model_rwlock);
+		history_shm_import(model);
+		STARPU_PTHREAD_RWLOCK_UNLOCK(&model->state->model_rwlock);
+	}
 
-	locked = _starpu_fwrlock(f) == 0;
-	check_model(model);
-	fseek(f, 0, SEEK_SET);
-	_starpu_fftruncate(f, 0);
-	dump_model_file(f, model);
-	if (locked)
-		_starpu_fwrunlock(f);
+	ret = save_model_file(path, model, binary_models);
+	STARPU_ASSERT_MSG(ret == 0, "Could not save performance model %s: %s\n", path, strerror(-ret));
 
-	fclose(f);
+	if (model->state->shm)
+		/* The shared store is still up to date with the file */
+		_starpu_perfmodel_shm_saved(model->state->shm, path);
 }
 #endif
 
+int starpu_perfmodel_save_file(const char *filename, struct starpu_perfmodel *model, int binary)
+{
+#ifdef STARPU_SIMGRID
+	(void) filename;
+	(void) model;
+	(void) binary;
+	return -ENOSYS;
+#else
+	return save_model_file(filename, model, binary);
+#endif
+}
+
 static void _starpu_dump_registered_models(void)
 {
 #ifndef STARPU_SIMGRID
@@ -1294,9 +2383,9 @@ void _starpu_deinitialize_performance_model(struct starpu_perfmodel *model)
 				for(impl=0 ; impl<model->state->nimpls_set[i] ; impl++)
 				{
 					struct starpu_perfmodel_per_arch *archmodel = &model->state->per_arch[i][impl];
+					struct starpu_perfmodel_history_list *list;
 					if (archmodel->history)
 					{
-						struct starpu_perfmodel_history_list *list;
 						struct starpu_perfmodel_history_table *entry=NULL, *tmp=NULL;
 
 						HASH_ITER(hh, archmodel->history, entry, tmp)
@@ -1305,18 +2394,31 @@ void _starpu_deinitialize_performance_model(struct starpu_perfmodel *model)
 							free(entry);
 						}
 						archmodel->history = NULL;
+					}
 
-						list = archmodel->list;
-						while (list)
-						{
-							struct starpu_perfmodel_history_list *plist;
-							free(list->entry);
-							plist = list;
-							list = list->next;
-							free(plist);
-						}
-						archmodel->list = NULL;
+					/* Multiple regression models only have the list */
+					list = archmodel->list;
+					while (list)
+					{
+						struct starpu_perfmodel_history_list *plist;
+						free(list->entry->parameters);
+						free(list->entry->window);
+						free(list->entry);
+						plist = list;
+						list = list->next;
+						free(plist);
 					}
+					archmodel->list = NULL;
+
+					free(archmodel->regression.coeff);
+					archmodel->regression.coeff = NULL;
+					free(archmodel->regression.rls_r);
+					archmodel->regression.rls_r = NULL;
+					free(archmodel->regression.rls_z);
+					archmodel->regression.rls_z = NULL;
+					free(archmodel->history_snapshot);
+					archmodel->history_snapshot = NULL;
+					archmodel->history_unpublished = 0;
 				}
 				free(model->state->per_arch[i]);
 				model->state->per_arch[i] = NULL;
@@ -1340,6 +2442,20 @@ void _starpu_deinitialize_performance_model(struct starpu_perfmodel *model)
 		free(model->state->combs);
 		model->state->combs = NULL;
 		model->state->ncombs = 0;
+
+		perfmodel_free_retired(model->state);
+
+		if (model->state->mapped)
+		{
+			binary_unmap(model->state->mapped, model->state->mapped_size);
+			model->state->mapped = NULL;
+			model->state->mapped_size = 0;
+		}
+	}
+	if (model->state && model->state->shm)
+	{
+		_starpu_perfmodel_shm_close(model->state->shm);
+		model->state->shm = NULL;
 	}
 	model->is_init = 0;
 	model->is_loaded = 0;
@@ -1404,6 +2520,14 @@ void _starpu_load_history_based_model(struct starpu_perfmodel *model, unsigned s
 		if (path[0] == '\0')
 		{
 			_STARPU_DEBUG("No performance model file for model %s ...\n", model->symbol);
+#ifndef STARPU_SIMGRID
+			if (shared_models && scan_history)
+			{
+				/* Other processes may be calibrating it already */
+				starpu_perfmodel_get_model_path_default_location(model->symbol, path, sizeof(path));
+				history_share(model, path);
+			}
+#endif
 			STARPU_PTHREAD_RWLOCK_UNLOCK(&model->state->model_rwlock);
 			return;
 		}
@@ -1428,7 +2552,9 @@ void _starpu_load_history_based_model(struct starpu_perfmodel *model, unsigned s
 			{
 				int locked;
 				locked = _starpu_frdlock(f) == 0;
-				parse_model_file(f, path, model, scan_history);
+				/* Interpolation needs the entries sorted by size,
+				 * which binary files do not provide */
+				load_model_file(f, path, model, scan_history, model->type != STARPU_INTERPOLATION_BASED);
 				if (locked)
 					_starpu_frdunlock(f);
 				fclose(f);
@@ -1440,6 +2566,10 @@ void _starpu_load_history_based_model(struct starpu_perfmodel *model, unsigned s
 			}
 		}
 
+#ifndef STARPU_SIMGRID
+		if (shared_models && scan_history)
+			history_share(model, path);
+#endif
 	}
 	STARPU_PTHREAD_RWLOCK_UNLOCK(&model->state->model_rwlock);
 
@@ -1493,7 +2623,7 @@ int starpu_perfmodel_load_file(const char *filename, struct starpu_perfmodel *mo
 	model->path = strdup(filename);
 
 	locked = _starpu_frdlock(f) == 0;
-	ret = parse_model_file(f, filename, model, 1);
+	ret = load_model_file(f, filename, model, 1, 0);
 	if (locked)
 		_starpu_frdunlock(f);
 
@@ -1630,7 +2760,7 @@ double _starpu_non_linear_regression_based_job_expected_perf(struct starpu_perfm
 	double exp = NAN;
 	size_t size = 0;
 	struct starpu_perfmodel_regression_model *regmodel;
-	struct starpu_perfmodel_history_table *entry = NULL;
+	const struct starpu_perfmodel_history_entry *entry = NULL;
 
 	comb = starpu_perfmodel_arch_comb_get(arch->ndevices, arch->devices);
 	if (comb == -1)
@@ -1658,18 +2788,16 @@ double _starpu_non_linear_regression_based_job_expected_perf(struct starpu_perfm
 	{
 		uint32_t key = _starpu_compute_buffers_footprint(model, arch, nimpl, j);
 		struct starpu_perfmodel_per_arch *per_arch_model = &model->state->per_arch[comb][nimpl];
-		struct starpu_perfmodel_history_table *history;
 
-		history = per_arch_model->history;
-		HASH_FIND_UINT32_T(history, &key, entry);
+		entry = history_find(per_arch_model, key);
 		STARPU_PTHREAD_RWLOCK_UNLOCK(&model->state->model_rwlock);
 
 		/* Here helgrind would shout that this is unprotected access.
 		 * We do not care about racing access to the mean, we only want
 		 * a good-enough estimation */
 
-		if (entry && entry->history_entry && entry->history_entry->nsample >= _starpu_calibration_minimum)
-			exp = entry->history_entry->mean;
+		if (entry && entry->nsample >= _starpu_calibration_minimum)
+			exp = entry->mean;
 
 docal:
 		STARPU_HG_DISABLE_CHECKING(model->benchmarking);
@@ -1678,7 +2806,7 @@ docal:
 			char archname[STR_SHORT_LENGTH];
 
 			starpu_perfmodel_get_arch_name(arch, archname, sizeof(archname), nimpl);
-			_STARPU_DISP("Warning: model %s is not calibrated enough for %s size %lu (only %u measurements), forcing calibration for this run. Use the STARPU_CALIBRATE environment variable to control this. You probably need to run again to continue calibrating the model, until this warning disappears.\n", model->symbol, archname, (unsigned long) size, entry && entry->history_entry ? entry->history_entry->nsample : 0);
+			_STARPU_DISP("Warning: model %s is not calibrated enough for %s size %lu (only %u measurements), forcing calibration for this run. Use the STARPU_CALIBRATE environment variable to control this. You probably need to run again to continue calibrating the model, until this warning disappears.\n", model->symbol, archname, (unsigned long) size, entry ? entry->nsample : 0);
 			_starpu_set_calibrate_flag(1);
 			model->benchmarking = 1;
 		}
@@ -1687,6 +2815,166 @@ docal:
 	return exp;
 }
 
+/* Last measurements of a history entry, for the robust estimators, and
+ * state of the change detection */
+struct starpu_perfmodel_history_window
+{
+	/** Number of measurements in \p samples */
+	unsigned n;
+	/** Next slot of \p samples to overwrite */
+	unsigned pos;
+	/** Two-sided CUSUM of the standardized deviations from the mean */
+	double cusum_high;
+	double cusum_low;
+	/** history_window measurements, then as much scratch space */
+	double samples[];
+};
+
+static int double_cmp(const void *a, const void *b)
+{
+	double da = *(const double *) a, db = *(const double *) b;
+	return da < db ? -1 : da > db;
+}
+
+static void history_window_push(struct starpu_perfmodel_history_window *window, double measured, unsigned number)
+{
+	unsigned i;
+
+	for (i = 0; i < STARPU_MIN(number, history_window); i++)
+	{
+		window->samples[window->pos] = measured;
+		window->pos = (window->pos + 1) % history_window;
+		if (window->n < history_window)
+			window->n++;
+	}
+}
+
+static struct starpu_perfmodel_history_window *history_window_get(struct starpu_perfmodel_history_entry *entry)
+{
+	if (!entry->window)
+	{
+		_STARPU_CALLOC(entry->window, 1, sizeof(*entry->window) + 2 * history_window * sizeof(entry->window->samples[0]));
+		/* Entries loaded from a file only have their estimation left,
+		 * use it as a prior */
+		if (entry->nsample)
+			history_window_push(entry->window, entry->mean, entry->nsample);
+	}
+	return entry->window;
+}
+
+/* Estimate the mean and deviation of \p entry from its last measurements */
+static void history_window_estimate(struct starpu_perfmodel_history_entry *entry)
+{
+	struct starpu_perfmodel_history_window *window = entry->window;
+	double *sorted = &window->samples[history_window];
+	unsigned n = window->n, i;
+
+	memcpy(sorted, window->samples, n * sizeof(*sorted));
+	qsort(sorted, n, sizeof(*sorted), double_cmp);
+
+	if (history_estimator == HISTORY_ESTIMATOR_MEDIAN)
+	{
+		double median = n % 2 ? sorted[n/2] : (sorted[n/2-1] + sorted[n/2]) / 2;
+
+		/* Scaled median absolute deviation, which is the standard
+		 * deviation for normal distributions */
+		for (i = 0; i < n; i++)
+			sorted[i] = fabs(sorted[i] - median);
+		qsort(sorted, n, sizeof(*sorted), double_cmp);
+		entry->mean = median;
+		entry->deviation = 1.4826 * (n % 2 ? sorted[n/2] : (sorted[n/2-1] + sorted[n/2]) / 2);
+	}
+	else
+	{
+		/* Interquartile mean */
+		unsigned trim = n / 4, kept = n - 2 * trim;
+		double sum = 0., sum2 = 0.;
+
+		for (i = trim; i < n - trim; i++)
+		{
+			sum += sorted[i];
+			sum2 += sorted[i] * sorted[i];
+		}
+		entry->mean = sum / kept;
+		entry->deviation = sqrt(fabs(sum2 - sum*sum/kept) / kept);
+	}
+}
+
+/* Whether the measurement departs from the distribution of \p entry for long
+ * enough to consider that it changed */
+static int history_change_detected(struct starpu_perfmodel_history_entry *entry, double measured, unsigned number)
+{
+	struct starpu_perfmodel_history_window *window = history_window_get(entry);
+	/* Do not let a very stable entry trigger on small variations */
+	double sigma = STARPU_MAX(entry->deviation, 0.01 * entry->mean);
+	double z;
+
+	if (entry->nsample < _starpu_calibration_minimum || sigma <= 0.)
+		return 0;
+
+	/* Clamp the contribution of a single measurement, so that only a
+	 * sustained shift can trigger, not a few outliers, and allow drifting
+	 * by half a deviation without accumulating */
+	z = (measured - entry->mean) / sigma;
+	z = STARPU_MAX(-2., STARPU_MIN(2., z));
+	window->cusum_high = STARPU_MAX(0., window->cusum_high + number * (z - 0.5));
+	window->cusum_low = STARPU_MAX(0., window->cusum_low + number * (-z - 0.5));
+	return window->cusum_high > history_change_threshold || window->cusum_low > history_change_threshold;
+}
+
+/* Merge a measurement into the multiple linear regression of
+ * \p per_arch_model, and update its coefficients. The model lock must be held
+ * in write mode. */
+static void multiple_regression_update(struct starpu_perfmodel *model, struct starpu_perfmodel_per_arch *per_arch_model, const double *parameters, double measured, unsigned number)
+{
+	struct starpu_perfmodel_regression_model *reg_model = &per_arch_model->regression;
+	unsigned ncoeff = model->ncombinations + 1;
+
+	if (reg_model->ncoeff != ncoeff)
+	{
+		/* First measurement, or the combinations of the model changed */
+		double *old = reg_model->coeff;
+		reg_model->multi_valid = 0;
+		reg_model->coeff = NULL;
+		STARPU_WMB();
+		if (old)
+			/* Predictions may still be reading it */
+			perfmodel_retire(model->state, old);
+		free(reg_model->rls_r);
+		reg_model->rls_r = NULL;
+		free(reg_model->rls_z);
+		reg_model->rls_z = NULL;
+		reg_model->nsample = 0;
+		reg_model->ncoeff = ncoeff;
+
+		if (mlr_forgetting_factor < 1. && ncoeff >= 1. / (1. - mlr_forgetting_factor))
+			_STARPU_DISP("Warning: model %s has %u coefficients, but STARPU_MLR_FORGETTING_FACTOR %f only keeps about %.0f measurements, the coefficients will not be reliable\n", model->symbol, ncoeff, mlr_forgetting_factor, 1. / (1. - mlr_forgetting_factor));
+	}
+
+	_starpu_multiple_regression_update(reg_model, parameters, model->nparameters, model->combinations, measured, number, mlr_forgetting_factor);
+
+	double *coeff;
+	_STARPU_MALLOC(coeff, ncoeff*sizeof(double));
+	if (_starpu_multiple_regression_solve(reg_model, coeff))
+	{
+		/* Keep the previous coefficients, if any */
+		free(coeff);
+		return;
+	}
+
+	/* Predictions may be reading the previous coefficients, publish the
+	 * new ones only once they are computed */
+	double *old = reg_model->coeff;
+	STARPU_WMB();
+	reg_model->coeff = coeff;
+	reg_model->multi_valid = 1;
+	/* Retire the previous ones only once predictions can not see them any
+	 * more */
+	STARPU_WMB();
+	if (old)
+		perfmodel_retire(model->state, old);
+}
+
 double _starpu_multiple_regression_based_job_expected_perf(struct starpu_perfmodel *model, struct starpu_perfmodel_arch* arch, struct _starpu_job *j, unsigned nimpl)
 {
 	int comb;
@@ -1707,13 +2995,20 @@ double _starpu_multiple_regression_based_job_expected_perf(struct starpu_perfmod
 	}
 	reg_model = &model->state->per_arch[comb][nimpl].regression;
 	STARPU_PTHREAD_RWLOCK_UNLOCK(&model->state->model_rwlock);
-	if (reg_model->coeff == NULL)
+
+	/* The coefficients may get retired meanwhile */
+	unsigned epoch = perfmodel_read_begin(model->state);
+	const double *coeff = reg_model->coeff;
+	if (coeff == NULL)
+	{
+		perfmodel_read_end(model->state, epoch);
 		goto docal;
+	}
 
 	double *parameters;
 	_STARPU_MALLOC(parameters, model->nparameters*sizeof(double));
 	model->parameters(j->task, parameters);
-	expected_duration=reg_model->coeff[0];
+	expected_duration=coeff[0];
 	unsigned i;
 	for (i=0; i < model->ncombinations; i++)
 	{
@@ -1722,8 +3017,9 @@ double _starpu_multiple_regression_based_job_expected_perf(struct starpu_perfmod
 		for (k=0; k < model->nparameters; k++)
 			parameter_value *= pow(parameters[k],model->combinations[i][k]);
 
-		expected_duration += reg_model->coeff[i+1]*parameter_value;
+		expected_duration += coeff[i+1]*parameter_value;
 	}
+	perfmodel_read_end(model->state, epoch);
 
 docal:
 	STARPU_HG_DISABLE_CHECKING(model->benchmarking);
@@ -1746,39 +3042,115 @@ docal:
 	return expected_duration;
 }
 
+/* Get the entry of \p key on \p comb if it is calibrated enough to transfer
+ * its predictions to another combination. With \p locked, the model lock is
+ * held */
+static const struct starpu_perfmodel_history_entry *history_transfer_source(struct starpu_perfmodel *model, int comb, unsigned impl, uint32_t key, unsigned locked)
+{
+	struct starpu_perfmodel_per_arch *per_arch;
+	const struct starpu_perfmodel_history_entry *entry;
+
+	if (comb >= model->state->ncombs_set)
+		return NULL;
+	STARPU_RMB();
+	per_arch = model->state->per_arch[comb];
+	if (per_arch == NULL)
+		return NULL;
+
+	entry = locked ? history_find(&per_arch[impl], key) : history_lookup(model, &per_arch[impl], key);
+	if (!entry || entry->nsample < _starpu_calibration_minimum || entry->mean <= 0.)
+		return NULL;
+	return entry;
+}
+
+/* Learn how much slower or faster the combination of \p per_arch_model is
+ * than another combination where \p key is calibrated, to transfer the
+ * predictions of the latter to the footprints which are not calibrated yet.
+ * The model lock has to be held */
+static void history_transfer_learn(struct starpu_perfmodel *model, struct starpu_perfmodel_per_arch *per_arch_model, int comb, unsigned impl, uint32_t key, double measured, unsigned number)
+{
+	const struct starpu_perfmodel_history_entry *source = NULL;
+	int c, source_comb = -1;
+
+	if (measured <= 0.)
+		return;
+
+	if (per_arch_model->transfer_nsample)
+	{
+		/* Keep learning against the same combination */
+		source_comb = per_arch_model->transfer_comb;
+		source = history_transfer_source(model, source_comb, impl, key, 1);
+	}
+	else
+		for (c = 0; c < model->state->ncombs && !source; c++)
+		{
+			source_comb = model->state->combs[c];
+			if (source_comb != comb)
+				source = history_transfer_source(model, source_comb, impl, key, 1);
+		}
+
+	if (!source)
+		return;
+
+	/* The ratios are averaged geometrically, so that they do not depend
+	 * on the durations of the footprints */
+	per_arch_model->transfer_comb = source_comb;
+	per_arch_model->transfer_log_ratio += log(measured / source->mean) * number;
+	STARPU_WMB();
+	per_arch_model->transfer_nsample += number;
+}
+
+/* Predict the duration of \p key on the combination of \p per_arch_model,
+ * where it is not calibrated enough, from the combination it learned its
+ * ratio against */
+static double history_transfer_predict(struct starpu_perfmodel *model, struct starpu_perfmodel_per_arch *per_arch_model, unsigned impl, uint32_t key, size_t offset)
+{
+	const struct starpu_perfmodel_history_entry *source;
+	unsigned nsample = per_arch_model->transfer_nsample;
+
+	if (nsample < transfer_min)
+		return NAN;
+	STARPU_RMB();
+
+	source = history_transfer_source(model, per_arch_model->transfer_comb, impl, key, 0);
+	if (!source)
+		return NAN;
+	return *(double *) ((char *) source + offset) * exp(per_arch_model->transfer_log_ratio / nsample);
+}
+
 double __starpu_history_based_job_expected_perf(struct starpu_perfmodel *model, struct starpu_perfmodel_arch* arch, struct _starpu_job *j,unsigned nimpl,size_t offset)
 {
 	int comb;
 	double exp = NAN;
-	struct starpu_perfmodel_per_arch *per_arch_model;
-	struct starpu_perfmodel_history_entry *entry = NULL;
-	struct starpu_perfmodel_history_table *history, *elt;
+	struct starpu_perfmodel_per_arch *per_arch, *per_arch_model = NULL;
+	const struct starpu_perfmodel_history_entry *entry = NULL;
 	uint32_t key;
-	double *data;
+	unsigned epoch;
+	const double *data;
 
 	comb = starpu_perfmodel_arch_comb_get(arch->ndevices, arch->devices);
 	key = _starpu_compute_buffers_footprint(model, arch, nimpl, j);
 	if(comb == -1)
 		goto docal;
 
-	STARPU_PTHREAD_RWLOCK_RDLOCK(&model->state->model_rwlock);
-	if (comb >= model->state->ncombs_set ||
-	    model->state->per_arch[comb] == NULL)
-	{
+	/* We do not take the model lock, see history_lookup. The per_arch
+	 * array is published before ncombs_set grows */
+	epoch = perfmodel_read_begin(model->state);
+	if (comb >= model->state->ncombs_set)
 		// The model has not been executed on this combination
-		STARPU_PTHREAD_RWLOCK_UNLOCK(&model->state->model_rwlock);
-		goto docal;
-	}
+		goto done;
+	STARPU_RMB();
+	per_arch = model->state->per_arch[comb];
+	if (per_arch == NULL)
+		// The model has not been executed on this combination
+		goto done;
 
-	per_arch_model = &model->state->per_arch[comb][nimpl];
+	per_arch_model = &per_arch[nimpl];
 
-	history = per_arch_model->history;
-	HASH_FIND_UINT32_T(history, &key, elt);
-	entry = (elt == NULL) ? NULL : elt->history_entry;
+	entry = history_lookup(model, per_arch_model, key);
 	if (entry)
-		data = (double*) ((char*) entry + offset);
+		data = (const double*) ((const char*) entry + offset);
 	STARPU_ASSERT_MSG(!entry || *data >= 0, "entry=%p, entry data=%lf\n", entry, entry?*data:NAN);
-	STARPU_PTHREAD_RWLOCK_UNLOCK(&model->state->model_rwlock);
 
 	/* Here helgrind would shout that this is unprotected access.
 	 * We do not care about racing access to the mean/deviation, we only want
@@ -1806,6 +3178,13 @@ double __starpu_history_based_job_expected_perf(struct starpu_perfmodel *model,
 		}
 	}
 
+#ifndef STARPU_SIMGRID
+	if (isnan(exp) && transfer_min && model->type == STARPU_HISTORY_BASED)
+		exp = history_transfer_predict(model, per_arch_model, nimpl, key, offset);
+#endif
+
+done:
+	perfmodel_read_end(model->state, epoch);
 docal:
 #ifdef STARPU_SIMGRID
 	if (isnan(exp))
@@ -1843,6 +3222,158 @@ double _starpu_history_based_job_expected_deviation(struct starpu_perfmodel *mod
 	return __starpu_history_based_job_expected_perf(model, arch, j, nimpl, offsetof(struct starpu_perfmodel_history_entry, deviation));
 }
 
+/* Number of neighbours we look at on each side for a calibrated entry */
+#define INTERPOLATION_MAX_SCAN 8
+
+/* Predict the duration for \p size, whose footprint was not measured enough,
+ * by interpolating in log-log space between the closest calibrated sizes, or
+ * else from the regression. Set \p confidence to the ratio between these
+ * sizes, or to at most 0.5 for the regression. Like history_lookup, this does
+ * not take the model lock. */
+static double history_interpolate(struct starpu_perfmodel_per_arch *per_arch_model, size_t size, double *confidence)
+{
+	const struct _starpu_perfmodel_history_snapshot *snapshot = per_arch_model->history_snapshot;
+	struct starpu_perfmodel_regression_model *reg_model = &per_arch_model->regression;
+	struct starpu_perfmodel_history_entry *below = NULL, *above = NULL;
+	double range = 1., predicted = NAN;
+
+	if (snapshot && snapshot->by_size && size)
+	{
+		unsigned long lo = 0, hi = snapshot->nentries, i, n;
+
+		/* First entry which is not smaller */
+		while (lo < hi)
+		{
+			unsigned long mid = (lo + hi) / 2;
+			if (snapshot->by_size[mid]->size < size)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+
+		for (i = lo, n = 0; i < snapshot->nentries && n < INTERPOLATION_MAX_SCAN; i++, n++)
+			if (snapshot->by_size[i]->nsample >= _starpu_calibration_minimum)
+			{
+				above = snapshot->by_size[i];
+				break;
+			}
+		for (i = lo, n = 0; i > 0 && n < INTERPOLATION_MAX_SCAN; i--, n++)
+			if (snapshot->by_size[i-1]->nsample >= _starpu_calibration_minimum)
+			{
+				below = snapshot->by_size[i-1];
+				break;
+			}
+	}
+
+	if (above && above->size == size)
+	{
+		/* Same size, but a different footprint, e.g. another shape */
+		*confidence = 1.;
+		return above->mean;
+	}
+
+	if (below && above)
+	{
+		double x0 = below->size, x1 = above->size;
+		double y0 = below->mean, y1 = above->mean;
+		double t = (log((double) size) - log(x0)) / (log(x1) - log(x0));
+
+		*confidence = x0 / x1;
+		if (y0 > 0. && y1 > 0.)
+			return exp(log(y0) + t * (log(y1) - log(y0)));
+		return y0 + t * (y1 - y0);
+	}
+
+	/* Trust the regression less out of the measured range */
+	if (reg_model->minx && size < reg_model->minx)
+		range = (double) size / reg_model->minx;
+	else if (reg_model->maxx && size > reg_model->maxx)
+		range = (double) reg_model->maxx / size;
+
+	if (reg_model->nl_valid)
+		predicted = reg_model->a*pow((double)size, reg_model->b) + reg_model->c;
+	else if (reg_model->valid)
+		predicted = reg_model->alpha*pow((double)size, reg_model->beta);
+
+	if (isnan(predicted) || predicted < 0.)
+	{
+		*confidence = 0.;
+		return NAN;
+	}
+	*confidence = 0.5 * range;
+	return predicted;
+}
+
+double _starpu_interpolation_based_job_expected_perf(struct starpu_perfmodel *model, struct starpu_perfmodel_arch* arch, struct _starpu_job *j, unsigned nimpl, double *confidence)
+{
+	int comb;
+	double exp = NAN, conf = 0.;
+	struct starpu_perfmodel_per_arch *per_arch;
+	const struct starpu_perfmodel_history_entry *entry = NULL;
+	uint32_t key;
+	unsigned epoch;
+
+	comb = starpu_perfmodel_arch_comb_get(arch->ndevices, arch->devices);
+	key = _starpu_compute_buffers_footprint(model, arch, nimpl, j);
+	if (comb == -1)
+		goto docal;
+	/* See __starpu_history_based_job_expected_perf */
+	epoch = perfmodel_read_begin(model->state);
+	if (comb >= model->state->ncombs_set)
+		// The model has not been executed on this combination
+		goto done;
+	STARPU_RMB();
+	per_arch = model->state->per_arch[comb];
+	if (per_arch == NULL)
+		goto done;
+
+	entry = history_lookup(model, &per_arch[nimpl], key);
+	if (entry && entry->nsample >= _starpu_calibration_minimum)
+	{
+		exp = entry->mean;
+		conf = 1.;
+	}
+	else if (j->task)
+	{
+		size_t size = __starpu_job_get_data_size(model, arch, nimpl, j);
+		/* The neighbours may not be published yet */
+		history_publish_if_late(model, &per_arch[nimpl]);
+		exp = history_interpolate(&per_arch[nimpl], size, &conf);
+		if (conf < interpolation_min_confidence)
+			exp = NAN;
+	}
+
+done:
+	perfmodel_read_end(model->state, epoch);
+docal:
+#ifdef STARPU_SIMGRID
+	if (isnan(exp))
+	{
+		char archname[STR_SHORT_LENGTH];
+		starpu_perfmodel_get_arch_name(arch, archname, sizeof(archname), nimpl);
+
+		_STARPU_DISP("Warning: model %s is not calibrated at all for %s size %ld footprint %x. Assuming it can not work there\n", model->symbol, archname, j->task?(long int)_starpu_job_get_data_size(model, arch, nimpl, j):-1, key);
+		exp = 0.;
+	}
+#else
+	STARPU_HG_DISABLE_CHECKING(model->benchmarking);
+	if (isnan(exp) && !model->benchmarking)
+	{
+		char archname[STR_LONG_LENGTH];
+
+		starpu_perfmodel_get_arch_name(arch, archname, sizeof(archname), nimpl);
+		_STARPU_DISP("Warning: model %s is not calibrated enough for %s size %ld footprint %x (only %u measurements, and prediction confidence %.2f below STARPU_INTERPOLATION_MIN_CONFIDENCE), forcing calibration for this run. Use the STARPU_CALIBRATE environment variable to control this. You probably need to run again to continue calibrating the model, until this warning disappears.\n", model->symbol, archname, j->task?(long int)_starpu_job_get_data_size(model, arch, nimpl, j):-1, key, entry ? entry->nsample : 0, conf);
+		_starpu_set_calibrate_flag(1);
+		model->benchmarking = 1;
+	}
+#endif
+
+	if (confidence)
+		*confidence = isnan(exp) ? 0. : conf;
+	STARPU_ASSERT_MSG(isnan(exp)||exp >= 0, "exp=%lf\n", exp);
+	return exp;
+}
+
 double starpu_perfmodel_history_based_expected_perf(struct starpu_perfmodel *model, struct starpu_perfmodel_arch * arch, uint32_t footprint)
 {
 	struct _starpu_job j =
@@ -1866,53 +3397,22 @@ void _starpu_update_perfmodel_history(struct _starpu_job *j, struct starpu_perfm
 	STARPU_ASSERT_MSG(measured >= 0, "measured=%lf\n", measured);
 	if (model)
 	{
-		int c;
-		unsigned found = 0;
 		int comb = _starpu_perfmodel_create_comb_if_needed(arch);
 
 		STARPU_PTHREAD_RWLOCK_WRLOCK(&model->state->model_rwlock);
 
-		for(c = 0; c < model->state->ncombs; c++)
-		{
-			if(model->state->combs[c] == comb)
-			{
-				found = 1;
-				break;
-			}
-		}
-
-		if(!found)
-		{
-			if (model->state->ncombs + 1 >= model->state->ncombs_set)
-			{
-				// The number of combinations is bigger than the one which was initially allocated, we need to reallocate,
-				// do not only reallocate 1 extra comb, rather reallocate 5 to avoid too frequent calls to _starpu_perfmodel_realloc
-				_starpu_perfmodel_realloc(model, model->state->ncombs_set+5);
-			}
-			model->state->combs[model->state->ncombs++] = comb;
-		}
-
-		if(!model->state->per_arch[comb])
-		{
-			_starpu_perfmodel_malloc_per_arch(model, comb, STARPU_MAXIMPLEMENTATIONS);
-			_starpu_perfmodel_malloc_per_arch_is_set(model, comb, STARPU_MAXIMPLEMENTATIONS);
-			model->state->nimpls[comb] = 0;
-		}
-
-		struct starpu_perfmodel_per_arch *per_arch_model = &model->state->per_arch[comb][impl];
-		if (model->state->per_arch_is_set[comb][impl] == 0)
-		{
-			// We are adding a new implementation for the given comb and the given impl
-			model->state->nimpls[comb]++;
-			model->state->per_arch_is_set[comb][impl] = 1;
-		}
+		struct starpu_perfmodel_per_arch *per_arch_model = perfmodel_get_per_arch(model, comb, impl);
 
-		if (model->type == STARPU_HISTORY_BASED || model->type == STARPU_NL_REGRESSION_BASED || model->type == STARPU_REGRESSION_BASED)
+		if (model->type == STARPU_HISTORY_BASED || model->type == STARPU_NL_REGRESSION_BASED || model->type == STARPU_REGRESSION_BASED || model->type == STARPU_INTERPOLATION_BASED)
 		{
 			struct starpu_perfmodel_history_entry *entry;
 			struct starpu_perfmodel_history_table *elt;
 			struct starpu_perfmodel_history_list **list;
 			uint32_t key = _starpu_compute_buffers_footprint(model, arch, impl, j);
+			/* What this measurement changes, to be merged into the
+			 * shared store */
+			unsigned old_nsample = 0, reset = 0;
+			double old_sum = 0., old_sum2 = 0.;
 
 			list = &per_arch_model->list;
 
@@ -1932,7 +3432,7 @@ void _starpu_update_perfmodel_history(struct _starpu_job *j, struct starpu_perfm
 
 				/* For history-based, do not take the first measurement into account, it is very often quite bogus */
 				/* TODO: it'd be good to use a better estimation heuristic, like the median, or latest n values, etc. */
-				if (number != 1 || model->type != STARPU_HISTORY_BASED)
+				if (number != 1 || (model->type != STARPU_HISTORY_BASED && model->type != STARPU_INTERPOLATION_BASED))
 				{
 					entry->sum = measured * number;
 					entry->sum2 = measured*measured * number;
@@ -1946,42 +3446,78 @@ void _starpu_update_perfmodel_history(struct _starpu_job *j, struct starpu_perfm
 				entry->footprint = key;
 
 				insert_history_entry(entry, list, &per_arch_model->history);
+				per_arch_model->history_unpublished++;
 			}
 			else
 			{
 				/* There is already an entry with the same footprint */
+				old_nsample = entry->nsample;
+				old_sum = entry->sum;
+				old_sum2 = entry->sum2;
 
-				double local_deviation = measured/entry->mean;
-
-				if (entry->nsample &&
-					(100 * local_deviation > (100 + historymaxerror)
-					 || (100 / local_deviation > (100 + historymaxerror))))
+				if (history_change_threshold > 0. && history_change_detected(entry, measured, number))
 				{
-					entry->nerror+=number;
-
-					/* More errors than measurements, we're most probably completely wrong, we flush out all the entries */
-					if (entry->nerror >= entry->nsample)
-					{
-						char archname[STR_SHORT_LENGTH];
-						starpu_perfmodel_get_arch_name(arch, archname, sizeof(archname), impl);
-						_STARPU_DISP("Too big deviation for model %s on %s: %fus vs average %fus, %u such errors against %u samples (%+f%%), flushing the performance model. Use the STARPU_HISTORY_MAX_ERROR environment variable to control the threshold (currently %d%%)\n", model->symbol, archname, measured, entry->mean, entry->nerror, entry->nsample, measured * 100. / entry->mean - 100, historymaxerror);
-						entry->sum = 0.0;
-						entry->sum2 = 0.0;
-						entry->nsample = 0;
-						entry->nerror = 0;
-						entry->mean = 0.0;
-						entry->deviation = 0.0;
-					}
+					/* The distribution changed, e.g. because of a
+					 * hardware or system change, restart from the
+					 * current measurement */
+					char archname[STR_SHORT_LENGTH];
+					starpu_perfmodel_get_arch_name(arch, archname, sizeof(archname), impl);
+					_STARPU_DEBUG("Change detected for model %s on %s footprint %x: %fus vs average %fus, resetting its history\n", model->symbol, archname, key, measured, entry->mean);
+					entry->sum = measured * number;
+					entry->sum2 = measured*measured * number;
+					entry->nsample = number;
+					entry->nerror = 0;
+					entry->mean = measured;
+					entry->deviation = 0.;
+					reset = 1;
+					memset(entry->window, 0, sizeof(*entry->window));
+					if (history_estimator != HISTORY_ESTIMATOR_MEAN)
+						history_window_push(entry->window, measured, number);
 				}
-				else
+				else if (history_estimator != HISTORY_ESTIMATOR_MEAN)
 				{
+					/* Robust estimators do not need to reject outliers */
+					history_window_push(history_window_get(entry), measured, number);
 					entry->sum += measured * number;
 					entry->sum2 += measured*measured * number;
 					entry->nsample += number;
+					history_window_estimate(entry);
+				}
+				else
+				{
+					double local_deviation = measured/entry->mean;
+
+					if (entry->nsample &&
+						(100 * local_deviation > (100 + historymaxerror)
+						 || (100 / local_deviation > (100 + historymaxerror))))
+					{
+						entry->nerror+=number;
 
-					unsigned n = entry->nsample;
-					entry->mean = entry->sum / n;
-					entry->deviation = sqrt((fabs(entry->sum2 - (entry->sum*entry->sum)/n))/n);
+						/* More errors than measurements, we're most probably completely wrong, we flush out all the entries */
+						if (entry->nerror >= entry->nsample)
+						{
+							char archname[STR_SHORT_LENGTH];
+							starpu_perfmodel_get_arch_name(arch, archname, sizeof(archname), impl);
+							_STARPU_DISP("Too big deviation for model %s on %s: %fus vs average %fus, %u such errors against %u samples (%+f%%), flushing the performance model. Use the STARPU_HISTORY_MAX_ERROR environment variable to control the threshold (currently %d%%)\n", model->symbol, archname, measured, entry->mean, entry->nerror, entry->nsample, measured * 100. / entry->mean - 100, historymaxerror);
+							entry->sum = 0.0;
+							entry->sum2 = 0.0;
+							entry->nsample = 0;
+							entry->nerror = 0;
+							entry->mean = 0.0;
+							entry->deviation = 0.0;
+							reset = 1;
+						}
+					}
+					else
+					{
+						entry->sum += measured * number;
+						entry->sum2 += measured*measured * number;
+						entry->nsample += number;
+
+						unsigned n = entry->nsample;
+						entry->mean = entry->sum / n;
+						entry->deviation = sqrt((fabs(entry->sum2 - (entry->sum*entry->sum)/n))/n);
+					}
 				}
 
 				if (j->task->flops != 0. && !isnan(entry->flops))
@@ -1998,9 +3534,30 @@ void _starpu_update_perfmodel_history(struct _starpu_job *j, struct starpu_perfm
 			}
 
 			STARPU_ASSERT(entry);
+
+			if (model->state->shm)
+			{
+				struct _starpu_perfmodel_shm_entry *shm_entry = _starpu_perfmodel_shm_find(model->state->shm, arch, impl, key, entry->size);
+				if (shm_entry)
+				{
+					if (reset)
+						/* Reset it for everybody */
+						_starpu_perfmodel_shm_set(shm_entry, entry->nsample, entry->sum, entry->sum2);
+					else if (entry->nsample != old_nsample)
+						_starpu_perfmodel_shm_add(shm_entry, entry->nsample - old_nsample, entry->sum - old_sum, entry->sum2 - old_sum2);
+					/* And get the measurements of the other processes */
+					history_shm_apply(entry, shm_entry);
+				}
+			}
+
+			if (transfer_min && model->type == STARPU_HISTORY_BASED)
+				history_transfer_learn(model, per_arch_model, comb, impl, key, measured, number);
+
+			if (history_should_publish(per_arch_model))
+				history_publish(model, per_arch_model);
 		}
 
-		if (model->type == STARPU_REGRESSION_BASED || model->type == STARPU_NL_REGRESSION_BASED)
+		if (model->type == STARPU_REGRESSION_BASED || model->type == STARPU_NL_REGRESSION_BASED || model->type == STARPU_INTERPOLATION_BASED)
 		{
 			struct starpu_perfmodel_regression_model *reg_model;
 			reg_model = &per_arch_model->regression;
@@ -2034,8 +3591,19 @@ void _starpu_update_perfmodel_history(struct _starpu_job *j, struct starpu_perfm
 			}
 		}
 
-		if (model->type == STARPU_MULTIPLE_REGRESSION_BASED)
+		if (model->type == STARPU_MULTIPLE_REGRESSION_BASED && model->ncombinations && model->combinations)
+		{
+			double *parameters;
+			_STARPU_MALLOC(parameters, model->nparameters*sizeof(double));
+			model->parameters(j->task, parameters);
+			STARPU_ASSERT(measured >= 0);
+			multiple_regression_update(model, per_arch_model, parameters, measured, number);
+			free(parameters);
+		}
+		else if (model->type == STARPU_MULTIPLE_REGRESSION_BASED)
 		{
+			/* No combinations to compute coefficients for, just
+			 * keep the measurements for analysing them */
 			struct starpu_perfmodel_history_entry *entry;
 			struct starpu_perfmodel_history_list **list;
 			list = &per_arch_model->list;
@@ -63,11 +63,73 @@ void _starpu_perfmodel_print_history_based(struct starpu_perfmodel_per_arch *per
 	}
 }
 
+/* Display how well the history entries are calibrated, how noisy they are,
+ * and how well the regressions fit them */
+static
+void _starpu_perfmodel_print_quality(struct starpu_perfmodel_per_arch *per_arch_model, FILE *output)
+{
+	struct starpu_perfmodel_regression_model *reg_model = &per_arch_model->regression;
+	struct starpu_perfmodel_history_list *ptr;
+	unsigned long nentries = 0, ncalibrated = 0, nsamples = 0;
+	double sum_rsd = 0., max_rsd = -1.;
+	uint32_t max_rsd_footprint = 0;
+	double sum_err = 0., max_err = 0., sum_nl_err = 0., max_nl_err = 0.;
+
+	for (ptr = per_arch_model->list; ptr; ptr = ptr->next)
+	{
+		struct starpu_perfmodel_history_entry *entry = ptr->entry;
+		double rsd;
+
+		nentries++;
+		nsamples += entry->nsample;
+		if (entry->nsample < _starpu_calibration_minimum || entry->mean <= 0.)
+			continue;
+		ncalibrated++;
+
+		/* Relative standard deviation of the measurements */
+		rsd = entry->deviation / entry->mean;
+		sum_rsd += rsd;
+		if (rsd > max_rsd)
+		{
+			max_rsd = rsd;
+			max_rsd_footprint = entry->footprint;
+		}
+
+		/* Relative error of the regressions against the measurements */
+		if (reg_model->valid)
+		{
+			double err = fabs(reg_model->alpha * pow(entry->size, reg_model->beta) - entry->mean) / entry->mean;
+			sum_err += err;
+			max_err = STARPU_MAX(max_err, err);
+		}
+		if (reg_model->nl_valid)
+		{
+			double err = fabs(reg_model->a * pow(entry->size, reg_model->b) + reg_model->c - entry->mean) / entry->mean;
+			sum_nl_err += err;
+			max_nl_err = STARPU_MAX(max_nl_err, err);
+		}
+	}
+
+	if (!nentries)
+		return;
+
+	fprintf(output, "\tQuality: %lu entries, %lu calibrated, %lu samples\n", nentries, ncalibrated, nsamples);
+	if (!ncalibrated)
+		return;
+	fprintf(output, "\t\trelative stddev: mean %.1f%%, max %.1f%% (footprint %08x)\n", 100. * sum_rsd / ncalibrated, 100. * max_rsd, max_rsd_footprint);
+	if (reg_model->valid)
+		fprintf(output, "\t\tlinear regression relative error: mean %.1f%%, max %.1f%%\n", 100. * sum_err / ncalibrated, 100. * max_err);
+	if (reg_model->nl_valid)
+		fprintf(output, "\t\tnon-linear regression relative error: mean %.1f%%, max %.1f%%\n", 100. * sum_nl_err / ncalibrated, 100. * max_nl_err);
+}
+
 void starpu_perfmodel_print(struct starpu_perfmodel *model, struct starpu_perfmodel_arch* arch, unsigned nimpl, char *parameter, uint32_t *footprint, FILE *output)
 {
 	int comb = starpu_perfmodel_arch_comb_get(arch->ndevices, arch->devices);
 	STARPU_ASSERT(comb != -1);
 
+	_starpu_perfmodel_materialize_history(model);
+
 	struct starpu_perfmodel_per_arch *arch_model = &model->state->per_arch[comb][nimpl];
 
 	if (arch_model->regression.nsample || arch_model->regression.valid || arch_model->regression.nl_valid || arch_model->list)
@@ -109,6 +171,9 @@ void starpu_perfmodel_print(struct starpu_perfmodel *model, struct starpu_perfmo
 			//fprintf(output, "\tNon-Linear model is INVALID\n");
 		}
 
+		if (!footprint)
+			_starpu_perfmodel_print_quality(arch_model, output);
+
 		_starpu_perfmodel_print_history_based(arch_model, parameter, footprint, output);
 
 #if 0
@@ -293,6 +358,9 @@ int starpu_perfmodel_print_all(struct starpu_perfmodel *model, char *arch, char
 int starpu_perfmodel_print_estimations(struct starpu_perfmodel *model, uint32_t footprint, FILE *output)
 {
 	unsigned workerid;
+
+	_starpu_perfmodel_materialize_history(model);
+
 	for (workerid = 0; workerid < starpu_worker_get_count(); workerid++)
 	{
 		struct starpu_perfmodel_arch* arch = starpu_worker_get_perf_archtype(workerid, STARPU_NMAX_SCHED_CTXS);
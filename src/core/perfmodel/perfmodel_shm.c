@@ -0,0 +1,563 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+/*
+ * Node-local store of the history entries of performance models, shared by
+ * the StarPU processes running on the same machine, see
+ * STARPU_PERF_MODEL_SHARED.
+ *
+ * Each model gets a POSIX shared-memory segment, named after its file, which
+ * holds an open-addressing hash table of the history entries of all its
+ * architecture combinations and implementations. Entries are only ever
+ * added, by atomically claiming a free slot, and their statistics are
+ * updated with atomic operations, so that processes never take a lock on the
+ * segment. The process which creates the segment seeds it with the content of
+ * the model file before marking it ready, the others wait for that.
+ *
+ * The segment records the model file it was seeded from, or last saved to,
+ * and the number of processes attached to it. The last process to detach
+ * removes it. A segment whose creator died before seeding it, or whose model
+ * file was changed behind its back, e.g. by a user or after a process
+ * crashed, is stale: it is removed and created again.
+ */
+
+#include <starpu.h>
+#include <common/config.h>
+#include <common/utils.h>
+#include <core/perfmodel/perfmodel.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/stat.h>
+#if defined(HAVE_MMAP) && !defined(STARPU_SIMGRID)
+#include <sys/mman.h>
+#endif
+
+#if defined(HAVE_MMAP) && !defined(STARPU_SIMGRID)
+
+#define SHM_MAGIC "STPUPM2"
+/* Number of entries of each segment. Pages are only allocated when used */
+#define SHM_NENTRIES 16384
+/* Maximum number of devices of the combinations which can be shared */
+#define SHM_MAXDEVICES 4
+/* How long to wait for the creator of a segment to seed it, in µs */
+#define SHM_READY_TIMEOUT 5000000.
+/* How long to wait for a process which is saving the model file to record
+ * it, in µs */
+#define SHM_SAVE_TIMEOUT 100000.
+/* How long a process may take to fill the key of an entry it claimed, in µs */
+#define SHM_BUSY_TIMEOUT 100000.
+/* How many times to replace a stale segment before giving up */
+#define SHM_MAX_ATTEMPTS 10
+
+enum
+{
+	SHM_ENTRY_FREE = 0,
+	SHM_ENTRY_BUSY = 1,
+	SHM_ENTRY_READY = 2,
+	/* Its claimer did not fill it in time, it is skipped */
+	SHM_ENTRY_DEAD = 3,
+};
+
+struct _starpu_perfmodel_shm_entry
+{
+	/** SHM_ENTRY_FREE, SHM_ENTRY_BUSY while the key is being filled,
+	 * SHM_ENTRY_READY then, or SHM_ENTRY_DEAD if it took too long */
+	uint32_t state;
+	uint32_t footprint;
+	uint32_t impl;
+	uint32_t ndevices;
+	struct
+	{
+		int32_t type;
+		int32_t devid;
+		int32_t ncores;
+	} devices[SHM_MAXDEVICES];
+	uint64_t size;
+	uint64_t nsample;
+	/** Bit patterns of the sums of the samples and of their squares,
+	 * updated by compare-and-swap */
+	uint64_t sum;
+	uint64_t sum2;
+};
+
+struct _starpu_perfmodel_shm_header
+{
+	char magic[8];
+	uint32_t version;
+	/** Set once the creator has seeded the segment */
+	uint32_t ready;
+	uint64_t nentries;
+	/** Process which created the segment */
+	int32_t creator;
+	/** Number of processes attached to the segment */
+	uint32_t nattached;
+	/** Identifies the state of the model file the segment was seeded
+	 * from or saved to, see shm_file_stamp() */
+	uint64_t file_stamp;
+	struct _starpu_perfmodel_shm_entry entries[];
+};
+
+struct _starpu_perfmodel_shm
+{
+	struct _starpu_perfmodel_shm_header *header;
+	size_t size;
+	char name[64];
+	/** Identifies the segment behind the name */
+	ino_t ino;
+};
+
+union shm_double
+{
+	uint64_t u;
+	double d;
+};
+
+static void shm_get_name(const char *path, char *name, size_t maxlen)
+{
+	snprintf(name, maxlen, "/starpu-perfmodel-%u-%08x", (unsigned) getuid(), starpu_hash_crc32c_string(path, 0));
+}
+
+void _starpu_perfmodel_shm_unlink(const char *path)
+{
+	char name[64];
+	shm_get_name(path, name, sizeof(name));
+	shm_unlink(name);
+}
+
+/* Remove the segment \p name, unless it was already replaced by another one */
+static void shm_unlink_same(const char *name, ino_t ino)
+{
+	struct stat st;
+	int fd = shm_open(name, O_RDONLY, 0600);
+	if (fd < 0)
+		return;
+	if (fstat(fd, &st) == 0 && st.st_ino == ino)
+		shm_unlink(name);
+	close(fd);
+}
+
+/* Identify the state of the model file: the files are saved by renaming a
+ * new file, and they can also be edited or removed by hand */
+static uint64_t shm_file_stamp(const char *path)
+{
+	struct stat st;
+	uint64_t stamp;
+
+	if (stat(path, &st))
+		return 0;
+	stamp = (uint64_t) st.st_ino;
+	stamp = stamp * 1000003 ^ (uint64_t) st.st_mtime;
+	stamp = stamp * 1000003 ^ (uint64_t) st.st_size;
+	return stamp ? stamp : 1;
+}
+
+static int shm_process_is_dead(int32_t pid)
+{
+	return pid > 0 && kill(pid, 0) < 0 && errno == ESRCH;
+}
+
+/* Attach to the existing segment \p header, return -EAGAIN if it is stale and
+ * was removed */
+static int shm_attach(struct _starpu_perfmodel_shm_header *header, const char *name, const char *path, ino_t ino, uint64_t stamp, double start)
+{
+	/* Wait for the creator to seed it */
+	while (!STARPU_ATOMIC_ADD(&header->ready, 0))
+	{
+		if (shm_process_is_dead(STARPU_ATOMIC_ADD(&header->creator, 0)) || starpu_timing_now() - start > SHM_READY_TIMEOUT)
+		{
+			_STARPU_DISP("Warning: the shared store %s of performance model %s was not seeded by its creator, replacing it\n", name, path);
+			shm_unlink_same(name, ino);
+			return -EAGAIN;
+		}
+		starpu_usleep(1000);
+	}
+	STARPU_RMB();
+
+	if (memcmp(header->magic, SHM_MAGIC, sizeof(header->magic)) || header->version != _STARPU_PERFMODEL_VERSION || header->nentries != SHM_NENTRIES)
+	{
+		_STARPU_DISP("Warning: the shared store %s of performance model %s has another format, not sharing it\n", name, path);
+		return -EINVAL;
+	}
+
+	if (STARPU_ATOMIC_ADD(&header->nattached, 1) == 1)
+	{
+		/* The last process detached, and is removing it */
+		(void) STARPU_ATOMIC_ADD(&header->nattached, -1);
+		starpu_usleep(1000);
+		return -EAGAIN;
+	}
+
+	/* A process may be saving the model file, give it time to record it */
+	start = starpu_timing_now();
+	while (*(volatile uint64_t *) &header->file_stamp != stamp)
+	{
+		if (starpu_timing_now() - start > SHM_SAVE_TIMEOUT)
+		{
+			_STARPU_DISP("Warning: the performance model file %s changed since the shared store %s was last saved, replacing it\n", path, name);
+			(void) STARPU_ATOMIC_ADD(&header->nattached, -1);
+			shm_unlink_same(name, ino);
+			return -EAGAIN;
+		}
+		starpu_usleep(1000);
+		stamp = shm_file_stamp(path);
+	}
+	return 0;
+}
+
+/* Create the segment or attach to it, return -EAGAIN if a stale segment
+ * was removed */
+static int shm_try_open(struct _starpu_perfmodel_shm *shm, const char *path, uint64_t stamp, int *created)
+{
+	struct _starpu_perfmodel_shm_header *header;
+	size_t size = shm->size;
+	double start = starpu_timing_now();
+	struct stat st;
+	int fd, ret;
+
+	*created = 0;
+	fd = shm_open(shm->name, O_RDWR|O_CREAT|O_EXCL, 0600);
+	if (fd >= 0)
+	{
+		if (ftruncate(fd, size) < 0)
+		{
+			_STARPU_DISP("Warning: could not allocate the shared store %s of performance model %s: %s\n", shm->name, path, strerror(errno));
+			close(fd);
+			shm_unlink(shm->name);
+			return -ENOMEM;
+		}
+		*created = 1;
+	}
+	else if (errno == EEXIST)
+	{
+		fd = shm_open(shm->name, O_RDWR, 0600);
+		if (fd < 0)
+		{
+			if (errno == ENOENT)
+				/* It was removed meanwhile */
+				return -EAGAIN;
+			_STARPU_DISP("Warning: could not open the shared store %s of performance model %s: %s\n", shm->name, path, strerror(errno));
+			return -errno;
+		}
+		/* Wait for the creator to size it */
+		while (fstat(fd, &st) == 0 && (size_t) st.st_size < size)
+		{
+			if (starpu_timing_now() - start > SHM_READY_TIMEOUT)
+			{
+				_STARPU_DISP("Warning: the shared store %s of performance model %s was not initialized by its creator, replacing it\n", shm->name, path);
+				shm_unlink_same(shm->name, st.st_ino);
+				close(fd);
+				return -EAGAIN;
+			}
+			starpu_usleep(1000);
+		}
+	}
+	else
+	{
+		_STARPU_DISP("Warning: could not create the shared store %s of performance model %s: %s\n", shm->name, path, strerror(errno));
+		return -errno;
+	}
+
+	if (fstat(fd, &st) < 0)
+	{
+		ret = -errno;
+		close(fd);
+		if (*created)
+			shm_unlink(shm->name);
+		return ret;
+	}
+	shm->ino = st.st_ino;
+
+	header = mmap(NULL, size, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (header == MAP_FAILED)
+	{
+		_STARPU_DISP("Warning: could not map the shared store %s of performance model %s: %s\n", shm->name, path, strerror(errno));
+		if (*created)
+			shm_unlink(shm->name);
+		return -ENOMEM;
+	}
+
+	if (*created)
+	{
+		memcpy(header->magic, SHM_MAGIC, sizeof(header->magic));
+		header->version = _STARPU_PERFMODEL_VERSION;
+		header->nentries = SHM_NENTRIES;
+		header->creator = getpid();
+		header->nattached = 1;
+		header->file_stamp = stamp;
+	}
+	else
+	{
+		ret = shm_attach(header, shm->name, path, shm->ino, stamp, start);
+		if (ret)
+		{
+			munmap(header, size);
+			return ret;
+		}
+	}
+
+	shm->header = header;
+	return 0;
+}
+
+struct _starpu_perfmodel_shm *_starpu_perfmodel_shm_open(const char *path, int *created)
+{
+	struct _starpu_perfmodel_shm *shm;
+	uint64_t stamp = shm_file_stamp(path);
+	unsigned attempt;
+	int ret = -EAGAIN;
+
+	_STARPU_MALLOC(shm, sizeof(*shm));
+	shm->size = sizeof(*shm->header) + SHM_NENTRIES * sizeof(shm->header->entries[0]);
+	shm_get_name(path, shm->name, sizeof(shm->name));
+
+	for (attempt = 0; ret == -EAGAIN && attempt < SHM_MAX_ATTEMPTS; attempt++)
+		ret = shm_try_open(shm, path, stamp, created);
+
+	if (ret)
+	{
+		free(shm);
+		return NULL;
+	}
+	return shm;
+}
+
+void _starpu_perfmodel_shm_ready(struct _starpu_perfmodel_shm *shm)
+{
+	/* Make the seeded entries visible before the flag */
+	STARPU_WMB();
+	(void) STARPU_ATOMIC_ADD(&shm->header->ready, 1);
+}
+
+void _starpu_perfmodel_shm_saved(struct _starpu_perfmodel_shm *shm, const char *path)
+{
+	*(volatile uint64_t *) &shm->header->file_stamp = shm_file_stamp(path);
+	STARPU_WMB();
+}
+
+void _starpu_perfmodel_shm_close(struct _starpu_perfmodel_shm *shm)
+{
+	if (STARPU_ATOMIC_ADD(&shm->header->nattached, -1) == 0)
+		/* The model file was saved with our measurements, which are
+		 * the last ones */
+		shm_unlink_same(shm->name, shm->ino);
+	munmap(shm->header, shm->size);
+	free(shm);
+}
+
+static uint32_t shm_hash(struct starpu_perfmodel_arch *arch, unsigned impl, uint32_t footprint)
+{
+	uint32_t hash = starpu_hash_crc32c_be(footprint, impl);
+	int dev;
+	for (dev = 0; dev < arch->ndevices; dev++)
+	{
+		hash = starpu_hash_crc32c_be(arch->devices[dev].type, hash);
+		hash = starpu_hash_crc32c_be(arch->devices[dev].devid, hash);
+		hash = starpu_hash_crc32c_be(arch->devices[dev].ncores, hash);
+	}
+	return hash;
+}
+
+static int shm_entry_matches(const struct _starpu_perfmodel_shm_entry *entry, struct starpu_perfmodel_arch *arch, unsigned impl, uint32_t footprint)
+{
+	int dev;
+	if (entry->footprint != footprint || entry->impl != impl || entry->ndevices != (uint32_t) arch->ndevices)
+		return 0;
+	for (dev = 0; dev < arch->ndevices; dev++)
+		if (entry->devices[dev].type != (int32_t) arch->devices[dev].type
+		 || entry->devices[dev].devid != arch->devices[dev].devid
+		 || entry->devices[dev].ncores != arch->devices[dev].ncores)
+			return 0;
+	return 1;
+}
+
+struct _starpu_perfmodel_shm_entry *_starpu_perfmodel_shm_find(struct _starpu_perfmodel_shm *shm, struct starpu_perfmodel_arch *arch, unsigned impl, uint32_t footprint, size_t size)
+{
+	struct _starpu_perfmodel_shm_header *header = shm->header;
+	uint32_t hash;
+	uint64_t i;
+	int dev;
+
+	if (arch->ndevices > SHM_MAXDEVICES)
+		return NULL;
+
+	hash = shm_hash(arch, impl, footprint);
+	for (i = 0; i < header->nentries; i++)
+	{
+		struct _starpu_perfmodel_shm_entry *entry = &header->entries[(hash + i) % header->nentries];
+		uint32_t state = STARPU_ATOMIC_ADD(&entry->state, 0);
+
+		if (state == SHM_ENTRY_FREE)
+		{
+			if (!STARPU_BOOL_COMPARE_AND_SWAP32(&entry->state, SHM_ENTRY_FREE, SHM_ENTRY_BUSY))
+			{
+				/* Somebody else claimed it meanwhile, check it again */
+				i--;
+				continue;
+			}
+			entry->footprint = footprint;
+			entry->impl = impl;
+			entry->ndevices = arch->ndevices;
+			for (dev = 0; dev < arch->ndevices; dev++)
+			{
+				entry->devices[dev].type = arch->devices[dev].type;
+				entry->devices[dev].devid = arch->devices[dev].devid;
+				entry->devices[dev].ncores = arch->devices[dev].ncores;
+			}
+			entry->size = size;
+			STARPU_WMB();
+			if (STARPU_BOOL_COMPARE_AND_SWAP32(&entry->state, SHM_ENTRY_BUSY, SHM_ENTRY_READY))
+				return entry;
+			/* We took too long and the others gave up on it */
+			continue;
+		}
+
+		if (state == SHM_ENTRY_BUSY)
+		{
+			/* Wait for the key to be filled, but not after a
+			 * process which crashed meanwhile */
+			double start = starpu_timing_now();
+			while (state == SHM_ENTRY_BUSY && starpu_timing_now() - start < SHM_BUSY_TIMEOUT)
+				state = STARPU_ATOMIC_ADD(&entry->state, 0);
+			if (state == SHM_ENTRY_BUSY && STARPU_BOOL_COMPARE_AND_SWAP32(&entry->state, SHM_ENTRY_BUSY, SHM_ENTRY_DEAD))
+				state = SHM_ENTRY_DEAD;
+			else
+				state = STARPU_ATOMIC_ADD(&entry->state, 0);
+		}
+
+		if (state == SHM_ENTRY_READY && shm_entry_matches(entry, arch, impl, footprint))
+			return entry;
+	}
+
+	/* The store is full */
+	return NULL;
+}
+
+static void shm_add_double(uint64_t *ptr, double val)
+{
+	union shm_double old, new;
+	do
+	{
+		old.u = *(volatile uint64_t *) ptr;
+		new.d = old.d + val;
+	}
+	while (!STARPU_BOOL_COMPARE_AND_SWAP64(ptr, old.u, new.u));
+}
+
+void _starpu_perfmodel_shm_add(struct _starpu_perfmodel_shm_entry *entry, unsigned nsample, double sum, double sum2)
+{
+	(void) STARPU_ATOMIC_ADD64(&entry->nsample, nsample);
+	shm_add_double(&entry->sum, sum);
+	shm_add_double(&entry->sum2, sum2);
+}
+
+void _starpu_perfmodel_shm_set(struct _starpu_perfmodel_shm_entry *entry, unsigned nsample, double sum, double sum2)
+{
+	union shm_double val;
+	entry->nsample = nsample;
+	val.d = sum;
+	entry->sum = val.u;
+	val.d = sum2;
+	entry->sum2 = val.u;
+	STARPU_WMB();
+}
+
+void _starpu_perfmodel_shm_get(struct _starpu_perfmodel_shm_entry *entry, unsigned *nsample, double *sum, double *sum2)
+{
+	union shm_double val;
+	*nsample = *(volatile uint64_t *) &entry->nsample;
+	val.u = *(volatile uint64_t *) &entry->sum;
+	*sum = val.d;
+	val.u = *(volatile uint64_t *) &entry->sum2;
+	*sum2 = val.d;
+}
+
+void _starpu_perfmodel_shm_foreach(struct _starpu_perfmodel_shm *shm, void (*func)(struct _starpu_perfmodel_shm_entry *entry, struct starpu_perfmodel_arch *arch, unsigned impl, uint32_t footprint, size_t size, void *arg), void *arg)
+{
+	struct _starpu_perfmodel_shm_header *header = shm->header;
+	uint64_t i;
+
+	for (i = 0; i < header->nentries; i++)
+	{
+		struct _starpu_perfmodel_shm_entry *entry = &header->entries[i];
+		struct starpu_perfmodel_device devices[SHM_MAXDEVICES];
+		struct starpu_perfmodel_arch arch = { .devices = devices };
+		int dev;
+
+		if (STARPU_ATOMIC_ADD(&entry->state, 0) != SHM_ENTRY_READY)
+			continue;
+		STARPU_RMB();
+		arch.ndevices = entry->ndevices;
+		for (dev = 0; dev < arch.ndevices; dev++)
+		{
+			devices[dev].type = entry->devices[dev].type;
+			devices[dev].devid = entry->devices[dev].devid;
+			devices[dev].ncores = entry->devices[dev].ncores;
+		}
+		func(entry, &arch, entry->impl, entry->footprint, entry->size, arg);
+	}
+}
+#else
+void _starpu_perfmodel_shm_unlink(const char *path STARPU_ATTRIBUTE_UNUSED)
+{
+}
+
+struct _starpu_perfmodel_shm *_starpu_perfmodel_shm_open(const char *path STARPU_ATTRIBUTE_UNUSED, int *created)
+{
+	*created = 0;
+	_STARPU_DISP("Warning: performance models can not be shared between processes on this system\n");
+	return NULL;
+}
+
+void _starpu_perfmodel_shm_ready(struct _starpu_perfmodel_shm *shm STARPU_ATTRIBUTE_UNUSED)
+{
+}
+
+void _starpu_perfmodel_shm_saved(struct _starpu_perfmodel_shm *shm STARPU_ATTRIBUTE_UNUSED, const char *path STARPU_ATTRIBUTE_UNUSED)
+{
+}
+
+void _starpu_perfmodel_shm_close(struct _starpu_perfmodel_shm *shm STARPU_ATTRIBUTE_UNUSED)
+{
+}
+
+struct _starpu_perfmodel_shm_entry *_starpu_perfmodel_shm_find(struct _starpu_perfmodel_shm *shm STARPU_ATTRIBUTE_UNUSED, struct starpu_perfmodel_arch *arch STARPU_ATTRIBUTE_UNUSED, unsigned impl STARPU_ATTRIBUTE_UNUSED, uint32_t footprint STARPU_ATTRIBUTE_UNUSED, size_t size STARPU_ATTRIBUTE_UNUSED)
+{
+	return NULL;
+}
+
+void _starpu_perfmodel_shm_add(struct _starpu_perfmodel_shm_entry *entry STARPU_ATTRIBUTE_UNUSED, unsigned nsample STARPU_ATTRIBUTE_UNUSED, double sum STARPU_ATTRIBUTE_UNUSED, double sum2 STARPU_ATTRIBUTE_UNUSED)
+{
+}
+
+void _starpu_perfmodel_shm_set(struct _starpu_perfmodel_shm_entry *entry STARPU_ATTRIBUTE_UNUSED, unsigned nsample STARPU_ATTRIBUTE_UNUSED, double sum STARPU_ATTRIBUTE_UNUSED, double sum2 STARPU_ATTRIBUTE_UNUSED)
+{
+}
+
+void _starpu_perfmodel_shm_get(struct _starpu_perfmodel_shm_entry *entry STARPU_ATTRIBUTE_UNUSED, unsigned *nsample, double *sum, double *sum2)
+{
+	*nsample = 0;
+	*sum = 0.;
+	*sum2 = 0.;
+}
+
+void _starpu_perfmodel_shm_foreach(struct _starpu_perfmodel_shm *shm STARPU_ATTRIBUTE_UNUSED, void (*func)(struct _starpu_perfmodel_shm_entry *entry, struct starpu_perfmodel_arch *arch, unsigned impl, uint32_t footprint, size_t size, void *arg) STARPU_ATTRIBUTE_UNUSED, void *arg STARPU_ATTRIBUTE_UNUSED)
+{
+}
+#endif
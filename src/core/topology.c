@@ -41,6 +41,7 @@
 #include <datawizard/datastats.h>
 #include <datawizard/memory_nodes.h>
 #include <datawizard/memory_manager.h>
+#include <datawizard/numa_migration.h>
 
 #include <common/uthash.h>
 
@@ -2118,6 +2119,7 @@ int _starpu_build_topology(struct _starpu_machine_config *config, int no_mp_conf
 	_starpu_init_workers_binding_and_memory(config, no_mp_config);
 
 	_starpu_mem_chunk_init_last();
+	_starpu_numa_migration_init();
 
 	for (type = 0; type < STARPU_NARCH; type++)
 		config->arch_nodeid[type] = -1;
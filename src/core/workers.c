@@ -1825,6 +1825,8 @@ int starpu_initialize(struct starpu_conf *user_conf, int *argc, char ***argv)
 
 	_starpu_data_interface_init();
 
+	_starpu_cpu_copy_init();
+
 	_starpu_timing_init();
 
 	_starpu_load_bus_performance_files();
@@ -1838,6 +1840,7 @@ int starpu_initialize(struct starpu_conf *user_conf, int *argc, char ***argv)
 	/* sink doesn't exit even if no worker discovered */
 	if (ret && !is_a_sink)
 	{
+		_starpu_wait_bus_calibration();
 		starpu_perfmodel_free_sampling();
 		STARPU_PTHREAD_MUTEX_LOCK(&init_mutex);
 		init_count--;
@@ -1912,6 +1915,7 @@ int starpu_initialize(struct starpu_conf *user_conf, int *argc, char ***argv)
 	}
 
 	_starpu_watchdog_init();
+	_starpu_energy_sampling_init();
 
 	_starpu_profiling_start();
 
@@ -2179,19 +2183,24 @@ void starpu_shutdown(void)
 	     {
 		  _starpu_display_msi_stats(stderr);
 		  _starpu_display_alloc_cache_stats(stderr);
+		  _starpu_display_numa_migration_stats(stderr);
 	     }
 	}
 
+	_starpu_display_handle_stats();
+
 	starpu_profiling_bus_helper_display_summary();
 	starpu_profiling_worker_helper_display_summary();
 	starpu_bound_clear();
 
+	_starpu_wait_bus_calibration();
 	_starpu_deinitialize_registered_performance_models();
 
 	_starpu_watchdog_shutdown();
 
 	/* wait for their termination */
 	_starpu_terminate_workers(&_starpu_config);
+	_starpu_energy_sampling_shutdown();
 
 	{
 	     int stats = starpu_getenv_number("STARPU_MEMORY_STATS");
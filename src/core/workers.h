@@ -119,6 +119,12 @@ struct _starpu_node
 	unsigned data_requests_npending[STARPU_MAXNODES][2];
 	starpu_pthread_mutex_t data_requests_pending_list_mutex[STARPU_MAXNODES][2];
 
+	/** Bytes posted for transfer from this node to each other node and not
+	 * transferred yet, and the number of such requests, see
+	 * starpu_transfer_queued() */
+	unsigned long transfer_queued_size[STARPU_MAXNODES];
+	unsigned long transfer_queued_nrequests[STARPU_MAXNODES];
+
 	/*
 	 * used by malloc.c
 	 */
@@ -129,6 +135,8 @@ struct _starpu_node
 	int nfreechunks;
 	/** This protects chunks and nfreechunks */
 	starpu_pthread_mutex_t chunk_mutex;
+	/** Per-worker magazines of free blocks */
+	struct _starpu_magazine *magazines[STARPU_NMAXWORKERS];
 
 	/*
 	 * used by memory_manager.c
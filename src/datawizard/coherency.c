@@ -24,6 +24,9 @@
 #include <datawizard/write_back.h>
 #include <datawizard/memory_nodes.h>
 #include <datawizard/sort_data_handles.h>
+#include <datawizard/ooc_prefetch.h>
+#include <datawizard/numa_migration.h>
+#include <datawizard/footprint.h>
 #include <core/dependencies/data_concurrency.h>
 #include <core/disk.h>
 #include <profiling/profiling.h>
@@ -461,7 +464,7 @@ static struct _starpu_data_request *_starpu_search_existing_data_request(struct
 	/* Make sure we don't have anything else than R/W */
 	STARPU_ASSERT(mode != STARPU_UNMAP);
 
-	for (r = replicate->request[node]; r; r = r->next_same_req)
+	for (r = _starpu_replicate_get_request(replicate, node); r; r = r->next_same_req)
 	{
 		_starpu_spin_checklocked(&r->handle->header_lock);
 
@@ -561,7 +564,7 @@ struct _starpu_data_request *_starpu_create_request_to_fetch_data(starpu_data_ha
 			for (j = 0; j < nnodes; j++)
 			{
 				struct _starpu_data_request *r;
-				for (r = handle->per_node[i].request[j]; r; r = r->next_same_req)
+				for (r = _starpu_replicate_get_request(&handle->per_node[i], j); r; r = r->next_same_req)
 					nwait++;
 			}
 		/* If the request is not detached (i.e. the caller really wants
@@ -609,7 +612,7 @@ struct _starpu_data_request *_starpu_create_request_to_fetch_data(starpu_data_ha
 				struct _starpu_data_request *r2;
 				for (j = 0; j < nnodes; j++)
 				{
-					for (r2 = dst_replicate->request[j]; r2; r2 = r2->next_same_req)
+					for (r2 = _starpu_replicate_get_request(dst_replicate, j); r2; r2 = r2->next_same_req)
 					{
 						if (r2->task && r2->task == task)
 						{
@@ -796,7 +799,7 @@ struct _starpu_data_request *_starpu_create_request_to_fetch_data(starpu_data_ha
 			for (j = 0; j < nnodes; j++)
 			{
 				struct _starpu_data_request *r2;
-				for (r2 = handle->per_node[i].request[j]; r2; r2 = r2->next_same_req)
+				for (r2 = _starpu_replicate_get_request(&handle->per_node[i], j); r2; r2 = r2->next_same_req)
 				{
 					_starpu_spin_lock(&r2->lock);
 					if (is_prefetch < r2->prefetch)
@@ -858,10 +861,18 @@ int _starpu_fetch_data_on_node(starpu_data_handle_t handle, int node, struct _st
 			/* no valid copy, nothing to prefetch */
 			STARPU_ASSERT_MSG(handle->init_cl, "Could not find a valid copy of the data, and no handle initialization function");
 			_starpu_spin_unlock(&handle->header_lock);
+			if (callback_func)
+				callback_func(callback_arg);
 			return 0;
 		}
 	}
 
+	if (is_prefetch <= STARPU_TASK_PREFETCH && task
+		&& _starpu_numa_migration_observe(handle, node, dst_replicate))
+		/* The task keeps the handle alive while the header lock is
+		 * released for the migration */
+		_starpu_numa_migration_perform(handle, node);
+
 	if (!detached)
 	{
 		/* Take references which will be released by _starpu_release_data_on_node */
@@ -941,9 +952,25 @@ starpu_ssize_t _starpu_data_get_max_size(starpu_data_handle_t handle)
 
 uint32_t _starpu_data_get_footprint(starpu_data_handle_t handle)
 {
+	if (STARPU_UNLIKELY(!handle->footprints_valid))
+		_starpu_data_compute_footprints(handle);
+	else
+		STARPU_RMB();
 	return handle->footprint;
 }
 
+uint32_t _starpu_data_get_alloc_footprint(starpu_data_handle_t handle)
+{
+	if (handle->ops->get_max_size)
+		/* Variable-size data, the allocation may change at any time */
+		return _starpu_compute_data_alloc_footprint(handle);
+	if (STARPU_UNLIKELY(!handle->footprints_valid))
+		_starpu_data_compute_footprints(handle);
+	else
+		STARPU_RMB();
+	return handle->alloc_footprint;
+}
+
 /* in case the data was accessed on a write mode, do not forget to
  * make it accessible again once it is possible ! */
 void _starpu_release_data_on_node(starpu_data_handle_t handle, uint32_t default_wt_mask, enum starpu_data_access_mode down_to_mode, struct _starpu_data_replicate *replicate)
@@ -1200,6 +1227,11 @@ int _starpu_fetch_task_input(struct starpu_task *task, struct _starpu_job *j, in
 
 		local_replicate = get_replicate(handle, mode, workerid, node);
 
+		/* The state is read without the header lock, this is only statistics */
+		_starpu_handle_stats_access(handle, (mode & STARPU_R) && local_replicate->state == STARPU_INVALID);
+
+		_starpu_ooc_prefetch_observe(handle, node);
+
 		if (async)
 		{
 			ret = _starpu_fetch_data_on_node(handle, node, local_replicate, mode, 0, task, STARPU_FETCH, 1,
@@ -1545,7 +1577,7 @@ unsigned starpu_data_is_on_node(starpu_data_handle_t handle, unsigned node)
 
 		for (i = 0; i < nnodes; i++)
 		{
-			if (handle->per_node[node].request[i])
+			if (_starpu_replicate_get_request(&handle->per_node[node], i))
 			{
 				ret = 1;
 				break;
@@ -42,6 +42,18 @@ enum _starpu_cache_state
 	STARPU_INVALID
 };
 
+struct _starpu_data_request;
+
+/** Pending requests towards a replicate, indexed by the source node (or the
+ * destination node for write-only requests) */
+struct _starpu_data_replicate_requests
+{
+	/** This tracks the list of requests to provide the value */
+	struct _starpu_data_request *request[STARPU_MAXNODES];
+	/** This points to the last entry of request, to easily append to the list */
+	struct _starpu_data_request *last_request[STARPU_MAXNODES];
+};
+
 /** this should contain the information relative to a given data replicate  */
 struct _starpu_data_replicate
 {
@@ -95,10 +107,10 @@ struct _starpu_data_replicate
 	 */
 	uint32_t requested;
 
-	/** This tracks the list of requests to provide the value */
-	struct _starpu_data_request *request[STARPU_MAXNODES];
-	/** This points to the last entry of request, to easily append to the list */
-	struct _starpu_data_request *last_request[STARPU_MAXNODES];
+	/** This tracks the lists of requests to provide the value, only
+	 * allocated when a request is queued for the first time, since most
+	 * replicates never get any */
+	struct _starpu_data_replicate_requests *requests;
 
 	/* Which request is loading data here */
 	struct _starpu_data_request *load_request;
@@ -113,6 +125,12 @@ struct _starpu_data_replicate
 	struct _starpu_mem_chunk * mc;
 };
 
+/** Return the first pending request from \p node towards \p replicate */
+static inline struct _starpu_data_request *_starpu_replicate_get_request(struct _starpu_data_replicate *replicate, unsigned node)
+{
+	return replicate->requests ? replicate->requests->request[node] : NULL;
+}
+
 struct _starpu_data_requester_prio_list;
 
 struct _starpu_jobid_list
@@ -189,12 +207,20 @@ struct _starpu_data_state
 	/** Synchronous partitioning */
 	starpu_data_handle_t children;
 	unsigned nchildren;
+	/** With lazy allocation, copy of the filter given to
+	 * starpu_data_partition(), used by starpu_data_unpartition() to lay
+	 * the children out in the data once it gets allocated */
+	struct starpu_data_filter *lazy_filter;
 	/** How many partition plans this handle has */
 	unsigned nplans;
 	/** Switch codelet for asynchronous partitioning */
 	struct starpu_codelet *switch_cl;
 	/** size of dyn_nodes recorded in switch_cl */
 	unsigned switch_cl_nparts;
+	/** Partition plans released with starpu_data_partition_plan_release(),
+	 * kept for being reused by starpu_data_partition_plan() */
+	struct _starpu_partition_plan *plan_cache;
+	unsigned nplan_cache;
 	/** Whether a partition plan is currently submitted and the
 	 * corresponding unpartition has not been yet
 	 *
@@ -218,6 +244,11 @@ struct _starpu_data_state
 
 	/** Footprint which identifies data layout */
 	uint32_t footprint;
+	/** Footprint which identifies the allocation of the data */
+	uint32_t alloc_footprint;
+	/** Whether footprint and alloc_footprint are up to date, they are
+	 * recomputed lazily when the layout of the data changes */
+	unsigned footprints_valid;
 
 	/* The following bitfields are set from the application initialization */
 
@@ -230,6 +261,9 @@ struct _starpu_data_state
 	unsigned sequential_consistency:1;
 	/** Whether we shall not ever write to this handle, thus allowing various optimizations */
 	unsigned readonly:1;
+	/** Whether to avoid allocating the whole data in main memory when it
+	 * is partitioned before having a value */
+	unsigned lazy_allocation:1;
 
 	/** where is the data home, i.e. which node it was registered from ? -1 if none yet */
 	int home_node;
@@ -321,8 +355,15 @@ struct _starpu_data_state
 
 	_starpu_memory_stats_t memory_stats;
 
+	/** Access statistics, when STARPU_HANDLE_STATS is set */
+	struct _starpu_handle_stats *handle_stats;
+
 	unsigned int mf_node; //XXX
 
+	/** When registered with starpu_data_register_array(), the arena holding
+	 * this handle and its interfaces, freed along the last handle */
+	struct _starpu_data_arena *arena;
+
 	/** hook to be called when unregistering the data */
 	_starpu_data_handle_unregister_hook unregister_hook;
 
@@ -330,6 +371,24 @@ struct _starpu_data_state
 	/** This is protected by the arbiter mutex */
 	struct _starpu_data_requester_prio_list arbitered_req_list;
 
+	/** Out-of-core access sequence detection, protected by the
+	 * ooc_prefetch.c mutex */
+	/** Data accessed after this one last time */
+	struct _starpu_data_state *ooc_next;
+	/** Data whose ooc_next is this one */
+	struct _starpu_data_state *ooc_prev;
+	/** Index of the child last accessed, and stride from the previous one */
+	unsigned ooc_last_child;
+	int ooc_child_stride;
+
+	/** NUMA migration of the home buffer, protected by header_lock */
+	/** Last remote node which accessed the data, and how many times in a row */
+	int numa_migrate_node;
+	unsigned numa_migrate_count;
+	/** Whether the pages of the home buffer are being migrated, the
+	 * migration itself runs without header_lock */
+	unsigned numa_migrating;
+
 	/** Data maintained by schedulers themselves */
 	/** Last worker that took this data in locality mode, or -1 if nobody
 	 * took it yet */
@@ -375,6 +434,14 @@ size_t _starpu_data_get_alloc_size(starpu_data_handle_t handle);
 starpu_ssize_t _starpu_data_get_max_size(starpu_data_handle_t handle);
 
 uint32_t _starpu_data_get_footprint(starpu_data_handle_t handle);
+uint32_t _starpu_data_get_alloc_footprint(starpu_data_handle_t handle);
+
+/** Invalidate the cached footprints of the handle, to be called when the
+ * layout of the data gets changed */
+static inline void _starpu_data_invalidate_footprints(starpu_data_handle_t handle)
+{
+	handle->footprints_valid = 0;
+}
 
 void __starpu_push_task_output(struct _starpu_job *j);
 /** Version with driver trace */
@@ -21,6 +21,7 @@
 #include <core/sched_policy.h>
 #include <datawizard/datastats.h>
 #include <datawizard/memory_nodes.h>
+#include <core/disk.h>
 #include <drivers/disk/driver_disk.h>
 #include <drivers/mpi/driver_mpi_sink.h>
 #include <drivers/mpi/driver_mpi_source.h>
@@ -252,9 +253,15 @@ int STARPU_ATTRIBUTE_WARN_UNUSED_RESULT _starpu_driver_copy_data_1_to_1(starpu_d
 
 	if (!dst_replicate->allocated && dst_replicate->mapped == STARPU_UNMAPPED && dst_node != src_node
 			&& handle->ops->map_data
-			&& (_starpu_memory_node_get_mapped(dst_replicate->memory_node) /* || handle wants it */))
-	{
-		/* Memory node which can just map the main memory, try to map.  */
+			&& (_starpu_memory_node_get_mapped(dst_replicate->memory_node) /* || handle wants it */
+				|| (starpu_node_get_kind(src_node) == STARPU_DISK_RAM && starpu_node_get_kind(dst_node) == STARPU_CPU_RAM
+					&& src_replicate->allocated
+					&& _starpu_disk_can_map(starpu_memory_node_get_devid(src_node))
+					&& _starpu_disk_can_map_interface(handle, src_replicate->data_interface))))
+	{
+		/* Memory node which can just map the main memory, or disk
+		 * which can be mapped in the main memory, try to map.
+		 * Otherwise we fall back to allocating and copying below.  */
 		if (!handle->ops->map_data(
 				src_replicate->data_interface, src_replicate->memory_node,
 				dst_replicate->data_interface, dst_replicate->memory_node))
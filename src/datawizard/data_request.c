@@ -55,6 +55,13 @@ void _starpu_init_data_request_lists(void)
 			}
 		}
 		STARPU_HG_DISABLE_CHECKING(node->data_requests_npending);
+		for (j = 0; j < STARPU_MAXNODES; j++)
+		{
+			node->transfer_queued_size[j] = 0;
+			node->transfer_queued_nrequests[j] = 0;
+		}
+		STARPU_HG_DISABLE_CHECKING(node->transfer_queued_size);
+		STARPU_HG_DISABLE_CHECKING(node->transfer_queued_nrequests);
 	}
 }
 
@@ -108,7 +115,8 @@ static void _starpu_data_request_unlink(struct _starpu_data_request *r)
 			node = r->dst_replicate->memory_node;
 
 		/* Look for ourself in the list, we should be not very far. */
-		for (prevp = &r->dst_replicate->request[node], prev = NULL;
+		struct _starpu_data_replicate_requests *requests = r->dst_replicate->requests;
+		for (prevp = &requests->request[node], prev = NULL;
 		     *prevp && *prevp != r;
 		     prev = *prevp, prevp = &prev->next_same_req)
 			;
@@ -119,11 +127,11 @@ static void _starpu_data_request_unlink(struct _starpu_data_request *r)
 		if (!r->next_same_req)
 		{
 			/* I was last */
-			STARPU_ASSERT(r->dst_replicate->last_request[node] == r);
+			STARPU_ASSERT(requests->last_request[node] == r);
 			if (prev)
-				r->dst_replicate->last_request[node] = prev;
+				requests->last_request[node] = prev;
 			else
-				r->dst_replicate->last_request[node] = NULL;
+				requests->last_request[node] = NULL;
 		}
 	}
 }
@@ -189,9 +197,12 @@ struct _starpu_data_request *_starpu_create_data_request(starpu_data_handle_t ha
 	}
 	STARPU_ASSERT(starpu_node_get_kind(handling_node) == STARPU_CPU_RAM || _starpu_memory_node_get_nworkers(handling_node));
 	r->completed = 0;
+	r->posted = 0;
 	r->added_ref = 0;
 	r->canceled = 0;
 	r->prefetch = is_prefetch;
+	r->start_time = starpu_enable_handle_stats() ? starpu_timing_now() : 0.;
+	r->queued_size = 0;
 	r->task = task;
 	r->nb_tasks_prefetch = 0;
 	r->prio = prio;
@@ -227,11 +238,14 @@ struct _starpu_data_request *_starpu_create_data_request(starpu_data_handle_t ha
 		else
 			node = dst_replicate->memory_node;
 
-		if (!dst_replicate->request[node])
-			dst_replicate->request[node] = r;
+		if (!dst_replicate->requests)
+			_STARPU_CALLOC(dst_replicate->requests, 1, sizeof(*dst_replicate->requests));
+		struct _starpu_data_replicate_requests *requests = dst_replicate->requests;
+		if (!requests->request[node])
+			requests->request[node] = r;
 		else
-			dst_replicate->last_request[node]->next_same_req = r;
-		dst_replicate->last_request[node] = r;
+			requests->last_request[node]->next_same_req = r;
+		requests->last_request[node] = r;
 
 		if (mode & STARPU_R)
 		{
@@ -343,6 +357,48 @@ int _starpu_wait_data_request_completion(struct _starpu_data_request *r, enum _s
 	return retval;
 }
 
+/* Account the data that \p r will transfer in the queued size of its link.
+ * Idle prefetches are not accounted since they only happen when the link has
+ * nothing else to do, until they get upgraded. */
+static void _starpu_data_request_queue_transfer(struct _starpu_data_request *r)
+{
+	if (!(r->mode & STARPU_R) || !r->src_replicate || !r->dst_replicate || r->prefetch >= STARPU_IDLEFETCH || r->queued_size)
+		return;
+
+	struct _starpu_node *node_struct = _starpu_get_node_struct(r->src_replicate->memory_node);
+	unsigned dst_node = r->dst_replicate->memory_node;
+	size_t size = _starpu_data_get_size(r->handle);
+
+	r->queued_size = size;
+	(void) STARPU_ATOMIC_ADDL(&node_struct->transfer_queued_size[dst_node], size);
+	(void) STARPU_ATOMIC_ADDL(&node_struct->transfer_queued_nrequests[dst_node], 1);
+}
+
+/* The data of \p r is not going to be transferred any more, remove it from
+ * the queued size of its link. */
+static void _starpu_data_request_unqueue_transfer(struct _starpu_data_request *r)
+{
+	size_t size = r->queued_size;
+	if (!size)
+		return;
+
+	struct _starpu_node *node_struct = _starpu_get_node_struct(r->src_replicate->memory_node);
+	unsigned dst_node = r->dst_replicate->memory_node;
+
+	r->queued_size = 0;
+	(void) STARPU_ATOMIC_ADDL(&node_struct->transfer_queued_size[dst_node], -(unsigned long) size);
+	(void) STARPU_ATOMIC_ADDL(&node_struct->transfer_queued_nrequests[dst_node], -1UL);
+}
+
+size_t starpu_transfer_queued(unsigned src_node, unsigned dst_node, unsigned *nrequests)
+{
+	struct _starpu_node *node_struct = _starpu_get_node_struct(src_node);
+	unsigned long n = node_struct->transfer_queued_nrequests[dst_node];
+	if (nrequests)
+		*nrequests = n;
+	return node_struct->transfer_queued_size[dst_node];
+}
+
 /* this is non blocking */
 void _starpu_post_data_request(struct _starpu_data_request *r)
 {
@@ -363,6 +419,9 @@ void _starpu_post_data_request(struct _starpu_data_request *r)
 		STARPU_ASSERT(r->src_replicate->refcnt);
 	}
 
+	r->posted = 1;
+	_starpu_data_request_queue_transfer(r);
+
 	/* insert the request in the proper list */
 	STARPU_PTHREAD_MUTEX_LOCK(&node_struct->data_requests_list_mutex[r->peer_node][r->inout]);
 	if (r->prefetch >= STARPU_IDLEFETCH)
@@ -405,6 +464,7 @@ static void starpu_handle_data_request_completion(struct _starpu_data_request *r
 	struct _starpu_data_replicate *src_replicate = r->src_replicate;
 	struct _starpu_data_replicate *dst_replicate = r->dst_replicate;
 
+	_starpu_data_request_unqueue_transfer(r);
 
 	if (r->canceled < 2 && dst_replicate)
 	{
@@ -435,6 +495,14 @@ static void starpu_handle_data_request_completion(struct _starpu_data_request *r
 			_starpu_memory_handle_stats_loaded_owner(handle, dst_replicate->memory_node);
 		}
 #endif
+
+		if (starpu_enable_handle_stats())
+		{
+			size_t size = (mode & STARPU_R) && src_replicate ? _starpu_data_get_size(handle) : 0;
+			/* Only the last request of a chain is waited for */
+			double wait_time = r->prefetch == STARPU_FETCH && !r->next_req_count ? starpu_timing_now() - r->start_time : 0.;
+			_starpu_handle_stats_transfer(handle, size, wait_time);
+		}
 	}
 
 #ifdef STARPU_USE_FXT
@@ -573,6 +641,7 @@ static int starpu_handle_data_request(struct _starpu_data_request *r, enum _star
 		{
 			/* Oh, some other transfer is already loading the value. Just wait for it */
 			r->canceled = 2;
+			_starpu_data_request_unqueue_transfer(r);
 			_starpu_spin_unlock(&r->lock);
 			_starpu_spin_lock(&r2->lock);
 			if (r->prefetch < r2->prefetch)
@@ -991,11 +1060,18 @@ void _starpu_update_prefetch_status(struct _starpu_data_request *r, enum starpu_
 	}
 
 	r->prefetch=prefetch;
+	if (prefetch == STARPU_FETCH && starpu_enable_handle_stats())
+		/* Someone is waiting for it only from now on */
+		r->start_time = starpu_timing_now();
 
 	if (prefetch >= STARPU_IDLEFETCH)
 		/* No possible actual change */
 		return;
 
+	if (r->posted && !r->completed && !r->canceled)
+		/* An idle prefetch now competes with the other transfers */
+		_starpu_data_request_queue_transfer(r);
+
 	/* We have to promote chained_request too! */
 	unsigned chained_req;
 	for (chained_req = 0; chained_req < r->next_req_count; chained_req++)
@@ -90,6 +90,9 @@ LIST_TYPE(_starpu_data_request,
 	/** Whether the transfer is completed. */
 	unsigned completed:1;
 
+	/** Whether the request was posted, i.e. its transfer may be queued on its link. */
+	unsigned posted:1;
+
 	/** Whether we have already added our reference to the dst replicate. */
 	unsigned added_ref:1;
 
@@ -128,6 +131,14 @@ LIST_TYPE(_starpu_data_request,
 	struct _starpu_callback_list *callbacks;
 
 	unsigned long com_id;
+
+	/** When the request was created or turned into a fetch, for the
+	 * per-handle statistics */
+	double start_time;
+
+	/** The amount of data accounted for this request in the queued
+	 * size of its link, see starpu_transfer_queued() */
+	size_t queued_size;
 )
 PRIO_LIST_TYPE(_starpu_data_request, prio)
 
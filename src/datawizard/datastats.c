@@ -19,12 +19,16 @@
 #include <datawizard/coherency.h>
 #include <datawizard/memory_nodes.h>
 #include <common/config.h>
+#include <core/workers.h>
+#include <errno.h>
 
 int _starpu_enable_stats = 0;
+int _starpu_enable_handle_stats = 0;
 
 void _starpu_datastats_init()
 {
 	_starpu_enable_stats = !!starpu_getenv("STARPU_ENABLE_STATS");
+	_starpu_enable_handle_stats = starpu_getenv_number_default("STARPU_HANDLE_STATS", 0) > 0;
 }
 
 /* measure the cache hit ratio for each node */
@@ -115,3 +119,299 @@ void _starpu_display_alloc_cache_stats(FILE *stream)
 	}
 	fprintf(stream, "#---------------------\n");
 }
+
+/* measure how much data was moved between NUMA nodes by page migration */
+static unsigned numa_migrated_cnt[STARPU_MAXNODES][STARPU_MAXNODES];
+static size_t numa_migrated_bytes[STARPU_MAXNODES][STARPU_MAXNODES];
+
+void __starpu_numa_migration_inc_stats(unsigned src_node, unsigned dst_node, size_t size)
+{
+	STARPU_HG_DISABLE_CHECKING(numa_migrated_cnt[src_node][dst_node]);
+	STARPU_HG_DISABLE_CHECKING(numa_migrated_bytes[src_node][dst_node]);
+	numa_migrated_cnt[src_node][dst_node]++;
+	numa_migrated_bytes[src_node][dst_node] += size;
+}
+
+void _starpu_display_numa_migration_stats(FILE *stream)
+{
+	if (!starpu_enable_stats())
+		return;
+
+	unsigned src, dst;
+	size_t total = 0;
+
+	for (src = 0; src < STARPU_MAXNODES; src++)
+		for (dst = 0; dst < STARPU_MAXNODES; dst++)
+			total += numa_migrated_bytes[src][dst];
+	if (!total)
+		return;
+
+	fprintf(stream, "\n#---------------------\n");
+	fprintf(stream, "NUMA page migration stats:\n");
+	fprintf(stream, "TOTAL migrated\t%.2f MiB\n", (double) total / (1024*1024));
+	for (src = 0; src < STARPU_MAXNODES; src++)
+		for (dst = 0; dst < STARPU_MAXNODES; dst++)
+		{
+			if (numa_migrated_cnt[src][dst])
+			{
+				char src_name[128], dst_name[128];
+				starpu_memory_node_get_name(src, src_name, sizeof(src_name));
+				starpu_memory_node_get_name(dst, dst_name, sizeof(dst_name));
+				fprintf(stream, "%s -> %s\n", src_name, dst_name);
+				fprintf(stream, "\tdata : %u\n", numa_migrated_cnt[src][dst]);
+				fprintf(stream, "\tmigrated : %.2f MiB\n", (double) numa_migrated_bytes[src][dst] / (1024*1024));
+			}
+		}
+	fprintf(stream, "#---------------------\n");
+}
+
+/* Per-handle statistics. The counters are accumulated in per-worker slots of
+ * the handle, and summed into a record when the handle is unregistered, so
+ * that they can be dumped at shutdown. */
+struct handle_stats_record
+{
+	char *key;
+	size_t size;
+	struct _starpu_handle_stats_slot total;
+};
+
+/* Protects the shared slot of the handles, and the records */
+static starpu_pthread_mutex_t handle_stats_mutex = STARPU_PTHREAD_MUTEX_INITIALIZER;
+static struct handle_stats_record *handle_stats_records;
+static unsigned handle_stats_nrecords, handle_stats_maxrecords;
+
+void __starpu_handle_stats_register(starpu_data_handle_t handle)
+{
+	unsigned nslots = starpu_worker_get_count() + 1;
+	struct _starpu_handle_stats *stats;
+
+	if (handle->handle_stats)
+		/* Reused handle, e.g. from the partition plan cache */
+		return;
+
+	if (posix_memalign((void **) &stats, STARPU_CACHELINE_SIZE, sizeof(*stats) + nslots * sizeof(stats->slots[0])))
+		return;
+	memset(stats, 0, sizeof(*stats) + nslots * sizeof(stats->slots[0]));
+	stats->nslots = nslots;
+	handle->handle_stats = stats;
+}
+
+void __starpu_handle_stats_set_name(starpu_data_handle_t handle, const char *name)
+{
+	struct _starpu_handle_stats *stats = handle->handle_stats;
+	if (!stats || !name)
+		return;
+	free(stats->name);
+	stats->name = strdup(name);
+}
+
+/* Return the slot of the calling thread, and lock it if it is shared */
+static struct _starpu_handle_stats_slot *handle_stats_get_slot(struct _starpu_handle_stats *stats)
+{
+	int workerid = starpu_worker_get_id();
+	if (workerid >= 0 && (unsigned) workerid < stats->nslots - 1)
+		return &stats->slots[workerid];
+	STARPU_PTHREAD_MUTEX_LOCK(&handle_stats_mutex);
+	return &stats->slots[stats->nslots - 1];
+}
+
+static void handle_stats_release_slot(struct _starpu_handle_stats *stats, struct _starpu_handle_stats_slot *slot)
+{
+	if (slot == &stats->slots[stats->nslots - 1])
+		STARPU_PTHREAD_MUTEX_UNLOCK(&handle_stats_mutex);
+}
+
+void __starpu_handle_stats_access(starpu_data_handle_t handle, int miss)
+{
+	struct _starpu_handle_stats *stats = handle->handle_stats;
+	struct _starpu_handle_stats_slot *slot;
+	if (!stats)
+		return;
+	slot = handle_stats_get_slot(stats);
+	slot->accesses++;
+	if (miss)
+		slot->misses++;
+	handle_stats_release_slot(stats, slot);
+}
+
+void __starpu_handle_stats_eviction(starpu_data_handle_t handle)
+{
+	struct _starpu_handle_stats *stats = handle->handle_stats;
+	struct _starpu_handle_stats_slot *slot;
+	if (!stats)
+		return;
+	slot = handle_stats_get_slot(stats);
+	slot->evictions++;
+	handle_stats_release_slot(stats, slot);
+}
+
+void __starpu_handle_stats_transfer(starpu_data_handle_t handle, size_t size, double wait_time)
+{
+	struct _starpu_handle_stats *stats = handle->handle_stats;
+	struct _starpu_handle_stats_slot *slot;
+	if (!stats)
+		return;
+	slot = handle_stats_get_slot(stats);
+	slot->transferred += size;
+	slot->wait_time += wait_time;
+	handle_stats_release_slot(stats, slot);
+}
+
+/* Name the handle by its name, or by its position in the partitioning tree,
+ * followed by its coordinates if any */
+static int handle_stats_key(starpu_data_handle_t handle, char *buf, size_t size)
+{
+	int n;
+	unsigned i;
+
+	if (handle->handle_stats && handle->handle_stats->name)
+		n = snprintf(buf, size, "%s", handle->handle_stats->name);
+	else if (handle->father_handle)
+	{
+		n = handle_stats_key(handle->father_handle, buf, size);
+		if ((size_t) n < size)
+			n += snprintf(buf + n, size - n, "[%u]", handle->sibling_index);
+	}
+	else
+		n = snprintf(buf, size, "%p", handle);
+
+	if (handle->dimensions && (size_t) n < size)
+	{
+		for (i = 0; i < handle->dimensions && (size_t) n < size; i++)
+			n += snprintf(buf + n, size - n, "%c%d", i ? ',' : '(', handle->coordinates[i]);
+		if ((size_t) n < size)
+			n += snprintf(buf + n, size - n, ")");
+	}
+	return n;
+}
+
+void __starpu_handle_stats_unregister(starpu_data_handle_t handle)
+{
+	struct _starpu_handle_stats *stats = handle->handle_stats;
+	struct handle_stats_record record;
+	unsigned i;
+	char key[256];
+
+	if (!stats)
+		return;
+
+	memset(&record, 0, sizeof(record));
+	for (i = 0; i < stats->nslots; i++)
+	{
+		record.total.accesses += stats->slots[i].accesses;
+		record.total.misses += stats->slots[i].misses;
+		record.total.evictions += stats->slots[i].evictions;
+		record.total.transferred += stats->slots[i].transferred;
+		record.total.wait_time += stats->slots[i].wait_time;
+	}
+
+	if (record.total.accesses || record.total.transferred || record.total.evictions)
+	{
+		handle_stats_key(handle, key, sizeof(key));
+		record.key = strdup(key);
+		record.size = _starpu_data_get_size(handle);
+
+		STARPU_PTHREAD_MUTEX_LOCK(&handle_stats_mutex);
+		if (handle_stats_nrecords == handle_stats_maxrecords)
+		{
+			handle_stats_maxrecords = handle_stats_maxrecords ? 2 * handle_stats_maxrecords : 64;
+			_STARPU_REALLOC(handle_stats_records, handle_stats_maxrecords * sizeof(handle_stats_records[0]));
+		}
+		handle_stats_records[handle_stats_nrecords++] = record;
+		STARPU_PTHREAD_MUTEX_UNLOCK(&handle_stats_mutex);
+	}
+
+	handle->handle_stats = NULL;
+	free(stats->name);
+	free(stats);
+}
+
+/* Hottest data first */
+static int handle_stats_cmp(const void *a, const void *b)
+{
+	const struct handle_stats_record *ra = a, *rb = b;
+	if (ra->total.wait_time != rb->total.wait_time)
+		return ra->total.wait_time < rb->total.wait_time ? 1 : -1;
+	if (ra->total.accesses != rb->total.accesses)
+		return ra->total.accesses < rb->total.accesses ? 1 : -1;
+	return strcmp(ra->key, rb->key);
+}
+
+/* Write \p key between double quotes, escaping quotes and backslashes for
+ * JSON, or doubling quotes for CSV */
+static void handle_stats_print_key(FILE *stream, const char *key, int json)
+{
+	fputc('"', stream);
+	for (; *key; key++)
+	{
+		if (*key == '"')
+			fputc(json ? '\\' : '"', stream);
+		else if (json && *key == '\\')
+			fputc('\\', stream);
+		fputc(*key, stream);
+	}
+	fputc('"', stream);
+}
+
+void _starpu_display_handle_stats(void)
+{
+	const char *filename;
+	FILE *stream = stderr;
+	size_t len;
+	unsigned i;
+	int json;
+
+	if (!starpu_enable_handle_stats())
+		return;
+
+	filename = starpu_getenv("STARPU_HANDLE_STATS_FILE");
+	if (filename)
+	{
+		stream = fopen(filename, "w+");
+		STARPU_ASSERT_MSG(stream, "Could not open file %s for displaying handle stats (%s). You can specify another file destination with the STARPU_HANDLE_STATS_FILE environment variable", filename, strerror(errno));
+	}
+	len = filename ? strlen(filename) : 0;
+	json = len >= 5 && !strcmp(filename + len - 5, ".json");
+
+	STARPU_PTHREAD_MUTEX_LOCK(&handle_stats_mutex);
+	if (handle_stats_nrecords)
+		qsort(handle_stats_records, handle_stats_nrecords, sizeof(handle_stats_records[0]), handle_stats_cmp);
+
+	if (json)
+		fprintf(stream, "[\n");
+	else
+		fprintf(stream, "handle,size,accesses,misses,transferred,evictions,wait_us\n");
+
+	for (i = 0; i < handle_stats_nrecords; i++)
+	{
+		struct handle_stats_record *r = &handle_stats_records[i];
+		if (json)
+		{
+			fprintf(stream, "  { \"handle\": ");
+			handle_stats_print_key(stream, r->key, 1);
+			fprintf(stream, ", \"size\": %lu, \"accesses\": %lu, \"misses\": %lu, \"transferred\": %lu, \"evictions\": %lu, \"wait_us\": %.3f }%s\n",
+				(unsigned long) r->size, r->total.accesses, r->total.misses,
+				(unsigned long) r->total.transferred, r->total.evictions, r->total.wait_time,
+				i + 1 < handle_stats_nrecords ? "," : "");
+		}
+		else
+		{
+			handle_stats_print_key(stream, r->key, 0);
+			fprintf(stream, ",%lu,%lu,%lu,%lu,%lu,%.3f\n",
+				(unsigned long) r->size, r->total.accesses, r->total.misses,
+				(unsigned long) r->total.transferred, r->total.evictions, r->total.wait_time);
+		}
+		free(r->key);
+	}
+
+	if (json)
+		fprintf(stream, "]\n");
+
+	free(handle_stats_records);
+	handle_stats_records = NULL;
+	handle_stats_nrecords = handle_stats_maxrecords = 0;
+	STARPU_PTHREAD_MUTEX_UNLOCK(&handle_stats_mutex);
+
+	if (stream != stderr)
+		fclose(stream);
+}
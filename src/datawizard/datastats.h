@@ -65,6 +65,88 @@ void __starpu_data_allocation_inc_stats(unsigned node STARPU_ATTRIBUTE_UNUSED);
 
 void _starpu_display_alloc_cache_stats(FILE *stream);
 
+void __starpu_numa_migration_inc_stats(unsigned src_node, unsigned dst_node, size_t size);
+
+#define _starpu_numa_migration_inc_stats(src_node, dst_node, size) do { \
+	if (starpu_enable_stats()) \
+		__starpu_numa_migration_inc_stats(src_node, dst_node, size); \
+} while (0)
+
+void _starpu_display_numa_migration_stats(FILE *stream);
+
+/** Per-handle access statistics, enabled by STARPU_HANDLE_STATS. Each worker
+ * accumulates in its own slot, threads which are not workers use the last
+ * slot, under a mutex. */
+struct _starpu_handle_stats_slot
+{
+	/** Number of task accesses */
+	unsigned long accesses;
+	/** Number of task accesses for reading which needed a transfer */
+	unsigned long misses;
+	/** Number of times a replicate was evicted from a memory node */
+	unsigned long evictions;
+	/** Number of bytes transferred to some memory node */
+	size_t transferred;
+	/** Time spent waiting for fetches to complete, in µs */
+	double wait_time;
+} __attribute__((aligned(STARPU_CACHELINE_SIZE)));
+
+struct _starpu_handle_stats
+{
+	/** Name given by starpu_data_set_name() */
+	char *name;
+	unsigned nslots;
+	struct _starpu_handle_stats_slot slots[];
+};
+
+extern int _starpu_enable_handle_stats;
+
+static inline int starpu_enable_handle_stats(void)
+{
+	return _starpu_enable_handle_stats;
+}
+
+void __starpu_handle_stats_register(starpu_data_handle_t handle);
+void __starpu_handle_stats_unregister(starpu_data_handle_t handle);
+void __starpu_handle_stats_set_name(starpu_data_handle_t handle, const char *name);
+void __starpu_handle_stats_access(starpu_data_handle_t handle, int miss);
+void __starpu_handle_stats_eviction(starpu_data_handle_t handle);
+void __starpu_handle_stats_transfer(starpu_data_handle_t handle, size_t size, double wait_time);
+
+#define _starpu_handle_stats_register(handle) do { \
+	if (starpu_enable_handle_stats()) \
+		__starpu_handle_stats_register(handle); \
+} while (0)
+
+#define _starpu_handle_stats_unregister(handle) do { \
+	if (starpu_enable_handle_stats()) \
+		__starpu_handle_stats_unregister(handle); \
+} while (0)
+
+#define _starpu_handle_stats_set_name(handle, name) do { \
+	if (starpu_enable_handle_stats()) \
+		__starpu_handle_stats_set_name(handle, name); \
+} while (0)
+
+#define _starpu_handle_stats_access(handle, miss) do { \
+	if (starpu_enable_handle_stats()) \
+		__starpu_handle_stats_access(handle, miss); \
+} while (0)
+
+#define _starpu_handle_stats_eviction(handle) do { \
+	if (starpu_enable_handle_stats()) \
+		__starpu_handle_stats_eviction(handle); \
+} while (0)
+
+#define _starpu_handle_stats_transfer(handle, size, wait_time) do { \
+	if (starpu_enable_handle_stats()) \
+		__starpu_handle_stats_transfer(handle, size, wait_time); \
+} while (0)
+
+/** Write the statistics of the handles unregistered so far to the file
+ * given by STARPU_HANDLE_STATS_FILE */
+void _starpu_display_handle_stats(void);
+
 #pragma GCC visibility pop
 
 #endif // __DATASTATS_H__
@@ -175,6 +175,84 @@ static unsigned _starpu_data_partition_nparts(starpu_data_handle_t initial_handl
 
 }
 
+/* Whether we can avoid allocating \p handle on \p node when partitioning it
+ * before it has a value, and rather allocate it when unpartitioning */
+static int _starpu_data_can_partition_lazily(starpu_data_handle_t handle, unsigned node)
+{
+	return handle->lazy_allocation
+		&& !handle->per_node[node].allocated
+		&& handle->ops->copy_methods
+		&& handle->ops->copy_methods->any_to_any
+		&& !_starpu_data_is_multiformat_handle(handle);
+}
+
+/* Compute in \p view the interface of the \p child -th child of \p root_handle
+ * inside the buffer of \p root_handle on \p node, using the filter kept by a
+ * lazy partitioning */
+static void _starpu_data_lazy_child_view(starpu_data_handle_t root_handle, unsigned child, unsigned node, void *view)
+{
+	starpu_data_handle_t child_handle = starpu_data_get_child(root_handle, child);
+	void *root_interface = starpu_data_get_interface_on_node(root_handle, node);
+
+	memset(view, 0, child_handle->ops->interface_size);
+	root_handle->lazy_filter->filter_func(root_interface, view, root_handle->lazy_filter, child, root_handle->nchildren);
+}
+
+/* The pieces of \p root_handle are about to be gathered on \p node, make
+ * the piece of the \p child -th child there point inside the buffer of
+ * \p root_handle, unless it already has its own buffer there */
+static void _starpu_data_lazy_attach_child(starpu_data_handle_t root_handle, unsigned child, unsigned node)
+{
+	starpu_data_handle_t child_handle = starpu_data_get_child(root_handle, child);
+	struct _starpu_data_replicate *child_replicate = &child_handle->per_node[node];
+	void *view;
+
+	_STARPU_MALLOC(view, child_handle->ops->interface_size);
+	_starpu_data_lazy_child_view(root_handle, child, node, view);
+
+	_starpu_spin_lock(&child_handle->header_lock);
+	if (!child_replicate->allocated)
+	{
+		memcpy(child_replicate->data_interface, view, child_handle->ops->interface_size);
+		child_replicate->allocated = 1;
+		child_replicate->automatically_allocated = 0;
+	}
+	_starpu_spin_unlock(&child_handle->header_lock);
+	free(view);
+}
+
+/* The \p child -th child of \p root_handle now has a valid copy on \p node.
+ * If it was in its own buffer, copy it into the buffer of \p root_handle and
+ * release its buffer. Called with the child header lock held */
+static void _starpu_data_lazy_gather_child(starpu_data_handle_t root_handle, unsigned child, unsigned node)
+{
+	starpu_data_handle_t child_handle = starpu_data_get_child(root_handle, child);
+	struct _starpu_data_replicate *child_replicate = &child_handle->per_node[node];
+	void *view;
+	unsigned initialized;
+
+	if (!child_replicate->mc || !child_replicate->automatically_allocated)
+		/* Already inside the root buffer */
+		return;
+
+	_STARPU_MALLOC(view, child_handle->ops->interface_size);
+	_starpu_data_lazy_child_view(root_handle, child, node, view);
+
+	if (child_replicate->state != STARPU_INVALID)
+	{
+		int ret = child_handle->ops->copy_methods->any_to_any(child_replicate->data_interface, node, view, node, NULL);
+		STARPU_ASSERT_MSG(ret == 0, "could not gather piece %u of data %p", child, root_handle);
+	}
+
+	initialized = child_replicate->initialized;
+	_starpu_request_mem_chunk_removal(child_handle, child_replicate, node, _starpu_data_get_alloc_size(child_handle));
+	memcpy(child_replicate->data_interface, view, child_handle->ops->interface_size);
+	child_replicate->allocated = 1;
+	child_replicate->automatically_allocated = 0;
+	child_replicate->initialized = initialized;
+	free(view);
+}
+
 static void _starpu_data_partition(starpu_data_handle_t initial_handle, starpu_data_handle_t *childrenp, unsigned nparts, struct starpu_data_filter *f, int inherit_state)
 {
 	unsigned i;
@@ -208,17 +286,28 @@ static void _starpu_data_partition(starpu_data_handle_t initial_handle, starpu_d
 	}
 	if (found == STARPU_MAXNODES)
 	{
-		/* This is lazy allocation, allocate it now in main RAM, so as
-		 * to have somewhere to gather pieces later */
-		/* FIXME: mark as unevictable! */
 		int home_node = initial_handle->home_node;
 		if (home_node < 0 || (starpu_node_get_kind(home_node) != STARPU_CPU_RAM))
 			home_node = STARPU_MAIN_RAM;
-		int ret = _starpu_allocate_memory_on_node(initial_handle, &initial_handle->per_node[home_node], STARPU_FETCH, 0);
+		if (inherit_state && _starpu_data_can_partition_lazily(initial_handle, home_node))
+		{
+			/* The application asked not to materialize the data
+			 * before having to gather the pieces, keep the filter
+			 * to lay them out in the data at unpartitioning time */
+			_STARPU_MALLOC(initial_handle->lazy_filter, sizeof(*f));
+			*initial_handle->lazy_filter = *f;
+		}
+		else
+		{
+			/* This is lazy allocation, allocate it now in main RAM, so as
+			 * to have somewhere to gather pieces later */
+			/* FIXME: mark as unevictable! */
+			int ret = _starpu_allocate_memory_on_node(initial_handle, &initial_handle->per_node[home_node], STARPU_FETCH, 0);
 #ifdef STARPU_DEVEL
 #warning we should reclaim memory if allocation failed
 #endif
-		STARPU_ASSERT(!ret);
+			STARPU_ASSERT(!ret);
+		}
 	}
 
 	if (nparts && !inherit_state)
@@ -278,6 +367,7 @@ static void _starpu_data_partition(starpu_data_handle_t initial_handle, starpu_d
 		child->initialized = initial_handle->initialized;
 		child->readonly = initial_handle->readonly;
 		child->ooc = initial_handle->ooc;
+		child->lazy_allocation = initial_handle->lazy_allocation;
 
 		/* The methods used for reduction are propagated to the
 		 * children. */
@@ -324,9 +414,9 @@ static void _starpu_data_partition(starpu_data_handle_t initial_handle, starpu_d
 			f->filter_func(initial_interface, child_interface, f, i, nparts);
 		}
 
-		/* We compute the size and the footprint of the child once and
-		 * store it in the handle */
-		child->footprint = _starpu_compute_data_footprint(child);
+		/* We compute the footprints of the child once and store them
+		 * in the handle */
+		_starpu_data_compute_footprints(child);
 
 		_STARPU_TRACE_HANDLE_DATA_REGISTER(child);
 	}
@@ -354,11 +444,22 @@ void starpu_data_unpartition(starpu_data_handle_t root_handle, unsigned gatherin
 
 	STARPU_ASSERT_MSG(root_handle->nchildren != 0, "data %p is not partitioned, can not unpartition it", root_handle);
 
+	if (root_handle->lazy_filter && !root_handle->per_node[gathering_node].allocated)
+	{
+		/* The data was partitioned without allocating it, now we need
+		 * it to gather the pieces */
+		int ret = _starpu_allocate_memory_on_node(root_handle, &root_handle->per_node[gathering_node], STARPU_FETCH, 0);
+		STARPU_ASSERT_MSG(!ret, "could not allocate data %p on node %u to gather its pieces", root_handle, gathering_node);
+	}
+
 	/* first take all the children lock (in order !) */
 	for (child = 0; child < root_handle->nchildren; child++)
 	{
 		starpu_data_handle_t child_handle = starpu_data_get_child(root_handle, child);
 
+		if (root_handle->lazy_filter)
+			_starpu_data_lazy_attach_child(root_handle, child, gathering_node);
+
 		/* make sure the intermediate children is unpartitionned as well */
 		if (child_handle->nchildren > 0)
 			starpu_data_unpartition(child_handle, gathering_node);
@@ -423,6 +524,9 @@ void starpu_data_unpartition(starpu_data_handle_t root_handle, unsigned gatherin
 
 		_starpu_spin_lock(&child_handle->header_lock);
 
+		if (root_handle->lazy_filter)
+			_starpu_data_lazy_gather_child(root_handle, child, gathering_node);
+
 		sizes[child] = _starpu_data_get_alloc_size(child_handle);
 
 		if (child_handle->unregister_hook)
@@ -442,6 +546,7 @@ void starpu_data_unpartition(starpu_data_handle_t root_handle, unsigned gatherin
 		}
 
 		_starpu_memory_stats_free(child_handle);
+		_starpu_handle_stats_unregister(child_handle);
 	}
 
 	/* the gathering_node should now have a valid copy of all the children.
@@ -568,6 +673,8 @@ void starpu_data_unpartition(starpu_data_handle_t root_handle, unsigned gatherin
 	starpu_data_handle_t children = root_handle->children;
 	root_handle->children = NULL;
 	root_handle->nchildren = 0;
+	free(root_handle->lazy_filter);
+	root_handle->lazy_filter = NULL;
 	root_handle->nplans--;
 
 	/* now the parent may be used again so we release the lock */
@@ -593,12 +700,108 @@ void starpu_data_partition(starpu_data_handle_t initial_handle, struct starpu_da
 	_starpu_data_partition(initial_handle, NULL, nparts, f, 1);
 }
 
+/* Maximum number of released partition plans kept for each handle */
+#define STARPU_PARTITION_PLAN_CACHE_SIZE 4
+
+/* Plans whose filter has a filter_arg_ptr are not cached, since we can not
+ * know whether what it points to was modified */
+static int _starpu_data_partition_plan_match(struct _starpu_partition_plan *plan, struct starpu_data_filter *f, unsigned nparts)
+{
+	return plan->nparts == nparts
+		&& plan->filter.filter_func == f->filter_func
+		&& plan->filter.nchildren == f->nchildren
+		&& plan->filter.get_nchildren == f->get_nchildren
+		&& plan->filter.get_child_ops == f->get_child_ops
+		&& plan->filter.filter_arg == f->filter_arg;
+}
+
+/* Look for a released plan of \p initial_handle with the same filter, and
+ * take it back from the cache. Called with the header lock held */
+static starpu_data_handle_t *_starpu_data_partition_plan_lookup(starpu_data_handle_t initial_handle, struct starpu_data_filter *f, unsigned nparts)
+{
+	struct _starpu_partition_plan *plan, **prev;
+
+	for (prev = &initial_handle->plan_cache; (plan = *prev); prev = &plan->next)
+	{
+		if (_starpu_data_partition_plan_match(plan, f, nparts))
+		{
+			starpu_data_handle_t *children = plan->children;
+			*prev = plan->next;
+			initial_handle->nplan_cache--;
+			free(plan);
+			return children;
+		}
+	}
+	return NULL;
+}
+
+static void _starpu_data_partition_plan_destroy(unsigned nparts, starpu_data_handle_t *children)
+{
+	unsigned i;
+	/* This may be children itself */
+	starpu_data_handle_t *siblings = children[0]->siblings;
+
+	for (i = 0; i < nparts; i++)
+	{
+		children[i]->siblings = NULL;
+		starpu_data_unregister_submit(children[i]);
+	}
+
+	free(siblings);
+}
+
+void _starpu_data_partition_plan_cache_flush(starpu_data_handle_t handle)
+{
+	struct _starpu_partition_plan *plan, *next;
+
+	_starpu_spin_lock(&handle->header_lock);
+	plan = handle->plan_cache;
+	handle->plan_cache = NULL;
+	handle->nplan_cache = 0;
+	_starpu_spin_unlock(&handle->header_lock);
+
+	for ( ; plan; plan = next)
+	{
+		next = plan->next;
+		_starpu_data_partition_plan_destroy(plan->nparts, plan->children);
+		free(plan);
+	}
+}
+
+void starpu_data_partition_plan_cache_flush(starpu_data_handle_t initial_handle)
+{
+	_starpu_data_partition_plan_cache_flush(initial_handle);
+}
+
 void starpu_data_partition_plan(starpu_data_handle_t initial_handle, struct starpu_data_filter *f, starpu_data_handle_t *childrenp)
 {
 	unsigned i;
 	unsigned nparts = _starpu_data_partition_nparts(initial_handle, f);
 	STARPU_ASSERT_MSG(initial_handle->nchildren == 0, "partition planning and synchronous partitioning is not supported");
 	STARPU_ASSERT_MSG(initial_handle->sequential_consistency, "partition planning is currently only supported for data with sequential consistency");
+
+	if (initial_handle->plan_cache && !f->filter_arg_ptr)
+	{
+		starpu_data_handle_t *cached;
+
+		_starpu_spin_lock(&initial_handle->header_lock);
+		cached = _starpu_data_partition_plan_lookup(initial_handle, f, nparts);
+		if (cached)
+		{
+			/* The children are still registered and their
+			 * interfaces still describe the same pieces, just
+			 * bring them back to the state of a new plan */
+			initial_handle->nplans++;
+			for (i = 0; i < nparts; i++)
+			{
+				cached[i]->initialized = initial_handle->initialized;
+				childrenp[i] = cached[i];
+			}
+		}
+		_starpu_spin_unlock(&initial_handle->header_lock);
+		if (cached)
+			return;
+	}
 	struct starpu_codelet *cl = initial_handle->switch_cl;
 	int home_node = initial_handle->home_node;
 	starpu_data_handle_t *children;
@@ -641,20 +844,12 @@ void starpu_data_partition_plan(starpu_data_handle_t initial_handle, struct star
 
 void starpu_data_partition_clean_node(starpu_data_handle_t root_handle, unsigned nparts, starpu_data_handle_t *children, int gather_node)
 {
-	unsigned i;
-
 	if (children[0]->active)
 	{
 		starpu_data_unpartition_submit(root_handle, nparts, children, gather_node);
 	}
 
-	free(children[0]->siblings);
-
-	for (i = 0; i < nparts; i++)
-	{
-		children[i]->siblings = NULL;
-		starpu_data_unregister_submit(children[i]);
-	}
+	_starpu_data_partition_plan_destroy(nparts, children);
 
 	_starpu_spin_lock(&root_handle->header_lock);
 	root_handle->nplans--;
@@ -669,6 +864,59 @@ void starpu_data_partition_clean(starpu_data_handle_t root_handle, unsigned npar
 	starpu_data_partition_clean_node(root_handle, nparts, children, root_handle->home_node);
 }
 
+void starpu_data_partition_plan_release_node(starpu_data_handle_t root_handle, struct starpu_data_filter *f, unsigned nparts, starpu_data_handle_t *children, int gather_node)
+{
+	struct _starpu_partition_plan *plan, *evicted = NULL;
+
+	STARPU_ASSERT_MSG(_starpu_data_partition_nparts(root_handle, f) == nparts, "the partition plan being released has %u parts, while the filter gives %u parts", nparts, _starpu_data_partition_nparts(root_handle, f));
+	STARPU_ASSERT_MSG(children[0]->father_handle == root_handle, "the partition plan being released was not made from %p", root_handle);
+
+	if (f->filter_arg_ptr)
+	{
+		/* Not cacheable */
+		starpu_data_partition_clean_node(root_handle, nparts, children, gather_node);
+		return;
+	}
+
+	if (children[0]->active)
+	{
+		starpu_data_unpartition_submit(root_handle, nparts, children, gather_node);
+	}
+
+	_STARPU_MALLOC(plan, sizeof(*plan));
+	plan->filter = *f;
+	plan->nparts = nparts;
+	/* The array allocated by starpu_data_partition_plan */
+	plan->children = children[0]->siblings;
+
+	_starpu_spin_lock(&root_handle->header_lock);
+	plan->next = root_handle->plan_cache;
+	root_handle->plan_cache = plan;
+	if (++root_handle->nplan_cache > STARPU_PARTITION_PLAN_CACHE_SIZE)
+	{
+		/* Too many plans, drop the oldest one */
+		struct _starpu_partition_plan **prev = &root_handle->plan_cache;
+		while ((*prev)->next)
+			prev = &(*prev)->next;
+		evicted = *prev;
+		*prev = NULL;
+		root_handle->nplan_cache--;
+	}
+	root_handle->nplans--;
+	_starpu_spin_unlock(&root_handle->header_lock);
+
+	if (evicted)
+	{
+		_starpu_data_partition_plan_destroy(evicted->nparts, evicted->children);
+		free(evicted);
+	}
+}
+
+void starpu_data_partition_plan_release(starpu_data_handle_t root_handle, struct starpu_data_filter *f, unsigned nparts, starpu_data_handle_t *children)
+{
+	starpu_data_partition_plan_release_node(root_handle, f, nparts, children, root_handle->home_node);
+}
+
 static
 void _starpu_data_partition_submit(starpu_data_handle_t initial_handle, unsigned nparts, starpu_data_handle_t *children, unsigned char *handles_sequential_consistency)
 {
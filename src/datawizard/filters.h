@@ -28,6 +28,18 @@
 
 #pragma GCC visibility push(hidden)
 
+/** Partition plan kept in the cache of its root handle */
+struct _starpu_partition_plan
+{
+	struct starpu_data_filter filter;
+	unsigned nparts;
+	starpu_data_handle_t *children;
+	struct _starpu_partition_plan *next;
+};
+
+/** unregister the children of the partition plans cached in \p handle */
+void _starpu_data_partition_plan_cache_flush(starpu_data_handle_t handle);
+
 /** submit asynchronous unpartitioning / partitioning to make target active read-only or read-write */
 void _starpu_data_partition_access_submit(starpu_data_handle_t target, int write);
 
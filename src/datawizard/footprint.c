@@ -115,6 +115,15 @@ uint32_t _starpu_compute_data_alloc_footprint(starpu_data_handle_t handle)
 	return starpu_hash_crc32c_be(handle_footprint, init);
 }
 
+void _starpu_data_compute_footprints(starpu_data_handle_t handle)
+{
+	/* Several threads may race here, they will compute the same values */
+	handle->footprint = _starpu_compute_data_footprint(handle);
+	handle->alloc_footprint = _starpu_compute_data_alloc_footprint(handle);
+	STARPU_WMB();
+	handle->footprints_valid = 1;
+}
+
 uint32_t starpu_task_footprint(struct starpu_perfmodel *model, struct starpu_task *task, struct starpu_perfmodel_arch* arch, unsigned nimpl)
 {
 	struct _starpu_job *j = _starpu_get_job_associated_to_task(task);
@@ -36,6 +36,9 @@ uint32_t _starpu_compute_data_footprint(starpu_data_handle_t handle);
 /** Compute the footprint that characterizes the allocation of the data handle. */
 uint32_t _starpu_compute_data_alloc_footprint(starpu_data_handle_t handle);
 
+/** Compute both footprints of the data handle and cache them in the handle. */
+void _starpu_data_compute_footprints(starpu_data_handle_t handle);
+
 #pragma GCC visibility pop
 
 #endif // __FOOTPRINT_H__
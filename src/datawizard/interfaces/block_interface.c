@@ -190,9 +190,6 @@ static void display_block_interface(starpu_data_handle_t handle, FILE *f)
 	fprintf(f, "%u\t%u\t%u\t", block_interface->nx, block_interface->ny, block_interface->nz);
 }
 
-#define IS_CONTIGUOUS_MATRIX(nx, ny, ldy) ((nx) == (ldy))
-#define IS_CONTIGUOUS_BLOCK(nx, ny, nz, ldy, ldz) ((nx) * (ny) == (ldz))
-
 static int pack_block_handle(starpu_data_handle_t handle, unsigned node, void **ptr, starpu_ssize_t *count)
 {
 	STARPU_ASSERT(starpu_data_test_if_allocated_on_node(handle, node));
@@ -211,38 +208,17 @@ static int pack_block_handle(starpu_data_handle_t handle, unsigned node, void **
 
 	if (ptr != NULL)
 	{
-		uint32_t z, y;
 		char *block = (void *)block_interface->ptr;
 
 		*ptr = (void *)starpu_malloc_on_node_flags(node, *count, 0);
 
 		char *cur = *ptr;
 
-		if (IS_CONTIGUOUS_BLOCK(nx, ny, nz, ldy, ldz))
-			memcpy(cur, block, nx * ny * nz * elemsize);
-		else
-		{
-			char *block_z = block;
-			for(z=0 ; z<nz ; z++)
-			{
-				if (IS_CONTIGUOUS_MATRIX(nx, ny, ldy))
-				{
-					memcpy(cur, block_z, nx * ny * elemsize);
-					cur += nx*ny*elemsize;
-				}
-				else
-				{
-					char *block_y = block_z;
-					for(y=0 ; y<ny ; y++)
-					{
-						memcpy(cur, block_y, nx*elemsize);
-						cur += nx*elemsize;
-						block_y += ldy * elemsize;
-					}
-				}
-				block_z += ldz * elemsize;
-			}
-		}
+		starpu_interface_copy3d((uintptr_t) block, 0, node,
+					(uintptr_t) cur, 0, node,
+					nx*elemsize,
+					ny, ldy*elemsize, nx*elemsize,
+					nz, ldz*elemsize, nx*ny*elemsize, NULL);
 	}
 
 	return 0;
@@ -264,35 +240,14 @@ static int peek_block_handle(starpu_data_handle_t handle, unsigned node, void *p
 
 	STARPU_ASSERT(count == elemsize * nx * ny * nz);
 
-	uint32_t z, y;
 	char *cur = ptr;
 	char *block = (void *)block_interface->ptr;
 
-	if (IS_CONTIGUOUS_BLOCK(nx, ny, nz, ldy, ldz))
-		memcpy(block, cur, nx * ny * nz * elemsize);
-	else
-	{
-		char *block_z = block;
-		for(z=0 ; z<nz ; z++)
-		{
-			if (IS_CONTIGUOUS_MATRIX(nx, ny, ldy))
-			{
-				memcpy(block_z, cur, nx * ny * elemsize);
-				cur += nx*ny*elemsize;
-			}
-			else
-			{
-				char *block_y = block_z;
-				for(y=0 ; y<ny ; y++)
-				{
-					memcpy(block_y, cur, nx*elemsize);
-					cur += nx*elemsize;
-					block_y += ldy * elemsize;
-				}
-			}
-			block_z += ldz * elemsize;
-		}
-	}
+	starpu_interface_copy3d((uintptr_t) cur, 0, node,
+				(uintptr_t) block, 0, node,
+				nx*elemsize,
+				ny, nx*elemsize, ldy*elemsize,
+				nz, nx*ny*elemsize, ldz*elemsize, NULL);
 
 	return 0;
 }
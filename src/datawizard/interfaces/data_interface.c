@@ -21,6 +21,7 @@
 #include <datawizard/memory_nodes.h>
 #include <datawizard/memstats.h>
 #include <datawizard/malloc.h>
+#include <datawizard/ooc_prefetch.h>
 #include <core/dependencies/data_concurrency.h>
 #include <common/knobs.h>
 #include <common/starpu_spinlock.h>
@@ -141,9 +142,10 @@ static void _starpu_register_new_data(starpu_data_handle_t handle, int home_node
 
 	/* Store some values directly in the handle not to recompute them all
 	 * the time. */
-	handle->footprint = _starpu_compute_data_footprint(handle);
+	_starpu_data_compute_footprints(handle);
 
 	handle->home_node = home_node;
+	handle->numa_migrate_node = -1;
 
 	handle->wt_mask = wt_mask;
 
@@ -223,11 +225,7 @@ void _starpu_data_initialize_per_worker(starpu_data_handle_t handle)
 		replicate->handle = handle;
 		//replicate->nb_tasks_prefetch = 0;
 
-		//for (node = 0; node < STARPU_MAXNODES; node++)
-		//{
-		//	replicate->request[node] = NULL;
-		//	replicate->last_request[node] = NULL;
-		//}
+		//replicate->requests = NULL;
 		//replicate->load_request = NULL;
 
 		/* Assuming being used for SCRATCH for now, patched when entering REDUX mode */
@@ -253,7 +251,9 @@ void starpu_data_ptr_register(starpu_data_handle_t handle, unsigned node)
 	_starpu_spin_unlock(&handle->header_lock);
 }
 
-int _starpu_data_handle_init(starpu_data_handle_t handle, struct starpu_data_interface_ops *interface_ops, unsigned int mf_node)
+/* Initialize \p handle, taking the per-node interfaces from \p interfaces if
+ * it is not NULL */
+static void __starpu_data_handle_init(starpu_data_handle_t handle, struct starpu_data_interface_ops *interface_ops, unsigned int mf_node, char *interfaces)
 {
 	unsigned node;
 
@@ -297,6 +297,8 @@ int _starpu_data_handle_init(starpu_data_handle_t handle, struct starpu_data_int
 	//handle->nplans = 0;
 	//handle->switch_cl = NULL;
 	//handle->switch_cl_nparts = 0;
+	//handle->plan_cache = NULL;
+	//handle->nplan_cache = 0;
 	//handle->partitioned = 0;
 	//handle->part_readonly = 0;
 
@@ -318,7 +320,10 @@ int _starpu_data_handle_init(starpu_data_handle_t handle, struct starpu_data_int
 
 		replicate->handle = handle;
 
-		_STARPU_CALLOC(replicate->data_interface, 1, interfacesize);
+		if (interfaces)
+			replicate->data_interface = interfaces + node * interfacesize;
+		else
+			_STARPU_CALLOC(replicate->data_interface, 1, interfacesize);
 		if (handle->ops->init) handle->ops->init(replicate->data_interface);
 	}
 
@@ -371,6 +376,7 @@ int _starpu_data_handle_init(starpu_data_handle_t handle, struct starpu_data_int
 	//handle->mpi_data = NULL; /* invalid until set */
 
 	_starpu_memory_stats_init(handle);
+	_starpu_handle_stats_register(handle);
 
 	handle->mf_node = mf_node;
 
@@ -392,7 +398,12 @@ int _starpu_data_handle_init(starpu_data_handle_t handle, struct starpu_data_int
 
 	//handle->user_data = NULL;
 	//handle->sched_data = NULL;
+	//handle->arena = NULL;
+}
 
+int _starpu_data_handle_init(starpu_data_handle_t handle, struct starpu_data_interface_ops *interface_ops, unsigned int mf_node)
+{
+	__starpu_data_handle_init(handle, interface_ops, mf_node, NULL);
 	return 0;
 }
 
@@ -460,6 +471,62 @@ void starpu_data_register(starpu_data_handle_t *handleptr, int home_node, void *
 	_STARPU_TRACE_HANDLE_DATA_REGISTER(handle);
 }
 
+void starpu_data_register_array(starpu_data_handle_t *handles, unsigned n, int home_node, void *data_interfaces, struct starpu_data_interface_ops *ops)
+{
+	STARPU_ASSERT_MSG(home_node >= -1 && home_node < (int)starpu_memory_nodes_get_count(), "Invalid memory node number");
+	STARPU_ASSERT(handles);
+	if (!n)
+		return;
+
+	size_t interfacesize = ops->interface_size;
+	struct _starpu_data_arena *arena;
+	unsigned i;
+
+	/* Allocate all the handles and their interfaces at once */
+	_STARPU_MALLOC(arena, sizeof(*arena));
+	arena->nhandles = n;
+	_STARPU_CALLOC(arena->handles, n, sizeof(*arena->handles));
+	_STARPU_CALLOC(arena->interfaces, (size_t) n * STARPU_MAXNODES, interfacesize);
+
+	if (ops->interfaceid == STARPU_UNKNOWN_INTERFACE_ID)
+	{
+		ops->interfaceid = starpu_data_interface_get_next_id();
+	}
+	STARPU_ASSERT(ops->register_data_handle);
+	_starpu_data_register_ops(ops);
+
+	for (i = 0; i < n; i++)
+	{
+		starpu_data_handle_t handle = &arena->handles[i];
+		__starpu_data_handle_init(handle, ops, home_node, (char *) arena->interfaces + (size_t) i * STARPU_MAXNODES * interfacesize);
+		handle->arena = arena;
+		handles[i] = handle;
+
+		ops->register_data_handle(handle, home_node, (char *) data_interfaces + i * interfacesize);
+		_starpu_register_new_data(handle, home_node, 0);
+		_STARPU_TRACE_HANDLE_DATA_REGISTER(handle);
+	}
+}
+
+/* Free the handle, or drop its reference on its arena */
+static void _starpu_data_handle_free(starpu_data_handle_t handle)
+{
+	struct _starpu_data_arena *arena = handle->arena;
+
+	if (!arena)
+	{
+		free(handle);
+		return;
+	}
+
+	if (STARPU_ATOMIC_ADD(&arena->nhandles, -1) == 0)
+	{
+		free(arena->interfaces);
+		free(arena->handles);
+		free(arena);
+	}
+}
+
 void starpu_data_register_same(starpu_data_handle_t *handledst, starpu_data_handle_t handlesrc)
 {
 	void *local_interface = starpu_data_get_interface_on_node(handlesrc, STARPU_MAIN_RAM);
@@ -505,13 +572,20 @@ void _starpu_data_free_interfaces(starpu_data_handle_t handle)
 		handle->ops->unregister_data_handle(handle);
 
 	for (node = 0; node < STARPU_MAXNODES; node++)
-		free(handle->per_node[node].data_interface);
+	{
+		free(handle->per_node[node].requests);
+		if (!handle->arena)
+			free(handle->per_node[node].data_interface);
+	}
 
 	if (handle->per_worker)
 	{
 		unsigned worker;
 		for (worker = 0; worker < nworkers; worker++)
+		{
+			free(handle->per_worker[worker].requests);
 			free(handle->per_worker[worker].data_interface);
+		}
 		free(handle->per_worker);
 	}
 }
@@ -659,6 +733,8 @@ static int _starpu_ro_data_detach(starpu_data_handle_t handle)
 static void _starpu_data_unregister(starpu_data_handle_t handle, unsigned coherent, unsigned nowait)
 {
 	STARPU_ASSERT(handle);
+	if (handle->plan_cache)
+		_starpu_data_partition_plan_cache_flush(handle);
 	STARPU_ASSERT_MSG(handle->nchildren == 0, "data %p needs to be unpartitioned before unregistration", handle);
 	STARPU_ASSERT_MSG(handle->nplans == 0, "data %p needs its partition plans to be cleaned before unregistration", handle);
 	STARPU_ASSERT_MSG(handle->partitioned == 0, "data %p needs its partitioned plans to be unpartitioned before unregistration", handle);
@@ -668,6 +744,8 @@ static void _starpu_data_unregister(starpu_data_handle_t handle, unsigned cohere
 	if (!_starpu_ro_data_detach(handle))
 		return;
 
+	_starpu_ooc_prefetch_forget(handle);
+
 	int sequential_consistency = handle->sequential_consistency;
 	if (sequential_consistency && !nowait)
 	{
@@ -857,6 +935,7 @@ retry_busy:
 	_starpu_data_free_interfaces(handle);
 
 	_starpu_memory_stats_free(handle);
+	_starpu_handle_stats_unregister(handle);
 
 	_starpu_spin_unlock(&handle->header_lock);
 	_starpu_spin_destroy(&handle->header_lock);
@@ -884,7 +963,7 @@ retry_busy:
 		free(handle->switch_cl);
 	}
 	_STARPU_TRACE_HANDLE_DATA_UNREGISTER(handle);
-	free(handle);
+	_starpu_data_handle_free(handle);
 	(void)STARPU_ATOMIC_ADD(&nregistered, -1);
 }
 
@@ -930,6 +1009,172 @@ void starpu_data_unregister_submit(starpu_data_handle_t handle)
 	starpu_data_acquire_on_node_cb(handle, STARPU_ACQUIRE_NO_NODE_LOCK_ALL, handle->initialized?STARPU_RW:STARPU_W, _starpu_data_unregister_submit_cb, handle);
 }
 
+struct _starpu_unregister_array_arg
+{
+	unsigned pending;
+	starpu_pthread_mutex_t mutex;
+	starpu_pthread_cond_t cond;
+};
+
+struct _starpu_unregister_array_data_arg
+{
+	starpu_data_handle_t handle;
+	struct _starpu_unregister_array_arg *arg;
+};
+
+/* Whether the copy back to the home node can be batched with the others */
+static int _starpu_data_unregister_array_batched(starpu_data_handle_t handle)
+{
+	return handle->home_node >= 0
+		&& starpu_node_get_kind(handle->home_node) == STARPU_CPU_RAM
+		&& !_starpu_data_is_multiformat_handle(handle)
+		&& !handle->readonly_dup_of;
+}
+
+static void _starpu_data_unregister_array_cb(void *_arg)
+{
+	struct _starpu_unregister_array_data_arg *data_arg = _arg;
+	struct _starpu_unregister_array_arg *arg = data_arg->arg;
+
+	/* The data is now valid in its home node */
+	starpu_data_release_on_node(data_arg->handle, data_arg->handle->home_node);
+
+	STARPU_PTHREAD_MUTEX_LOCK(&arg->mutex);
+	if (!--arg->pending)
+		STARPU_PTHREAD_COND_SIGNAL(&arg->cond);
+	STARPU_PTHREAD_MUTEX_UNLOCK(&arg->mutex);
+}
+
+void starpu_data_unregister_array(unsigned n, starpu_data_handle_t *handles)
+{
+	struct _starpu_unregister_array_arg arg;
+	struct _starpu_unregister_array_data_arg *data_args;
+	unsigned i;
+
+	STARPU_ASSERT_MSG(_starpu_worker_may_perform_blocking_calls(), "starpu_data_unregister_array must not be called from a task or callback, perhaps you can use starpu_data_unregister_array_submit instead");
+
+	_STARPU_MALLOC(data_args, n * sizeof(*data_args));
+	arg.pending = 1;
+	STARPU_PTHREAD_MUTEX_INIT(&arg.mutex, NULL);
+	STARPU_PTHREAD_COND_INIT(&arg.cond, NULL);
+
+	/* First bring all the data back to their home node at the same time */
+	for (i = 0; i < n; i++)
+	{
+		starpu_data_handle_t handle = handles[i];
+		STARPU_ASSERT_MSG(handle->magic == 42, "data %p is invalid (was it already registered?)", handle);
+		STARPU_ASSERT_MSG(!handle->lazy_unregister, "data %p can not be unregistered twice", handle);
+
+		data_args[i].handle = handle;
+		data_args[i].arg = &arg;
+
+		if (!_starpu_data_unregister_array_batched(handle))
+			/* Will be unregistered the usual way */
+			continue;
+
+		STARPU_PTHREAD_MUTEX_LOCK(&arg.mutex);
+		arg.pending++;
+		STARPU_PTHREAD_MUTEX_UNLOCK(&arg.mutex);
+		starpu_data_acquire_on_node_cb(handle, handle->home_node, STARPU_R, _starpu_data_unregister_array_cb, &data_args[i]);
+	}
+
+	/* And wait for them all */
+	STARPU_PTHREAD_MUTEX_LOCK(&arg.mutex);
+	arg.pending--;
+	while (arg.pending)
+		STARPU_PTHREAD_COND_WAIT(&arg.cond, &arg.mutex);
+	STARPU_PTHREAD_MUTEX_UNLOCK(&arg.mutex);
+	STARPU_PTHREAD_MUTEX_DESTROY(&arg.mutex);
+	STARPU_PTHREAD_COND_DESTROY(&arg.cond);
+
+	for (i = 0; i < n; i++)
+	{
+		starpu_data_handle_t handle = handles[i];
+		/* The batched ones are already up to date in their home node */
+		_starpu_data_unregister(handle, !_starpu_data_unregister_array_batched(handle), 0);
+	}
+
+	free(data_args);
+}
+
+/* Waits for the tasks of all the data unregistered by
+ * starpu_data_unregister_array_submit */
+static struct starpu_codelet _starpu_data_unregister_array_cl =
+{
+	.where = STARPU_NOWHERE,
+	.nbuffers = STARPU_VARIABLE_NBUFFERS,
+	.name = "data_unregister_array"
+};
+
+static void _starpu_data_unregister_array_submit_cb(void *arg)
+{
+	struct starpu_task *task = arg;
+	unsigned nbuffers = STARPU_TASK_GET_NBUFFERS(task);
+	unsigned i;
+
+	/* The data dependencies of the task are released, but some requests
+	 * may still be using the data */
+	for (i = 0; i < nbuffers; i++)
+	{
+		starpu_data_handle_t handle = STARPU_TASK_GET_HANDLE(task, i);
+		_starpu_spin_lock(&handle->header_lock);
+		if (handle->busy_count)
+		{
+			/* _starpu_data_check_not_busy will destroy it */
+			handle->lazy_unregister = 1;
+			_starpu_spin_unlock(&handle->header_lock);
+		}
+		else
+		{
+			_starpu_spin_unlock(&handle->header_lock);
+			_starpu_data_unregister(handle, 0, 1);
+		}
+	}
+}
+
+void starpu_data_unregister_array_submit(unsigned n, starpu_data_handle_t *handles)
+{
+	struct starpu_task *task;
+	unsigned i, nbuffers = 0;
+
+	if (!n)
+		return;
+
+	/* Wait for all the task dependencies on these handles with a single
+	 * task, rather than one acquisition per handle */
+	task = starpu_task_create();
+	task->name = "data_unregister_array";
+	task->cl = &_starpu_data_unregister_array_cl;
+	_STARPU_MALLOC(task->dyn_handles, n * sizeof(*task->dyn_handles));
+	_STARPU_MALLOC(task->dyn_modes, n * sizeof(*task->dyn_modes));
+
+	for (i = 0; i < n; i++)
+	{
+		starpu_data_handle_t handle = handles[i];
+		STARPU_ASSERT_MSG(handle->magic == 42, "data %p is invalid (was it already registered?)", handle);
+		STARPU_ASSERT_MSG(!handle->lazy_unregister, "data %p can not be unregistered twice", handle);
+
+		if (!_starpu_ro_data_detach(handle))
+			continue;
+
+		task->dyn_handles[nbuffers] = handle;
+		task->dyn_modes[nbuffers] = handle->initialized?STARPU_RW:STARPU_W;
+		nbuffers++;
+	}
+
+	if (!nbuffers)
+	{
+		starpu_task_destroy(task);
+		return;
+	}
+
+	task->nbuffers = nbuffers;
+	task->callback_func = _starpu_data_unregister_array_submit_cb;
+	task->callback_arg = task;
+	if (_starpu_task_submit_internally(task) != 0)
+		_STARPU_ERROR("Could not submit the unregistration task\n");
+}
+
 static void _starpu_data_invalidate(void *data)
 {
 	starpu_data_handle_t handle = data;
@@ -944,7 +1189,7 @@ static void _starpu_data_invalidate(void *data)
 		unsigned i, j, nnodes = starpu_memory_nodes_get_count();
 		for (i = 0; i < nnodes; i++)
 			for (j = 0; j < nnodes; j++)
-				STARPU_ASSERT_MSG(!handle->per_node[i].request[j], "request for handle %p pending from %u to %u while invalidating data!", handle, j, i);
+				STARPU_ASSERT_MSG(!_starpu_replicate_get_request(&handle->per_node[i], j), "request for handle %p pending from %u to %u while invalidating data!", handle, j, i);
 	}
 #endif
 
@@ -1056,6 +1301,8 @@ int starpu_data_peek_node(starpu_data_handle_t handle, unsigned node, void *ptr,
 	STARPU_ASSERT_MSG(handle->ops->peek_data, "The datatype interface %s (%d) does not have a peek operation", handle->ops->name, handle->ops->interfaceid);
 	int ret;
 	ret = handle->ops->peek_data(handle, node, ptr, count);
+	/* This may have changed the shape of the data */
+	_starpu_data_invalidate_footprints(handle);
 	return ret;
 }
 
@@ -1069,6 +1316,8 @@ int starpu_data_unpack_node(starpu_data_handle_t handle, unsigned node, void *pt
 	STARPU_ASSERT_MSG(handle->ops->unpack_data, "The datatype interface %s (%d) does not have an unpack operation", handle->ops->name, handle->ops->interfaceid);
 	int ret;
 	ret = handle->ops->unpack_data(handle, node, ptr, count);
+	/* This may have changed the shape of the data */
+	_starpu_data_invalidate_footprints(handle);
 	return ret;
 }
 
@@ -1093,6 +1342,7 @@ size_t starpu_data_get_alloc_size(starpu_data_handle_t handle)
 void starpu_data_set_name(starpu_data_handle_t handle STARPU_ATTRIBUTE_UNUSED, const char *name STARPU_ATTRIBUTE_UNUSED)
 {
 	_STARPU_TRACE_DATA_NAME(handle, name);
+	_starpu_handle_stats_set_name(handle, name);
 }
 
 int starpu_data_get_home_node(starpu_data_handle_t handle)
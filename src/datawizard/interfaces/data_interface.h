@@ -47,6 +47,16 @@ union _starpu_interface
 /** Some data interfaces or filters use this interface internally */
 extern struct starpu_data_interface_ops starpu_interface_multiformat_ops;
 
+/** Contiguous storage for the handles registered by
+ * starpu_data_register_array() and their per-node interfaces */
+struct _starpu_data_arena
+{
+	/** Number of handles of the arena which are still registered */
+	unsigned nhandles;
+	struct _starpu_data_state *handles;
+	void *interfaces;
+};
+
 void _starpu_data_free_interfaces(starpu_data_handle_t handle);
 
 extern int _starpu_data_handle_init(starpu_data_handle_t handle, struct starpu_data_interface_ops *interface_ops, unsigned int mf_node);
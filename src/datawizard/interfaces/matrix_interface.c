@@ -166,6 +166,48 @@ void starpu_matrix_data_register(starpu_data_handle_t *handleptr, int home_node,
 	starpu_matrix_data_register_allocsize(handleptr, home_node, ptr, ld, nx, ny, elemsize, nx * ny * elemsize);
 }
 
+void starpu_matrix_data_register_array(starpu_data_handle_t *handles, unsigned n, int home_node,
+				       uintptr_t *ptrs, uint32_t ld, uint32_t nx,
+				       uint32_t ny, size_t elemsize)
+{
+	STARPU_ASSERT_MSG(ld >= nx, "ld = %u should not be less than nx = %u.", ld, nx);
+	struct starpu_matrix_interface *matrix_interfaces;
+	unsigned i;
+
+	matrix_interfaces = malloc(n * sizeof(*matrix_interfaces));
+	STARPU_ASSERT_MSG(matrix_interfaces || !n, "Cannot allocate %u interfaces", n);
+	for (i = 0; i < n; i++)
+	{
+		uintptr_t ptr = ptrs ? ptrs[i] : 0;
+		struct starpu_matrix_interface matrix_interface =
+		{
+			.id = STARPU_MATRIX_INTERFACE_ID,
+			.ptr = ptr,
+			.ld = ld,
+			.nx = nx,
+			.ny = ny,
+			.elemsize = elemsize,
+			.dev_handle = ptr,
+			.offset = 0,
+			.allocsize = nx * ny * elemsize,
+		};
+#ifndef STARPU_SIMGRID
+		if (home_node >= 0 && starpu_node_get_kind(home_node) == STARPU_CPU_RAM)
+		{
+			if (nx && ny && elemsize)
+			{
+				STARPU_ASSERT_ACCESSIBLE(ptr);
+				STARPU_ASSERT_ACCESSIBLE(ptr + (ny-1)*ld*elemsize + nx*elemsize - 1);
+			}
+		}
+#endif
+		matrix_interfaces[i] = matrix_interface;
+	}
+
+	starpu_data_register_array(handles, n, home_node, matrix_interfaces, &starpu_interface_matrix_ops);
+	free(matrix_interfaces);
+}
+
 void starpu_matrix_ptr_register(starpu_data_handle_t handle, unsigned node,
 				uintptr_t ptr, uintptr_t dev_handle, size_t offset, uint32_t ld)
 {
@@ -261,18 +303,9 @@ static int pack_matrix_handle(starpu_data_handle_t handle, unsigned node, void *
 
 		char *cur = (char*) *ptr + sizeof(*header);
 
-		if (IS_CONTIGUOUS_MATRIX(nx, ny, ld))
-			memcpy(cur, matrix, nx*ny*elemsize);
-		else
-		{
-			uint32_t y;
-			for(y=0 ; y<ny ; y++)
-			{
-				memcpy(cur, matrix, nx*elemsize);
-				cur += nx*elemsize;
-				matrix += ld * elemsize;
-			}
-		}
+		starpu_interface_copy2d((uintptr_t) matrix, 0, node,
+					(uintptr_t) cur, 0, node,
+					nx*elemsize, ny, ld*elemsize, nx*elemsize, NULL);
 	}
 
 	return 0;
@@ -332,18 +365,9 @@ static int peek_matrix_handle(starpu_data_handle_t handle, unsigned node, void *
 
 	char *matrix = (void *)matrix_interface->ptr;
 
-	if (IS_CONTIGUOUS_MATRIX(nx, ny, ld))
-		memcpy(matrix, ptr, nx*ny*elemsize);
-	else
-	{
-		uint32_t y;
-		for(y=0 ; y<ny ; y++)
-		{
-			memcpy(matrix, cur, nx*elemsize);
-			cur += nx*elemsize;
-			matrix += ld * elemsize;
-		}
-	}
+	starpu_interface_copy2d((uintptr_t) cur, 0, node,
+				(uintptr_t) matrix, 0, node,
+				nx*elemsize, ny, nx*elemsize, ld*elemsize, NULL);
 
 	return 0;
 }
@@ -314,7 +314,7 @@ static size_t _get_size(uint32_t* nn, size_t ndim, size_t elemsize)
 	return size;
 }
 
-static void _pack_cpy_ndim_ptr(char *cur, char* ndptr, uint32_t* nn, uint32_t* ldn, size_t dim, size_t elemsize)
+static void _pack_cpy_ndim_ptr(char *cur, char* ndptr, uint32_t* nn, uint32_t* ldn, size_t dim, size_t elemsize, unsigned node)
 {
 	uint32_t i = dim - 1;
 	uint32_t n;
@@ -323,20 +323,26 @@ static void _pack_cpy_ndim_ptr(char *cur, char* ndptr, uint32_t* nn, uint32_t* l
 	{
 		memcpy(cur, ndptr, _get_size(nn, dim, elemsize));
 	}
+	else if (dim == 2)
+	{
+		starpu_interface_copy2d((uintptr_t) ndptr, 0, node,
+					(uintptr_t) cur, 0, node,
+					nn[0] * elemsize, nn[1], ldn[1] * elemsize, nn[0] * elemsize, NULL);
+	}
 	else
 	{
 		char *ndptr_i = ndptr;
 		size_t count = _get_size(nn, i, elemsize);
 		for(n=0; n<nn[i]; n++)
 		{
-			_pack_cpy_ndim_ptr(cur, ndptr_i, nn, ldn, dim-1, elemsize);
+			_pack_cpy_ndim_ptr(cur, ndptr_i, nn, ldn, dim-1, elemsize, node);
 			cur += count;
 			ndptr_i += ldn[i] * elemsize;
 		}
 	}
 }
 
-static void _peek_cpy_ndim_ptr(char* ndptr, char *cur, uint32_t* nn, uint32_t* ldn, size_t dim, size_t elemsize)
+static void _peek_cpy_ndim_ptr(char* ndptr, char *cur, uint32_t* nn, uint32_t* ldn, size_t dim, size_t elemsize, unsigned node)
 {
 	uint32_t i = dim - 1;
 	uint32_t n;
@@ -345,13 +351,19 @@ static void _peek_cpy_ndim_ptr(char* ndptr, char *cur, uint32_t* nn, uint32_t* l
 	{
 		memcpy(ndptr, cur, _get_size(nn, dim, elemsize));
 	}
+	else if (dim == 2)
+	{
+		starpu_interface_copy2d((uintptr_t) cur, 0, node,
+					(uintptr_t) ndptr, 0, node,
+					nn[0] * elemsize, nn[1], nn[0] * elemsize, ldn[1] * elemsize, NULL);
+	}
 	else
 	{
 		char *ndptr_i = ndptr;
 		size_t count = _get_size(nn, i, elemsize);
 		for(n=0; n<nn[i]; n++)
 		{
-			_peek_cpy_ndim_ptr(ndptr_i, cur, nn, ldn, dim-1, elemsize);
+			_peek_cpy_ndim_ptr(ndptr_i, cur, nn, ldn, dim-1, elemsize, node);
 			cur += count;
 			ndptr_i += ldn[i] * elemsize;
 		}
@@ -380,7 +392,7 @@ static int pack_ndim_handle(starpu_data_handle_t handle, unsigned node, void **p
 
 		char *cur = *ptr;
 
-		_pack_cpy_ndim_ptr(cur, ndptr, nn, ldn, ndim, elemsize);
+		_pack_cpy_ndim_ptr(cur, ndptr, nn, ldn, ndim, elemsize, node);
 	}
 
 	return 0;
@@ -403,7 +415,7 @@ static int peek_ndim_handle(starpu_data_handle_t handle, unsigned node, void *pt
 	char *cur = ptr;
 	char *ndptr = (void *)ndim_interface->ptr;
 
-	_peek_cpy_ndim_ptr(ndptr, cur, nn, ldn, ndim, elemsize);
+	_peek_cpy_ndim_ptr(ndptr, cur, nn, ldn, ndim, elemsize, node);
 
 	return 0;
 }
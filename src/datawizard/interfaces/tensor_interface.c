@@ -199,10 +199,6 @@ static void display_tensor_interface(starpu_data_handle_t handle, FILE *f)
 	fprintf(f, "%u\t%u\t%u\t%u\t", tensor_interface->nx, tensor_interface->ny, tensor_interface->nz, tensor_interface->nt);
 }
 
-#define IS_CONTIGUOUS_MATRIX(nx, ny, ldy) ((nx) == (ldy))
-#define IS_CONTIGUOUS_BLOCK(nx, ny, nz, ldy, ldz) ((nx) * (ny) == (ldz))
-#define IS_CONTIGUOUS_TENSOR(nx, ny, nz, nt, ldy, ldz, ldt) ((nx) * (ny) * (nz) == (ldt))
-
 static int pack_tensor_handle(starpu_data_handle_t handle, unsigned node, void **ptr, starpu_ssize_t *count)
 {
 	STARPU_ASSERT(starpu_data_test_if_allocated_on_node(handle, node));
@@ -223,50 +219,17 @@ static int pack_tensor_handle(starpu_data_handle_t handle, unsigned node, void *
 
 	if (ptr != NULL)
 	{
-		uint32_t t, z, y;
 		char *block = (void *)tensor_interface->ptr;
 
 		*ptr = (void *)starpu_malloc_on_node_flags(node, *count, 0);
 
 		char *cur = *ptr;
-		if (IS_CONTIGUOUS_TENSOR(nx, ny, nz, nt, ldy, ldz, ldt))
-			memcpy(cur, block, nx * ny * nz * nt * elemsize);
-		else
-		{
-			char *block_t = block;
-			for(t=0 ; t<nt ; t++)
-			{
-				if (IS_CONTIGUOUS_BLOCK(nx, ny, nz, ldy, ldz))
-				{
-					memcpy(cur, block_t, nx * ny * nz * elemsize);
-					cur += nx*ny*nz*elemsize;
-				}
-				else
-				{
-					char *block_z = block_t;
-					for(z=0 ; z<nz ; z++)
-					{
-						if (IS_CONTIGUOUS_MATRIX(nx, ny, ldy))
-						{
-							memcpy(cur, block_z, nx * ny * elemsize);
-							cur += nx*ny*elemsize;
-						}
-						else
-						{
-							char *block_y = block_z;
-							for(y=0 ; y<ny ; y++)
-							{
-								memcpy(cur, block_y, nx*elemsize);
-								cur += nx*elemsize;
-								block_y += ldy * elemsize;
-							}
-						}
-						block_z += ldz * elemsize;
-					}
-				}
-				block_t += ldt * elemsize;
-			}
-		}
+		starpu_interface_copy4d((uintptr_t) block, 0, node,
+					(uintptr_t) cur, 0, node,
+					nx*elemsize,
+					ny, ldy*elemsize, nx*elemsize,
+					nz, ldz*elemsize, nx*ny*elemsize,
+					nt, ldt*elemsize, nx*ny*nz*elemsize, NULL);
 	}
 
 	return 0;
@@ -290,48 +253,15 @@ static int peek_tensor_handle(starpu_data_handle_t handle, unsigned node, void *
 
 	STARPU_ASSERT(count == elemsize * nx * ny * nz * nt);
 
-	uint32_t t, z, y;
 	char *cur = ptr;
 	char *block = (void *)tensor_interface->ptr;
 
-	if (IS_CONTIGUOUS_TENSOR(nx, ny, nz, nt, ldy, ldz, ldt))
-		memcpy(block, cur, nx * ny * nz * nt * elemsize);
-	else
-	{
-		char *block_t = block;
-		for(t=0 ; t<nt ; t++)
-		{
-			if (IS_CONTIGUOUS_BLOCK(nx, ny, nz, ldy, ldz))
-			{
-				memcpy(block_t, cur, nx * ny * nz * elemsize);
-				cur += nx*ny*nz*elemsize;
-			}
-			else
-			{
-				char *block_z = block_t;
-				for(z=0 ; z<nz ; z++)
-				{
-					if (IS_CONTIGUOUS_MATRIX(nx, ny, ldy))
-					{
-						memcpy(block_z, cur, nx * ny * elemsize);
-						cur += nx*ny*elemsize;
-					}
-					else
-					{
-						char *block_y = block_z;
-						for(y=0 ; y<ny ; y++)
-						{
-							memcpy(block_y, cur, nx*elemsize);
-							cur += nx*elemsize;
-							block_y += ldy * elemsize;
-						}
-					}
-					block_z += ldz * elemsize;
-				}
-			}
-			block_t += ldt * elemsize;
-		}
-	}
+	starpu_interface_copy4d((uintptr_t) cur, 0, node,
+				(uintptr_t) block, 0, node,
+				nx*elemsize,
+				ny, nx*elemsize, ldy*elemsize,
+				nz, nx*ny*elemsize, ldz*elemsize,
+				nt, nx*ny*nz*elemsize, ldt*elemsize, NULL);
 
 	return 0;
 }
@@ -160,6 +160,45 @@ void starpu_vector_data_register(starpu_data_handle_t *handleptr, int home_node,
 	starpu_vector_data_register_allocsize(handleptr, home_node, ptr, nx, elemsize, nx * elemsize);
 }
 
+void starpu_vector_data_register_array(starpu_data_handle_t *handles, unsigned n, int home_node,
+				       uintptr_t *ptrs, uint32_t nx, size_t elemsize)
+{
+	struct starpu_vector_interface *vectors;
+	unsigned i;
+
+	vectors = malloc(n * sizeof(*vectors));
+	STARPU_ASSERT_MSG(vectors || !n, "Cannot allocate %u interfaces", n);
+	for (i = 0; i < n; i++)
+	{
+		uintptr_t ptr = ptrs ? ptrs[i] : 0;
+		struct starpu_vector_interface vector =
+		{
+			.id = STARPU_VECTOR_INTERFACE_ID,
+			.ptr = ptr,
+			.nx = nx,
+			.elemsize = elemsize,
+			.dev_handle = ptr,
+			.slice_base = 0,
+			.offset = 0,
+			.allocsize = nx * elemsize,
+		};
+#if (!defined(STARPU_SIMGRID) && !defined(STARPU_OPENMP))
+		if (home_node >= 0 && starpu_node_get_kind(home_node) == STARPU_CPU_RAM)
+		{
+			if (nx && elemsize)
+			{
+				STARPU_ASSERT_ACCESSIBLE(ptr);
+				STARPU_ASSERT_ACCESSIBLE(ptr + nx*elemsize - 1);
+			}
+		}
+#endif
+		vectors[i] = vector;
+	}
+
+	starpu_data_register_array(handles, n, home_node, vectors, &starpu_interface_vector_ops);
+	free(vectors);
+}
+
 void starpu_vector_ptr_register(starpu_data_handle_t handle, unsigned node,
 			uintptr_t ptr, uintptr_t dev_handle, size_t offset)
 {
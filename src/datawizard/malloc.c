@@ -34,6 +34,8 @@
 #include <sys/mman.h>
 #include <fcntl.h>
 #include <smpi/smpi.h>
+#elif defined(HAVE_MMAP)
+#include <sys/mman.h>
 #endif
 
 #ifdef STARPU_HAVE_HWLOC
@@ -57,6 +59,17 @@
 static size_t _malloc_align = sizeof(void*);
 static int disable_pinning;
 static int enable_suballocator;
+/* Huge page backing of CPU memory allocated with starpu_malloc_on_node:
+ * 0: none, 1: transparent huge pages, 2: 2MiB hugetlbfs pages, 3: also 1GiB
+ * hugetlbfs pages for allocations which are a multiple of 1GiB */
+static int malloc_hugepages;
+
+#define HUGEPAGE_SIZE (2*1024*1024)
+#define HUGEPAGE_1G_SIZE (1024*1024*1024)
+#if defined(MAP_HUGE_SHIFT) && !defined(MAP_HUGE_1GB)
+#define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#define MAP_HUGE_1GB (30 << MAP_HUGE_SHIFT)
+#endif
 
 /* This file is used for implementing "folded" allocation */
 #ifdef STARPU_SIMGRID
@@ -753,23 +766,160 @@ int starpu_free_noflag(void *A, size_t dim)
 	return starpu_free_flags(A, dim, STARPU_MALLOC_PINNED);
 }
 
+/* Return whether we allocate \p size bytes of CPU memory of \p dst_node with
+ * huge pages ourself */
+static int _starpu_malloc_use_hugepages(unsigned dst_node, size_t size, int flags)
+{
+#if defined(HAVE_MMAP) && !defined(STARPU_SIMGRID)
+	return malloc_hugepages
+		&& !malloc_hook
+		/* Smaller buffers would waste most of the page, they
+		 * are rather suballocated in chunks, see below */
+		&& size >= HUGEPAGE_SIZE
+		/* Only data buffers accounted in the memory node, temporary
+		 * buffers (e.g. for packing) may be released with
+		 * _starpu_free_flags_on_node, which uses the system allocator */
+		&& (flags & STARPU_MALLOC_COUNT)
+		&& starpu_node_get_kind(dst_node) == STARPU_CPU_RAM
+		/* Pinned memory has to come from the GPU driver */
+		&& !(_starpu_malloc_should_pin(flags) && STARPU_RUNNING_ON_VALGRIND == 0);
+#else
+	(void) dst_node;
+	(void) size;
+	(void) flags;
+	return 0;
+#endif
+}
+
+#if defined(HAVE_MMAP) && !defined(STARPU_SIMGRID)
+static size_t _starpu_hugepages_size(size_t size)
+{
+#ifdef MAP_HUGE_1GB
+	if (malloc_hugepages >= 3 && !(size % HUGEPAGE_1G_SIZE))
+		return size;
+#endif
+	return (size + HUGEPAGE_SIZE - 1) & ~((size_t) HUGEPAGE_SIZE - 1);
+}
+
+/* Allocate \p size bytes backed by huge pages, bound to the NUMA node of
+ * \p dst_node */
+static void *_starpu_malloc_hugepages(unsigned dst_node, size_t size)
+{
+	size_t mapped = _starpu_hugepages_size(size);
+	void *A = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+	if (malloc_hugepages >= 2)
+	{
+		static int warned;
+		int hugeflags = MAP_HUGETLB;
+#ifdef MAP_HUGE_1GB
+		if (mapped == size && !(size % HUGEPAGE_1G_SIZE) && malloc_hugepages >= 3)
+			hugeflags |= MAP_HUGE_1GB;
+		else
+			hugeflags |= MAP_HUGE_2MB;
+#endif
+		A = mmap(NULL, mapped, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS|hugeflags, -1, 0);
+		if (A == MAP_FAILED && !warned)
+		{
+			_STARPU_DISP("Warning: could not allocate %luMiB with hugetlbfs pages (%s), falling back to transparent huge pages. Perhaps /proc/sys/vm/nr_hugepages needs to be increased\n", (unsigned long) (mapped >> 20), strerror(errno));
+			warned = 1;
+		}
+	}
+#endif
+
+	if (A == MAP_FAILED)
+	{
+		/* Transparent huge pages, align the area on a huge page
+		 * boundary so that it can be completely backed by huge pages */
+		mapped = (size + HUGEPAGE_SIZE - 1) & ~((size_t) HUGEPAGE_SIZE - 1);
+		size_t total = mapped + HUGEPAGE_SIZE;
+		char *raw = mmap(NULL, total, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+		if (raw == MAP_FAILED)
+			return NULL;
+		char *aligned = (char *) (((uintptr_t) raw + HUGEPAGE_SIZE - 1) & ~((uintptr_t) HUGEPAGE_SIZE - 1));
+		if (aligned != raw)
+			munmap(raw, aligned - raw);
+		if (raw + total != aligned + mapped)
+			munmap(aligned + mapped, (raw + total) - (aligned + mapped));
+		A = aligned;
+#ifdef MADV_HUGEPAGE
+		madvise(A, mapped, MADV_HUGEPAGE);
+#endif
+	}
+
+#ifdef STARPU_HAVE_HWLOC
+	/* Bind before the first touch */
+	if (starpu_memory_nodes_get_numa_count() > 1)
+	{
+		struct _starpu_machine_config *config = _starpu_get_machine_config();
+		hwloc_topology_t hwtopology = config->topology.hwtopology;
+		hwloc_obj_t numa_node_obj = hwloc_get_obj_by_type(hwtopology, HWLOC_OBJ_NUMANODE, starpu_memory_nodes_numa_id_to_hwloclogid(dst_node));
+		if (numa_node_obj)
+		{
+			hwloc_bitmap_t nodeset = numa_node_obj->nodeset;
+#if HWLOC_API_VERSION >= 0x00020000
+			hwloc_set_area_membind(hwtopology, A, mapped, nodeset, HWLOC_MEMBIND_BIND, HWLOC_MEMBIND_BYNODESET | HWLOC_MEMBIND_NOCPUBIND);
+#else
+			hwloc_set_area_membind_nodeset(hwtopology, A, mapped, nodeset, HWLOC_MEMBIND_BIND, HWLOC_MEMBIND_NOCPUBIND);
+#endif
+		}
+	}
+#else
+	(void) dst_node;
+#endif
+
+	return A;
+}
+
+static void _starpu_free_hugepages(void *A, size_t size)
+{
+	size_t mapped = _starpu_hugepages_size(size);
+	/* This is the same size whether the allocation got hugetlbfs pages or
+	 * fell back to transparent huge pages */
+	munmap(A, mapped);
+}
+#endif
+
+/* Size to account in the memory node for allocating \p size bytes. Huge page
+ * mappings are rounded up, and other allocations can not use the rounding */
+static size_t _starpu_malloc_accounted_size(size_t size, int hugepages)
+{
+#if defined(HAVE_MMAP) && !defined(STARPU_SIMGRID)
+	if (hugepages)
+		return _starpu_hugepages_size(size);
+#else
+	(void) hugepages;
+#endif
+	return size;
+}
+
 static uintptr_t _starpu_malloc_on_node(unsigned dst_node, size_t size, int flags)
 {
 	uintptr_t addr = 0;
+	int hugepages;
+	size_t accounted;
 
 	if (size == 0)
 		size = 1;
+	hugepages = _starpu_malloc_use_hugepages(dst_node, size, flags);
+	accounted = _starpu_malloc_accounted_size(size, hugepages);
 
 	/* Handle count first */
 	if (flags & STARPU_MALLOC_COUNT)
 	{
-		if (starpu_memory_allocate(dst_node, size, flags) != 0)
+		if (starpu_memory_allocate(dst_node, accounted, flags) != 0)
 			return 0;
 		/* And prevent double-count in starpu_malloc_flags */
 		flags &= ~STARPU_MALLOC_COUNT;
 	}
 
 	const struct _starpu_node_ops *node_ops = _starpu_memory_node_get_node_ops(dst_node);
+#if defined(HAVE_MMAP) && !defined(STARPU_SIMGRID)
+	if (hugepages)
+		addr = (uintptr_t) _starpu_malloc_hugepages(dst_node, size);
+	else
+#endif
 	if (node_ops && node_ops->malloc_on_device)
 	{
 		int devid = starpu_memory_node_get_devid(dst_node);
@@ -781,9 +931,9 @@ static uintptr_t _starpu_malloc_on_node(unsigned dst_node, size_t size, int flag
 	if (addr == 0)
 	{
 		// Allocation failed, gives the memory back to the memory manager
-		_STARPU_TRACE_MEMORY_FULL(size);
+		_STARPU_TRACE_MEMORY_FULL(accounted);
 		if (flags & STARPU_MALLOC_COUNT)
-			starpu_memory_deallocate(dst_node, size);
+			starpu_memory_deallocate(dst_node, accounted);
 	}
 	return addr;
 }
@@ -791,12 +941,19 @@ static uintptr_t _starpu_malloc_on_node(unsigned dst_node, size_t size, int flag
 void _starpu_free_on_node_flags(unsigned dst_node, uintptr_t addr, size_t size, int flags)
 {
 	int count = flags & STARPU_MALLOC_COUNT;
-	flags &= ~STARPU_MALLOC_COUNT;
+	int hugepages;
 
 	if (size == 0)
 		size = 1;
+	hugepages = _starpu_malloc_use_hugepages(dst_node, size, flags);
+	flags &= ~STARPU_MALLOC_COUNT;
 
 	const struct _starpu_node_ops *node_ops = _starpu_memory_node_get_node_ops(dst_node);
+#if defined(HAVE_MMAP) && !defined(STARPU_SIMGRID)
+	if (hugepages)
+		_starpu_free_hugepages((void *) addr, size);
+	else
+#endif
 	if (node_ops && node_ops->free_on_device)
 	{
 		int devid = starpu_memory_node_get_devid(dst_node);
@@ -806,7 +963,7 @@ void _starpu_free_on_node_flags(unsigned dst_node, uintptr_t addr, size_t size,
 		STARPU_ABORT_MSG("No free_on_device function defined for node %s\n", _starpu_node_get_prefix(starpu_node_get_kind(dst_node)));
 
 	if (count)
-		starpu_memory_deallocate(dst_node, size);
+		starpu_memory_deallocate(dst_node, _starpu_malloc_accounted_size(size, hugepages));
 }
 
 int
@@ -849,9 +1006,11 @@ _starpu_malloc_init(unsigned dst_node)
 	struct _starpu_node *node_struct = _starpu_get_node_struct(dst_node);
 	_starpu_chunk_list_init(&node_struct->chunks);
 	node_struct->nfreechunks = 0;
+	memset(node_struct->magazines, 0, sizeof(node_struct->magazines));
 	STARPU_PTHREAD_MUTEX_INIT(&node_struct->chunk_mutex, NULL);
 	disable_pinning = starpu_getenv_number("STARPU_DISABLE_PINNING");
 	enable_suballocator = starpu_getenv_number_default("STARPU_SUBALLOCATOR", 1);
+	malloc_hugepages = starpu_getenv_number_default("STARPU_MALLOC_HUGEPAGES", 0);
 	node_struct->malloc_on_node_default_flags = STARPU_MALLOC_PINNED | STARPU_MALLOC_COUNT;
 #ifdef STARPU_SIMGRID
 	/* Reasonably "costless" */
@@ -864,6 +1023,7 @@ _starpu_malloc_shutdown(unsigned dst_node)
 {
 	struct _starpu_node *node_struct = _starpu_get_node_struct(dst_node);
 	struct _starpu_chunk *chunk, *next_chunk;
+	unsigned worker;
 
 	STARPU_PTHREAD_MUTEX_LOCK(&node_struct->chunk_mutex);
 	for (chunk = _starpu_chunk_list_begin(&node_struct->chunks);
@@ -871,10 +1031,20 @@ _starpu_malloc_shutdown(unsigned dst_node)
 	     chunk = next_chunk)
 	{
 		next_chunk = _starpu_chunk_list_next(chunk);
-		_starpu_free_on_node_flags(dst_node, chunk->base, CHUNK_SIZE, node_struct->malloc_on_node_default_flags);
+		_starpu_free_on_node_flags(dst_node, chunk->base, CHUNK_SIZE, chunk->flags);
 		_starpu_chunk_list_erase(&node_struct->chunks, chunk);
 		free(chunk);
 	}
+	/* The blocks of the magazines were in the chunks */
+	for (worker = 0; worker < STARPU_NMAXWORKERS; worker++)
+	{
+		struct _starpu_magazine *magazine = node_struct->magazines[worker];
+		if (!magazine)
+			continue;
+		_starpu_spin_destroy(&magazine->lock);
+		free(magazine);
+		node_struct->magazines[worker] = NULL;
+	}
 	STARPU_PTHREAD_MUTEX_UNLOCK(&node_struct->chunk_mutex);
 	STARPU_PTHREAD_MUTEX_DESTROY(&node_struct->chunk_mutex);
 }
@@ -891,6 +1061,7 @@ static struct _starpu_chunk *_starpu_new_chunk(unsigned dst_node, int flags)
 	/* Create a new chunk */
 	chunk = _starpu_chunk_new();
 	chunk->base = base;
+	chunk->flags = CHUNK_FLAGS(flags);
 
 	/* First block is just a fake block pointing to the free segments list */
 	chunk->bitmap[0].length = 0;
@@ -905,6 +1076,17 @@ static struct _starpu_chunk *_starpu_new_chunk(unsigned dst_node, int flags)
 	return chunk;
 }
 
+/* Return whether main memory allocated with huge pages should be
+ * suballocated. This is not worth it when the memory of the node is limited
+ * to a few chunks */
+static int _starpu_malloc_should_suballoc_hugepages(unsigned dst_node, int flags)
+{
+	if (!_starpu_malloc_use_hugepages(dst_node, CHUNK_SIZE, flags))
+		return 0;
+	starpu_ssize_t total = starpu_memory_get_total(dst_node);
+	return total < 0 || total >= 16 * (starpu_ssize_t) CHUNK_SIZE;
+}
+
 /* Return whether we should use our suballocator */
 static int _starpu_malloc_should_suballoc(unsigned dst_node, size_t size, int flags)
 {
@@ -913,37 +1095,29 @@ static int _starpu_malloc_should_suballoc(unsigned dst_node, size_t size, int fl
 		(starpu_node_get_kind(dst_node) == STARPU_CUDA_RAM
 		 || starpu_node_get_kind(dst_node) == STARPU_HIP_RAM
 		 || (starpu_node_get_kind(dst_node) == STARPU_CPU_RAM
-		     && _starpu_malloc_should_pin(flags))
+		     && (_starpu_malloc_should_pin(flags)
+			 || _starpu_malloc_should_suballoc_hugepages(dst_node, flags)))
 		 )))
 	       || starpu_node_get_kind(dst_node) == STARPU_MAX_FPGA_RAM;
 }
 
-uintptr_t
-starpu_malloc_on_node_flags(unsigned dst_node, size_t size, int flags)
+/* Allocate \p nblocks blocks from the chunks of \p dst_node, and from a new
+ * chunk if \p grow is set, called with chunk_mutex held */
+static uintptr_t _starpu_chunk_alloc(struct _starpu_node *node_struct, unsigned dst_node, int nblocks, int flags, int grow)
 {
-	/* Big allocation, allocate normally */
-	if (!_starpu_malloc_should_suballoc(dst_node, size, flags))
-		return _starpu_malloc_on_node(dst_node, size, flags);
-
-	struct _starpu_node *node_struct = _starpu_get_node_struct(dst_node);
-
-	/* Round up allocation to block size */
-	int nblocks = (size + CHUNK_ALLOC_MIN - 1) / CHUNK_ALLOC_MIN;
-	if (!nblocks)
-		nblocks = 1;
-
 	struct _starpu_chunk *chunk;
 	int prevblock, block;
 	int available_max;
 	struct block *bitmap;
 
-	STARPU_PTHREAD_MUTEX_LOCK(&node_struct->chunk_mutex);
-
 	/* Try to find a big enough segment among the chunks */
 	for (chunk = _starpu_chunk_list_begin(&node_struct->chunks);
 	     chunk != _starpu_chunk_list_end(&node_struct->chunks);
 	     chunk = _starpu_chunk_list_next(chunk))
 	{
+		if (chunk->flags != CHUNK_FLAGS(flags))
+			/* Not the same kind of memory */
+			continue;
 		if (chunk->available_max < nblocks)
 			continue;
 
@@ -980,15 +1154,14 @@ starpu_malloc_on_node_flags(unsigned dst_node, size_t size, int flags)
 		chunk->available_max = available_max;
 	}
 
+	if (!grow)
+		return 0;
+
 	/* Didn't find a big enough segment, create another chunk.  */
 	chunk = _starpu_new_chunk(dst_node, flags);
 	if (!chunk)
-	{
 		/* Really no memory any more, fail */
-		STARPU_PTHREAD_MUTEX_UNLOCK(&node_struct->chunk_mutex);
-		errno = ENOMEM;
 		return 0;
-	}
 
 	/* And make it easy to find. */
 	_starpu_chunk_list_push_front(&node_struct->chunks, chunk);
@@ -1015,30 +1188,15 @@ found:
 		bitmap[block + nblocks].next = bitmap[block].next;
 	}
 
-	STARPU_PTHREAD_MUTEX_UNLOCK(&node_struct->chunk_mutex);
-
 	return chunk->base + (block-1) * CHUNK_ALLOC_MIN;
 }
 
-void
-starpu_free_on_node_flags(unsigned dst_node, uintptr_t addr, size_t size, int flags)
+/* Give back \p nblocks blocks at \p addr to the chunks of \p dst_node, called
+ * with chunk_mutex held */
+static void _starpu_chunk_free(struct _starpu_node *node_struct, unsigned dst_node, uintptr_t addr, size_t size, int nblocks)
 {
-	/* Big allocation, deallocate normally */
-	if (!_starpu_malloc_should_suballoc(dst_node, size, flags))
-	{
-		_starpu_free_on_node_flags(dst_node, addr, size, flags);
-		return;
-	}
-
-	struct _starpu_node *node_struct = _starpu_get_node_struct(dst_node);
 	struct _starpu_chunk *chunk;
 
-	/* Round up allocation to block size */
-	int nblocks = (size + CHUNK_ALLOC_MIN - 1) / CHUNK_ALLOC_MIN;
-	if (!nblocks)
-		nblocks = 1;
-
-	STARPU_PTHREAD_MUTEX_LOCK(&node_struct->chunk_mutex);
 	for (chunk = _starpu_chunk_list_begin(&node_struct->chunks);
 	     chunk != _starpu_chunk_list_end(&node_struct->chunks);
 	     chunk = _starpu_chunk_list_next(chunk))
@@ -1100,7 +1258,7 @@ starpu_free_on_node_flags(unsigned dst_node, uintptr_t addr, size_t size, int fl
 		     starpu_node_get_kind(dst_node) != STARPU_MAX_FPGA_RAM)
 		{
 			/* We already have free chunks, release this one */
-			_starpu_free_on_node_flags(dst_node, chunk->base, CHUNK_SIZE, flags);
+			_starpu_free_on_node_flags(dst_node, chunk->base, CHUNK_SIZE, chunk->flags);
 			_starpu_chunk_list_erase(&node_struct->chunks, chunk);
 			free(chunk);
 		}
@@ -1113,7 +1271,176 @@ starpu_free_on_node_flags(unsigned dst_node, uintptr_t addr, size_t size, int fl
 		_starpu_chunk_list_erase(&node_struct->chunks, chunk);
 		_starpu_chunk_list_push_front(&node_struct->chunks, chunk);
 	}
+}
+
+/* Give back to the chunks the blocks of a magazine which are above \p keep
+ * entries, called with both the magazine lock and chunk_mutex held */
+static void _starpu_magazine_drain(struct _starpu_node *node_struct, unsigned dst_node, struct _starpu_magazine *magazine, int class, int keep)
+{
+	int nblocks = class + 1;
+	while (magazine->nfree[class] > keep)
+	{
+		uintptr_t addr = magazine->free[class][--magazine->nfree[class]];
+		_starpu_chunk_free(node_struct, dst_node, addr, nblocks * CHUNK_ALLOC_MIN, nblocks);
+	}
+}
+
+/* Give back all the blocks kept in the magazines of \p dst_node, called with
+ * chunk_mutex held */
+static void _starpu_magazines_flush(struct _starpu_node *node_struct, unsigned dst_node)
+{
+	unsigned worker;
+	int class;
+
+	for (worker = 0; worker < STARPU_NMAXWORKERS; worker++)
+	{
+		struct _starpu_magazine *magazine = node_struct->magazines[worker];
+		if (!magazine)
+			continue;
+		_starpu_spin_lock(&magazine->lock);
+		for (class = 0; class < MAGAZINE_NCLASSES; class++)
+			_starpu_magazine_drain(node_struct, dst_node, magazine, class, 0);
+		_starpu_spin_unlock(&magazine->lock);
+	}
+}
+
+/* Return the magazine of the current worker for \p dst_node, or NULL if
+ * the current thread is not a worker or its magazine keeps blocks allocated
+ * with other \p flags */
+static struct _starpu_magazine *_starpu_magazine_get(struct _starpu_node *node_struct, int flags)
+{
+	int workerid = starpu_worker_get_id();
+	struct _starpu_magazine *magazine;
+
+	if (workerid < 0)
+		return NULL;
+
+	magazine = node_struct->magazines[workerid];
+	if (STARPU_UNLIKELY(!magazine))
+	{
+		_STARPU_CALLOC(magazine, 1, sizeof(*magazine));
+		_starpu_spin_init(&magazine->lock);
+		/* Applications usually use the same flags for all their data */
+		magazine->flags = CHUNK_FLAGS(flags);
+		/* Only this worker creates its magazine, flushes just need
+		 * to see it completely initialized */
+		STARPU_WMB();
+		node_struct->magazines[workerid] = magazine;
+	}
+	else if (magazine->flags != CHUNK_FLAGS(flags))
+		return NULL;
+	return magazine;
+}
+
+uintptr_t
+starpu_malloc_on_node_flags(unsigned dst_node, size_t size, int flags)
+{
+	/* Big allocation, allocate normally */
+	if (!_starpu_malloc_should_suballoc(dst_node, size, flags))
+		return _starpu_malloc_on_node(dst_node, size, flags);
+
+	struct _starpu_node *node_struct = _starpu_get_node_struct(dst_node);
+	struct _starpu_magazine *magazine = NULL;
+	uintptr_t addr;
+
+	/* Round up allocation to block size */
+	int nblocks = (size + CHUNK_ALLOC_MIN - 1) / CHUNK_ALLOC_MIN;
+	if (!nblocks)
+		nblocks = 1;
+	int class = nblocks - 1;
+
+	if (nblocks <= MAGAZINE_NCLASSES)
+		magazine = _starpu_magazine_get(node_struct, flags);
+
+	if (magazine)
+	{
+		/* Fast path: reuse a block recently freed by this worker.
+		 * The lock is only ever contended by flushes */
+		_starpu_spin_lock(&magazine->lock);
+		if (magazine->nfree[class])
+		{
+			addr = magazine->free[class][--magazine->nfree[class]];
+			_starpu_spin_unlock(&magazine->lock);
+			return addr;
+		}
+		_starpu_spin_unlock(&magazine->lock);
+	}
+
+	STARPU_PTHREAD_MUTEX_LOCK(&node_struct->chunk_mutex);
+	addr = _starpu_chunk_alloc(node_struct, dst_node, nblocks, flags, 1);
+	if (!addr)
+	{
+		/* Some memory may be sleeping in magazines, get it back */
+		_starpu_magazines_flush(node_struct, dst_node);
+		addr = _starpu_chunk_alloc(node_struct, dst_node, nblocks, flags, 1);
+	}
+	else if (magazine)
+	{
+		/* Refill half of the magazine while we hold the lock */
+		int refill = MAGAZINE_CAPACITY(class) / 2;
+		_starpu_spin_lock(&magazine->lock);
+		while (magazine->nfree[class] < refill)
+		{
+			/* But do not allocate new chunks just for this */
+			uintptr_t more = _starpu_chunk_alloc(node_struct, dst_node, nblocks, flags, 0);
+			if (!more)
+				break;
+			magazine->free[class][magazine->nfree[class]++] = more;
+		}
+		_starpu_spin_unlock(&magazine->lock);
+	}
+	STARPU_PTHREAD_MUTEX_UNLOCK(&node_struct->chunk_mutex);
+
+	if (!addr)
+		errno = ENOMEM;
+	return addr;
+}
+
+void
+starpu_free_on_node_flags(unsigned dst_node, uintptr_t addr, size_t size, int flags)
+{
+	/* Big allocation, deallocate normally */
+	if (!_starpu_malloc_should_suballoc(dst_node, size, flags))
+	{
+		_starpu_free_on_node_flags(dst_node, addr, size, flags);
+		return;
+	}
+
+	struct _starpu_node *node_struct = _starpu_get_node_struct(dst_node);
+	struct _starpu_magazine *magazine = NULL;
 
+	/* Round up allocation to block size */
+	int nblocks = (size + CHUNK_ALLOC_MIN - 1) / CHUNK_ALLOC_MIN;
+	if (!nblocks)
+		nblocks = 1;
+	int class = nblocks - 1;
+
+	if (nblocks <= MAGAZINE_NCLASSES)
+		magazine = _starpu_magazine_get(node_struct, flags);
+
+	if (magazine)
+	{
+		/* Fast path: keep the block for the next allocations of this
+		 * worker */
+		_starpu_spin_lock(&magazine->lock);
+		if (magazine->nfree[class] < MAGAZINE_CAPACITY(class))
+		{
+			magazine->free[class][magazine->nfree[class]++] = addr;
+			_starpu_spin_unlock(&magazine->lock);
+			return;
+		}
+		_starpu_spin_unlock(&magazine->lock);
+	}
+
+	STARPU_PTHREAD_MUTEX_LOCK(&node_struct->chunk_mutex);
+	_starpu_chunk_free(node_struct, dst_node, addr, size, nblocks);
+	if (magazine)
+	{
+		/* Magazine is full, flush half of it */
+		_starpu_spin_lock(&magazine->lock);
+		_starpu_magazine_drain(node_struct, dst_node, magazine, class, MAGAZINE_CAPACITY(class) / 2);
+		_starpu_spin_unlock(&magazine->lock);
+	}
 	STARPU_PTHREAD_MUTEX_UNLOCK(&node_struct->chunk_mutex);
 }
 
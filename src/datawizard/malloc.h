@@ -17,6 +17,8 @@
 #ifndef __ALLOC_H__
 #define __ALLOC_H__
 
+#include <common/starpu_spinlock.h>
+
 #pragma GCC visibility push(hidden)
 
 /** @file */
@@ -70,6 +72,37 @@ int _starpu_malloc_willpin_on_node(unsigned dst_node);
 /* Number of blocks */
 #define CHUNK_NBLOCKS (CHUNK_SIZE/CHUNK_ALLOC_MIN)
 
+/*
+ * To avoid contending on the chunks of a node, each worker keeps a magazine
+ * of the blocks it recently freed, sorted by size class, i.e. number of
+ * blocks. Allocations first look there, and the chunks are only touched to
+ * refill or flush the magazine.
+ */
+
+/* Allocation flags which make a difference for chunks, e.g. pinned chunks and
+ * huge-page chunks can not be mixed */
+#define CHUNK_FLAGS(flags) ((int) ((flags) & ~STARPU_MALLOC_NORECLAIM))
+
+/* Allocations of up to this many blocks go through the magazines */
+#define MAGAZINE_NCLASSES 8
+
+/* Amount of memory kept in each class of a magazine */
+#define MAGAZINE_BYTES (512*1024)
+
+/* Number of segments kept in a magazine class */
+#define MAGAZINE_MAX (MAGAZINE_BYTES / CHUNK_ALLOC_MIN)
+#define MAGAZINE_CAPACITY(class) (MAGAZINE_MAX / ((class) + 1))
+
+struct _starpu_magazine
+{
+	/* Only taken by the owning worker, and when flushing all magazines */
+	struct _starpu_spinlock lock;
+	/* Allocation flags of the blocks kept in this magazine */
+	int flags;
+	int nfree[MAGAZINE_NCLASSES];
+	uintptr_t free[MAGAZINE_NCLASSES][MAGAZINE_MAX];
+};
+
 /* Linked list for available segments */
 struct block
 {
@@ -81,6 +114,10 @@ struct block
 LIST_TYPE(_starpu_chunk,
 	uintptr_t base;
 
+	/* Flags the chunk was allocated with, only blocks allocated with the
+	 * same flags can be taken from it, see CHUNK_FLAGS */
+	int flags;
+
 	/* Available number of blocks, for debugging */
 	int available;
 
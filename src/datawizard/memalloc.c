@@ -698,6 +698,7 @@ static size_t try_to_throw_mem_chunk(struct _starpu_mem_chunk *mc, unsigned node
 						if (handle->per_node[node].refcnt == 0)
 						{
 							/* And still nobody on it, now the actual buffer may be reused or freed */
+							_starpu_handle_stats_eviction(handle);
 							if (replicate)
 							{
 								/* Reuse for this replicate */
@@ -886,7 +887,7 @@ static int try_to_reuse_potentially_in_use_mc(unsigned node, starpu_data_handle_
 
 		if (victim)
 		{
-			uint32_t victim_footprint = _starpu_compute_data_alloc_footprint(victim);
+			uint32_t victim_footprint = _starpu_data_get_alloc_footprint(victim);
 			if (victim_footprint != footprint)
 			{
 				/* Don't even bother looking for it, it won't fit anyway */
@@ -1425,7 +1426,7 @@ static struct _starpu_mem_chunk *_starpu_memchunk_init(struct _starpu_data_repli
 	STARPU_ASSERT(handle->ops);
 
 	mc->data = handle;
-	mc->footprint = _starpu_compute_data_alloc_footprint(handle);
+	mc->footprint = _starpu_data_get_alloc_footprint(handle);
 	mc->ops = handle->ops;
 	mc->automatically_allocated = automatically_allocated;
 	mc->relaxed_coherency = replicate->relaxed_coherency;
@@ -1572,7 +1573,7 @@ static starpu_ssize_t _starpu_allocate_interface(starpu_data_handle_t handle, st
 	_starpu_data_allocation_inc_stats(dst_node);
 
 	/* perhaps we can directly reuse a buffer in the free-list */
-	uint32_t footprint = _starpu_compute_data_alloc_footprint(handle);
+	uint32_t footprint = _starpu_data_get_alloc_footprint(handle);
 
 	int prefetch_oom = is_prefetch && node_struct->prefetch_out_of_memory;
 
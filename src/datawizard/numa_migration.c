@@ -0,0 +1,261 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+/*
+ * When the tasks accessing a data registered by the application keep running
+ * on another NUMA node than the one holding the application buffer, we keep
+ * paying for a replicate on that node, and for the transfers between both.
+ * Since all CPU NUMA nodes share the same address space, we can instead ask
+ * the kernel to move the pages of the application buffer to that node, and
+ * make it the new home node of the data, without changing its address.
+ *
+ * We count the accesses from the same remote node which miss the data, and
+ * migrate once STARPU_NUMA_MIGRATE of them happened without any access from
+ * the home node or from another node in between.
+ *
+ * Only the placement of the pages changes, so even if the interface has
+ * several buffers, or a leading dimension, migrating only the area returned
+ * by to_pointer is still correct.
+ */
+
+#include <datawizard/numa_migration.h>
+#include <datawizard/coherency.h>
+#include <datawizard/datastats.h>
+#include <datawizard/memory_nodes.h>
+#include <datawizard/memalloc.h>
+#include <core/workers.h>
+
+#ifdef STARPU_HAVE_HWLOC
+#include <hwloc.h>
+#if HWLOC_API_VERSION < 0x00010b00
+#define HWLOC_OBJ_NUMANODE HWLOC_OBJ_NODE
+#endif
+#endif
+
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+unsigned _starpu_numa_migrate_threshold;
+
+void _starpu_numa_migration_init(void)
+{
+	_starpu_numa_migrate_threshold = 0;
+#if defined(STARPU_HAVE_HWLOC) && defined(HAVE_UNISTD_H) && !defined(STARPU_SIMGRID)
+	int threshold = starpu_getenv_number_default("STARPU_NUMA_MIGRATE", 0);
+	if (threshold > 0 && starpu_memory_nodes_get_numa_count() > 1)
+		_starpu_numa_migrate_threshold = threshold;
+#endif
+}
+
+#if defined(STARPU_HAVE_HWLOC) && defined(HAVE_UNISTD_H) && !defined(STARPU_SIMGRID)
+/* Move the pages of \p ptr to memory node \p node. Only the pages which are
+ * completely covered by the buffer are moved, not to drag along neighbouring
+ * data */
+static int _starpu_numa_migrate_pages(void *ptr, size_t size, unsigned node)
+{
+	struct _starpu_machine_config *config = _starpu_get_machine_config();
+	hwloc_topology_t hwtopology = config->topology.hwtopology;
+	hwloc_obj_t numa_node_obj = hwloc_get_obj_by_type(hwtopology, HWLOC_OBJ_NUMANODE, starpu_memory_nodes_numa_id_to_hwloclogid(node));
+	uintptr_t pagesize = sysconf(_SC_PAGESIZE);
+	uintptr_t start = ((uintptr_t) ptr + pagesize - 1) & ~(pagesize - 1);
+	uintptr_t end = ((uintptr_t) ptr + size) & ~(pagesize - 1);
+	int ret;
+
+	if (!numa_node_obj || end <= start)
+		return -EINVAL;
+
+#if HWLOC_API_VERSION >= 0x00020000
+	ret = hwloc_set_area_membind(hwtopology, (void *) start, end - start, numa_node_obj->nodeset, HWLOC_MEMBIND_BIND, HWLOC_MEMBIND_BYNODESET | HWLOC_MEMBIND_MIGRATE | HWLOC_MEMBIND_NOCPUBIND);
+#else
+	ret = hwloc_set_area_membind_nodeset(hwtopology, (void *) start, end - start, numa_node_obj->nodeset, HWLOC_MEMBIND_BIND, HWLOC_MEMBIND_MIGRATE | HWLOC_MEMBIND_NOCPUBIND);
+#endif
+	return ret;
+}
+
+/* Whether the home buffer of \p handle can be moved to another node */
+static int _starpu_numa_migration_possible(starpu_data_handle_t handle, unsigned home, unsigned node)
+{
+	struct _starpu_data_replicate *src = &handle->per_node[home];
+	struct _starpu_data_replicate *dst = &handle->per_node[node];
+	unsigned nnodes = starpu_memory_nodes_get_count();
+	unsigned n, m;
+
+	/* Only application buffers, the memory allocated by StarPU is accounted
+	 * per node */
+	if (!src->allocated || src->automatically_allocated || src->mc || src->state == STARPU_INVALID)
+		return 0;
+	if (dst->state != STARPU_INVALID || (dst->allocated && !dst->automatically_allocated) || dst->mapped != STARPU_UNMAPPED)
+		return 0;
+
+	/* Nobody should be using it, and its layout should not be shared with
+	 * other handles. busy_count is not checked since it includes the
+	 * references of the task which is accessing it */
+	if (src->refcnt || dst->refcnt
+		|| handle->father_handle || handle->nchildren
+		|| handle->reduction_refcnt || handle->per_worker
+		|| handle->ops->interfaceid == STARPU_MULTIFORMAT_INTERFACE_ID)
+		return 0;
+
+	for (n = 0; n < nnodes; n++)
+	{
+		if (handle->per_node[n].mapped != STARPU_UNMAPPED)
+			return 0;
+		/* Nor being transferred */
+		for (m = 0; m < STARPU_MAXNODES; m++)
+			if (_starpu_replicate_get_request(&handle->per_node[n], m))
+				return 0;
+	}
+
+	return 1;
+}
+
+/* Make \p node the home node of \p handle, once the pages of its buffer
+ * were moved there */
+static void _starpu_numa_migrate_home(starpu_data_handle_t handle, unsigned home, unsigned node, size_t size)
+{
+	struct _starpu_data_replicate *src = &handle->per_node[home];
+	struct _starpu_data_replicate *dst = &handle->per_node[node];
+
+	/* Drop the stale replicate which was allocated there */
+	if (dst->allocated)
+		_starpu_request_mem_chunk_removal(handle, dst, node, size);
+
+	/* The application buffer now lives on node, just move its description */
+	memcpy(dst->data_interface, src->data_interface, handle->ops->interface_size);
+	dst->allocated = 1;
+	dst->automatically_allocated = 0;
+	dst->initialized = src->initialized;
+	dst->state = src->state;
+	if (dst->state == STARPU_OWNER)
+		_STARPU_TRACE_DATA_STATE_OWNER(handle, node);
+	else
+		_STARPU_TRACE_DATA_STATE_SHARED(handle, node);
+
+	src->state = STARPU_INVALID;
+	src->allocated = 0;
+	src->initialized = 0;
+	_STARPU_TRACE_DATA_STATE_INVALID(handle, home);
+
+	handle->home_node = node;
+
+	_starpu_numa_migration_inc_stats(home, node, size);
+}
+#endif
+
+int _starpu_numa_migration_perform(starpu_data_handle_t handle, int node)
+{
+#if defined(STARPU_HAVE_HWLOC) && defined(HAVE_UNISTD_H) && !defined(STARPU_SIMGRID)
+	unsigned home = handle->home_node;
+	void *ptr = starpu_data_handle_to_pointer(handle, home);
+	size_t size = _starpu_data_get_alloc_size(handle);
+	int ret = 0;
+
+	_starpu_spin_checklocked(&handle->header_lock);
+	STARPU_ASSERT(handle->numa_migrating);
+
+	if (ptr && size)
+	{
+		/* Moving the pages takes time, let the other accessors
+		 * proceed meanwhile, the kernel keeps the content coherent */
+		_starpu_spin_unlock(&handle->header_lock);
+		int migrated = _starpu_numa_migrate_pages(ptr, size, node);
+		int err = errno;
+		_starpu_spin_lock(&handle->header_lock);
+
+		if (migrated < 0)
+		{
+			static int warned;
+			if (!warned)
+			{
+				_STARPU_DISP("Warning: could not migrate pages to NUMA node %d (%s), disabling NUMA migration\n", node, strerror(err));
+				warned = 1;
+			}
+			_starpu_numa_migrate_threshold = 0;
+		}
+		/* Somebody may have started using it in the meanwhile, then
+		 * only the pages have moved, which does not harm */
+		else if (_starpu_numa_migration_possible(handle, home, node))
+		{
+			_starpu_numa_migrate_home(handle, home, node, size);
+			ret = 1;
+		}
+	}
+
+	handle->numa_migrating = 0;
+	return ret;
+#else
+	(void) handle;
+	(void) node;
+	return 0;
+#endif
+}
+
+int __starpu_numa_migration_observe(starpu_data_handle_t handle, int node, struct _starpu_data_replicate *replicate)
+{
+#if defined(STARPU_HAVE_HWLOC) && defined(HAVE_UNISTD_H) && !defined(STARPU_SIMGRID)
+	int home = handle->home_node;
+	unsigned n;
+
+	_starpu_spin_checklocked(&handle->header_lock);
+
+	if (home < 0 || node < 0 || !replicate || replicate != &handle->per_node[node]
+		|| starpu_node_get_kind(home) != STARPU_CPU_RAM
+		|| starpu_node_get_kind(node) != STARPU_CPU_RAM)
+		return 0;
+
+	if (node == home)
+	{
+		/* Accessed in place, keep it there */
+		handle->numa_migrate_count = 0;
+		return 0;
+	}
+
+	if (replicate->state != STARPU_INVALID)
+		/* No transfer needed */
+		return 0;
+
+	if (handle->numa_migrating)
+		/* Another accessor is already on it */
+		return 0;
+
+	for (n = 0; n < STARPU_MAXNODES; n++)
+		if (_starpu_replicate_get_request(replicate, n))
+			/* Already being transferred, e.g. prefetched for the same task */
+			return 0;
+
+	if (handle->numa_migrate_node != node)
+	{
+		handle->numa_migrate_node = node;
+		handle->numa_migrate_count = 0;
+	}
+
+	if (++handle->numa_migrate_count < _starpu_numa_migrate_threshold)
+		return 0;
+
+	if (!_starpu_numa_migration_possible(handle, home, node))
+		return 0;
+
+	handle->numa_migrate_count = 0;
+	handle->numa_migrating = 1;
+	return 1;
+#else
+	(void) handle;
+	(void) node;
+	(void) replicate;
+	return 0;
+#endif
+}
@@ -0,0 +1,58 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#ifndef __NUMA_MIGRATION_H__
+#define __NUMA_MIGRATION_H__
+
+/** @file */
+
+#include <starpu.h>
+#include <common/config.h>
+
+#pragma GCC visibility push(hidden)
+
+struct _starpu_data_replicate;
+
+/** Number of consecutive accesses from the same remote NUMA node after which
+ * the home buffer of a data gets migrated there, 0 when disabled, see \ref
+ * STARPU_NUMA_MIGRATE */
+extern unsigned _starpu_numa_migrate_threshold;
+
+void _starpu_numa_migration_init(void);
+
+int __starpu_numa_migration_observe(starpu_data_handle_t handle, int node, struct _starpu_data_replicate *replicate);
+
+/** Migrate the pages of the home buffer of \p handle to \p node, after
+ * _starpu_numa_migration_observe() returned 1. Called with the handle header
+ * lock held, which is released during the migration itself, so the state of
+ * the handle has to be checked again afterwards. Returns 1 if \p node is now
+ * the home node of \p handle */
+int _starpu_numa_migration_perform(starpu_data_handle_t handle, int node);
+
+/** Record that a task accesses \p handle on \p node through \p replicate.
+ * Called with the handle header lock held, before taking references on the
+ * data. Returns 1 if it keeps getting accessed from there, and its home
+ * buffer should thus be migrated with _starpu_numa_migration_perform() */
+static inline int _starpu_numa_migration_observe(starpu_data_handle_t handle, int node, struct _starpu_data_replicate *replicate)
+{
+	if (STARPU_UNLIKELY(_starpu_numa_migrate_threshold))
+		return __starpu_numa_migration_observe(handle, node, replicate);
+	return 0;
+}
+
+#pragma GCC visibility pop
+
+#endif // __NUMA_MIGRATION_H__
@@ -0,0 +1,252 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+/*
+ * Out-of-core codes typically stream over their data in a predictable order,
+ * e.g. tile index order, or partition children order. By the time a task
+ * gets scheduled, it is too late to hide the disk latency. We thus observe
+ * the order in which data gets fetched by tasks into each main memory node, and
+ * issue idle prefetches for the data predicted to come next, when it is only
+ * available on a disk node:
+ *
+ * - for partition children, we detect a constant stride between the indexes
+ *   of the children accessed successively,
+ * - for other data, we remember which data was accessed after each data, so
+ *   that the next sweep over the data can follow the same sequence.
+ *
+ * The total amount of data being prefetched this way, by all the memory
+ * nodes, is bounded by STARPU_DISK_PREFETCH_SIZE.
+ */
+
+#include <string.h>
+
+#include <datawizard/ooc_prefetch.h>
+#include <datawizard/coherency.h>
+#include <datawizard/memory_nodes.h>
+#include <common/utils.h>
+
+int _starpu_ooc_prefetch_enabled;
+
+static starpu_pthread_mutex_t ooc_prefetch_mutex = STARPU_PTHREAD_MUTEX_INITIALIZER;
+
+/* Maximum number of data to prefetch ahead */
+#define OOC_PREFETCH_MAX_DEPTH 64
+
+/* Number of data to prefetch ahead */
+static unsigned ooc_prefetch_depth;
+/* Maximum amount of bytes being prefetched at the same time */
+static unsigned long ooc_prefetch_size;
+/* Amount of bytes currently being prefetched */
+static unsigned long ooc_prefetch_inflight;
+
+static unsigned ooc_disk_nodes[STARPU_MAXNODES];
+static unsigned ooc_ndisk_nodes;
+
+/* Last data fetched to each memory node, to learn the sequence */
+static starpu_data_handle_t ooc_last[STARPU_MAXNODES];
+
+void _starpu_ooc_prefetch_register_disk(unsigned node)
+{
+	unsigned depth = starpu_getenv_number_default("STARPU_DISK_PREFETCH", 4);
+	if (!depth)
+		return;
+	if (depth > OOC_PREFETCH_MAX_DEPTH)
+		depth = OOC_PREFETCH_MAX_DEPTH;
+
+	STARPU_PTHREAD_MUTEX_LOCK(&ooc_prefetch_mutex);
+	ooc_prefetch_depth = depth;
+	ooc_prefetch_size = (unsigned long) starpu_getenv_number_default("STARPU_DISK_PREFETCH_SIZE", 64) << 20;
+	ooc_disk_nodes[ooc_ndisk_nodes++] = node;
+	STARPU_HG_DISABLE_CHECKING(ooc_prefetch_inflight);
+	_starpu_ooc_prefetch_enabled = 1;
+	STARPU_PTHREAD_MUTEX_UNLOCK(&ooc_prefetch_mutex);
+}
+
+void _starpu_ooc_prefetch_shutdown(void)
+{
+	STARPU_PTHREAD_MUTEX_LOCK(&ooc_prefetch_mutex);
+	_starpu_ooc_prefetch_enabled = 0;
+	ooc_ndisk_nodes = 0;
+	memset(ooc_last, 0, sizeof(ooc_last));
+	STARPU_PTHREAD_MUTEX_UNLOCK(&ooc_prefetch_mutex);
+}
+
+/* Whether a disk node holds a valid copy of \p handle */
+static int _starpu_ooc_prefetch_on_disk(starpu_data_handle_t handle)
+{
+	unsigned i;
+	for (i = 0; i < ooc_ndisk_nodes; i++)
+		if (handle->per_node[ooc_disk_nodes[i]].state != STARPU_INVALID)
+			return 1;
+	return 0;
+}
+
+/* Called with ooc_prefetch_mutex held */
+static void _starpu_ooc_prefetch_link(starpu_data_handle_t prev, starpu_data_handle_t next)
+{
+	if (prev->ooc_next == next)
+		return;
+
+	/* Keep at most one data pointing to each data, so that unregistration
+	 * can clear it */
+	if (prev->ooc_next)
+		prev->ooc_next->ooc_prev = NULL;
+	if (next->ooc_prev)
+		next->ooc_prev->ooc_next = NULL;
+
+	prev->ooc_next = next;
+	next->ooc_prev = prev;
+}
+
+/* Called with ooc_prefetch_mutex held, which prevents \p handle from getting
+ * unregistered. If \p handle is worth prefetching, keep it busy so that it
+ * remains valid once the mutex is released, and return 1. */
+static int _starpu_ooc_prefetch_candidate(starpu_data_handle_t handle, unsigned node)
+{
+	int ret = 0;
+
+	/* Do not wait for other accessors, this is only a hint */
+	if (_starpu_spin_trylock(&handle->header_lock))
+		return 0;
+
+	/* Only bring data which is only available on a disk */
+	if (handle->per_node[node].state == STARPU_INVALID
+		&& _starpu_ooc_prefetch_on_disk(handle)
+		&& !handle->nchildren
+		&& !handle->partitioned
+		&& handle->active)
+	{
+		handle->busy_count++;
+		ret = 1;
+	}
+	_starpu_spin_unlock(&handle->header_lock);
+	return ret;
+}
+
+/* Called when a prefetch of \p arg bytes is over */
+static void _starpu_ooc_prefetch_done(void *arg)
+{
+	unsigned long size = (uintptr_t) arg;
+	(void) STARPU_ATOMIC_ADDL(&ooc_prefetch_inflight, -size);
+}
+
+/* Called without ooc_prefetch_mutex held, releases the reference taken by
+ * _starpu_ooc_prefetch_candidate */
+static void _starpu_ooc_prefetch_issue(starpu_data_handle_t handle, unsigned node)
+{
+	size_t size = _starpu_data_get_size(handle);
+	starpu_ssize_t available = starpu_memory_get_available(node);
+
+	if (available < 0 || (size_t) available >= size)
+	{
+		/* Reserve the bytes in the budget, released on completion */
+		if (STARPU_ATOMIC_ADDL(&ooc_prefetch_inflight, size) <= ooc_prefetch_size)
+			_starpu_fetch_data_on_node(handle, node, &handle->per_node[node], STARPU_R, 1, NULL, STARPU_IDLEFETCH, 1,
+						   _starpu_ooc_prefetch_done, (void *) (uintptr_t) size, STARPU_DEFAULT_PRIO, "_starpu_ooc_prefetch_issue");
+		else
+			(void) STARPU_ATOMIC_ADDL(&ooc_prefetch_inflight, -size);
+	}
+
+	_starpu_spin_lock(&handle->header_lock);
+	handle->busy_count--;
+	if (!_starpu_data_check_not_busy(handle))
+		_starpu_spin_unlock(&handle->header_lock);
+}
+
+void __starpu_ooc_prefetch_observe(starpu_data_handle_t handle, unsigned node)
+{
+	starpu_data_handle_t candidates[OOC_PREFETCH_MAX_DEPTH];
+	unsigned depth, ncandidates = 0, i;
+	size_t size;
+
+	if (starpu_node_get_kind(node) != STARPU_CPU_RAM)
+		return;
+
+	size = _starpu_data_get_size(handle);
+	if (!size)
+		return;
+
+	depth = ooc_prefetch_depth;
+	/* No room for prefetching more for now, but still learn the sequence */
+	if (ooc_prefetch_inflight + size > ooc_prefetch_size)
+		depth = 0;
+
+	STARPU_PTHREAD_MUTEX_LOCK(&ooc_prefetch_mutex);
+	if (handle->father_handle)
+	{
+		/* Partition child, look for a stride among the children */
+		starpu_data_handle_t father = handle->father_handle;
+		int stride = (int) handle->sibling_index - (int) father->ooc_last_child;
+
+		if (stride && stride == father->ooc_child_stride)
+		{
+			for (i = 1; i <= depth; i++)
+			{
+				int index = (int) handle->sibling_index + (int) i * stride;
+				starpu_data_handle_t sibling;
+
+				if (index < 0 || index >= (int) handle->nsiblings)
+					break;
+				if (handle->siblings)
+					sibling = handle->siblings[index];
+				else
+					sibling = &father->children[index];
+				if (_starpu_ooc_prefetch_candidate(sibling, node))
+					candidates[ncandidates++] = sibling;
+			}
+		}
+		father->ooc_child_stride = stride;
+		father->ooc_last_child = handle->sibling_index;
+	}
+	else
+	{
+		/* Learn the sequence */
+		if (ooc_last[node] && ooc_last[node] != handle)
+			_starpu_ooc_prefetch_link(ooc_last[node], handle);
+		ooc_last[node] = handle;
+
+		/* And follow what happened last time */
+		starpu_data_handle_t next = handle->ooc_next;
+		for (i = 0; i < depth && next && next != handle; i++)
+		{
+			if (_starpu_ooc_prefetch_candidate(next, node))
+				candidates[ncandidates++] = next;
+			next = next->ooc_next;
+		}
+	}
+	STARPU_PTHREAD_MUTEX_UNLOCK(&ooc_prefetch_mutex);
+
+	/* Issuing the prefetches may take time, do not hold the mutex meanwhile */
+	for (i = 0; i < ncandidates; i++)
+		_starpu_ooc_prefetch_issue(candidates[i], node);
+}
+
+void __starpu_ooc_prefetch_forget(starpu_data_handle_t handle)
+{
+	unsigned i;
+
+	STARPU_PTHREAD_MUTEX_LOCK(&ooc_prefetch_mutex);
+	if (handle->ooc_next)
+		handle->ooc_next->ooc_prev = NULL;
+	if (handle->ooc_prev)
+		handle->ooc_prev->ooc_next = NULL;
+	handle->ooc_next = NULL;
+	handle->ooc_prev = NULL;
+	for (i = 0; i < STARPU_MAXNODES; i++)
+		if (ooc_last[i] == handle)
+			ooc_last[i] = NULL;
+	STARPU_PTHREAD_MUTEX_UNLOCK(&ooc_prefetch_mutex);
+}
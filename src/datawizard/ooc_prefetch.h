@@ -0,0 +1,55 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#ifndef __OOC_PREFETCH_H__
+#define __OOC_PREFETCH_H__
+
+/** @file */
+
+#include <starpu.h>
+#include <common/config.h>
+
+#pragma GCC visibility push(hidden)
+
+/** Whether the out-of-core sequence prefetcher is active, i.e. a disk node
+ * was registered and \ref STARPU_DISK_PREFETCH is not 0 */
+extern int _starpu_ooc_prefetch_enabled;
+
+/** Start detecting access sequences for the data stored on disk node \p node */
+void _starpu_ooc_prefetch_register_disk(unsigned node);
+void _starpu_ooc_prefetch_shutdown(void);
+
+void __starpu_ooc_prefetch_observe(starpu_data_handle_t handle, unsigned node);
+void __starpu_ooc_prefetch_forget(starpu_data_handle_t handle);
+
+/** Record that \p handle is being fetched to \p node for a task, and
+ * prefetch the data predicted to be accessed next from the disk */
+static inline void _starpu_ooc_prefetch_observe(starpu_data_handle_t handle, unsigned node)
+{
+	if (STARPU_UNLIKELY(_starpu_ooc_prefetch_enabled))
+		__starpu_ooc_prefetch_observe(handle, node);
+}
+
+/** Drop any reference to \p handle, which is getting unregistered */
+static inline void _starpu_ooc_prefetch_forget(starpu_data_handle_t handle)
+{
+	if (STARPU_UNLIKELY(_starpu_ooc_prefetch_enabled))
+		__starpu_ooc_prefetch_forget(handle);
+}
+
+#pragma GCC visibility pop
+
+#endif // __OOC_PREFETCH_H__
@@ -24,6 +24,7 @@
 #include <core/dependencies/data_concurrency.h>
 #include <core/sched_policy.h>
 #include <datawizard/memory_nodes.h>
+#include <datawizard/sort_data_handles.h>
 
 static void _starpu_data_check_initialized(starpu_data_handle_t handle, enum starpu_data_access_mode mode)
 {
@@ -83,6 +84,10 @@ struct user_interaction_wrapper
 	void *callback_arg;
 	struct starpu_task *pre_sync_task;
 	struct starpu_task *post_sync_task;
+	/** For starpu_data_acquire_array: the array this belongs to, and
+	 * whether the implicit dependencies are satisfied */
+	struct user_interaction_array *array;
+	unsigned ready;
 };
 
 static inline void _starpu_data_acquire_wrapper_init(struct user_interaction_wrapper *wrapper, starpu_data_handle_t handle, int node, enum starpu_data_access_mode mode)
@@ -449,6 +454,302 @@ int starpu_data_acquire(starpu_data_handle_t handle, enum starpu_data_access_mod
 	return starpu_data_acquire_on_node(handle, home_node, mode);
 }
 
+/*
+ *	Acquisition of an array of data
+ *
+ * The implicit dependencies of all the data are registered at once. The data
+ * are then locked one after the other, in the order of
+ * _starpu_sort_task_handles like for tasks, to avoid deadlocks with other
+ * acquisitions, but the fetch of each data is launched as soon as it is
+ * locked, so that all the transfers proceed concurrently.
+ */
+
+struct user_interaction_array
+{
+	unsigned n;
+	/** Sorted in locking order */
+	struct user_interaction_wrapper *wrappers;
+	/** Next data to be locked */
+	unsigned next;
+	/** Whether some thread is progressing in locking the data */
+	unsigned locking;
+	/** One reference per data not available yet, one for the locking
+	 * phase, and one per thread working on the array */
+	unsigned refs;
+	starpu_pthread_mutex_t lock;
+	starpu_pthread_cond_t cond;
+	void (*callback)(void *);
+	void *callback_arg;
+};
+
+static void _starpu_data_acquire_array_fini(struct user_interaction_array *array)
+{
+	unsigned i;
+	for (i = 0; i < array->n; i++)
+		_starpu_data_acquire_wrapper_fini(&array->wrappers[i]);
+	STARPU_PTHREAD_MUTEX_DESTROY(&array->lock);
+	STARPU_PTHREAD_COND_DESTROY(&array->cond);
+	free(array->wrappers);
+	free(array);
+}
+
+/* Drop a reference on the array, and terminate the acquisition if it was the
+ * last one. The array must not be used any more by the caller */
+static void _starpu_data_acquire_array_put(struct user_interaction_array *array)
+{
+	void (*callback)(void *);
+	void *callback_arg;
+	unsigned refs;
+
+	STARPU_PTHREAD_MUTEX_LOCK(&array->lock);
+	refs = --array->refs;
+	callback = array->callback;
+	callback_arg = array->callback_arg;
+	if (!refs && !callback)
+		/* starpu_data_acquire_array will free it */
+		STARPU_PTHREAD_COND_SIGNAL(&array->cond);
+	STARPU_PTHREAD_MUTEX_UNLOCK(&array->lock);
+
+	if (!refs && callback)
+	{
+		callback(callback_arg);
+		_starpu_data_acquire_array_fini(array);
+	}
+}
+
+/* Called when the fetch of one of the data is done */
+static void _starpu_data_acquire_array_fetch_callback(void *arg)
+{
+	struct user_interaction_wrapper *wrapper = (struct user_interaction_wrapper *) arg;
+
+	if (wrapper->post_sync_task)
+		_starpu_add_post_sync_tasks(wrapper->post_sync_task, wrapper->handle);
+
+	_starpu_data_acquire_array_put(wrapper->array);
+}
+
+static void _starpu_data_acquire_array_continuation(void *arg);
+
+/* Lock the data whose implicit dependencies are satisfied, in order. Called
+ * with array->locking set */
+static void _starpu_data_acquire_array_lock(struct user_interaction_array *array)
+{
+	unsigned done;
+
+	STARPU_PTHREAD_MUTEX_LOCK(&array->lock);
+	while (array->next < array->n && array->wrappers[array->next].ready)
+	{
+		struct user_interaction_wrapper *wrapper = &array->wrappers[array->next++];
+		STARPU_PTHREAD_MUTEX_UNLOCK(&array->lock);
+
+		if (_starpu_attempt_to_submit_data_request_from_apps(wrapper->handle, wrapper->mode,
+				_starpu_data_acquire_array_continuation, wrapper))
+			/* We will continue when we get it */
+			return;
+
+		_starpu_data_acquire_launch_fetch(wrapper, 1, _starpu_data_acquire_array_fetch_callback, wrapper);
+
+		STARPU_PTHREAD_MUTEX_LOCK(&array->lock);
+	}
+	done = array->next == array->n;
+	array->locking = 0;
+	STARPU_PTHREAD_MUTEX_UNLOCK(&array->lock);
+
+	if (done)
+		/* Locking phase is over */
+		_starpu_data_acquire_array_put(array);
+}
+
+/* Called when one of the data got locked, which may be from another thread */
+static void _starpu_data_acquire_array_continuation(void *arg)
+{
+	struct user_interaction_wrapper *wrapper = (struct user_interaction_wrapper *) arg;
+	struct user_interaction_array *array = wrapper->array;
+
+	_starpu_data_acquire_launch_fetch(wrapper, 1, _starpu_data_acquire_array_fetch_callback, wrapper);
+	_starpu_data_acquire_array_lock(array);
+}
+
+/* Called when the implicit dependencies of one of the data are satisfied */
+static void _starpu_data_acquire_array_set_ready(struct user_interaction_wrapper *wrapper)
+{
+	struct user_interaction_array *array = wrapper->array;
+	unsigned lock;
+
+	STARPU_PTHREAD_MUTEX_LOCK(&array->lock);
+	wrapper->ready = 1;
+	array->refs++;
+	lock = !array->locking && array->next < array->n;
+	if (lock)
+		array->locking = 1;
+	STARPU_PTHREAD_MUTEX_UNLOCK(&array->lock);
+
+	if (lock)
+		_starpu_data_acquire_array_lock(array);
+	_starpu_data_acquire_array_put(array);
+}
+
+static void _starpu_data_acquire_array_pre_sync_callback(void *arg)
+{
+	_starpu_data_acquire_array_set_ready(arg);
+}
+
+static struct user_interaction_array *_starpu_data_acquire_array(unsigned n, starpu_data_handle_t *handles, enum starpu_data_access_mode mode, void (*callback)(void *), void *arg)
+{
+	struct user_interaction_array *array;
+	struct _starpu_data_descr *descrs;
+	unsigned i;
+
+	_STARPU_CALLOC(array, 1, sizeof(*array));
+	_STARPU_CALLOC(array->wrappers, n, sizeof(*array->wrappers));
+	array->n = n;
+	array->refs = n + 1;
+	array->callback = callback;
+	array->callback_arg = arg;
+	STARPU_PTHREAD_MUTEX_INIT(&array->lock, NULL);
+	STARPU_PTHREAD_COND_INIT(&array->cond, NULL);
+
+	/* Determine the locking order */
+	_STARPU_MALLOC(descrs, n * sizeof(*descrs));
+	for (i = 0; i < n; i++)
+	{
+		starpu_data_handle_t handle = handles[i];
+		STARPU_ASSERT(handle);
+		STARPU_ASSERT_MSG(handle->nchildren == 0, "Acquiring a partitioned data (%p) is not possible", handle);
+		/* Check that previous tasks have set a value if needed */
+		_starpu_data_check_initialized(handle, mode);
+		descrs[i].handle = handle;
+		descrs[i].mode = mode;
+		descrs[i].node = -1;
+		descrs[i].index = i;
+	}
+	_starpu_sort_task_handles(descrs, n);
+
+	/* Initialize everything before the first callback may trigger */
+	for (i = 0; i < n; i++)
+	{
+		starpu_data_handle_t handle = descrs[i].handle;
+		struct user_interaction_wrapper *wrapper = &array->wrappers[i];
+		int home_node = handle->home_node;
+
+		STARPU_ASSERT_MSG(i == 0 || handle != descrs[i-1].handle, "Data %p can not be acquired twice by the same starpu_data_acquire_array call", handle);
+
+		if (home_node < 0)
+			home_node = STARPU_MAIN_RAM;
+		_starpu_data_acquire_wrapper_init(wrapper, handle, home_node, mode);
+		wrapper->async = 1;
+		wrapper->prio = STARPU_DEFAULT_PRIO;
+		wrapper->array = array;
+	}
+	free(descrs);
+
+	/* Register the implicit dependencies of all the data at once */
+	for (i = 0; i < n; i++)
+	{
+		struct user_interaction_wrapper *wrapper = &array->wrappers[i];
+		starpu_data_handle_t handle = wrapper->handle;
+
+		STARPU_PTHREAD_MUTEX_LOCK(&handle->sequential_consistency_mutex);
+		if (handle->sequential_consistency)
+		{
+			struct starpu_task *new_task;
+			int submit_pre_sync = 0;
+			wrapper->pre_sync_task = starpu_task_create();
+			wrapper->pre_sync_task->name = "_starpu_data_acquire_array_pre";
+			wrapper->pre_sync_task->detach = 1;
+			wrapper->pre_sync_task->callback_func = _starpu_data_acquire_array_pre_sync_callback;
+			wrapper->pre_sync_task->callback_arg = wrapper;
+			wrapper->pre_sync_task->type = STARPU_TASK_TYPE_DATA_ACQUIRE;
+
+			wrapper->post_sync_task = starpu_task_create();
+			wrapper->post_sync_task->name = "_starpu_data_acquire_array_release";
+			wrapper->post_sync_task->detach = 1;
+			wrapper->post_sync_task->type = STARPU_TASK_TYPE_DATA_ACQUIRE;
+
+			new_task = _starpu_detect_implicit_data_deps_with_handle(wrapper->pre_sync_task, &submit_pre_sync, wrapper->post_sync_task, &_starpu_get_job_associated_to_task(wrapper->post_sync_task)->implicit_dep_slot, handle, mode, 1);
+			STARPU_PTHREAD_MUTEX_UNLOCK(&handle->sequential_consistency_mutex);
+
+			if (STARPU_UNLIKELY(new_task))
+			{
+				int ret = _starpu_task_submit_internally(new_task);
+				STARPU_ASSERT(!ret);
+			}
+
+			if (submit_pre_sync)
+			{
+				int ret = _starpu_task_submit_internally(wrapper->pre_sync_task);
+				STARPU_ASSERT(!ret);
+			}
+			else
+			{
+				wrapper->pre_sync_task->detach = 0;
+				starpu_task_destroy(wrapper->pre_sync_task);
+				_starpu_data_acquire_array_set_ready(wrapper);
+			}
+		}
+		else
+		{
+			STARPU_PTHREAD_MUTEX_UNLOCK(&handle->sequential_consistency_mutex);
+			_starpu_data_acquire_array_set_ready(wrapper);
+		}
+	}
+
+	return array;
+}
+
+int starpu_data_acquire_array_cb(unsigned n, starpu_data_handle_t *handles, enum starpu_data_access_mode mode, void (*callback)(void *), void *arg)
+{
+	STARPU_ASSERT(callback);
+	_STARPU_LOG_IN();
+
+	if (!n)
+	{
+		callback(arg);
+		_STARPU_LOG_OUT();
+		return 0;
+	}
+
+	_starpu_data_acquire_array(n, handles, mode, callback, arg);
+
+	_STARPU_LOG_OUT();
+	return 0;
+}
+
+int starpu_data_acquire_array(unsigned n, starpu_data_handle_t *handles, enum starpu_data_access_mode mode)
+{
+	struct user_interaction_array *array;
+	_STARPU_LOG_IN();
+
+	/* unless asynchronous, it is forbidden to call this function from a callback or a codelet */
+	STARPU_ASSERT_MSG(_starpu_worker_may_perform_blocking_calls(), "Acquiring data synchronously is not possible from a codelet or from a task callback, use starpu_data_acquire_array_cb instead.");
+
+	if (!n)
+	{
+		_STARPU_LOG_OUT();
+		return 0;
+	}
+
+	array = _starpu_data_acquire_array(n, handles, mode, NULL, NULL);
+
+	/* Wait for all of them at once */
+	STARPU_PTHREAD_MUTEX_LOCK(&array->lock);
+	while (array->refs)
+		STARPU_PTHREAD_COND_WAIT(&array->cond, &array->lock);
+	STARPU_PTHREAD_MUTEX_UNLOCK(&array->lock);
+
+	_starpu_data_acquire_array_fini(array);
+
+	_STARPU_LOG_OUT();
+	return 0;
+}
+
+void starpu_data_release_array(unsigned n, starpu_data_handle_t *handles)
+{
+	unsigned i;
+	for (i = 0; i < n; i++)
+		starpu_data_release(handles[i]);
+}
+
 int starpu_data_acquire_on_node_try(starpu_data_handle_t handle, int node, enum starpu_data_access_mode mode)
 {
 	STARPU_ASSERT(handle);
@@ -797,6 +1098,16 @@ unsigned starpu_data_get_ooc_flag(starpu_data_handle_t handle)
 	return handle->ooc;
 }
 
+void starpu_data_set_lazy_allocation_flag(starpu_data_handle_t handle, unsigned flag)
+{
+	handle->lazy_allocation = flag;
+}
+
+unsigned starpu_data_get_lazy_allocation_flag(starpu_data_handle_t handle)
+{
+	return handle->lazy_allocation;
+}
+
 /* By default, sequential consistency is enabled */
 static unsigned default_sequential_consistency_flag = 1;
 
@@ -832,7 +1143,7 @@ void starpu_data_query_status2(starpu_data_handle_t handle, int memory_node, int
 		unsigned node;
 		for (node = 0; node < STARPU_MAXNODES; node++)
 		{
-			if (handle->per_node[memory_node].request[node])
+			if (_starpu_replicate_get_request(&handle->per_node[memory_node], node))
 			{
 				requested = 1;
 				break;
@@ -780,8 +780,13 @@ struct _starpu_node_ops _starpu_driver_cpu_node_ops =
 	.copy_interface_to[STARPU_CPU_RAM] = _starpu_cpu_copy_interface,
 
 	.copy_data_to[STARPU_CPU_RAM] = _starpu_cpu_copy_data,
+	.copy2d_data_to[STARPU_CPU_RAM] = _starpu_cpu_copy2d_data,
+	.copy3d_data_to[STARPU_CPU_RAM] = _starpu_cpu_copy3d_data,
 
 	.map[STARPU_CPU_RAM] = _starpu_cpu_map,
 	.unmap[STARPU_CPU_RAM] = _starpu_cpu_unmap,
 	.update_map[STARPU_CPU_RAM] = _starpu_cpu_update_map,
+
+	.map[STARPU_DISK_RAM] = _starpu_disk_map_to_cpu,
+	.unmap[STARPU_DISK_RAM] = _starpu_disk_unmap_from_cpu,
 };
@@ -42,6 +42,11 @@ void *_starpu_cpu_worker(void *);
 int _starpu_cpu_copy_interface(starpu_data_handle_t handle, void *src_interface, unsigned src_node, void *dst_interface, unsigned dst_node, struct _starpu_data_request *req);
 int _starpu_cpu_copy_data(uintptr_t src_ptr, size_t src_offset, int src_dev, uintptr_t dst_ptr, size_t dst_offset, int dst_dev, size_t ssize, struct _starpu_async_channel *async_channel);
 
+/** Select the strided copy kernels for the processor */
+void _starpu_cpu_copy_init(void);
+int _starpu_cpu_copy2d_data(uintptr_t src_ptr, size_t src_offset, int src_dev, uintptr_t dst_ptr, size_t dst_offset, int dst_dev, size_t blocksize, size_t numblocks, size_t ld_src, size_t ld_dst, struct _starpu_async_channel *async_channel);
+int _starpu_cpu_copy3d_data(uintptr_t src_ptr, size_t src_offset, int src_dev, uintptr_t dst_ptr, size_t dst_offset, int dst_dev, size_t blocksize, size_t numblocks_1, size_t ld1_src, size_t ld1_dst, size_t numblocks_2, size_t ld2_src, size_t ld2_dst, struct _starpu_async_channel *async_channel);
+
 int _starpu_cpu_is_direct_access_supported(unsigned node, unsigned handling_node);
 uintptr_t _starpu_cpu_malloc_on_device(int dst_node, size_t size, int flags);
 void _starpu_cpu_free_on_device(int dst_node, uintptr_t addr, size_t size, int flags);
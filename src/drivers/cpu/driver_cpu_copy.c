@@ -0,0 +1,327 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+/*
+ * Strided copies between CPU memory nodes, used by the copy methods and the
+ * pack/peek methods of the matrix, block, tensor and ndim interfaces.
+ *
+ * Copying narrow tiles row by row with memcpy is dominated by the call
+ * overhead, we thus copy the rows inline with vector loads and stores,
+ * using the widest instruction set supported by the processor, selected at
+ * initialization. Rows which are not a multiple of the vector size are
+ * completed by an overlapping vector copy of their end.
+ *
+ * When the destination is bigger than STARPU_NT_COPY_THRESHOLD, we use
+ * non-temporal stores, to avoid evicting the whole cache for data which will
+ * not be read back soon by this core.
+ */
+
+#include <common/config.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#include <starpu.h>
+#include <common/utils.h>
+#include <drivers/cpu/driver_cpu.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#ifdef STARPU_HAVE_X86_TARGET_ATTRIBUTE
+#include <immintrin.h>
+#endif
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+typedef void (*copy2d_kernel_t)(char *dst, size_t ld_dst, const char *src, size_t ld_src,
+				size_t blocksize, size_t numblocks, int nt);
+
+/* Copy less than 16 bytes without calling memcpy, with possibly overlapping
+ * accesses */
+static inline void copy_row_tiny(char *d, const char *s, size_t n)
+{
+	if (n >= 8)
+	{
+		uint64_t a, b;
+		memcpy(&a, s, 8);
+		memcpy(&b, s + n - 8, 8);
+		memcpy(d, &a, 8);
+		memcpy(d + n - 8, &b, 8);
+	}
+	else if (n >= 4)
+	{
+		uint32_t a, b;
+		memcpy(&a, s, 4);
+		memcpy(&b, s + n - 4, 4);
+		memcpy(d, &a, 4);
+		memcpy(d + n - 4, &b, 4);
+	}
+	else if (n)
+	{
+		/* 1 to 3 bytes */
+		d[0] = s[0];
+		d[n/2] = s[n/2];
+		d[n-1] = s[n-1];
+	}
+}
+
+/* Copy less than 32 bytes */
+static inline void copy_row_small(char *d, const char *s, size_t n)
+{
+#if defined(__SSE2__)
+	if (n >= 16)
+	{
+		__m128i a = _mm_loadu_si128((const __m128i *) s);
+		__m128i b = _mm_loadu_si128((const __m128i *) (s + n - 16));
+		_mm_storeu_si128((__m128i *) d, a);
+		_mm_storeu_si128((__m128i *) (d + n - 16), b);
+		return;
+	}
+#endif
+	if (n >= 16)
+		memcpy(d, s, n);
+	else
+		copy_row_tiny(d, s, n);
+}
+
+static void copy2d_generic(char *dst, size_t ld_dst, const char *src, size_t ld_src,
+			   size_t blocksize, size_t numblocks, int nt)
+{
+	size_t i;
+	(void) nt;
+
+	if (blocksize < 32)
+		for (i = 0; i < numblocks; i++)
+			copy_row_small(dst + i*ld_dst, src + i*ld_src, blocksize);
+	else
+		for (i = 0; i < numblocks; i++)
+			memcpy(dst + i*ld_dst, src + i*ld_src, blocksize);
+}
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+/* NEON is always available on aarch64 */
+static void copy2d_neon(char *dst, size_t ld_dst, const char *src, size_t ld_src,
+			size_t blocksize, size_t numblocks, int nt)
+{
+	size_t i, j;
+	(void) nt;
+
+	if (blocksize < 16)
+	{
+		for (i = 0; i < numblocks; i++)
+			copy_row_tiny(dst + i*ld_dst, src + i*ld_src, blocksize);
+		return;
+	}
+
+	for (i = 0; i < numblocks; i++)
+	{
+		uint8_t *d = (uint8_t *) dst + i*ld_dst;
+		const uint8_t *s = (const uint8_t *) src + i*ld_src;
+		for (j = 0; j + 32 <= blocksize; j += 32)
+		{
+			uint8x16_t a = vld1q_u8(s + j);
+			uint8x16_t b = vld1q_u8(s + j + 16);
+			vst1q_u8(d + j, a);
+			vst1q_u8(d + j + 16, b);
+		}
+		for (; j + 16 <= blocksize; j += 16)
+			vst1q_u8(d + j, vld1q_u8(s + j));
+		if (j < blocksize)
+			vst1q_u8(d + blocksize - 16, vld1q_u8(s + blocksize - 16));
+	}
+}
+#endif
+
+#ifdef STARPU_HAVE_X86_TARGET_ATTRIBUTE
+__attribute__((target("avx2")))
+static inline void copy_row_avx2(char *d, const char *s, size_t n, int nt)
+{
+	size_t j = 0;
+
+	if (n < 32)
+	{
+		copy_row_small(d, s, n);
+		return;
+	}
+
+	if (nt)
+	{
+		/* Align the destination for the streaming stores */
+		j = (-(uintptr_t) d) & 31;
+		if (j)
+			_mm256_storeu_si256((__m256i *) d, _mm256_loadu_si256((const __m256i *) s));
+		for (; j + 32 <= n; j += 32)
+			_mm256_stream_si256((__m256i *) (d + j), _mm256_loadu_si256((const __m256i *) (s + j)));
+	}
+	else
+	{
+		for (; j + 128 <= n; j += 128)
+		{
+			__m256i a = _mm256_loadu_si256((const __m256i *) (s + j));
+			__m256i b = _mm256_loadu_si256((const __m256i *) (s + j + 32));
+			__m256i c = _mm256_loadu_si256((const __m256i *) (s + j + 64));
+			__m256i e = _mm256_loadu_si256((const __m256i *) (s + j + 96));
+			_mm256_storeu_si256((__m256i *) (d + j), a);
+			_mm256_storeu_si256((__m256i *) (d + j + 32), b);
+			_mm256_storeu_si256((__m256i *) (d + j + 64), c);
+			_mm256_storeu_si256((__m256i *) (d + j + 96), e);
+		}
+		for (; j + 32 <= n; j += 32)
+			_mm256_storeu_si256((__m256i *) (d + j), _mm256_loadu_si256((const __m256i *) (s + j)));
+	}
+
+	if (j < n)
+		_mm256_storeu_si256((__m256i *) (d + n - 32), _mm256_loadu_si256((const __m256i *) (s + n - 32)));
+}
+
+__attribute__((target("avx2")))
+static void copy2d_avx2(char *dst, size_t ld_dst, const char *src, size_t ld_src,
+			size_t blocksize, size_t numblocks, int nt)
+{
+	size_t i;
+
+	for (i = 0; i < numblocks; i++)
+		copy_row_avx2(dst + i*ld_dst, src + i*ld_src, blocksize, nt);
+
+	if (nt)
+		_mm_sfence();
+}
+
+__attribute__((target("avx512f,avx2")))
+static void copy2d_avx512(char *dst, size_t ld_dst, const char *src, size_t ld_src,
+			  size_t blocksize, size_t numblocks, int nt)
+{
+	size_t i, j;
+
+	if (blocksize < 128)
+	{
+		copy2d_avx2(dst, ld_dst, src, ld_src, blocksize, numblocks, nt);
+		return;
+	}
+
+	for (i = 0; i < numblocks; i++)
+	{
+		char *d = dst + i*ld_dst;
+		const char *s = src + i*ld_src;
+
+		j = 0;
+		if (nt)
+		{
+			j = (-(uintptr_t) d) & 63;
+			if (j)
+				_mm512_storeu_si512((void *) d, _mm512_loadu_si512((const void *) s));
+			for (; j + 64 <= blocksize; j += 64)
+				_mm512_stream_si512((__m512i *) (d + j), _mm512_loadu_si512((const void *) (s + j)));
+		}
+		else
+		{
+			for (; j + 64 <= blocksize; j += 64)
+				_mm512_storeu_si512((void *) (d + j), _mm512_loadu_si512((const void *) (s + j)));
+		}
+		if (j < blocksize)
+			_mm512_storeu_si512((void *) (d + blocksize - 64), _mm512_loadu_si512((const void *) (s + blocksize - 64)));
+	}
+
+	if (nt)
+		_mm_sfence();
+}
+#endif
+
+static copy2d_kernel_t copy2d_kernel = copy2d_generic;
+static const char *copy2d_kernel_name = "generic";
+/* Total size above which we use non-temporal stores, 0 to disable */
+static size_t nt_threshold;
+
+void _starpu_cpu_copy_init(void)
+{
+	starpu_ssize_t threshold = starpu_getenv_number_default("STARPU_NT_COPY_THRESHOLD", 8);
+
+	nt_threshold = threshold > 0 ? (size_t) threshold << 20 : 0;
+
+	copy2d_kernel = copy2d_generic;
+	copy2d_kernel_name = "generic";
+
+	if (!starpu_getenv_number_default("STARPU_SIMD_COPY", 1))
+		return;
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+	copy2d_kernel = copy2d_neon;
+	copy2d_kernel_name = "neon";
+#endif
+#ifdef STARPU_HAVE_X86_TARGET_ATTRIBUTE
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2"))
+	{
+		copy2d_kernel = copy2d_avx512;
+		copy2d_kernel_name = "avx512";
+	}
+	else if (__builtin_cpu_supports("avx2"))
+	{
+		copy2d_kernel = copy2d_avx2;
+		copy2d_kernel_name = "avx2";
+	}
+#endif
+	_STARPU_DEBUG("using %s strided copy kernel\n", copy2d_kernel_name);
+}
+
+/* Whether a copy of \p size bytes in total should use non-temporal stores */
+static inline int copy_use_nt(size_t blocksize, size_t size)
+{
+	return nt_threshold && size >= nt_threshold && blocksize >= 256;
+}
+
+int _starpu_cpu_copy2d_data(uintptr_t src, size_t src_offset, int src_dev,
+			    uintptr_t dst, size_t dst_offset, int dst_dev,
+			    size_t blocksize,
+			    size_t numblocks, size_t ld_src, size_t ld_dst,
+			    struct _starpu_async_channel *async_channel)
+{
+	(void) async_channel;
+	(void) src_dev;
+	(void) dst_dev;
+
+	copy2d_kernel((char *) dst + dst_offset, ld_dst, (const char *) src + src_offset, ld_src,
+		      blocksize, numblocks, copy_use_nt(blocksize, blocksize * numblocks));
+	return 0;
+}
+
+int _starpu_cpu_copy3d_data(uintptr_t src, size_t src_offset, int src_dev,
+			    uintptr_t dst, size_t dst_offset, int dst_dev,
+			    size_t blocksize,
+			    size_t numblocks_1, size_t ld1_src, size_t ld1_dst,
+			    size_t numblocks_2, size_t ld2_src, size_t ld2_dst,
+			    struct _starpu_async_channel *async_channel)
+{
+	size_t i;
+	int nt = copy_use_nt(blocksize, blocksize * numblocks_1 * numblocks_2);
+	(void) async_channel;
+	(void) src_dev;
+	(void) dst_dev;
+
+	if (ld1_src == blocksize && ld1_dst == blocksize)
+		/* Contiguous planes */
+		return _starpu_cpu_copy2d_data(src, src_offset, src_dev, dst, dst_offset, dst_dev,
+					       blocksize * numblocks_1, numblocks_2, ld2_src, ld2_dst,
+					       async_channel);
+
+	for (i = 0; i < numblocks_2; i++)
+		copy2d_kernel((char *) dst + dst_offset + i*ld2_dst, ld1_dst,
+			      (const char *) src + src_offset + i*ld2_src, ld1_src,
+			      blocksize, numblocks_1, nt);
+	return 0;
+}
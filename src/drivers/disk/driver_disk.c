@@ -238,6 +238,57 @@ int _starpu_disk_copy_data_from_cpu_to_disk(uintptr_t src, size_t src_offset, in
 					     size, async_channel);
 }
 
+uintptr_t _starpu_disk_map_to_cpu(uintptr_t src, size_t src_offset, unsigned src_node, unsigned dst_node, size_t size, int *ret)
+{
+	(void) dst_node;
+	int src_dev = starpu_memory_node_get_devid(src_node);
+	void *ptr;
+
+	if (!src || !_starpu_disk_can_map(src_dev))
+	{
+		*ret = -EIO;
+		return 0;
+	}
+
+	ptr = _starpu_disk_map(src_dev, (void *) src, src_offset, size);
+	if (!ptr)
+	{
+		*ret = -ENOMEM;
+		return 0;
+	}
+
+	*ret = 0;
+	return (uintptr_t) ptr;
+}
+
+int _starpu_disk_unmap_from_cpu(uintptr_t src, size_t src_offset, unsigned src_node, uintptr_t dst, unsigned dst_node, size_t size)
+{
+	(void) dst_node;
+	int src_dev = starpu_memory_node_get_devid(src_node);
+
+	return _starpu_disk_unmap(src_dev, (void *) src, (void *) dst, src_offset, size);
+}
+
+int _starpu_disk_can_map_interface(starpu_data_handle_t handle, void *src_interface)
+{
+	/* The mapping is used as the data itself, so the disk has to hold
+	 * exactly the memory layout, i.e. the interface has to be stored on
+	 * disk with any_to_any rather than with pack_data, and be contiguous */
+	switch (handle->ops->interfaceid)
+	{
+		case STARPU_VARIABLE_INTERFACE_ID:
+		case STARPU_VECTOR_INTERFACE_ID:
+			return 1;
+		case STARPU_MATRIX_INTERFACE_ID:
+		{
+			struct starpu_matrix_interface *matrix = src_interface;
+			return matrix->ld == matrix->nx || matrix->ny == 1;
+		}
+		default:
+			return 0;
+	}
+}
+
 int _starpu_disk_is_direct_access_supported(unsigned node, unsigned handling_node)
 {
 	/* Each worker can manage disks but disk <-> disk is not always allowed */
@@ -43,6 +43,11 @@ int _starpu_disk_copy_data_from_disk_to_cpu(uintptr_t src, size_t src_offset, in
 int _starpu_disk_copy_data_from_disk_to_disk(uintptr_t src, size_t src_offset, int src_dev, uintptr_t dst, size_t dst_offset, int dst_dev, size_t size, struct _starpu_async_channel *async_channel);
 int _starpu_disk_copy_data_from_cpu_to_disk(uintptr_t src, size_t src_offset, int src_dev, uintptr_t dst, size_t dst_offset, int dst_dev, size_t size, struct _starpu_async_channel *async_channel);
 
+uintptr_t _starpu_disk_map_to_cpu(uintptr_t src, size_t src_offset, unsigned src_node, unsigned dst_node, size_t size, int *ret);
+int _starpu_disk_unmap_from_cpu(uintptr_t src, size_t src_offset, unsigned src_node, uintptr_t dst, unsigned dst_node, size_t size);
+/** whether the disk replicate described by \p src_interface can be mapped as the main memory replicate */
+int _starpu_disk_can_map_interface(starpu_data_handle_t handle, void *src_interface);
+
 extern struct _starpu_node_ops _starpu_driver_disk_node_ops;
 int _starpu_disk_is_direct_access_supported(unsigned node, unsigned handling_node);
 uintptr_t _starpu_disk_malloc_on_device(int dst_dev, size_t size, int flags);
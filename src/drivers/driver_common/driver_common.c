@@ -72,6 +72,8 @@ void _starpu_driver_start_job(struct _starpu_worker *worker, struct _starpu_job
 	if ((profiling && profiling_info) || (rank == 0 && (calibrate_model || !_starpu_perf_counter_paused())))
 		_starpu_clock_gettime(&start);
 	_starpu_add_worker_status(worker, STATUS_INDEX_EXECUTING, &start);
+	if (_starpu_energy_sampling_enabled)
+		_starpu_energy_sampling_start_job(workerid);
 
 	if (rank == 0)
 	{
@@ -191,6 +193,13 @@ void _starpu_driver_end_job(struct _starpu_worker *worker, struct _starpu_job *j
 	if ((profiling && profiling_info) || (rank == 0 && (calibrate_model || !_starpu_perf_counter_paused())))
 		_starpu_clock_gettime(&end);
 	_starpu_clear_worker_status(worker, STATUS_INDEX_EXECUTING, &end);
+	if (_starpu_energy_sampling_enabled)
+	{
+		double energy = _starpu_energy_sampling_end_job(workerid);
+		/* Assume that all the workers of a parallel task consumed as much */
+		if (rank == 0 && profiling_info && energy > 0.)
+			profiling_info->energy_consumed = energy * j->task_size;
+	}
 
 	if (rank == 0)
 	{
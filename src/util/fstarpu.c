@@ -114,6 +114,7 @@ static const intptr_t fstarpu_history_based	= STARPU_HISTORY_BASED;
 static const intptr_t fstarpu_regression_based	= STARPU_REGRESSION_BASED;
 static const intptr_t fstarpu_nl_regression_based	= STARPU_NL_REGRESSION_BASED;
 static const intptr_t fstarpu_multiple_regression_based	= STARPU_MULTIPLE_REGRESSION_BASED;
+static const intptr_t fstarpu_interpolation_based	= STARPU_INTERPOLATION_BASED;
 
 static const intptr_t fstarpu_seq	= STARPU_SEQ;
 static const intptr_t fstarpu_spmd	= STARPU_SPMD;
@@ -215,6 +216,7 @@ intptr_t fstarpu_get_constant(char *s)
 	else if (!strcmp(s, "FSTARPU_REGRESSION_BASED"))	{ return fstarpu_regression_based; }
 	else if (!strcmp(s, "FSTARPU_NL_REGRESSION_BASED"))	{ return fstarpu_nl_regression_based; }
 	else if (!strcmp(s, "FSTARPU_MULTIPLE_REGRESSION_BASED"))	{ return fstarpu_multiple_regression_based; }
+	else if (!strcmp(s, "FSTARPU_INTERPOLATION_BASED"))	{ return fstarpu_interpolation_based; }
 
 	else if (!strcmp(s, "FSTARPU_SEQ"))	{ return fstarpu_seq; }
 	else if (!strcmp(s, "FSTARPU_SPMD"))	{ return fstarpu_spmd; }
@@ -489,7 +491,7 @@ void fstarpu_perfmodel_set_symbol(struct starpu_perfmodel *model, const char *mo
 
 void fstarpu_perfmodel_set_type(struct starpu_perfmodel *model, intptr_t type)
 {
-	STARPU_ASSERT(type == fstarpu_history_based || type == fstarpu_regression_based || type == fstarpu_nl_regression_based || type == fstarpu_multiple_regression_based);
+	STARPU_ASSERT(type == fstarpu_history_based || type == fstarpu_regression_based || type == fstarpu_nl_regression_based || type == fstarpu_multiple_regression_based || type == fstarpu_interpolation_based);
 	model->type = type;
 }
 
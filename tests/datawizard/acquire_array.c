@@ -0,0 +1,159 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <starpu.h>
+#include "../helper.h"
+
+/*
+ * Acquire many data at once, synchronously and asynchronously, while tasks
+ * are still working on them, and check that the values are up to date.
+ */
+
+#ifdef STARPU_QUICK_CHECK
+#define NDATA 16
+#define NITER 4
+#else
+#define NDATA 128
+#define NITER 16
+#endif
+#define NX 64
+
+static void inc(void *descr[], void *_args)
+{
+	int *v = (int *) STARPU_VECTOR_GET_PTR(descr[0]);
+	unsigned n = STARPU_VECTOR_GET_NX(descr[0]);
+	unsigned i;
+	(void)_args;
+
+	for (i = 0; i < n; i++)
+		v[i]++;
+}
+
+static struct starpu_codelet cl =
+{
+	.cpu_funcs = {inc},
+	.cpu_funcs_name = {"inc"},
+	.nbuffers = 1,
+	.modes = {STARPU_RW}
+};
+
+static int v[NDATA][NX];
+static starpu_data_handle_t handles[NDATA];
+static unsigned expected;
+static unsigned cb_expected;
+
+static starpu_pthread_mutex_t mutex = STARPU_PTHREAD_MUTEX_INITIALIZER;
+static starpu_pthread_cond_t cond = STARPU_PTHREAD_COND_INITIALIZER;
+static unsigned acquired;
+
+static void check(unsigned value)
+{
+	unsigned i, j;
+	for (i = 0; i < NDATA; i++)
+		for (j = 0; j < NX; j++)
+			STARPU_ASSERT_MSG(v[i][j] == (int) value, "v[%u][%u] is %d instead of %u", i, j, v[i][j], value);
+}
+
+static void callback(void *arg)
+{
+	check(*(unsigned *) arg);
+	/* Modify them to check that the write access is kept */
+	unsigned i, j;
+	for (i = 0; i < NDATA; i++)
+		for (j = 0; j < NX; j++)
+			v[i][j]++;
+	starpu_data_release_array(NDATA, handles);
+
+	STARPU_PTHREAD_MUTEX_LOCK(&mutex);
+	acquired = 1;
+	STARPU_PTHREAD_COND_SIGNAL(&cond);
+	STARPU_PTHREAD_MUTEX_UNLOCK(&mutex);
+}
+
+static int submit(void)
+{
+	unsigned i;
+	int ret;
+
+	for (i = 0; i < NDATA; i++)
+	{
+		ret = starpu_task_insert(&cl, STARPU_RW, handles[i], 0);
+		if (ret == -ENODEV) return ret;
+		STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_insert");
+	}
+	expected++;
+	return 0;
+}
+
+int main(void)
+{
+	starpu_data_handle_t reversed[NDATA];
+	unsigned iter, i;
+	int ret;
+
+	ret = starpu_init(NULL);
+	if (ret == -ENODEV) return STARPU_TEST_SKIPPED;
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+
+	for (i = 0; i < NDATA; i++)
+	{
+		starpu_vector_data_register(&handles[i], STARPU_MAIN_RAM, (uintptr_t) v[i], NX, sizeof(v[i][0]));
+		reversed[NDATA-1-i] = handles[i];
+	}
+
+	for (iter = 0; iter < NITER; iter++)
+	{
+		/* Synchronously, in both orders */
+		ret = submit();
+		if (ret == -ENODEV) goto enodev;
+		starpu_data_acquire_array(NDATA, iter % 2 ? reversed : handles, STARPU_R);
+		check(expected);
+		starpu_data_release_array(NDATA, handles);
+
+		/* Asynchronously */
+		ret = submit();
+		if (ret == -ENODEV) goto enodev;
+		acquired = 0;
+		cb_expected = expected;
+		starpu_data_acquire_array_cb(NDATA, handles, STARPU_RW, callback, &cb_expected);
+		expected++;
+		/* These have to wait for the release */
+		ret = submit();
+		if (ret == -ENODEV) goto enodev;
+
+		STARPU_PTHREAD_MUTEX_LOCK(&mutex);
+		while (!acquired)
+			STARPU_PTHREAD_COND_WAIT(&cond, &mutex);
+		STARPU_PTHREAD_MUTEX_UNLOCK(&mutex);
+	}
+
+	starpu_task_wait_for_all();
+	for (i = 0; i < NDATA; i++)
+		starpu_data_unregister(handles[i]);
+	check(expected);
+
+	starpu_shutdown();
+
+	return EXIT_SUCCESS;
+
+enodev:
+	starpu_task_wait_for_all();
+	for (i = 0; i < NDATA; i++)
+		starpu_data_unregister(handles[i]);
+	starpu_shutdown();
+	fprintf(stderr, "WARNING: No one can execute this task\n");
+	return STARPU_TEST_SKIPPED;
+}
@@ -0,0 +1,124 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <starpu.h>
+#include "../helper.h"
+
+/*
+ * Register the tiles of a matrix at once, work on them, and unregister them at
+ * once. Also register and unregister temporary data at once.
+ */
+
+#ifdef STARPU_QUICK_CHECK
+#define NT 16
+#else
+#define NT 64
+#endif
+#define BS 32
+
+static void inc(void *descr[], void *_args)
+{
+	int *m = (int *) STARPU_MATRIX_GET_PTR(descr[0]);
+	unsigned nx = STARPU_MATRIX_GET_NX(descr[0]);
+	unsigned ny = STARPU_MATRIX_GET_NY(descr[0]);
+	unsigned ld = STARPU_MATRIX_GET_LD(descr[0]);
+	unsigned i, j;
+	(void)_args;
+
+	for (j = 0; j < ny; j++)
+		for (i = 0; i < nx; i++)
+			m[j*ld + i]++;
+}
+
+static struct starpu_codelet cl =
+{
+	.cpu_funcs = {inc},
+	.cpu_funcs_name = {"inc"},
+	.nbuffers = 1,
+	.modes = {STARPU_RW}
+};
+
+static void zero(void *descr[], void *_args)
+{
+	int *v = (int *) STARPU_VECTOR_GET_PTR(descr[0]);
+	(void)_args;
+	memset(v, 0, STARPU_VECTOR_GET_NX(descr[0]) * sizeof(*v));
+}
+
+static struct starpu_codelet zero_cl =
+{
+	.cpu_funcs = {zero},
+	.cpu_funcs_name = {"zero"},
+	.nbuffers = 1,
+	.modes = {STARPU_W}
+};
+
+int main(void)
+{
+	int ret;
+	int *m;
+	starpu_data_handle_t handles[NT*NT];
+	starpu_data_handle_t tmp[NT];
+	uintptr_t ptrs[NT*NT];
+	unsigned i, j;
+
+	ret = starpu_init(NULL);
+	if (ret == -ENODEV) return STARPU_TEST_SKIPPED;
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+
+	m = calloc(NT*NT*BS*BS, sizeof(*m));
+	for (j = 0; j < NT; j++)
+		for (i = 0; i < NT; i++)
+			ptrs[j*NT+i] = (uintptr_t) &m[j*BS*NT*BS + i*BS];
+
+	starpu_matrix_data_register_array(handles, NT*NT, STARPU_MAIN_RAM, ptrs, NT*BS, BS, BS, sizeof(*m));
+	starpu_vector_data_register_array(tmp, NT, -1, NULL, BS, sizeof(int));
+
+	for (i = 0; i < NT*NT; i++)
+	{
+		ret = starpu_task_insert(&cl, STARPU_RW, handles[i], 0);
+		if (ret == -ENODEV) goto enodev;
+		STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_insert");
+		ret = starpu_task_insert(&cl, STARPU_RW, handles[i], 0);
+		STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_insert");
+	}
+	for (i = 0; i < NT; i++)
+	{
+		ret = starpu_task_insert(&zero_cl, STARPU_W, tmp[i], 0);
+		STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_insert");
+	}
+
+	/* Unregister one of them alone, the rest at once */
+	starpu_data_unregister(handles[0]);
+	starpu_data_unregister_array(NT*NT-1, handles+1);
+	starpu_data_unregister_array_submit(NT, tmp);
+
+	for (i = 0; i < NT*NT*BS*BS; i++)
+		STARPU_ASSERT_MSG(m[i] == 2, "m[%u] is %d instead of 2", i, m[i]);
+
+	starpu_shutdown();
+	free(m);
+
+	return EXIT_SUCCESS;
+
+enodev:
+	starpu_data_unregister_array_submit(NT*NT, handles);
+	starpu_data_unregister_array_submit(NT, tmp);
+	starpu_shutdown();
+	free(m);
+	fprintf(stderr, "WARNING: No one can execute this task\n");
+	return STARPU_TEST_SKIPPED;
+}
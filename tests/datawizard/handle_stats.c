@@ -0,0 +1,157 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <starpu.h>
+#include "../helper.h"
+
+/*
+ * Enable the per-handle statistics, access a named handle and the children of
+ * a partitioned handle with coordinates, and check the CSV written at
+ * shutdown.
+ */
+
+#define NITER 16
+#define NPARTS 4
+#define SIZE 1024
+
+#if !defined(STARPU_HAVE_SETENV)
+#warning setenv is not defined. Skipping test
+int main(void)
+{
+	return STARPU_TEST_SKIPPED;
+}
+#else
+
+static void func(void *descr[], void *arg)
+{
+	(void)descr;
+	(void)arg;
+}
+
+static struct starpu_codelet cl_r =
+{
+	.cpu_funcs = { func },
+	.cpu_funcs_name = { "func" },
+	.nbuffers = 1,
+	.modes = { STARPU_R },
+};
+
+static struct starpu_codelet cl_rw =
+{
+	.cpu_funcs = { func },
+	.cpu_funcs_name = { "func" },
+	.nbuffers = 1,
+	.modes = { STARPU_RW },
+};
+
+/* Return the number of accesses recorded for \p key, or -1 if not found */
+static long get_accesses(const char *filename, const char *key)
+{
+	FILE *f = fopen(filename, "r");
+	char line[512], expected[128];
+	long accesses = -1;
+
+	STARPU_ASSERT_MSG(f, "could not open %s", filename);
+	STARPU_ASSERT(fgets(line, sizeof(line), f));
+	STARPU_ASSERT_MSG(!strncmp(line, "handle,", 7), "bogus header %s", line);
+
+	snprintf(expected, sizeof(expected), "\"%s\",", key);
+	while (fgets(line, sizeof(line), f))
+	{
+		if (!strncmp(line, expected, strlen(expected)))
+		{
+			unsigned long size;
+			STARPU_ASSERT(sscanf(line + strlen(expected), "%lu,%ld", &size, &accesses) == 2);
+			break;
+		}
+	}
+	fclose(f);
+	return accesses;
+}
+
+int main(void)
+{
+	int ret;
+	unsigned i, iter;
+	int a, v[SIZE];
+	char filename[128];
+	char key[32];
+	starpu_data_handle_t a_handle, v_handle, children[NPARTS];
+	struct starpu_data_filter f =
+	{
+		.filter_func = starpu_vector_filter_block,
+		.nchildren = NPARTS
+	};
+
+	snprintf(filename, sizeof(filename), "/tmp/starpu_handle_stats_%d.csv", (int) getpid());
+	setenv("STARPU_HANDLE_STATS", "1", 1);
+	setenv("STARPU_HANDLE_STATS_FILE", filename, 1);
+
+	ret = starpu_init(NULL);
+	if (ret == -ENODEV) return STARPU_TEST_SKIPPED;
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+
+	starpu_variable_data_register(&a_handle, STARPU_MAIN_RAM, (uintptr_t) &a, sizeof(a));
+	starpu_data_set_name(a_handle, "a");
+	starpu_vector_data_register(&v_handle, STARPU_MAIN_RAM, (uintptr_t) v, SIZE, sizeof(v[0]));
+	starpu_data_set_name(v_handle, "v");
+
+	starpu_data_partition_plan(v_handle, &f, children);
+	for (i = 0; i < NPARTS; i++)
+		starpu_data_set_coordinates(children[i], 1, i);
+
+	for (iter = 0; iter < NITER; iter++)
+	{
+		ret = starpu_task_insert(&cl_r, STARPU_R, a_handle, 0);
+		if (ret == -ENODEV) goto enodev;
+		STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_insert");
+		for (i = 0; i < NPARTS; i++)
+		{
+			ret = starpu_task_insert(&cl_rw, STARPU_RW, children[i], 0);
+			if (ret == -ENODEV) goto enodev;
+			STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_insert");
+		}
+	}
+
+	starpu_data_partition_clean(v_handle, NPARTS, children);
+	starpu_data_unregister(v_handle);
+	starpu_data_unregister(a_handle);
+	starpu_shutdown();
+
+	STARPU_ASSERT_MSG(get_accesses(filename, "a") == NITER, "wrong number of accesses to a");
+	for (i = 0; i < NPARTS; i++)
+	{
+		snprintf(key, sizeof(key), "v[%u](%u)", i, i);
+		STARPU_ASSERT_MSG(get_accesses(filename, key) == NITER, "wrong number of accesses to %s", key);
+	}
+	unlink(filename);
+
+	return EXIT_SUCCESS;
+
+enodev:
+	starpu_task_wait_for_all();
+	starpu_data_partition_clean(v_handle, NPARTS, children);
+	starpu_data_unregister(v_handle);
+	starpu_data_unregister(a_handle);
+	starpu_shutdown();
+	unlink(filename);
+	return STARPU_TEST_SKIPPED;
+}
+#endif
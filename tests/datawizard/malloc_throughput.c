@@ -0,0 +1,143 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <starpu.h>
+#include "../helper.h"
+
+/*
+ * Measure the throughput of small allocations made concurrently by the
+ * workers in their memory node, for an increasing number of workers. CPU
+ * memory is suballocated in chunks when it is pinned, or when huge pages are
+ * enabled, so we enable the latter.
+ */
+
+#ifdef STARPU_QUICK_CHECK
+#define NITER 2000
+#else
+#define NITER 100000
+#endif
+/* Number of buffers kept allocated by each worker */
+#define WINDOW 16
+/* Number of different sizes */
+#define NSIZES 4
+
+#if !defined(STARPU_HAVE_SETENV)
+#warning setenv is not defined. Skipping test
+int main(void)
+{
+	return STARPU_TEST_SKIPPED;
+}
+#else
+
+static const size_t sizes[NSIZES] = { 4096, 16384, 40000, 65536 };
+
+static void alloc_loop(void *descr[], void *arg)
+{
+	(void)descr;
+	(void)arg;
+	unsigned node = starpu_worker_get_local_memory_node();
+	uintptr_t buffers[WINDOW] = { 0 };
+	size_t buffer_sizes[WINDOW];
+	unsigned i;
+
+	for (i = 0; i < NITER; i++)
+	{
+		unsigned slot = i % WINDOW;
+		if (buffers[slot])
+			starpu_free_on_node(node, buffers[slot], buffer_sizes[slot]);
+		buffer_sizes[slot] = sizes[(i * 7) % NSIZES];
+		buffers[slot] = starpu_malloc_on_node(node, buffer_sizes[slot]);
+		STARPU_ASSERT(buffers[slot]);
+		/* Touch it */
+		*(volatile char *) buffers[slot] = 0;
+	}
+
+	for (i = 0; i < WINDOW; i++)
+		if (buffers[i])
+			starpu_free_on_node(node, buffers[i], buffer_sizes[i]);
+}
+
+static struct starpu_codelet cl =
+{
+	.cpu_funcs = { alloc_loop },
+	.cpu_funcs_name = { "alloc_loop" },
+	.nbuffers = 0,
+};
+
+static int bench(int ncpus, double *throughput)
+{
+	struct starpu_conf conf;
+	int ret, worker, nworkers;
+	double start, end;
+
+	starpu_conf_init(&conf);
+	starpu_conf_noworker(&conf);
+	conf.ncpus = ncpus;
+	conf.precedence_over_environment_variables = 1;
+	ret = starpu_init(&conf);
+	if (ret == -ENODEV) return ret;
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+
+	nworkers = starpu_cpu_worker_get_count();
+	if (nworkers < ncpus)
+	{
+		starpu_shutdown();
+		return -ENODEV;
+	}
+
+	start = starpu_timing_now();
+	for (worker = 0; worker < nworkers; worker++)
+	{
+		ret = starpu_task_insert(&cl, STARPU_EXECUTE_ON_WORKER, worker, 0);
+		if (ret == -ENODEV) goto enodev;
+		STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_insert");
+	}
+	starpu_task_wait_for_all();
+	end = starpu_timing_now();
+
+	/* allocations + deallocations per µs */
+	*throughput = (2. * NITER * nworkers) / (end - start);
+	starpu_shutdown();
+	return 0;
+
+enodev:
+	starpu_task_wait_for_all();
+	starpu_shutdown();
+	return -ENODEV;
+}
+
+int main(void)
+{
+	int ncpus, ret;
+	double throughput;
+	int tested = 0;
+
+	setenv("STARPU_MALLOC_HUGEPAGES", "1", 0);
+
+	for (ncpus = 1; ; ncpus *= 2)
+	{
+		ret = bench(ncpus, &throughput);
+		if (ret == -ENODEV)
+			break;
+		FPRINTF(stdout, "%d workers: %.2f M(de)allocations/s\n", ncpus, throughput);
+		tested = 1;
+	}
+
+	return tested ? EXIT_SUCCESS : STARPU_TEST_SKIPPED;
+}
+#endif
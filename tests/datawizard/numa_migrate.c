@@ -0,0 +1,126 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <starpu.h>
+#include "../helper.h"
+
+/*
+ * Keep accessing a buffer registered on the first NUMA node from a worker of
+ * another NUMA node, and check that its pages get migrated there while the
+ * data stays coherent.
+ */
+
+#define SIZE (1024*1024)
+#define NITER 8
+
+#if !defined(STARPU_HAVE_SETENV)
+#warning setenv is not defined. Skipping test
+int main(void)
+{
+	return STARPU_TEST_SKIPPED;
+}
+#else
+
+static void inc(void *descr[], void *_args)
+{
+	int *v = (int *) STARPU_VECTOR_GET_PTR(descr[0]);
+	unsigned n = STARPU_VECTOR_GET_NX(descr[0]);
+	unsigned i;
+	(void)_args;
+
+	for (i = 0; i < n; i++)
+		v[i]++;
+}
+
+static struct starpu_codelet cl =
+{
+	.cpu_funcs = {inc},
+	.cpu_funcs_name = {"inc"},
+	.nbuffers = 1,
+	.modes = {STARPU_RW}
+};
+
+int main(void)
+{
+	int ret;
+	int *v;
+	starpu_data_handle_t handle;
+	unsigned iter, i;
+	int worker, remote_worker = -1;
+	unsigned remote_node = 0;
+
+	setenv("STARPU_NUMA_MIGRATE", "2", 1);
+	setenv("STARPU_USE_NUMA", "1", 1);
+
+	ret = starpu_init(NULL);
+	if (ret == -ENODEV) return STARPU_TEST_SKIPPED;
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+
+	for (worker = 0; worker < (int) starpu_worker_get_count(); worker++)
+	{
+		unsigned node = starpu_worker_get_memory_node(worker);
+		if (starpu_worker_get_type(worker) == STARPU_CPU_WORKER && node != STARPU_MAIN_RAM
+			&& starpu_node_get_kind(node) == STARPU_CPU_RAM)
+		{
+			remote_worker = worker;
+			remote_node = node;
+			break;
+		}
+	}
+
+	if (remote_worker == -1)
+	{
+		starpu_shutdown();
+		return STARPU_TEST_SKIPPED;
+	}
+
+	v = malloc(SIZE * sizeof(*v));
+	for (i = 0; i < SIZE; i++)
+		v[i] = i;
+	starpu_vector_data_register(&handle, STARPU_MAIN_RAM, (uintptr_t) v, SIZE, sizeof(v[0]));
+
+	for (iter = 0; iter < NITER; iter++)
+	{
+		ret = starpu_task_insert(&cl, STARPU_RW, handle, STARPU_EXECUTE_ON_WORKER, remote_worker, 0);
+		if (ret == -ENODEV) goto enodev;
+		STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_insert");
+		/* Write it from the first node, so that the next task misses it */
+		starpu_data_acquire_on_node(handle, STARPU_MAIN_RAM, STARPU_RW);
+		starpu_data_release_on_node(handle, STARPU_MAIN_RAM);
+	}
+
+	starpu_task_wait_for_all();
+	if (starpu_data_get_home_node(handle) != (int) remote_node)
+		FPRINTF(stderr, "data was not migrated to node %u\n", remote_node);
+
+	starpu_data_unregister(handle);
+
+	for (i = 0; i < SIZE; i++)
+		STARPU_ASSERT_MSG(v[i] == (int) (i + NITER), "v[%u] is %d instead of %u", i, v[i], i + NITER);
+	free(v);
+
+	starpu_shutdown();
+
+	return EXIT_SUCCESS;
+
+enodev:
+	starpu_data_unregister(handle);
+	free(v);
+	starpu_shutdown();
+	fprintf(stderr, "WARNING: No one can execute this task\n");
+	return STARPU_TEST_SKIPPED;
+}
+#endif
@@ -0,0 +1,125 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <starpu.h>
+#include "../helper.h"
+
+/*
+ * Partition a data registered without a home node and with lazy
+ * allocation, check that it is not allocated in main memory until it gets
+ * unpartitioned, and that the pieces written by tasks are then gathered.
+ * The first child is partitioned again, to also check nested partitioning.
+ */
+
+#define SIZE 4096
+#define NPARTS 4
+#define NSUBPARTS 2
+
+static void fill(void *descr[], void *arg)
+{
+	int *v = (int *) STARPU_VECTOR_GET_PTR(descr[0]);
+	unsigned n = STARPU_VECTOR_GET_NX(descr[0]);
+	int base;
+	unsigned i;
+
+	starpu_codelet_unpack_args(arg, &base);
+	for (i = 0; i < n; i++)
+		v[i] = base + i;
+}
+
+static struct starpu_codelet cl =
+{
+	.cpu_funcs = {fill},
+	.cpu_funcs_name = {"fill"},
+	.nbuffers = 1,
+	.modes = {STARPU_W}
+};
+
+static int submit_fill(starpu_data_handle_t handle, int base)
+{
+	return starpu_task_insert(&cl, STARPU_W, handle, STARPU_VALUE, &base, sizeof(base), 0);
+}
+
+int main(void)
+{
+	int ret;
+	unsigned i;
+	starpu_data_handle_t handle, sub;
+	int *v;
+
+	ret = starpu_init(NULL);
+	if (ret == -ENODEV) return STARPU_TEST_SKIPPED;
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+
+	starpu_vector_data_register(&handle, -1, 0, SIZE, sizeof(int));
+	starpu_data_set_lazy_allocation_flag(handle, 1);
+
+	struct starpu_data_filter f =
+	{
+		.filter_func = starpu_vector_filter_block,
+		.nchildren = NPARTS
+	};
+	struct starpu_data_filter f2 =
+	{
+		.filter_func = starpu_vector_filter_block,
+		.nchildren = NSUBPARTS
+	};
+
+	starpu_data_partition(handle, &f);
+	STARPU_ASSERT_MSG(!starpu_data_test_if_allocated_on_node(handle, STARPU_MAIN_RAM), "the data was allocated by partitioning");
+
+	sub = starpu_data_get_child(handle, 0);
+	STARPU_ASSERT(starpu_data_get_lazy_allocation_flag(sub));
+	starpu_data_partition(sub, &f2);
+
+	for (i = 0; i < NSUBPARTS; i++)
+	{
+		ret = submit_fill(starpu_data_get_sub_data(handle, 2, 0, i), i * (SIZE / NPARTS / NSUBPARTS));
+		if (ret == -ENODEV) goto enodev;
+		STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_insert");
+	}
+	for (i = 1; i < NPARTS; i++)
+	{
+		ret = submit_fill(starpu_data_get_child(handle, i), i * (SIZE / NPARTS));
+		if (ret == -ENODEV) goto enodev;
+		STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_insert");
+	}
+
+	starpu_task_wait_for_all();
+	STARPU_ASSERT_MSG(!starpu_data_test_if_allocated_on_node(handle, STARPU_MAIN_RAM), "the data was allocated by writing the pieces");
+
+	starpu_data_unpartition(handle, STARPU_MAIN_RAM);
+
+	ret = starpu_data_acquire(handle, STARPU_R);
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_data_acquire");
+	v = (int *) starpu_data_get_local_ptr(handle);
+	for (i = 0; i < SIZE; i++)
+		STARPU_ASSERT_MSG(v[i] == (int) i, "v[%u] is %d instead of %u", i, v[i], i);
+	starpu_data_release(handle);
+
+	starpu_data_unregister(handle);
+	starpu_shutdown();
+
+	return EXIT_SUCCESS;
+
+enodev:
+	starpu_task_wait_for_all();
+	starpu_data_unpartition(handle, STARPU_MAIN_RAM);
+	starpu_data_unregister(handle);
+	starpu_shutdown();
+	fprintf(stderr, "WARNING: No one can execute this task\n");
+	return STARPU_TEST_SKIPPED;
+}
@@ -0,0 +1,163 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <starpu.h>
+#include "../helper.h"
+
+/*
+ * Alternate between two partitionings of the same data, releasing the plans
+ * into the cache, and check that the child handles get reused and that the
+ * data stays coherent. Then check that a filter_arg_ptr buffer reused with
+ * different contents does not get the previous children.
+ */
+
+#define SIZE 1024
+#define NPARTS1 4
+#define NPARTS2 8
+#ifdef STARPU_QUICK_CHECK
+#define NITER 8
+#else
+#define NITER 32
+#endif
+
+static void inc(void *descr[], void *_args)
+{
+	int *v = (int *) STARPU_VECTOR_GET_PTR(descr[0]);
+	unsigned n = STARPU_VECTOR_GET_NX(descr[0]);
+	unsigned i;
+	(void)_args;
+
+	for (i = 0; i < n; i++)
+		v[i]++;
+}
+
+static struct starpu_codelet cl =
+{
+	.cpu_funcs = {inc},
+	.cpu_funcs_name = {"inc"},
+	.nbuffers = 1,
+	.modes = {STARPU_RW}
+};
+
+static int process(starpu_data_handle_t handle, struct starpu_data_filter *f, unsigned nparts, starpu_data_handle_t *handles)
+{
+	unsigned i;
+	int ret;
+
+	starpu_data_partition_plan(handle, f, handles);
+	starpu_data_partition_submit(handle, nparts, handles);
+	for (i = 0; i < nparts; i++)
+	{
+		ret = starpu_task_insert(&cl, STARPU_RW, handles[i], 0);
+		if (ret == -ENODEV) return ret;
+		STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_insert");
+	}
+	starpu_data_partition_plan_release(handle, f, nparts, handles);
+	return 0;
+}
+
+int main(void)
+{
+	int ret;
+	int v[SIZE];
+	starpu_data_handle_t handle, handles1[NPARTS1], handles2[NPARTS2];
+	starpu_data_handle_t first1[NPARTS1], first2[NPARTS2];
+	unsigned iter, i;
+
+	ret = starpu_init(NULL);
+	if (ret == -ENODEV) return STARPU_TEST_SKIPPED;
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+
+	for (i = 0; i < SIZE; i++)
+		v[i] = i;
+	starpu_vector_data_register(&handle, STARPU_MAIN_RAM, (uintptr_t) v, SIZE, sizeof(v[0]));
+
+	struct starpu_data_filter f1 =
+	{
+		.filter_func = starpu_vector_filter_block,
+		.nchildren = NPARTS1
+	};
+	struct starpu_data_filter f2 =
+	{
+		.filter_func = starpu_vector_filter_block,
+		.nchildren = NPARTS2
+	};
+
+	for (iter = 0; iter < NITER; iter++)
+	{
+		ret = process(handle, &f1, NPARTS1, handles1);
+		if (ret == -ENODEV) goto enodev;
+		ret = process(handle, &f2, NPARTS2, handles2);
+		if (ret == -ENODEV) goto enodev;
+
+		if (iter == 0)
+		{
+			memcpy(first1, handles1, sizeof(handles1));
+			memcpy(first2, handles2, sizeof(handles2));
+		}
+		else
+		{
+			STARPU_ASSERT_MSG(!memcmp(first1, handles1, sizeof(handles1)), "partition plan was not reused");
+			STARPU_ASSERT_MSG(!memcmp(first2, handles2, sizeof(handles2)), "partition plan was not reused");
+		}
+	}
+
+	/* Also check a plain clean of a plan taken from the cache */
+	starpu_data_partition_plan(handle, &f1, handles1);
+	STARPU_ASSERT(!memcmp(first1, handles1, sizeof(handles1)));
+	starpu_data_partition_clean(handle, NPARTS1, handles1);
+
+	/* Reuse the same lengths buffer, with different contents */
+	uint32_t lengths[NPARTS1];
+	struct starpu_data_filter f3 =
+	{
+		.filter_func = starpu_vector_filter_list,
+		.nchildren = NPARTS1,
+		.filter_arg_ptr = lengths
+	};
+	for (iter = 0; iter < 2; iter++)
+	{
+		for (i = 0; i < NPARTS1; i++)
+			lengths[i] = i == iter ? SIZE - (NPARTS1-1) * (SIZE/8) : SIZE/8;
+		starpu_data_partition_plan(handle, &f3, handles1);
+		for (i = 0; i < NPARTS1; i++)
+			STARPU_ASSERT_MSG(starpu_vector_get_nx(handles1[i]) == lengths[i], "piece %u has %u elements instead of %u", i, (unsigned) starpu_vector_get_nx(handles1[i]), (unsigned) lengths[i]);
+		starpu_data_partition_submit(handle, NPARTS1, handles1);
+		for (i = 0; i < NPARTS1; i++)
+		{
+			ret = starpu_task_insert(&cl, STARPU_RW, handles1[i], 0);
+			if (ret == -ENODEV) goto enodev;
+			STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_insert");
+		}
+		starpu_data_partition_plan_release(handle, &f3, NPARTS1, handles1);
+	}
+
+	starpu_data_unregister(handle);
+
+	for (i = 0; i < SIZE; i++)
+		STARPU_ASSERT_MSG(v[i] == (int) (i + 2*NITER + 2), "v[%u] is %d instead of %u", i, v[i], i + 2*NITER + 2);
+
+	starpu_shutdown();
+
+	return EXIT_SUCCESS;
+
+enodev:
+	starpu_data_partition_plan_cache_flush(handle);
+	starpu_data_unregister(handle);
+	starpu_shutdown();
+	fprintf(stderr, "WARNING: No one can execute this task\n");
+	return STARPU_TEST_SKIPPED;
+}
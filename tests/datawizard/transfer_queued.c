@@ -0,0 +1,125 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <starpu.h>
+#include "../helper.h"
+
+/*
+ * Idle-prefetch a bunch of data to another memory node while the workers are
+ * paused, upgrade them to prefetches, check that the queued transfer volume
+ * of the link then accounts for them, that it makes transfer predictions
+ * longer, and that it goes back to zero once the data is there.
+ */
+
+#define NDATA 16
+#define SIZE (1024*1024)
+
+#if !defined(STARPU_HAVE_SETENV)
+#warning setenv is not defined. Skipping test
+int main(void)
+{
+	return STARPU_TEST_SKIPPED;
+}
+#else
+
+int main(void)
+{
+	starpu_data_handle_t handles[NDATA];
+	size_t size = SIZE * sizeof(float);
+	size_t queued;
+	unsigned nrequests;
+	double busy_prediction, idle_prediction;
+	float *v[NDATA];
+	unsigned node, dst_node = STARPU_MAIN_RAM;
+	unsigned i;
+	int ret;
+
+	setenv("STARPU_USE_NUMA", "1", 1);
+	/* Have several NUMA nodes, even on a single-node machine */
+	setenv("HWLOC_SYNTHETIC", "pack:4 numa:1 core:1 pu:1", 0);
+	setenv("STARPU_TRANSFER_CONTENTION", "1", 1);
+
+	ret = starpu_init(NULL);
+	if (ret == -ENODEV) return STARPU_TEST_SKIPPED;
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+
+	for (node = 0; node < starpu_memory_nodes_get_count(); node++)
+		if (node != STARPU_MAIN_RAM && starpu_node_get_kind(node) != STARPU_DISK_RAM)
+		{
+			dst_node = node;
+			break;
+		}
+
+	if (dst_node == STARPU_MAIN_RAM)
+	{
+		starpu_shutdown();
+		return STARPU_TEST_SKIPPED;
+	}
+
+	queued = starpu_transfer_queued(STARPU_MAIN_RAM, dst_node, &nrequests);
+	STARPU_ASSERT_MSG(queued == 0 && nrequests == 0, "%zu bytes in %u requests queued before any transfer", queued, nrequests);
+
+	for (i = 0; i < NDATA; i++)
+	{
+		v[i] = calloc(SIZE, sizeof(float));
+		starpu_vector_data_register(&handles[i], STARPU_MAIN_RAM, (uintptr_t) v[i], SIZE, sizeof(float));
+	}
+
+	/* Keep the requests queued */
+	starpu_pause();
+
+	/* Idle prefetches do not compete with other transfers */
+	for (i = 0; i < NDATA; i++)
+		starpu_data_idle_prefetch_on_node(handles[i], dst_node, 1);
+	queued = starpu_transfer_queued(STARPU_MAIN_RAM, dst_node, &nrequests);
+	STARPU_ASSERT_MSG(queued == 0 && nrequests == 0, "%zu bytes in %u requests queued for %d idle prefetches", queued, nrequests, NDATA);
+
+	/* Until they get upgraded */
+	for (i = 0; i < NDATA; i++)
+		starpu_data_prefetch_on_node(handles[i], dst_node, 1);
+	queued = starpu_transfer_queued(STARPU_MAIN_RAM, dst_node, &nrequests);
+	busy_prediction = starpu_transfer_predict(STARPU_MAIN_RAM, dst_node, size);
+	FPRINTF(stderr, "%zu bytes in %u requests queued for %d prefetches\n", queued, nrequests, NDATA);
+	STARPU_ASSERT_MSG(nrequests > 0 && queued > 0, "no transfer queued after %d prefetches", NDATA);
+	STARPU_ASSERT_MSG(nrequests <= NDATA && queued == nrequests * size, "%zu bytes in %u requests queued for %d prefetches", queued, nrequests, NDATA);
+
+	starpu_resume();
+
+	for (i = 0; i < NDATA; i++)
+	{
+		ret = starpu_data_acquire_on_node(handles[i], dst_node, STARPU_R);
+		STARPU_CHECK_RETURN_VALUE(ret, "starpu_data_acquire_on_node");
+		starpu_data_release_on_node(handles[i], dst_node);
+	}
+	starpu_task_wait_for_all();
+
+	queued = starpu_transfer_queued(STARPU_MAIN_RAM, dst_node, &nrequests);
+	STARPU_ASSERT_MSG(queued == 0 && nrequests == 0, "%zu bytes in %u requests still queued after the transfers", queued, nrequests);
+
+	idle_prediction = starpu_transfer_predict(STARPU_MAIN_RAM, dst_node, size);
+	STARPU_ASSERT_MSG(busy_prediction > idle_prediction, "busy link predicted at %f but idle link at %f", busy_prediction, idle_prediction);
+
+	for (i = 0; i < NDATA; i++)
+	{
+		starpu_data_unregister(handles[i]);
+		free(v[i]);
+	}
+
+	starpu_shutdown();
+
+	return EXIT_SUCCESS;
+}
+#endif
@@ -401,6 +401,10 @@ int main(void)
 
 	ret = merge_result(ret, dotest(&starpu_disk_stdio_ops, s));
 	ret = merge_result(ret, dotest(&starpu_disk_unistd_ops, s));
+	ret = merge_result(ret, dotest(&starpu_disk_unistd_mmap_ops, s));
+#ifdef STARPU_HAVE_IO_URING
+	ret = merge_result(ret, dotest(&starpu_disk_unistd_uring_ops, s));
+#endif
 #ifdef STARPU_LINUX_SYS
 	if ((NX * sizeof(int)) % getpagesize() == 0)
 	{
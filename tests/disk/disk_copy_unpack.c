@@ -164,6 +164,17 @@ int main(void)
 
 	ret = merge_result(ret, dotest(&starpu_disk_stdio_ops, s));
 	ret = merge_result(ret, dotest(&starpu_disk_unistd_ops, s));
+	ret = merge_result(ret, dotest(&starpu_disk_unistd_mmap_ops, s));
+	struct starpu_disk_compress_param compress_param =
+	{
+		.ops = &starpu_disk_unistd_ops,
+		.parameter = s,
+		.threshold = 0,
+	};
+	ret = merge_result(ret, dotest(&starpu_disk_compress_ops, &compress_param));
+#ifdef STARPU_HAVE_IO_URING
+	ret = merge_result(ret, dotest(&starpu_disk_unistd_uring_ops, s));
+#endif
 #ifdef STARPU_LINUX_SYS
 	ret = merge_result(ret, dotest(&starpu_disk_unistd_o_direct_ops, s));
 #endif
@@ -0,0 +1,188 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <starpu.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include "../helper.h"
+
+/*
+ * Stream several times over more data than the main memory can hold, so
+ * that the out-of-core sequence prefetcher gets to predict the next data to
+ * be read from the disk.
+ */
+
+#ifdef STARPU_QUICK_CHECK
+#  define NDATA 8
+#  define NITER 3
+#else
+#  define NDATA 32
+#  define NITER 5
+#endif
+/* in elements */
+#define NX (512*1024/sizeof(unsigned))
+#define MEMSIZE_STR "2"
+
+#if !defined(STARPU_HAVE_SETENV)
+#warning setenv is not defined. Skipping test
+int main(void)
+{
+	return STARPU_TEST_SKIPPED;
+}
+#elif STARPU_MAXNODES == 1
+/* Cannot register a disk */
+int main(int argc, char **argv)
+{
+	return STARPU_TEST_SKIPPED;
+}
+#else
+
+static void zero(void *buffers[], void *args)
+{
+	(void)args;
+	unsigned *val = (unsigned*) STARPU_VECTOR_GET_PTR(buffers[0]);
+	unsigned n = STARPU_VECTOR_GET_NX(buffers[0]);
+	unsigned i;
+	for (i = 0; i < n; i++)
+		val[i] = 0;
+}
+
+static void inc(void *buffers[], void *args)
+{
+	(void)args;
+	unsigned *val = (unsigned*) STARPU_VECTOR_GET_PTR(buffers[0]);
+	unsigned n = STARPU_VECTOR_GET_NX(buffers[0]);
+	unsigned i;
+	for (i = 0; i < n; i++)
+		val[i]++;
+}
+
+static void check(void *buffers[], void *args)
+{
+	unsigned *val = (unsigned*) STARPU_VECTOR_GET_PTR(buffers[0]);
+	unsigned n = STARPU_VECTOR_GET_NX(buffers[0]);
+	unsigned expected;
+	unsigned i;
+	starpu_codelet_unpack_args(args, &expected);
+	for (i = 0; i < n; i++)
+		STARPU_ASSERT_MSG(val[i] == expected, "Incorrect value. Value %u should be %u", val[i], expected);
+}
+
+static struct starpu_codelet zero_cl =
+{
+	.cpu_funcs = { zero },
+	.nbuffers = 1,
+	.modes = { STARPU_W },
+};
+
+static struct starpu_codelet inc_cl =
+{
+	.cpu_funcs = { inc },
+	.nbuffers = 1,
+	.modes = { STARPU_RW },
+};
+
+static struct starpu_codelet check_cl =
+{
+	.cpu_funcs = { check },
+	.nbuffers = 1,
+	.modes = { STARPU_R },
+};
+
+static int stream(starpu_data_handle_t *handles, unsigned n)
+{
+	unsigned iter, i;
+	int ret;
+
+	for (i = 0; i < n; i++)
+	{
+		ret = starpu_task_insert(&zero_cl, STARPU_W, handles[i], 0);
+		if (ret == -ENODEV) return ret;
+		STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_insert");
+	}
+
+	for (iter = 0; iter < NITER; iter++)
+		for (i = 0; i < n; i++)
+		{
+			ret = starpu_task_insert(&inc_cl, STARPU_RW, handles[i], 0);
+			if (ret == -ENODEV) return ret;
+			STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_insert");
+		}
+
+	unsigned expected = NITER;
+	for (i = 0; i < n; i++)
+	{
+		ret = starpu_task_insert(&check_cl, STARPU_R, handles[i], STARPU_VALUE, &expected, sizeof(expected), 0);
+		if (ret == -ENODEV) return ret;
+		STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_insert");
+	}
+
+	starpu_task_wait_for_all();
+	return 0;
+}
+
+int main(void)
+{
+	starpu_data_handle_t handles[NDATA];
+	char s[128];
+	unsigned i;
+	int ret;
+
+	snprintf(s, sizeof(s), "/tmp/%s-disk-XXXXXX", getenv("USER"));
+	if (!_starpu_mkdtemp(s))
+	{
+		FPRINTF(stderr, "Cannot make directory '%s'\n", s);
+		return STARPU_TEST_SKIPPED;
+	}
+
+	setenv("STARPU_LIMIT_CPU_NUMA_MEM", MEMSIZE_STR, 1);
+
+	struct starpu_conf conf;
+	ret = starpu_conf_init(&conf);
+	if (ret == -EINVAL)
+		return EXIT_FAILURE;
+	conf.precedence_over_environment_variables = 1;
+	starpu_conf_noworker(&conf);
+	conf.ncpus = 1;
+	ret = starpu_init(&conf);
+	if (ret == -ENODEV) goto skip;
+
+	int new_dd = starpu_disk_register(&starpu_disk_unistd_ops, (void *) s, STARPU_DISK_SIZE_MIN);
+	if (new_dd == -ENOENT)
+	{
+		starpu_shutdown();
+		goto skip;
+	}
+
+	for (i = 0; i < NDATA; i++)
+		starpu_vector_data_register(&handles[i], -1, 0, NX, sizeof(unsigned));
+	ret = stream(handles, NDATA);
+	for (i = 0; i < NDATA; i++)
+		starpu_data_unregister(handles[i]);
+	if (ret == -ENODEV) goto enodev;
+
+	starpu_shutdown();
+	rmdir(s);
+	return EXIT_SUCCESS;
+
+enodev:
+	starpu_shutdown();
+skip:
+	rmdir(s);
+	return STARPU_TEST_SKIPPED;
+}
+#endif
@@ -279,6 +279,16 @@ int main(void)
 	if (ret == STARPU_TEST_SKIPPED) goto skipped;
 	ret = merge_result(ret, dotest(&starpu_disk_unistd_ops, s, starpu_my_vector_data_register, "unistd with pack/unpack vector ops"));
 	if (ret == STARPU_TEST_SKIPPED) goto skipped;
+	ret = merge_result(ret, dotest(&starpu_disk_unistd_mmap_ops, s, starpu_vector_data_register, "unistd_mmap with read/write vector ops"));
+	if (ret == STARPU_TEST_SKIPPED) goto skipped;
+	ret = merge_result(ret, dotest(&starpu_disk_unistd_mmap_ops, s, starpu_my_vector_data_register, "unistd_mmap with pack/unpack vector ops"));
+	if (ret == STARPU_TEST_SKIPPED) goto skipped;
+#ifdef STARPU_HAVE_IO_URING
+	ret = merge_result(ret, dotest(&starpu_disk_unistd_uring_ops, s, starpu_vector_data_register, "unistd_uring with read/write vector ops"));
+	if (ret == STARPU_TEST_SKIPPED) goto skipped;
+	ret = merge_result(ret, dotest(&starpu_disk_unistd_uring_ops, s, starpu_my_vector_data_register, "unistd_uring with pack/unpack vector ops"));
+	if (ret == STARPU_TEST_SKIPPED) goto skipped;
+#endif
 #ifdef STARPU_LINUX_SYS
 	ret = merge_result(ret, dotest(&starpu_disk_unistd_o_direct_ops, s, starpu_vector_data_register, "unistd_direct with read/write vector ops"));
 	if (ret == STARPU_TEST_SKIPPED) goto skipped;
@@ -0,0 +1,72 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <starpu.h>
+#include <starpu_hash.h>
+#include "../helper.h"
+
+/*
+ * Check that the hash functions return the same values as the bit-by-bit
+ * definition, for all lengths and alignments, since these values are
+ * stored in the performance model files.
+ */
+
+#define SIZE 256
+
+static uint32_t ref_crc32c_be_n(const uint8_t *p, size_t n, uint32_t crc)
+{
+	size_t i;
+	unsigned j;
+
+	for (i = 0; i < n; i++)
+	{
+		crc ^= ((uint32_t) p[i]) << 24;
+		for (j = 0; j < 8; j++)
+			crc = (crc << 1) ^ ((crc & 0x80000000) ? 0x1EDC6F41 : 0);
+	}
+	return crc;
+}
+
+int main(void)
+{
+	uint8_t buffer[SIZE + 8];
+	size_t offset, n;
+	uint32_t crc, i;
+	const char *str = "starpu_perfmodel";
+	void *ptr = buffer;
+
+	for (i = 0; i < sizeof(buffer); i++)
+		buffer[i] = (uint8_t) (i * 37 + 11);
+
+	for (offset = 0; offset < 8; offset++)
+		for (n = 0; n <= SIZE; n++)
+		{
+			crc = (uint32_t) (n * 2654435761U);
+			STARPU_ASSERT_MSG(starpu_hash_crc32c_be_n(buffer + offset, n, crc) == ref_crc32c_be_n(buffer + offset, n, crc),
+					  "wrong hash for %zu bytes at offset %zu", n, offset);
+		}
+
+	for (i = 0; i < 1000; i++)
+	{
+		crc = i * 0x9E3779B9;
+		STARPU_ASSERT(starpu_hash_crc32c_be(i, crc) == ref_crc32c_be_n((uint8_t *) &i, sizeof(i), crc));
+	}
+
+	STARPU_ASSERT(starpu_hash_crc32c_string(str, 0) == ref_crc32c_be_n((const uint8_t *) str, strlen(str), 0));
+	STARPU_ASSERT(starpu_hash_crc32c_be_ptr(ptr, 42) == ref_crc32c_be_n((const uint8_t *) &ptr, sizeof(ptr), 42));
+
+	return EXIT_SUCCESS;
+}
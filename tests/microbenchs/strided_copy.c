@@ -0,0 +1,217 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <starpu.h>
+#include "../helper.h"
+
+/*
+ * Measure the bandwidth of the copy and pack/peek methods of the strided
+ * interfaces, for narrow, medium and wide tiles, and compare it with a plain
+ * row-by-row memcpy loop. The source and destination use different leading
+ * dimensions, and the results are checked.
+ */
+
+#ifdef STARPU_QUICK_CHECK
+#define NITER 4
+#else
+#define NITER 32
+#endif
+
+struct shape
+{
+	const char *name;
+	uint32_t nx, ny, nz, nt;
+	/* Padding of the rows in the source */
+	uint32_t pad;
+};
+
+static const struct shape shapes[] =
+{
+	{ "narrow", 4, 512, 4, 2, 252 },
+	{ "medium", 60, 128, 4, 2, 68 },
+	{ "wide", 1000, 32, 4, 2, 24 },
+};
+#define NSHAPES (sizeof(shapes)/sizeof(shapes[0]))
+
+enum interface { MATRIX, BLOCK, TENSOR, NDIM, NINTERFACES };
+static const char *interface_names[NINTERFACES] = { "matrix", "block", "tensor", "ndim" };
+
+/* Register nx*ny*nz*nt elements with rows ld apart, with the given interface */
+static starpu_data_handle_t do_register(enum interface iface, int *ptr, const struct shape *s, uint32_t ld)
+{
+	starpu_data_handle_t handle = NULL;
+	uint32_t ldn[4] = { 1, ld, ld*s->ny, ld*s->ny*s->nz };
+	uint32_t nn[4] = { s->nx, s->ny, s->nz, s->nt };
+
+	switch (iface)
+	{
+	case MATRIX:
+		starpu_matrix_data_register(&handle, STARPU_MAIN_RAM, (uintptr_t) ptr, ld, s->nx, s->ny*s->nz*s->nt, sizeof(int));
+		break;
+	case BLOCK:
+		starpu_block_data_register(&handle, STARPU_MAIN_RAM, (uintptr_t) ptr, ldn[1], ldn[2], s->nx, s->ny, s->nz*s->nt, sizeof(int));
+		break;
+	case TENSOR:
+		starpu_tensor_data_register(&handle, STARPU_MAIN_RAM, (uintptr_t) ptr, ldn[1], ldn[2], ldn[3], s->nx, s->ny, s->nz, s->nt, sizeof(int));
+		break;
+	case NDIM:
+		starpu_ndim_data_register(&handle, STARPU_MAIN_RAM, (uintptr_t) ptr, ldn, nn, 4, sizeof(int));
+		break;
+	default:
+		STARPU_ABORT();
+	}
+	return handle;
+}
+
+static void check(const int *dst, uint32_t ld_dst, const int *src, uint32_t ld_src, const struct shape *s, const char *what)
+{
+	uint32_t nrows = s->ny*s->nz*s->nt;
+	uint32_t x, y;
+	for (y = 0; y < nrows; y++)
+		for (x = 0; x < s->nx; x++)
+			STARPU_ASSERT_MSG(dst[y*ld_dst + x] == src[y*ld_src + x], "%s: wrong value at row %u column %u: %d instead of %d", what, y, x, dst[y*ld_dst + x], src[y*ld_src + x]);
+}
+
+/* Reference: row by row memcpy */
+static double bench_memcpy(const int *src, uint32_t ld_src, const struct shape *s)
+{
+	uint32_t nrows = s->ny*s->nz*s->nt;
+	size_t rowsize = s->nx*sizeof(int);
+	char *packed = malloc(nrows * rowsize);
+	double start, end;
+	unsigned iter;
+	uint32_t y;
+
+	/* Warm up */
+	memset(packed, 0, nrows * rowsize);
+
+	start = starpu_timing_now();
+	for (iter = 0; iter < NITER; iter++)
+	{
+		char *cur = packed;
+		for (y = 0; y < nrows; y++)
+		{
+			memcpy(cur, src + y*ld_src, rowsize);
+			cur += rowsize;
+		}
+		STARPU_SYNCHRONIZE();
+	}
+	end = starpu_timing_now();
+	free(packed);
+	return (double) NITER * nrows * rowsize / (end - start);
+}
+
+static int bench(enum interface iface, const struct shape *s)
+{
+	uint32_t ld_src = s->nx + s->pad;
+	uint32_t ld_dst = s->nx + s->pad/2 + 1;
+	uint32_t nrows = s->ny*s->nz*s->nt;
+	size_t size = (size_t) nrows * s->nx * sizeof(int);
+	int *src, *dst;
+	starpu_data_handle_t src_handle, dst_handle;
+	double start, end, pack_bw, peek_bw, copy_bw;
+	unsigned iter, i;
+	void *packed = NULL;
+	starpu_ssize_t count;
+	int ret = 0;
+
+	src = malloc((size_t) nrows * ld_src * sizeof(int));
+	dst = calloc((size_t) nrows * ld_dst, sizeof(int));
+	for (i = 0; i < nrows * ld_src; i++)
+		src[i] = i;
+
+	src_handle = do_register(iface, src, s, ld_src);
+	dst_handle = do_register(iface, dst, s, ld_dst);
+
+	/* Pack / peek, as used for MPI and out-of-core. Warm up first */
+	starpu_data_pack_node(src_handle, STARPU_MAIN_RAM, &packed, &count);
+	starpu_data_peek_node(dst_handle, STARPU_MAIN_RAM, packed, count);
+	starpu_free_on_node_flags(STARPU_MAIN_RAM, (uintptr_t) packed, count, 0);
+
+	start = starpu_timing_now();
+	for (iter = 0; iter < NITER; iter++)
+	{
+		starpu_data_pack_node(src_handle, STARPU_MAIN_RAM, &packed, &count);
+		STARPU_ASSERT((size_t) count == size);
+		if (iter < NITER-1)
+			starpu_free_on_node_flags(STARPU_MAIN_RAM, (uintptr_t) packed, count, 0);
+	}
+	end = starpu_timing_now();
+	pack_bw = (double) NITER * size / (end - start);
+
+	start = starpu_timing_now();
+	for (iter = 0; iter < NITER; iter++)
+		starpu_data_peek_node(dst_handle, STARPU_MAIN_RAM, packed, count);
+	end = starpu_timing_now();
+	peek_bw = (double) NITER * size / (end - start);
+	starpu_free_on_node_flags(STARPU_MAIN_RAM, (uintptr_t) packed, count, 0);
+
+	check(dst, ld_dst, src, ld_src, s, "peek");
+
+	/* Copy between two handles */
+	memset(dst, 0, (size_t) nrows * ld_dst * sizeof(int));
+	start = starpu_timing_now();
+	for (iter = 0; iter < NITER; iter++)
+	{
+		ret = starpu_data_cpy(dst_handle, src_handle, 0, NULL, NULL);
+		if (ret == -ENODEV)
+			goto out;
+		STARPU_CHECK_RETURN_VALUE(ret, "starpu_data_cpy");
+	}
+	end = starpu_timing_now();
+	copy_bw = (double) NITER * size / (end - start);
+
+	starpu_data_acquire(dst_handle, STARPU_R);
+	check(dst, ld_dst, src, ld_src, s, "copy");
+	starpu_data_release(dst_handle);
+
+	FPRINTF(stdout, "%-6s %-6s pack %8.1f MB/s  peek %8.1f MB/s  copy %8.1f MB/s  memcpy loop %8.1f MB/s\n",
+		interface_names[iface], s->name, pack_bw, peek_bw, copy_bw, bench_memcpy(src, ld_src, s));
+
+out:
+	starpu_data_unregister(src_handle);
+	starpu_data_unregister(dst_handle);
+	free(src);
+	free(dst);
+	return ret == -ENODEV ? ret : 0;
+}
+
+int main(void)
+{
+	unsigned iface, shape;
+	int ret;
+
+	ret = starpu_init(NULL);
+	if (ret == -ENODEV) return STARPU_TEST_SKIPPED;
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+
+	for (iface = 0; iface < NINTERFACES; iface++)
+		for (shape = 0; shape < NSHAPES; shape++)
+		{
+			ret = bench(iface, &shapes[shape]);
+			if (ret == -ENODEV)
+			{
+				starpu_shutdown();
+				return STARPU_TEST_SKIPPED;
+			}
+		}
+
+	starpu_shutdown();
+	return EXIT_SUCCESS;
+}
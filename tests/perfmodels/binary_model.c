@@ -0,0 +1,186 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include <starpu.h>
+#include "../helper.h"
+
+/*
+ * Feed a history-based model with many footprints, save it both in the text
+ * and in the binary format, and check that loading either file gives the
+ * same predictions. Also check that the runtime loads the binary file lazily,
+ * and measure the load times.
+ */
+
+#ifdef STARPU_QUICK_CHECK
+#define NENTRIES 1000
+#else
+#define NENTRIES 10000
+#endif
+#define NSAMPLES 10
+
+#if !defined(STARPU_HAVE_SETENV)
+#warning setenv is not defined. Skipping test
+int main(void)
+{
+	return STARPU_TEST_SKIPPED;
+}
+#else
+
+static struct starpu_perfmodel model =
+{
+	.type = STARPU_HISTORY_BASED,
+	.symbol = "binary_model"
+};
+
+static struct starpu_perfmodel lazy_model =
+{
+	.type = STARPU_HISTORY_BASED,
+	.symbol = "binary_model"
+};
+
+static struct starpu_codelet cl =
+{
+	.model = &model,
+	.nbuffers = 1,
+	.modes = {STARPU_W}
+};
+
+static struct starpu_codelet lazy_cl =
+{
+	.model = &lazy_model,
+	.nbuffers = 1,
+	.modes = {STARPU_W}
+};
+
+static int same(double a, double b)
+{
+	return (isnan(a) && isnan(b)) || a == b;
+}
+
+/* Load \p filename, check its predictions against \p model, and return the
+ * load time */
+static double check_file(const char *filename, struct starpu_perfmodel_arch *arch, uint32_t *footprints)
+{
+	struct starpu_perfmodel loaded;
+	struct starpu_perfmodel_per_arch *per_arch;
+	struct starpu_perfmodel_history_list *ptr;
+	double start, end;
+	unsigned i, n;
+	int ret;
+
+	memset(&loaded, 0, sizeof(loaded));
+	start = starpu_timing_now();
+	ret = starpu_perfmodel_load_file(filename, &loaded);
+	end = starpu_timing_now();
+	STARPU_ASSERT_MSG(ret == 0, "could not load %s", filename);
+	STARPU_ASSERT(loaded.type == STARPU_HISTORY_BASED);
+
+	per_arch = starpu_perfmodel_get_model_per_arch(&loaded, arch, 0);
+	STARPU_ASSERT_MSG(per_arch, "%s: no model for the arch", filename);
+	for (n = 0, ptr = per_arch->list; ptr; ptr = ptr->next)
+		n++;
+	STARPU_ASSERT_MSG(n == NENTRIES, "%s: %u entries instead of %d", filename, n, NENTRIES);
+
+	for (i = 0; i < NENTRIES; i++)
+	{
+		double expected = starpu_perfmodel_history_based_expected_perf(&model, arch, footprints[i]);
+		double got = starpu_perfmodel_history_based_expected_perf(&loaded, arch, footprints[i]);
+		STARPU_ASSERT_MSG(!isnan(expected), "entry %u has no prediction", i);
+		STARPU_ASSERT_MSG(same(expected, got), "%s: entry %u predicts %f instead of %f", filename, i, got, expected);
+	}
+
+	starpu_perfmodel_unload_model(&loaded);
+	return end - start;
+}
+
+int main(void)
+{
+	struct starpu_task task;
+	struct starpu_perfmodel_device device = { .type = STARPU_CPU_WORKER, .devid = 0, .ncores = 0 };
+	struct starpu_perfmodel_arch arch = { .ndevices = 1, .devices = &device };
+	char text[128], binary[128];
+	uint32_t *footprints;
+	double text_time, binary_time;
+	unsigned i;
+	int ret;
+
+	/* Have the runtime save the models in the binary format */
+	setenv("STARPU_PERF_MODEL_BINARY", "1", 1);
+
+	ret = starpu_init(NULL);
+	if (ret == -ENODEV) return STARPU_TEST_SKIPPED;
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+
+	footprints = malloc(NENTRIES * sizeof(*footprints));
+	for (i = 0; i < NENTRIES; i++)
+	{
+		starpu_data_handle_t handle;
+		starpu_vector_data_register(&handle, -1, 0, i+1, sizeof(float));
+		/* The footprint is cached in the task */
+		starpu_task_init(&task);
+		task.cl = &cl;
+		task.handles[0] = handle;
+		starpu_perfmodel_update_history_n(&model, &task, &arch, 0, 0, 1. + i, NSAMPLES);
+		footprints[i] = starpu_task_data_footprint(&task);
+		starpu_task_clean(&task);
+		starpu_data_unregister(handle);
+	}
+
+	snprintf(text, sizeof(text), "/tmp/starpu_binary_model_%d.txt", (int) getpid());
+	snprintf(binary, sizeof(binary), "/tmp/starpu_binary_model_%d.bin", (int) getpid());
+	ret = starpu_perfmodel_save_file(text, &model, 0);
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_perfmodel_save_file");
+	ret = starpu_perfmodel_save_file(binary, &model, 1);
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_perfmodel_save_file");
+
+	text_time = check_file(text, &arch, footprints);
+	binary_time = check_file(binary, &arch, footprints);
+	FPRINTF(stdout, "%d entries: text load %.0f us, binary load %.0f us\n", NENTRIES, text_time, binary_time);
+	unlink(text);
+	unlink(binary);
+
+	/* Save it at its usual place, and let the runtime map it for another
+	 * codelet using the same symbol */
+	starpu_save_history_based_model(&model);
+	for (i = 0; i < NENTRIES; i += NENTRIES / 100)
+	{
+		starpu_data_handle_t handle;
+		double expected, got;
+		starpu_vector_data_register(&handle, -1, 0, i+1, sizeof(float));
+		starpu_task_init(&task);
+		task.cl = &lazy_cl;
+		task.handles[0] = handle;
+		expected = starpu_perfmodel_history_based_expected_perf(&model, &arch, footprints[i]);
+		got = starpu_task_expected_length(&task, &arch, 0);
+		STARPU_ASSERT_MSG(!isnan(expected), "entry %u has no prediction", i);
+		STARPU_ASSERT_MSG(same(expected, got), "mapped entry %u predicts %f instead of %f", i, got, expected);
+		starpu_task_clean(&task);
+		starpu_data_unregister(handle);
+	}
+	if (model.path)
+		unlink(model.path);
+
+	free(footprints);
+	starpu_shutdown();
+
+	return EXIT_SUCCESS;
+}
+#endif
@@ -0,0 +1,243 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include <sys/stat.h>
+#include <starpu.h>
+#include "../helper.h"
+#include <common/utils.h>
+#include <core/perfmodel/perfmodel.h>
+
+/*
+ * Calibrate the bus of a new host by only estimating it, check that the
+ * background measurement refines the predictions but is not kept, that the
+ * next initialization measures the NUMA nodes, and that changing the stored
+ * configuration recalibrates it while keeping the NUMA measurements.
+ */
+
+#if !defined(STARPU_HAVE_UNSETENV) || !defined(STARPU_HAVE_SETENV)
+#warning unsetenv or setenv are not defined. Skipping test
+int main(void)
+{
+	return STARPU_TEST_SKIPPED;
+}
+#else
+
+static char bus_dir[768];
+static char hostname[16];
+
+static void get_path(const char *type, char *path, size_t maxlen)
+{
+	snprintf(path, maxlen, "%s/%s.%s", bus_dir, hostname, type);
+}
+
+static int exists(const char *type)
+{
+	char path[1024];
+	struct stat statbuf;
+	get_path(type, path, sizeof(path));
+	return stat(path, &statbuf) == 0;
+}
+
+/* Parse the measurements file: return the number of NUMA pairs which were
+ * measured, and the timing from NUMA node 0 to NUMA node 1 */
+static unsigned read_measurements(unsigned *nnumas, double *timing01)
+{
+	char path[1024], line[1024];
+	unsigned ncpus, src, dst, n = 0;
+	double timing, latency;
+	int header = 0;
+	FILE *f;
+
+	*nnumas = 0;
+	*timing01 = NAN;
+	get_path("measurements", path, sizeof(path));
+	f = fopen(path, "r");
+	STARPU_ASSERT_MSG(f, "no measurements file");
+	while (fgets(line, sizeof(line), f))
+	{
+		if (line[0] == '#')
+			continue;
+		if (!header)
+		{
+			header = sscanf(line, "%u\t%u", &ncpus, nnumas) == 2;
+			continue;
+		}
+		if (sscanf(line, "numa\t%u\t%u\t%le\t%le", &src, &dst, &timing, &latency) != 4)
+			continue;
+		n++;
+		if (src == 0 && dst == 1)
+			*timing01 = timing;
+	}
+	fclose(f);
+	STARPU_ASSERT_MSG(header, "no configuration in the measurements file");
+	return n;
+}
+
+/* Replace the timing from NUMA node 0 to NUMA node 1 in the measurements
+ * file */
+static void set_measurement01(double timing01)
+{
+	char path[1024], line[1024];
+	char content[65536];
+	size_t len = 0;
+	unsigned src, dst;
+	double timing, latency;
+	FILE *f;
+
+	get_path("measurements", path, sizeof(path));
+	f = fopen(path, "r");
+	STARPU_ASSERT(f);
+	while (fgets(line, sizeof(line), f))
+	{
+		if (sscanf(line, "numa\t%u\t%u\t%le\t%le", &src, &dst, &timing, &latency) == 4 && src == 0 && dst == 1)
+			snprintf(line, sizeof(line), "numa\t0\t1\t%e\t%e\n", timing01, latency);
+		STARPU_ASSERT(len + strlen(line) < sizeof(content));
+		strcpy(content + len, line);
+		len += strlen(line);
+	}
+	fclose(f);
+
+	f = fopen(path, "w");
+	STARPU_ASSERT(f);
+	fputs(content, f);
+	fclose(f);
+}
+
+/* Start StarPU and check that it has a bandwidth between each pair of memory
+ * nodes. When the bus is measured in the background, check that its result
+ * is used */
+static int run(int background)
+{
+	unsigned src, dst, nnodes;
+	int ret;
+
+	ret = starpu_init(NULL);
+	if (ret == -ENODEV)
+		return ret;
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+
+	nnodes = starpu_memory_nodes_get_count();
+	if (background && nnodes > 1 && starpu_node_get_kind(1) == STARPU_CPU_RAM)
+	{
+		double estimated = starpu_transfer_bandwidth(0, 1);
+		_starpu_wait_bus_calibration();
+		FPRINTF(stderr, "bandwidth from NUMA 0 to NUMA 1 estimated %f, measured %f\n", estimated, starpu_transfer_bandwidth(0, 1));
+		STARPU_ASSERT_MSG(starpu_transfer_bandwidth(0, 1) != estimated, "the background measurement was not published");
+	}
+	for (src = 0; src < nnodes; src++)
+		for (dst = 0; dst < nnodes; dst++)
+			if (src != dst)
+			{
+				double bandwidth = starpu_transfer_bandwidth(src, dst);
+				STARPU_ASSERT_MSG(!isnan(bandwidth) && bandwidth > 0, "no bandwidth from %u to %u", src, dst);
+			}
+
+	starpu_shutdown();
+	return 0;
+}
+
+int main(void)
+{
+	static const char *types[] = { "affinity", "latency", "bandwidth", "config", "measurements", "platform.xml", "platform.v4.xml" };
+	char tmp_dir[256], perf_model_dir[512], path[1024];
+	char *tpath;
+	unsigned i, nnumas, npairs;
+	double timing01;
+	FILE *f;
+	int ret;
+
+	tpath = starpu_getenv("TMPDIR");
+	if (!tpath)
+		tpath = "/tmp";
+	snprintf(tmp_dir, sizeof(tmp_dir), "%s/starpu_bus_XXXXXX", tpath);
+	if (!_starpu_mkdtemp(tmp_dir))
+		return STARPU_TEST_SKIPPED;
+	snprintf(perf_model_dir, sizeof(perf_model_dir), "%s/sampling", tmp_dir);
+	snprintf(bus_dir, sizeof(bus_dir), "%s/bus", perf_model_dir);
+	snprintf(hostname, sizeof(hostname), "bus%d", (int) getpid());
+
+	unsetenv("STARPU_PERF_MODEL_PATH");
+	unsetenv("STARPU_BUS_CALIBRATE");
+	setenv("STARPU_PERF_MODEL_DIR", perf_model_dir, 1);
+	setenv("STARPU_HOSTNAME", hostname, 1);
+	/* Have several NUMA nodes to measure, even on a single-node machine */
+	setenv("HWLOC_SYNTHETIC", "pack:4 numa:1 core:1 pu:1", 0);
+	setenv("STARPU_USE_NUMA", "1", 1);
+
+	/* Only estimate the first time */
+	setenv("STARPU_BUS_CALIBRATE_ESTIMATE", "1", 1);
+	ret = run(1);
+	if (ret == -ENODEV)
+		return STARPU_TEST_SKIPPED;
+	/* The NUMA nodes were measured in the background, while the workers
+	 * were running, this is not kept */
+	npairs = read_measurements(&nnumas, &timing01);
+	FPRINTF(stderr, "%u NUMA nodes, %u pairs measured after the background measurement\n", nnumas, npairs);
+	STARPU_ASSERT_MSG(npairs == 0, "%u NUMA pairs measured in the background were kept", npairs);
+	STARPU_ASSERT(!exists("config"));
+	unsetenv("STARPU_BUS_CALIBRATE_ESTIMATE");
+
+	/* This measures everything */
+	run(0);
+	STARPU_ASSERT(exists("config"));
+	npairs = read_measurements(&nnumas, &timing01);
+	STARPU_ASSERT_MSG(npairs == nnumas * (nnumas-1), "only %u NUMA pairs out of %u were measured", npairs, nnumas * (nnumas-1));
+
+	/* Mark a measurement to check that it is kept */
+	if (nnumas > 1)
+		set_measurement01(1e-3);
+
+	/* Pretend that a CPU was removed, this has to recalibrate */
+	get_path("config", path, sizeof(path));
+	f = fopen(path, "w");
+	STARPU_ASSERT(f);
+	fprintf(f, "%u # Number of CPUs\n", 0);
+	fclose(f);
+	run(0);
+
+	f = fopen(path, "r");
+	STARPU_ASSERT(f);
+	ret = fscanf(f, "# Current configuration\n%u", &i);
+	fclose(f);
+	STARPU_ASSERT_MSG(ret == 1 && i > 0, "the bus configuration was not calibrated again");
+
+	/* The NUMA nodes did not change, they were not measured again */
+	npairs = read_measurements(&nnumas, &timing01);
+	STARPU_ASSERT_MSG(npairs == nnumas * (nnumas-1), "only %u NUMA pairs out of %u were kept", npairs, nnumas * (nnumas-1));
+	if (nnumas > 1)
+		STARPU_ASSERT_MSG(timing01 == 1e-3, "the timing from NUMA 0 to NUMA 1 was measured again: %e", timing01);
+
+	for (i = 0; i < sizeof(types)/sizeof(types[0]); i++)
+	{
+		get_path(types[i], path, sizeof(path));
+		unlink(path);
+	}
+	rmdir(bus_dir);
+	snprintf(path, sizeof(path), "%s/codelets/%d", perf_model_dir, _STARPU_PERFMODEL_VERSION);
+	rmdir(path);
+	snprintf(path, sizeof(path), "%s/codelets", perf_model_dir);
+	rmdir(path);
+	rmdir(perf_model_dir);
+	rmdir(tmp_dir);
+
+	return EXIT_SUCCESS;
+}
+#endif
@@ -0,0 +1,127 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include <starpu.h>
+#include "../helper.h"
+
+/*
+ * Record measurements for many footprints of a history-based model while
+ * other threads keep computing predictions, which must either be unknown or
+ * give the recorded value. Once recording is over, all predictions must be
+ * known.
+ */
+
+#ifdef STARPU_QUICK_CHECK
+#define NENTRIES 1000
+#else
+#define NENTRIES 10000
+#endif
+#define NTHREADS 4
+#define NSAMPLES 10
+
+static struct starpu_perfmodel model =
+{
+	.type = STARPU_HISTORY_BASED,
+	.symbol = "concurrent_history"
+};
+
+static struct starpu_codelet cl =
+{
+	.model = &model,
+	.nbuffers = 1,
+	.modes = {STARPU_W}
+};
+
+static struct starpu_perfmodel_device device = { .type = STARPU_CPU_WORKER, .devid = 0, .ncores = 0 };
+static struct starpu_perfmodel_arch arch = { .ndevices = 1, .devices = &device };
+static uint32_t footprints[NENTRIES];
+static volatile int done;
+
+static void *predict(void *arg)
+{
+	unsigned i = (uintptr_t) arg;
+	unsigned long n, nknown = 0;
+
+	for (n = 0; !done || n < NENTRIES; n++)
+	{
+		double expected = starpu_perfmodel_history_based_expected_perf(&model, &arch, footprints[i]);
+		STARPU_ASSERT_MSG(isnan(expected) || expected == 1. + i, "entry %u predicts %f instead of %f", i, expected, 1. + i);
+		nknown += !isnan(expected);
+		i = (i + 7) % NENTRIES;
+	}
+	return (void *) nknown;
+}
+
+int main(void)
+{
+	starpu_data_handle_t handles[NENTRIES];
+	starpu_pthread_t threads[NTHREADS];
+	struct starpu_task task;
+	unsigned i;
+	int ret;
+
+	ret = starpu_init(NULL);
+	if (ret == -ENODEV) return STARPU_TEST_SKIPPED;
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+
+	starpu_task_init(&task);
+	for (i = 0; i < NENTRIES; i++)
+	{
+		starpu_vector_data_register(&handles[i], -1, 0, i+1, sizeof(float));
+		task.cl = &cl;
+		task.handles[0] = handles[i];
+		footprints[i] = starpu_task_data_footprint(&task);
+		starpu_task_clean(&task);
+	}
+
+	/* Get the model loaded before predicting with it */
+	task.cl = &cl;
+	task.handles[0] = handles[0];
+	starpu_perfmodel_update_history_n(&model, &task, &arch, 0, 0, 1., NSAMPLES);
+	starpu_task_clean(&task);
+
+	for (i = 0; i < NTHREADS; i++)
+		STARPU_PTHREAD_CREATE(&threads[i], NULL, predict, (void *) (uintptr_t) (i * NENTRIES / NTHREADS));
+
+	for (i = 1; i < NENTRIES; i++)
+	{
+		task.cl = &cl;
+		task.handles[0] = handles[i];
+		starpu_perfmodel_update_history_n(&model, &task, &arch, 0, 0, 1. + i, NSAMPLES);
+		starpu_task_clean(&task);
+	}
+
+	done = 1;
+	for (i = 0; i < NTHREADS; i++)
+	{
+		void *nknown;
+		STARPU_PTHREAD_JOIN(threads[i], &nknown);
+		FPRINTF(stderr, "thread %u got %lu known predictions\n", i, (unsigned long) (uintptr_t) nknown);
+	}
+
+	for (i = 0; i < NENTRIES; i++)
+	{
+		double expected = starpu_perfmodel_history_based_expected_perf(&model, &arch, footprints[i]);
+		STARPU_ASSERT_MSG(expected == 1. + i, "entry %u predicts %f instead of %f", i, expected, 1. + i);
+		starpu_data_unregister(handles[i]);
+	}
+
+	starpu_shutdown();
+
+	return EXIT_SUCCESS;
+}
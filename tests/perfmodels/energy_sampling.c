@@ -0,0 +1,326 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <math.h>
+#include <sys/stat.h>
+#include <starpu.h>
+#include "../helper.h"
+#include <common/utils.h>
+
+/*
+ * Emulate the RAPL counters of the Linux powercap interface, whose package
+ * energy increases by TASK_ENERGY for each task run on the package, and check
+ * that once the sampling got a first rate, the sampled energy attributed to
+ * the tasks matches what they consumed, and that it is fed to their energy
+ * performance model.
+ */
+
+/* Per CPU worker, the tasks last about 1ms each */
+#define NWARMUP 30
+#define NTASKS 200
+#define TASK_ENERGY 1000000ULL /* µJ */
+/* On the total energy, and on the energy of a single task, which depends more
+ * on the scheduling of the workers by the system */
+#define TOLERANCE 0.1
+#define TASK_TOLERANCE 0.2
+#define MAX_PACKAGES 16
+
+#if !defined(STARPU_HAVE_SETENV) || !defined(STARPU_LINUX_SYS)
+#warning setenv is not defined or not running on Linux. Skipping test
+int main(void)
+{
+	return STARPU_TEST_SKIPPED;
+}
+#else
+
+static char tmp_dir[256];
+static unsigned npackages;
+static unsigned long long package_energy[MAX_PACKAGES];
+static unsigned worker_package[STARPU_NMAXWORKERS];
+static starpu_pthread_mutex_t energy_mutex = STARPU_PTHREAD_MUTEX_INITIALIZER;
+
+static void get_package_dir(unsigned package, char *dir, size_t maxlen)
+{
+	snprintf(dir, maxlen, "%s/intel-rapl:%u", tmp_dir, package);
+}
+
+static void get_dram_dir(char *dir, size_t maxlen)
+{
+	snprintf(dir, maxlen, "%s/intel-rapl:0/intel-rapl:0:0", tmp_dir);
+}
+
+static void write_file(const char *dir, const char *name, const char *content)
+{
+	char path[1024];
+	FILE *f;
+	snprintf(path, sizeof(path), "%s/%s", dir, name);
+	f = fopen(path, "w");
+	STARPU_ASSERT(f);
+	fprintf(f, "%s\n", content);
+	fclose(f);
+}
+
+/* Like the kernel, make the new value appear atomically */
+static void write_energy(const char *dir, unsigned long long energy)
+{
+	char content[32], path[1024], tmp_path[1024];
+	int ret;
+	snprintf(content, sizeof(content), "%llu", energy);
+	write_file(dir, "energy_uj.tmp", content);
+	snprintf(tmp_path, sizeof(tmp_path), "%s/energy_uj.tmp", dir);
+	snprintf(path, sizeof(path), "%s/energy_uj", dir);
+	ret = rename(tmp_path, path);
+	STARPU_ASSERT(ret == 0);
+}
+
+/* Package of the given CPU according to the kernel */
+static unsigned get_cpu_package(unsigned cpu)
+{
+	char path[256];
+	unsigned package = 0;
+	FILE *f;
+
+	snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", cpu);
+	f = fopen(path, "r");
+	if (f)
+	{
+		if (fscanf(f, "%u", &package) != 1)
+			package = 0;
+		fclose(f);
+	}
+	return package < MAX_PACKAGES ? package : 0;
+}
+
+static unsigned count_packages(void)
+{
+	struct stat statbuf;
+	char path[256];
+	unsigned cpu, n = 1;
+
+	for (cpu = 0; ; cpu++)
+	{
+		snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u", cpu);
+		if (stat(path, &statbuf))
+			break;
+		n = STARPU_MAX(n, get_cpu_package(cpu) + 1);
+	}
+	return n;
+}
+
+static void consume(void *descr[], void *arg)
+{
+	double start = starpu_timing_now();
+	unsigned package = worker_package[starpu_worker_get_id()];
+	char dir[512];
+	(void)descr;
+	(void)arg;
+
+	/* Keep the package busy for a while */
+	while (starpu_timing_now() - start < 1000.)
+		;
+
+	get_package_dir(package, dir, sizeof(dir));
+	STARPU_PTHREAD_MUTEX_LOCK(&energy_mutex);
+	package_energy[package] += TASK_ENERGY;
+	write_energy(dir, package_energy[package]);
+	STARPU_PTHREAD_MUTEX_UNLOCK(&energy_mutex);
+}
+
+static struct starpu_perfmodel energy_model =
+{
+	.type = STARPU_HISTORY_BASED,
+	.symbol = "energy_sampling"
+};
+
+static struct starpu_codelet cl =
+{
+	.cpu_funcs = {consume},
+	.cpu_funcs_name = {"consume"},
+	.energy_model = &energy_model,
+	.nbuffers = 0,
+};
+
+/* Run \p ntasks tasks, return the energy attributed to them, in J, and the
+ * number of tasks which got some */
+static int run_tasks(unsigned ntasks, double *energy, unsigned *nmeasured)
+{
+	struct starpu_task **tasks;
+	unsigned i;
+	int ret = 0;
+
+	*energy = 0.;
+	*nmeasured = 0;
+	tasks = calloc(ntasks, sizeof(*tasks));
+	STARPU_ASSERT(tasks);
+
+	for (i = 0; i < ntasks; i++)
+	{
+		tasks[i] = starpu_task_create();
+		tasks[i]->cl = &cl;
+		tasks[i]->destroy = 0;
+		ret = starpu_task_submit(tasks[i]);
+		if (ret == -ENODEV)
+		{
+			starpu_task_destroy(tasks[i]);
+			break;
+		}
+		STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_submit");
+	}
+	starpu_task_wait_for_all();
+
+	ntasks = i;
+	for (i = 0; i < ntasks; i++)
+	{
+		double task_energy = tasks[i]->profiling_info->energy_consumed;
+		STARPU_ASSERT_MSG(task_energy >= 0., "task %u consumed %f J", i, task_energy);
+		if (task_energy > 0.)
+			(*nmeasured)++;
+		*energy += task_energy;
+		starpu_task_destroy(tasks[i]);
+	}
+	free(tasks);
+	return ret;
+}
+
+static void cleanup(void)
+{
+	static const char *files[] = { "name", "max_energy_range_uj", "energy_uj" };
+	char dir[512], path[1024];
+	unsigned i, package;
+
+	get_dram_dir(dir, sizeof(dir));
+	for (i = 0; i < sizeof(files)/sizeof(files[0]); i++)
+	{
+		snprintf(path, sizeof(path), "%s/%s", dir, files[i]);
+		unlink(path);
+	}
+	rmdir(dir);
+	for (package = 0; package < npackages; package++)
+	{
+		get_package_dir(package, dir, sizeof(dir));
+		for (i = 0; i < sizeof(files)/sizeof(files[0]); i++)
+		{
+			snprintf(path, sizeof(path), "%s/%s", dir, files[i]);
+			unlink(path);
+		}
+		rmdir(dir);
+	}
+	rmdir(tmp_dir);
+}
+
+int main(void)
+{
+	char dir[512], name[32];
+	char *tpath;
+	unsigned package, ntasks, nmeasured;
+	int worker;
+	double energy, expected;
+	int ret;
+
+	tpath = starpu_getenv("TMPDIR");
+	if (!tpath)
+		tpath = "/tmp";
+	snprintf(tmp_dir, sizeof(tmp_dir), "%s/starpu_powercap_XXXXXX", tpath);
+	if (!_starpu_mkdtemp(tmp_dir))
+		return STARPU_TEST_SKIPPED;
+
+	/* One package zone per actual package, so that each worker has its
+	 * counter */
+	npackages = count_packages();
+	for (package = 0; package < npackages; package++)
+	{
+		get_package_dir(package, dir, sizeof(dir));
+		mkdir(dir, 0755);
+		snprintf(name, sizeof(name), "package-%u", package);
+		write_file(dir, "name", name);
+		write_file(dir, "max_energy_range_uj", "262143328850");
+		write_energy(dir, 0);
+	}
+	get_dram_dir(dir, sizeof(dir));
+	mkdir(dir, 0755);
+	write_file(dir, "name", "dram");
+	write_file(dir, "max_energy_range_uj", "262143328850");
+	write_energy(dir, 0);
+
+	setenv("STARPU_POWERCAP_DIR", tmp_dir, 1);
+	setenv("STARPU_ENERGY_SAMPLING", "10", 1);
+	/* Start from an empty energy model */
+	setenv("STARPU_CALIBRATE", "2", 1);
+	setenv("STARPU_CALIBRATE_MINIMUM", "1", 1);
+
+	ret = starpu_init(NULL);
+	if (ret == -ENODEV)
+		goto skip;
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+
+	if (starpu_cpu_worker_get_count() == 0)
+	{
+		starpu_shutdown();
+		goto skip;
+	}
+
+	for (worker = 0; worker < (int) starpu_worker_get_count(); worker++)
+	{
+		int cpu = starpu_worker_get_bindid(worker);
+#ifdef STARPU_HAVE_HWLOC
+		hwloc_obj_t obj = starpu_worker_get_hwloc_obj(worker);
+		if (obj)
+			cpu = obj->os_index;
+#endif
+		worker_package[worker] = cpu >= 0 ? get_cpu_package(cpu) : 0;
+	}
+
+	starpu_profiling_status_set(STARPU_PROFILING_ENABLE);
+
+	/* The energy of the first sampling period can not be attributed,
+	 * since the rate is not known yet */
+	ret = run_tasks(NWARMUP * starpu_cpu_worker_get_count(), &energy, &nmeasured);
+	if (ret == -ENODEV)
+	{
+		starpu_shutdown();
+		goto skip;
+	}
+	FPRINTF(stderr, "%u warmup tasks got %f J\n", nmeasured, energy);
+
+	ntasks = NTASKS * starpu_cpu_worker_get_count();
+	run_tasks(ntasks, &energy, &nmeasured);
+	FPRINTF(stderr, "%u tasks out of %u got an energy, %f J in total\n", nmeasured, ntasks, energy);
+	STARPU_ASSERT_MSG(nmeasured == ntasks, "only %u tasks out of %u got an energy from the sampling", nmeasured, ntasks);
+	STARPU_ASSERT_MSG(fabs(energy - ntasks * TASK_ENERGY / 1e6) <= TOLERANCE * ntasks * TASK_ENERGY / 1e6,
+			  "%u tasks consumed %f J, %f J were attributed to them", ntasks, ntasks * TASK_ENERGY / 1e6, energy);
+
+	struct starpu_task *task = starpu_task_create();
+	task->cl = &cl;
+	expected = starpu_task_expected_energy(task, starpu_worker_get_perf_archtype(starpu_worker_get_by_type(STARPU_CPU_WORKER, 0), STARPU_NMAX_SCHED_CTXS), 0);
+	task->destroy = 0;
+	starpu_task_destroy(task);
+	FPRINTF(stderr, "the energy model predicts %f J per task\n", expected);
+	STARPU_ASSERT_MSG(!isnan(expected) && fabs(expected - TASK_ENERGY / 1e6) <= TASK_TOLERANCE * TASK_ENERGY / 1e6,
+			  "the energy model predicts %f J instead of %f J", expected, TASK_ENERGY / 1e6);
+
+	starpu_shutdown();
+
+	cleanup();
+	return EXIT_SUCCESS;
+
+skip:
+	cleanup();
+	return STARPU_TEST_SKIPPED;
+}
+#endif
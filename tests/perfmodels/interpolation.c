@@ -0,0 +1,122 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include <starpu.h>
+#include "../helper.h"
+
+/*
+ * Feed an interpolation-based model with a few sizes, and check the
+ * predictions and their confidence for sizes which were never measured.
+ */
+
+#define NSAMPLES 10
+
+static struct starpu_perfmodel model =
+{
+	.type = STARPU_INTERPOLATION_BASED,
+	.symbol = "interpolation"
+};
+
+static struct starpu_codelet cl =
+{
+	.model = &model,
+	.nbuffers = 1,
+	.modes = {STARPU_W}
+};
+
+static struct starpu_perfmodel_device device = { .type = STARPU_CPU_WORKER, .devid = 0, .ncores = 0 };
+static struct starpu_perfmodel_arch arch = { .ndevices = 1, .devices = &device };
+
+static unsigned measured[] = { 1000, 1500, 2000, 3000, 4000 };
+#define NMEASURED (sizeof(measured) / sizeof(measured[0]))
+
+/* Make the length proportional to the size */
+static double length(unsigned n)
+{
+	return n / 10.;
+}
+
+static double predict(unsigned n, double *confidence)
+{
+	starpu_data_handle_t handle;
+	struct starpu_task task;
+	double expected;
+
+	starpu_vector_data_register(&handle, -1, 0, n, sizeof(float));
+	starpu_task_init(&task);
+	task.cl = &cl;
+	task.handles[0] = handle;
+	expected = starpu_task_expected_length_confidence(&task, &arch, 0, confidence);
+	starpu_task_clean(&task);
+	starpu_data_unregister(handle);
+	return expected;
+}
+
+int main(void)
+{
+	struct starpu_task task;
+	double expected, confidence;
+	unsigned i;
+	int ret;
+
+	ret = starpu_init(NULL);
+	if (ret == -ENODEV) return STARPU_TEST_SKIPPED;
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+
+	for (i = 0; i < NMEASURED; i++)
+	{
+		starpu_data_handle_t handle;
+		starpu_vector_data_register(&handle, -1, 0, measured[i], sizeof(float));
+		starpu_task_init(&task);
+		task.cl = &cl;
+		task.handles[0] = handle;
+		starpu_perfmodel_update_history_n(&model, &task, &arch, 0, 0, length(measured[i]), NSAMPLES);
+		starpu_task_clean(&task);
+		starpu_data_unregister(handle);
+	}
+
+	/* Let the measurements get published for lock-free predictions */
+	starpu_sleep(0.2);
+
+	/* Measured sizes are predicted exactly */
+	for (i = 0; i < NMEASURED; i++)
+	{
+		expected = predict(measured[i], &confidence);
+		STARPU_ASSERT_MSG(expected == length(measured[i]) && confidence == 1., "size %u predicts %f with confidence %f instead of %f", measured[i], expected, confidence, length(measured[i]));
+	}
+
+	/* Sizes between measured sizes are interpolated */
+	for (i = 0; i < NMEASURED - 1; i++)
+	{
+		unsigned n = (measured[i] + measured[i+1]) / 2;
+		expected = predict(n, &confidence);
+		FPRINTF(stderr, "size %u predicts %f with confidence %f\n", n, expected, confidence);
+		STARPU_ASSERT_MSG(expected > length(measured[i]) && expected < length(measured[i+1]), "size %u predicts %f, out of [%f, %f]", n, expected, length(measured[i]), length(measured[i+1]));
+		STARPU_ASSERT_MSG(fabs(expected - length(n)) < 0.05 * length(n), "size %u predicts %f instead of about %f", n, expected, length(n));
+		STARPU_ASSERT_MSG(confidence > 0. && confidence < 1., "size %u predicted with confidence %f", n, confidence);
+	}
+
+	/* Sizes far from the measured range are not trusted */
+	expected = predict(100 * measured[NMEASURED-1], &confidence);
+	FPRINTF(stderr, "size %u predicts %f with confidence %f\n", 100 * measured[NMEASURED-1], expected, confidence);
+	STARPU_ASSERT_MSG(isnan(expected) && confidence == 0., "out of range size predicts %f with confidence %f", expected, confidence);
+
+	starpu_shutdown();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,162 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include <starpu.h>
+#include "../helper.h"
+
+/*
+ * Feed a multiple linear regression model with measurements following a law,
+ * then another law, and check that the predictions follow the second law
+ * thanks to the forgetting factor. Then save the model, and check that
+ * another codelet with the same symbol loads it and continues refining it.
+ */
+
+#define NMEASURES 200
+#define FORGETTING "0.9"
+
+#if !defined(STARPU_HAVE_SETENV)
+#warning setenv is not defined. Skipping test
+int main(void)
+{
+	return STARPU_TEST_SKIPPED;
+}
+#else
+
+static void params(struct starpu_task *task, double *parameters)
+{
+	memcpy(parameters, task->cl_arg, 3 * sizeof(double));
+}
+
+static const char *parameters_names[] = { "M", "N", "K" };
+/* M^2 * N */
+static unsigned combi1[3] = { 2, 1, 0 };
+/* N^3 * K */
+static unsigned combi2[3] = { 0, 3, 1 };
+static unsigned *combinations[] = { combi1, combi2 };
+
+static struct starpu_perfmodel model =
+{
+	.type = STARPU_MULTIPLE_REGRESSION_BASED,
+	.symbol = "multiple_regression",
+	.parameters = params,
+	.nparameters = 3,
+	.parameters_names = parameters_names,
+	.ncombinations = 2,
+	.combinations = combinations,
+};
+
+static struct starpu_perfmodel reloaded_model =
+{
+	.type = STARPU_MULTIPLE_REGRESSION_BASED,
+	.symbol = "multiple_regression",
+	.parameters = params,
+	.nparameters = 3,
+	.parameters_names = parameters_names,
+	.ncombinations = 2,
+	.combinations = combinations,
+};
+
+static struct starpu_codelet cl = { .model = &model };
+static struct starpu_codelet reloaded_cl = { .model = &reloaded_model };
+
+static struct starpu_perfmodel_device device = { .type = STARPU_CPU_WORKER, .devid = 0, .ncores = 0 };
+static struct starpu_perfmodel_arch arch = { .ndevices = 1, .devices = &device };
+
+static double law(const double *coeff, const double *parameters)
+{
+	return coeff[0] + coeff[1] * parameters[0] * parameters[0] * parameters[1] + coeff[2] * pow(parameters[1], 3) * parameters[2];
+}
+
+static void random_parameters(double *parameters)
+{
+	parameters[0] = 1 + starpu_lrand48() % 10;
+	parameters[1] = 1 + starpu_lrand48() % 10;
+	parameters[2] = 1 + starpu_lrand48() % 10;
+}
+
+static void feed(struct starpu_codelet *codelet, const double *coeff, unsigned n)
+{
+	struct starpu_task task;
+	double parameters[3];
+	unsigned i;
+
+	for (i = 0; i < n; i++)
+	{
+		random_parameters(parameters);
+		starpu_task_init(&task);
+		task.cl = codelet;
+		task.cl_arg = parameters;
+		starpu_perfmodel_update_history_n(codelet->model, &task, &arch, 0, 0, law(coeff, parameters), 1);
+		starpu_task_clean(&task);
+	}
+}
+
+static void check(struct starpu_codelet *codelet, const double *coeff)
+{
+	struct starpu_task task;
+	double parameters[3];
+	unsigned i;
+
+	for (i = 0; i < 10; i++)
+	{
+		double expected, predicted;
+		random_parameters(parameters);
+		starpu_task_init(&task);
+		task.cl = codelet;
+		task.cl_arg = parameters;
+		expected = law(coeff, parameters);
+		predicted = starpu_task_expected_length(&task, &arch, 0);
+		starpu_task_clean(&task);
+		STARPU_ASSERT_MSG(fabs(predicted - expected) <= 1e-3 * expected, "predicted %f instead of %f for %s", predicted, expected, codelet->model->symbol);
+	}
+}
+
+int main(void)
+{
+	double old_law[3] = { 10., 2., 0.5 };
+	double new_law[3] = { 20., 3., 0.25 };
+	int ret;
+
+	setenv("STARPU_MLR_FORGETTING_FACTOR", FORGETTING, 1);
+
+	ret = starpu_init(NULL);
+	if (ret == -ENODEV) return STARPU_TEST_SKIPPED;
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+
+	feed(&cl, old_law, NMEASURES);
+	check(&cl, old_law);
+
+	/* The hardware got "faster", the old measurements should be forgotten */
+	feed(&cl, new_law, NMEASURES);
+	check(&cl, new_law);
+
+	/* Load it again from the file, and check that the regression goes on */
+	starpu_save_history_based_model(&model);
+	feed(&reloaded_cl, new_law, 1);
+	check(&reloaded_cl, new_law);
+
+	if (model.path)
+		unlink(model.path);
+
+	starpu_shutdown();
+
+	return EXIT_SUCCESS;
+}
+#endif
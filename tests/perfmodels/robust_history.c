@@ -0,0 +1,140 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <starpu.h>
+#include "../helper.h"
+
+/*
+ * Check that with the median estimator, a few outliers do not change the
+ * prediction of a history entry, and that with change detection, an entry
+ * whose measurements shift is reset to the new distribution. Also check that
+ * the performance model display gives quality metrics.
+ */
+
+#if !defined(STARPU_HAVE_SETENV)
+#warning setenv is not defined. Skipping test
+int main(void)
+{
+	return STARPU_TEST_SKIPPED;
+}
+#else
+
+static struct starpu_perfmodel model =
+{
+	.type = STARPU_HISTORY_BASED,
+	.symbol = "robust_history"
+};
+
+static struct starpu_codelet cl =
+{
+	.model = &model,
+	.nbuffers = 1,
+	.modes = {STARPU_W}
+};
+
+static struct starpu_perfmodel_device device = { .type = STARPU_CPU_WORKER, .devid = 0, .ncores = 0 };
+static struct starpu_perfmodel_arch arch = { .ndevices = 1, .devices = &device };
+
+static void record(starpu_data_handle_t handle, double measured)
+{
+	struct starpu_task task;
+	starpu_task_init(&task);
+	task.cl = &cl;
+	task.handles[0] = handle;
+	starpu_perfmodel_update_history_n(&model, &task, &arch, 0, 0, measured, 1);
+	starpu_task_clean(&task);
+}
+
+static uint32_t footprint(starpu_data_handle_t handle)
+{
+	struct starpu_task task;
+	uint32_t res;
+	starpu_task_init(&task);
+	task.cl = &cl;
+	task.handles[0] = handle;
+	res = starpu_task_data_footprint(&task);
+	starpu_task_clean(&task);
+	return res;
+}
+
+int main(void)
+{
+	starpu_data_handle_t noisy, shifting;
+	double expected;
+	char line[256];
+	FILE *f;
+	int found = 0;
+	uint32_t shifting_footprint;
+	unsigned i;
+	int ret;
+
+	setenv("STARPU_HISTORY_ESTIMATOR", "median", 1);
+	setenv("STARPU_HISTORY_CHANGE_THRESHOLD", "5", 1);
+
+	ret = starpu_init(NULL);
+	if (ret == -ENODEV) return STARPU_TEST_SKIPPED;
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+
+	starpu_vector_data_register(&noisy, -1, 0, 100, sizeof(float));
+	starpu_vector_data_register(&shifting, -1, 0, 200, sizeof(float));
+
+	/* One measurement out of five is very perturbed */
+	for (i = 0; i < 40; i++)
+		record(noisy, i % 5 == 4 ? 10000. : 100.);
+
+	/* The measurements get twice as long */
+	for (i = 0; i < 40; i++)
+		record(shifting, 100.);
+	for (i = 0; i < 20; i++)
+		record(shifting, 200.);
+
+	expected = starpu_perfmodel_history_based_expected_perf(&model, &arch, footprint(noisy));
+	STARPU_ASSERT_MSG(expected == 100., "noisy entry predicts %f instead of 100", expected);
+	expected = starpu_perfmodel_history_based_expected_perf(&model, &arch, footprint(shifting));
+	STARPU_ASSERT_MSG(expected == 200., "shifting entry predicts %f instead of 200", expected);
+
+	/* The entry was reset when the shift was detected, so it does not
+	 * contain the old measurements any more */
+	shifting_footprint = footprint(shifting);
+	f = tmpfile();
+	STARPU_ASSERT(f);
+	starpu_perfmodel_print_all(&model, NULL, NULL, NULL, f);
+	rewind(f);
+	while (fgets(line, sizeof(line), f))
+	{
+		unsigned entry_footprint, nsample;
+		unsigned long size;
+		double flops, mean, deviation;
+
+		if (strstr(line, "Quality: 2 entries"))
+			found = 1;
+		if (sscanf(line, "%x\t%lu\t%le\t%le\t%le\t%u", &entry_footprint, &size, &flops, &mean, &deviation, &nsample) == 6 && entry_footprint == shifting_footprint)
+			STARPU_ASSERT_MSG(nsample <= 20, "shifting entry was not reset, it has %u samples", nsample);
+		FPRINTF(stderr, "%s", line);
+	}
+	fclose(f);
+	STARPU_ASSERT_MSG(found, "no quality metrics displayed");
+
+	starpu_data_unregister(noisy);
+	starpu_data_unregister(shifting);
+	starpu_shutdown();
+
+	return EXIT_SUCCESS;
+}
+#endif
@@ -0,0 +1,289 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <common/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <starpu.h>
+#include "../helper.h"
+
+/*
+ * Calibrate a history-based model from two processes which share it, check
+ * that each of them predicts from the measurements of both, that a new
+ * process starts from the merged model, and that the shared store is
+ * removed once no process uses it any more. Then let a process crash while
+ * using the model, remove the model file, and check that the next process
+ * does not get the measurements of the stale store.
+ */
+
+#if !defined(STARPU_HAVE_SETENV) || !defined(HAVE_MMAP) || defined(_WIN32) || defined(STARPU_SIMGRID)
+#warning setenv, mmap or fork are not available. Skipping test
+int main(void)
+{
+	return STARPU_TEST_SKIPPED;
+}
+#else
+#include <sys/mman.h>
+
+#define NSAMPLES 10
+/* The first measurement of the parent is dropped */
+#define CHILD_MEAN ((100. * (NSAMPLES-1) + 120. * NSAMPLES) / (2*NSAMPLES-1))
+#define FINAL_MEAN ((100. * (NSAMPLES-1) + 120. * NSAMPLES + 110.) / (2*NSAMPLES))
+
+static char symbol[32];
+static struct starpu_perfmodel model =
+{
+	.type = STARPU_HISTORY_BASED,
+	.symbol = symbol
+};
+
+static struct starpu_codelet cl =
+{
+	.model = &model,
+	.nbuffers = 1,
+	.modes = {STARPU_W}
+};
+
+static struct starpu_perfmodel_device device = { .type = STARPU_CPU_WORKER, .devid = 0, .ncores = 0 };
+static struct starpu_perfmodel_arch arch = { .ndevices = 1, .devices = &device };
+
+static void record(starpu_data_handle_t handle, double measured)
+{
+	struct starpu_task task;
+	starpu_task_init(&task);
+	task.cl = &cl;
+	task.handles[0] = handle;
+	starpu_perfmodel_update_history_n(&model, &task, &arch, 0, 0, measured, 1);
+	starpu_task_clean(&task);
+}
+
+static double predict(starpu_data_handle_t handle)
+{
+	struct starpu_task task;
+	uint32_t footprint;
+	starpu_task_init(&task);
+	task.cl = &cl;
+	task.handles[0] = handle;
+	footprint = starpu_task_data_footprint(&task);
+	starpu_task_clean(&task);
+	return starpu_perfmodel_history_based_expected_perf(&model, &arch, footprint);
+}
+
+/* Whether the shared store of the model file \p path exists */
+static int store_exists(const char *path)
+{
+	char name[64];
+	int fd;
+	snprintf(name, sizeof(name), "/starpu-perfmodel-%u-%08x", (unsigned) getuid(), starpu_hash_crc32c_string(path, 0));
+	fd = shm_open(name, O_RDONLY, 0600);
+	if (fd < 0)
+		return 0;
+	close(fd);
+	return 1;
+}
+
+static int wait_for(int fd)
+{
+	char c;
+	return read(fd, &c, 1) == 1;
+}
+
+static void notify(int fd)
+{
+	char c = 0;
+	int ret = write(fd, &c, 1);
+	STARPU_ASSERT(ret == 1);
+}
+
+/* Record NSAMPLES measurements of 120µs, after the parent recorded its own
+ * ones */
+static int child(int from_parent, int to_parent)
+{
+	starpu_data_handle_t handle;
+	double expected;
+	unsigned i;
+	int ret;
+
+	if (!wait_for(from_parent))
+		return EXIT_FAILURE;
+
+	ret = starpu_init(NULL);
+	if (ret == -ENODEV)
+		_exit(STARPU_TEST_SKIPPED);
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+	starpu_vector_data_register(&handle, -1, 0, 100, sizeof(float));
+
+	for (i = 0; i < NSAMPLES; i++)
+		record(handle, 120.);
+
+	expected = predict(handle);
+	FPRINTF(stderr, "child predicts %f\n", expected);
+	STARPU_ASSERT_MSG(fabs(expected - CHILD_MEAN) < 0.01, "child predicts %f, it did not get the measurements of its parent", expected);
+
+	starpu_data_unregister(handle);
+	starpu_shutdown();
+
+	notify(to_parent);
+	return EXIT_SUCCESS;
+}
+
+/* Record measurements of 500µs, and crash without saving them */
+static int crashing_child(void)
+{
+	starpu_data_handle_t handle;
+	unsigned i;
+	int ret;
+
+	ret = starpu_init(NULL);
+	if (ret == -ENODEV)
+		return STARPU_TEST_SKIPPED;
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+	starpu_vector_data_register(&handle, -1, 0, 100, sizeof(float));
+
+	for (i = 0; i < NSAMPLES; i++)
+		record(handle, 500.);
+
+	return EXIT_SUCCESS;
+}
+
+int main(void)
+{
+	starpu_data_handle_t handle;
+	struct starpu_perfmodel saved;
+	struct starpu_task task;
+	uint32_t footprint;
+	int to_child[2], to_parent[2];
+	char path[1024];
+	double expected;
+	unsigned i;
+	pid_t pid;
+	int ret, status;
+
+	/* Do not share with concurrent runs of the test */
+	snprintf(symbol, sizeof(symbol), "shared_model_%d", (int) getpid());
+
+	setenv("STARPU_PERF_MODEL_SHARED", "1", 1);
+	setenv("STARPU_CALIBRATE", "1", 1);
+
+	ret = pipe(to_child);
+	STARPU_ASSERT(ret == 0);
+	ret = pipe(to_parent);
+	STARPU_ASSERT(ret == 0);
+
+	/* Fork before StarPU starts its threads */
+	pid = fork();
+	STARPU_ASSERT(pid >= 0);
+	if (pid == 0)
+	{
+		close(to_child[1]);
+		close(to_parent[0]);
+		_exit(child(to_child[0], to_parent[1]));
+	}
+	close(to_child[0]);
+	close(to_parent[1]);
+
+	ret = starpu_init(NULL);
+	if (ret == -ENODEV)
+	{
+		kill(pid, SIGKILL);
+		waitpid(pid, NULL, 0);
+		return STARPU_TEST_SKIPPED;
+	}
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+	starpu_vector_data_register(&handle, -1, 0, 100, sizeof(float));
+
+	for (i = 0; i < NSAMPLES; i++)
+		record(handle, 100.);
+
+	/* Let the child measure while we are still running */
+	notify(to_child[1]);
+	if (wait_for(to_parent[0]))
+	{
+		/* Our next measurement gets the ones of the child */
+		record(handle, 110.);
+		expected = predict(handle);
+		FPRINTF(stderr, "parent predicts %f\n", expected);
+		STARPU_ASSERT_MSG(fabs(expected - FINAL_MEAN) < 0.01, "parent predicts %f, it did not get the measurements of its child", expected);
+	}
+
+	starpu_data_unregister(handle);
+	starpu_shutdown();
+
+	ret = waitpid(pid, &status, 0);
+	STARPU_ASSERT(ret == pid);
+	if (WIFEXITED(status) && WEXITSTATUS(status) == STARPU_TEST_SKIPPED)
+		goto out;
+	STARPU_ASSERT_MSG(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS, "child failed");
+
+	/* The model file has to contain the measurements of both processes */
+	ret = starpu_init(NULL);
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+	starpu_vector_data_register(&handle, -1, 0, 100, sizeof(float));
+	starpu_task_init(&task);
+	task.cl = &cl;
+	task.handles[0] = handle;
+	footprint = starpu_task_data_footprint(&task);
+	starpu_task_clean(&task);
+	memset(&saved, 0, sizeof(saved));
+	ret = starpu_perfmodel_load_symbol(symbol, &saved);
+	STARPU_ASSERT_MSG(ret == 0, "the model was not saved");
+	expected = starpu_perfmodel_history_based_expected_perf(&saved, &arch, footprint);
+	FPRINTF(stderr, "the saved model predicts %f\n", expected);
+	STARPU_ASSERT_MSG(fabs(expected - FINAL_MEAN) < 0.01, "the saved model predicts %f", expected);
+	starpu_perfmodel_unload_model(&saved);
+	starpu_data_unregister(handle);
+	starpu_shutdown();
+
+	starpu_perfmodel_get_model_path(symbol, path, sizeof(path));
+	STARPU_ASSERT_MSG(!store_exists(path), "the shared store was not removed by the last process");
+
+	/* Leave a store behind */
+	pid = fork();
+	STARPU_ASSERT(pid >= 0);
+	if (pid == 0)
+		_exit(crashing_child());
+	ret = waitpid(pid, &status, 0);
+	STARPU_ASSERT(ret == pid);
+	STARPU_ASSERT_MSG(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS, "crashing child failed");
+	STARPU_ASSERT_MSG(store_exists(path), "the crashed process did not leave its shared store");
+
+	/* The store does not correspond to the model file any more */
+	unlink(path);
+	ret = starpu_init(NULL);
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+	starpu_vector_data_register(&handle, -1, 0, 100, sizeof(float));
+	/* A single measurement is not enough to predict */
+	record(handle, 110.);
+	expected = predict(handle);
+	FPRINTF(stderr, "without a model file, the process predicts %f\n", expected);
+	STARPU_ASSERT_MSG(isnan(expected), "the process predicts %f from the stale shared store", expected);
+	starpu_data_unregister(handle);
+	starpu_shutdown();
+	STARPU_ASSERT_MSG(!store_exists(path), "the shared store was not removed by the last process");
+
+out:
+	starpu_perfmodel_get_model_path(symbol, path, sizeof(path));
+	unlink(path);
+
+	return EXIT_SUCCESS;
+}
+#endif
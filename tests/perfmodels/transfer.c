@@ -0,0 +1,142 @@
+/* StarPU --- Runtime system for heterogeneous multicore architectures.
+ *
+ * Copyright (C) 2024  Université de Bordeaux, CNRS (LaBRI UMR 5800), Inria
+ *
+ * StarPU is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or (at
+ * your option) any later version.
+ *
+ * StarPU is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU Lesser General Public License in COPYING.LGPL for more details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <math.h>
+#include <starpu.h>
+#include "../helper.h"
+
+/*
+ * Calibrate a history-based model on a single core, measure a few tasks on a
+ * combination of two cores which run twice as fast, and check that the
+ * predictions of the other footprints are transferred to the combination.
+ */
+
+#define NSIZES 8
+#define NSAMPLES 11
+#define NTRANSFER 3
+
+#if !defined(STARPU_HAVE_SETENV)
+#warning setenv is not defined. Skipping test
+int main(void)
+{
+	return STARPU_TEST_SKIPPED;
+}
+#else
+
+static struct starpu_perfmodel model =
+{
+	.type = STARPU_HISTORY_BASED,
+	.symbol = "transfer"
+};
+
+static struct starpu_codelet cl =
+{
+	.model = &model,
+	.nbuffers = 1,
+	.modes = {STARPU_W}
+};
+
+static struct starpu_perfmodel_device single_device = { .type = STARPU_CPU_WORKER, .devid = 0, .ncores = 1 };
+static struct starpu_perfmodel_arch single = { .ndevices = 1, .devices = &single_device };
+static struct starpu_perfmodel_device dual_device = { .type = STARPU_CPU_WORKER, .devid = 0, .ncores = 2 };
+static struct starpu_perfmodel_arch dual = { .ndevices = 1, .devices = &dual_device };
+
+static void record(starpu_data_handle_t handle, struct starpu_perfmodel_arch *arch, double measured)
+{
+	struct starpu_task task;
+	starpu_task_init(&task);
+	task.cl = &cl;
+	task.handles[0] = handle;
+	starpu_perfmodel_update_history_n(&model, &task, arch, 0, 0, measured, 1);
+	starpu_task_clean(&task);
+}
+
+static double predict(starpu_data_handle_t handle, struct starpu_perfmodel_arch *arch)
+{
+	struct starpu_task task;
+	uint32_t footprint;
+	starpu_task_init(&task);
+	task.cl = &cl;
+	task.handles[0] = handle;
+	footprint = starpu_task_data_footprint(&task);
+	starpu_task_clean(&task);
+	return starpu_perfmodel_history_based_expected_perf(&model, arch, footprint);
+}
+
+int main(void)
+{
+	starpu_data_handle_t handles[NSIZES], uncalibrated;
+	char path[1024];
+	double expected;
+	unsigned i, n;
+	int ret;
+
+	setenv("STARPU_PERF_MODEL_TRANSFER", "3", 1);
+	setenv("STARPU_CALIBRATE_MINIMUM", "10", 1);
+
+	ret = starpu_init(NULL);
+	if (ret == -ENODEV) return STARPU_TEST_SKIPPED;
+	STARPU_CHECK_RETURN_VALUE(ret, "starpu_init");
+
+	/* Start from scratch */
+	starpu_perfmodel_get_model_path(model.symbol, path, sizeof(path));
+	if (path[0])
+		unlink(path);
+
+	for (i = 0; i < NSIZES; i++)
+		starpu_vector_data_register(&handles[i], -1, 0, 100 * (i+1), sizeof(float));
+	starpu_vector_data_register(&uncalibrated, -1, 0, 100 * (NSIZES+1), sizeof(float));
+
+	/* Calibrate all sizes on a single core */
+	for (i = 0; i < NSIZES; i++)
+		for (n = 0; n < NSAMPLES; n++)
+			record(handles[i], &single, 100. * (i+1));
+
+	/* Only a few measurements on two cores */
+	for (n = 0; n < NTRANSFER; n++)
+	{
+		expected = predict(handles[NSIZES-1], &dual);
+		STARPU_ASSERT_MSG(isnan(expected), "predicted %f after only %u measurements", expected, n);
+		record(handles[0], &dual, 50.);
+	}
+
+	for (i = 1; i < NSIZES; i++)
+	{
+		expected = predict(handles[i], &dual);
+		FPRINTF(stderr, "size %u predicted %f on two cores\n", 100 * (i+1), expected);
+		STARPU_ASSERT_MSG(fabs(expected - 50. * (i+1)) < 0.01, "size %u predicted %f on two cores instead of %f", 100 * (i+1), expected, 50. * (i+1));
+	}
+
+	/* Nothing to transfer from */
+	expected = predict(uncalibrated, &dual);
+	STARPU_ASSERT_MSG(isnan(expected), "predicted %f without any calibration", expected);
+
+	for (i = 0; i < NSIZES; i++)
+		starpu_data_unregister(handles[i]);
+	starpu_data_unregister(uncalibrated);
+	starpu_shutdown();
+
+	/* The model was saved on shutdown */
+	starpu_perfmodel_get_model_path(model.symbol, path, sizeof(path));
+	if (path[0])
+		unlink(path);
+
+	return EXIT_SUCCESS;
+}
+#endif
@@ -32,8 +32,8 @@ files = []
 addFiles(pathname, files)
 
 doxyFiles=[f for f in files if f.endswith(".doxy")]
-cFiles=[f for f in files if f.endswith(".c") and not f.startswith("./build") and f.find("min-dgels")==-1 and f.find("experimental")==-1 and f.find("julia")==-1 and f.find("SobolQRNG")==-1 and f.find("socl/src/CL")==-1 and f.find("doc/")==-1]
-hFiles=[f for f in files if f.endswith(".h") and not f.startswith("./build") and f.find("min-dgels")==-1 and f.find("experimental")==-1 and f.find("julia")==-1 and f.find("SobolQRNG")==-1 and f.find("socl/src/CL")==-1 and f.find("doc/")==-1]
+cFiles=[f for f in files if f.endswith(".c") and not f.startswith("./build") and f.find("experimental")==-1 and f.find("julia")==-1 and f.find("SobolQRNG")==-1 and f.find("socl/src/CL")==-1 and f.find("doc/")==-1]
+hFiles=[f for f in files if f.endswith(".h") and not f.startswith("./build") and f.find("experimental")==-1 and f.find("julia")==-1 and f.find("SobolQRNG")==-1 and f.find("socl/src/CL")==-1 and f.find("doc/")==-1]
 
 for l in [cFiles]:#, hFiles, doxyFiles]:
     for f in l:
@@ -19,6 +19,7 @@
 #include <getopt.h>
 #include <unistd.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <common/config.h>
 #include <starpu.h>
@@ -44,16 +45,24 @@ static char *parch = NULL;
 /* should we display a specific footprint ? */
 static unsigned pdisplay_specific_footprint;
 static uint32_t pspecific_footprint;
+/* which file to load instead of the symbol ? */
+static char *pinput = NULL;
+/* which files to write the model to, in text or binary format ? */
+static char *poutput_text = NULL;
+static char *poutput_binary = NULL;
 
 static void usage()
 {
 	fprintf(stderr, "Display a given perfmodel\n\n");
 	fprintf(stderr, "Usage: %s [ options ]\n", PROGNAME);
 	fprintf(stderr, "\n");
-	fprintf(stderr, "One must specify either -l or -s. -x can be used with -s\n");
+	fprintf(stderr, "One must specify either -l, -s or -i. -x, -o and -b can be used with -s or -i\n");
 	fprintf(stderr, "Options:\n");
 	fprintf(stderr, "   -l			display all available models\n");
 	fprintf(stderr, "   -s <symbol>		specify the symbol\n");
+	fprintf(stderr, "   -i <file>		load the model from the given file, in text or binary format\n");
+	fprintf(stderr, "   -o <file>		write the model to the given file in text format\n");
+	fprintf(stderr, "   -b <file>		write the model to the given file in binary format\n");
 	fprintf(stderr, "   -x			display output in XML format\n");
 	fprintf(stderr, "   -p <parameter>	specify the parameter (e.g. a, b, c, mean, stddev)\n");
 	fprintf(stderr, "   -a <arch>		specify the architecture (e.g. cpu, cpu:k, cuda)\n");
@@ -75,6 +84,9 @@ static void parse_args(int argc, char **argv)
 		{"arch",      required_argument, NULL, 'a'},
 		{"footprint", required_argument, NULL, 'f'},
 		{"help",      no_argument,       NULL, 'h'},
+		{"input",     required_argument, NULL, 'i'},
+		{"output",    required_argument, NULL, 'o'},
+		{"binary",    required_argument, NULL, 'b'},
 		/* XXX Would be cleaner to set a flag */
 		{"list",      no_argument,       NULL, 'l'},
 		{"dir",       no_argument,       NULL, 'd'},
@@ -85,7 +97,7 @@ static void parse_args(int argc, char **argv)
 	};
 
 	int option_index;
-	while ((c = getopt_long(argc, argv, "dls:p:a:f:hx", long_options, &option_index)) != -1)
+	while ((c = getopt_long(argc, argv, "dls:p:a:f:hxi:o:b:", long_options, &option_index)) != -1)
 	{
 		switch (c)
 		{
@@ -99,6 +111,21 @@ static void parse_args(int argc, char **argv)
 			psymbol = optarg;
 			break;
 
+		case 'i':
+			/* input file */
+			pinput = optarg;
+			break;
+
+		case 'o':
+			/* text output file */
+			poutput_text = optarg;
+			break;
+
+		case 'b':
+			/* binary output file */
+			poutput_binary = optarg;
+			break;
+
 		case 'p':
 			/* parameter (eg. a, b, c, mean, stddev) */
 			pparameter = optarg;
@@ -140,7 +167,7 @@ static void parse_args(int argc, char **argv)
 		}
 	}
 
-	if (!psymbol && !plist && !pdirectory)
+	if (!psymbol && !pinput && !plist && !pdirectory)
 	{
 		fprintf(stderr, "Incorrect usage, aborting\n");
 		usage();
@@ -170,13 +197,34 @@ int main(int argc, char **argv)
 	else
 	{
 		struct starpu_perfmodel model = { .type = STARPU_PERFMODEL_INVALID };
-		int ret = starpu_perfmodel_load_symbol(psymbol, &model);
+		int ret;
+		if (pinput)
+		{
+			if (psymbol)
+				model.symbol = strdup(psymbol);
+			ret = starpu_perfmodel_load_file(pinput, &model);
+		}
+		else
+			ret = starpu_perfmodel_load_symbol(psymbol, &model);
 		if (ret == 1)
 		{
-			fprintf(stderr, "The performance model for the symbol <%s> could not be loaded\n", psymbol);
+			fprintf(stderr, "The performance model %s could not be loaded\n", pinput ? pinput : psymbol);
 			return 1;
 		}
-		if (xml)
+		if (poutput_text || poutput_binary)
+		{
+			if (poutput_text)
+				ret = starpu_perfmodel_save_file(poutput_text, &model, 0);
+			if (!ret && poutput_binary)
+				ret = starpu_perfmodel_save_file(poutput_binary, &model, 1);
+			if (ret)
+			{
+				fprintf(stderr, "The performance model could not be written: %s\n", strerror(-ret));
+				starpu_perfmodel_unload_model(&model);
+				return 1;
+			}
+		}
+		else if (xml)
 		{
 			starpu_perfmodel_dump_xml(stdout, &model);
 		}